@@ -80,7 +80,7 @@ bool IsValidUrl(const string& strUrl)
     return ((strUrl.find("http://") == 0) || (strUrl.find("https://") == 0));
 }
 
-static void FillHeader(const CAppHeader& header, vector<unsigned char>& vHeader)
+static void FillHeader(const CAppHeader& header, CTxOutReserve& vHeader)
 {
     // 1. flag: safe
     vHeader.push_back('s');
@@ -106,9 +106,9 @@ static void FillHeader(const CAppHeader& header, vector<unsigned char>& vHeader)
     vHeader.push_back(pAppCmd[3]);
 }
 
-vector<unsigned char> FillRegisterData(const string& strAdminAddress, const CAppHeader& header, const CAppData& appData)
+CTxOutReserve FillRegisterData(const string& strAdminAddress, const CAppHeader& header, const CAppData& appData)
 {
-    vector<unsigned char> vData;
+    CTxOutReserve vData;
     FillHeader(header, vData);
 
     App::RegisterData data;
@@ -134,9 +134,9 @@ vector<unsigned char> FillRegisterData(const string& strAdminAddress, const CApp
     return vData;
 }
 
-vector<unsigned char> FillAuthData(const string& strAdminAddress, const CAppHeader& header, const CAuthData& authData)
+CTxOutReserve FillAuthData(const string& strAdminAddress, const CAppHeader& header, const CAuthData& authData)
 {
-    vector<unsigned char> vData;
+    CTxOutReserve vData;
     FillHeader(header, vData);
 
     App::AuthData data;
@@ -158,9 +158,9 @@ vector<unsigned char> FillAuthData(const string& strAdminAddress, const CAppHead
     return vData;
 }
 
-vector<unsigned char> FillExtendData(const CAppHeader& header, const CExtendData& extendData)
+CTxOutReserve FillExtendData(const CAppHeader& header, const CExtendData& extendData)
 {
-    vector<unsigned char> vData;
+    CTxOutReserve vData;
     FillHeader(header, vData);
 
     App::ExtendData data;
@@ -180,9 +180,9 @@ vector<unsigned char> FillExtendData(const CAppHeader& header, const CExtendData
     return vData;
 }
 
-vector<unsigned char> FillIssueData(const CAppHeader& header, const CAssetData& assetData)
+CTxOutReserve FillIssueData(const CAppHeader& header, const CAssetData& assetData)
 {
-    vector<unsigned char> vData;
+    CTxOutReserve vData;
     FillHeader(header, vData);
 
     App::IssueData data;
@@ -213,9 +213,9 @@ vector<unsigned char> FillIssueData(const CAppHeader& header, const CAssetData&
     return vData;
 }
 
-vector<unsigned char> FillCommonData(const CAppHeader& header, const CCommonData& commonData)
+CTxOutReserve FillCommonData(const CAppHeader& header, const CCommonData& commonData)
 {
-    vector<unsigned char> vData;
+    CTxOutReserve vData;
     FillHeader(header, vData);
 
     App::CommonData data;
@@ -236,9 +236,9 @@ vector<unsigned char> FillCommonData(const CAppHeader& header, const CCommonData
     return vData;
 }
 
-vector<unsigned char> FillPutCandyData(const CAppHeader& header, const CPutCandyData& candyData)
+CTxOutReserve FillPutCandyData(const CAppHeader& header, const CPutCandyData& candyData)
 {
-    vector<unsigned char> vData;
+    CTxOutReserve vData;
     FillHeader(header, vData);
 
     App::PutCandyData data;
@@ -260,9 +260,9 @@ vector<unsigned char> FillPutCandyData(const CAppHeader& header, const CPutCandy
     return vData;
 }
 
-vector<unsigned char> FillGetCandyData(const CAppHeader& header, const CGetCandyData& candyData)
+CTxOutReserve FillGetCandyData(const CAppHeader& header, const CGetCandyData& candyData)
 {
-    vector<unsigned char> vData;
+    CTxOutReserve vData;
     FillHeader(header, vData);
 
     App::GetCandyData data;
@@ -283,9 +283,9 @@ vector<unsigned char> FillGetCandyData(const CAppHeader& header, const CGetCandy
     return vData;
 }
 
-vector<unsigned char> FillTransferSafeData(const CAppHeader& header, const CTransferSafeData& safeData)
+CTxOutReserve FillTransferSafeData(const CAppHeader& header, const CTransferSafeData& safeData)
 {
-    vector<unsigned char> vData;
+    CTxOutReserve vData;
     FillHeader(header, vData);
 
     App::TransferSafeData data;
@@ -304,7 +304,7 @@ vector<unsigned char> FillTransferSafeData(const CAppHeader& header, const CTran
     return vData;
 }
 
-static void ParseHeader(const vector<unsigned char>& vData, CAppHeader& header, unsigned int& nOffset)
+static void ParseHeader(const CTxOutReserve& vData, CAppHeader& header, unsigned int& nOffset)
 {
     nOffset = TXOUT_RESERVE_MIN_SIZE;
 
@@ -313,35 +313,28 @@ static void ParseHeader(const vector<unsigned char>& vData, CAppHeader& header,
     nOffset += sizeof(header.nVersion);
 
     // 2. app id (32 bytes)
-    vector<unsigned char> vAppId;
-    for(unsigned int i = 0; i < header.appId.size(); i++)
-        vAppId.push_back(vData[nOffset++]);
-    header.appId = uint256(vAppId);
+    memcpy(header.appId.begin(), &vData[nOffset], header.appId.size());
+    nOffset += header.appId.size();
 
     // 3. app command (4 bytes)
     header.nAppCmd = *(uint32_t*)&vData[nOffset];
     nOffset += sizeof(header.nAppCmd);
 }
 
-bool ParseReserve(const vector<unsigned char>& vReserve, CAppHeader& header, vector<unsigned char>& vData)
+bool ParseReserve(const CTxOutReserve& vReserve, CAppHeader& header, vector<unsigned char>& vData)
 {
     if(vReserve.size() <= TXOUT_RESERVE_MIN_SIZE + sizeof(uint16_t) + 32 + sizeof(uint32_t))
         return false;
 
     //SPOS no need to parse 
-    unsigned int nStartSPOSOffset = TXOUT_RESERVE_MIN_SIZE;
-    std::vector<unsigned char> vchConAlg;
-    for(unsigned int k = 0; k < 4; k++)
-        vchConAlg.push_back(vReserve[nStartSPOSOffset++]);
-
-    if (vchConAlg[0] == 's' && vchConAlg[1] == 'p' && vchConAlg[2] == 'o' && vchConAlg[3] == 's')
+    const unsigned char* pConAlg = &vReserve[TXOUT_RESERVE_MIN_SIZE];
+    if (pConAlg[0] == 's' && pConAlg[1] == 'p' && pConAlg[2] == 'o' && pConAlg[3] == 's')
         return false;
 
     unsigned int nOffset = 0;
     ParseHeader(vReserve, header, nOffset);
 
-    for(unsigned int i = nOffset; i < vReserve.size(); i++)
-        vData.push_back(vReserve[i]);
+    vData.insert(vData.end(), vReserve.begin() + nOffset, vReserve.end());
 
     return true;
 }
@@ -482,6 +475,104 @@ bool ParseTransferSafeData(const vector<unsigned char>& vSafeData, CTransferSafe
     return true;
 }
 
+bool ParseAppPayload(const CTxOut& txout, CAppPayload& payload)
+{
+    vector<unsigned char> vData;
+    if(!ParseReserve(txout.vReserve, payload.header, vData))
+        return false;
+
+    switch(payload.header.nAppCmd)
+    {
+    case REGISTER_APP_CMD:
+        payload.fDataValid = ParseRegisterData(vData, payload.appData, &payload.strAdminAddress);
+        break;
+    case ADD_AUTH_CMD:
+    case DELETE_AUTH_CMD:
+        payload.fDataValid = ParseAuthData(vData, payload.authData, &payload.strAdminAddress);
+        break;
+    case CREATE_EXTEND_TX_CMD:
+        payload.fDataValid = ParseExtendData(vData, payload.extendData);
+        break;
+    case ISSUE_ASSET_CMD:
+        payload.fDataValid = ParseIssueData(vData, payload.assetData);
+        break;
+    case ADD_ASSET_CMD:
+    case TRANSFER_ASSET_CMD:
+    case DESTORY_ASSET_CMD:
+    case CHANGE_ASSET_CMD:
+        payload.fDataValid = ParseCommonData(vData, payload.commonData);
+        break;
+    case PUT_CANDY_CMD:
+        payload.fDataValid = ParsePutCandyData(vData, payload.putCandyData);
+        break;
+    case GET_CANDY_CMD:
+        payload.fDataValid = ParseGetCandyData(vData, payload.getCandyData);
+        break;
+    case TRANSFER_SAFE_CMD:
+        payload.fDataValid = ParseTransferSafeData(vData, payload.transferSafeData);
+        break;
+    default:
+        payload.fDataValid = false;
+        break;
+    }
+
+    return true;
+}
+
+const CAppPayload* GetAppPayload(const CTransaction& tx, const unsigned int n)
+{
+    std::shared_ptr<const CTxAppPayloads> pPayloads = std::atomic_load(&tx.pAppPayloads);
+    if(!pPayloads)
+    {
+        std::shared_ptr<CTxAppPayloads> pNew = std::make_shared<CTxAppPayloads>();
+        pNew->vPayload.resize(tx.vout.size());
+        for(unsigned int i = 0; i < tx.vout.size(); i++)
+        {
+            std::unique_ptr<CAppPayload> pPayload(new CAppPayload());
+            if(ParseAppPayload(tx.vout[i], *pPayload))
+                pNew->vPayload[i] = std::move(pPayload);
+        }
+
+        // keep the first one if another thread decoded the transaction meanwhile,
+        // the pointers handed out before must stay valid
+        pPayloads = pNew;
+        std::shared_ptr<const CTxAppPayloads> pExpected;
+        if(!std::atomic_compare_exchange_strong(&tx.pAppPayloads, &pExpected, pPayloads))
+            pPayloads = pExpected;
+    }
+
+    if(n >= pPayloads->vPayload.size())
+        return NULL;
+    return pPayloads->vPayload[n].get();
+}
+
+bool GetPayloadAssetId(const CAppPayload& payload, uint256& assetId)
+{
+    if(!payload.fDataValid)
+        return false;
+
+    switch(payload.header.nAppCmd)
+    {
+    case ISSUE_ASSET_CMD:
+        assetId = payload.assetData.GetHash();
+        return true;
+    case ADD_ASSET_CMD:
+    case TRANSFER_ASSET_CMD:
+    case DESTORY_ASSET_CMD:
+    case CHANGE_ASSET_CMD:
+        assetId = payload.commonData.assetId;
+        return true;
+    case PUT_CANDY_CMD:
+        assetId = payload.putCandyData.assetId;
+        return true;
+    case GET_CANDY_CMD:
+        assetId = payload.getCandyData.assetId;
+        return true;
+    default:
+        return false;
+    }
+}
+
 bool ExistAppName(const string& strAppName, const bool fWithMempool)
 {
     uint256 appId;
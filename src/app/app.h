@@ -5,6 +5,9 @@
 #include "uint256.h"
 #include "serialize.h"
 #include "amount.h"
+#include "primitives/transaction.h"
+
+#include <memory>
 
 #define REGISTER_TXOUT          4
 #define ADD_AUTH_TXOUT          5
@@ -246,7 +249,7 @@ public:
         READWRITE(LIMITED_STRING(strCoverUrl, MAX_COVERURL_SIZE));
     }
 
-    uint256 GetHash()
+    uint256 GetHash() const
     {
         return SerializeHash(*this);
     }
@@ -580,22 +583,52 @@ public:
     }
 };
 
+/**
+ * Decoded reserve of an app output: the header and the data of header.nAppCmd.
+ * fDataValid is false when the data of the command can't be parsed, only the
+ * member matching the command is filled.
+ */
+class CAppPayload
+{
+public:
+    CAppHeader          header;
+    bool                fDataValid;
+    std::string         strAdminAddress; // register app, add and delete auth
+    CAppData            appData;
+    CAuthData           authData;
+    CExtendData         extendData;
+    CAssetData          assetData;
+    CCommonData         commonData; // add, transfer, destory and change asset
+    CPutCandyData       putCandyData;
+    CGetCandyData       getCandyData;
+    CTransferSafeData   transferSafeData;
+
+    CAppPayload() : fDataValid(false) {}
+};
+
+/** The decoded payloads of all outputs of a transaction, NULL for outputs without app data */
+class CTxAppPayloads
+{
+public:
+    std::vector<std::unique_ptr<const CAppPayload> > vPayload;
+};
+
 std::string TrimString(const std::string& strValue);
 std::string ToLower(const std::string& strValue);
 bool IsKeyWord(const std::string& strValue);
 bool IsContainSpace(const std::string& strValue);
 bool IsValidUrl(const std::string& strUrl);
 
-std::vector<unsigned char> FillRegisterData(const std::string& strAdminAddress, const CAppHeader& header, const CAppData& appData);
-std::vector<unsigned char> FillAuthData(const std::string& strAdminAddress, const CAppHeader& header, const CAuthData& authData);
-std::vector<unsigned char> FillExtendData(const CAppHeader& header, const CExtendData& extendData);
-std::vector<unsigned char> FillIssueData(const CAppHeader& header, const CAssetData& assetData);
-std::vector<unsigned char> FillCommonData(const CAppHeader& header, const CCommonData& commonData);
-std::vector<unsigned char> FillPutCandyData(const CAppHeader& header, const CPutCandyData& candyData);
-std::vector<unsigned char> FillGetCandyData(const CAppHeader& header, const CGetCandyData& candyData);
-std::vector<unsigned char> FillTransferSafeData(const CAppHeader& header, const CTransferSafeData& safeData);
+CTxOutReserve FillRegisterData(const std::string& strAdminAddress, const CAppHeader& header, const CAppData& appData);
+CTxOutReserve FillAuthData(const std::string& strAdminAddress, const CAppHeader& header, const CAuthData& authData);
+CTxOutReserve FillExtendData(const CAppHeader& header, const CExtendData& extendData);
+CTxOutReserve FillIssueData(const CAppHeader& header, const CAssetData& assetData);
+CTxOutReserve FillCommonData(const CAppHeader& header, const CCommonData& commonData);
+CTxOutReserve FillPutCandyData(const CAppHeader& header, const CPutCandyData& candyData);
+CTxOutReserve FillGetCandyData(const CAppHeader& header, const CGetCandyData& candyData);
+CTxOutReserve FillTransferSafeData(const CAppHeader& header, const CTransferSafeData& safeData);
 
-bool ParseReserve(const std::vector<unsigned char>& vReserve, CAppHeader& header, std::vector<unsigned char>& vData);
+bool ParseReserve(const CTxOutReserve& vReserve, CAppHeader& header, std::vector<unsigned char>& vData);
 bool ParseRegisterData(const std::vector<unsigned char>& vAppData, CAppData& appData, std::string* pAdminAddress = NULL);
 bool ParseAuthData(const std::vector<unsigned char>& vAuthData, CAuthData& authData, std::string* pAdminAddress = NULL);
 bool ParseExtendData(const std::vector<unsigned char>& vExtendData, CExtendData& extendData);
@@ -605,6 +638,17 @@ bool ParsePutCandyData(const std::vector<unsigned char>& vCandyData, CPutCandyDa
 bool ParseGetCandyData(const std::vector<unsigned char>& vCandyData, CGetCandyData& candyData);
 bool ParseTransferSafeData(const std::vector<unsigned char>& vSafeData, CTransferSafeData& safeData);
 
+/** Decode the reserve of txout, false for safe and SPOS outputs like ParseReserve() */
+bool ParseAppPayload(const CTxOut& txout, CAppPayload& payload);
+/**
+ * Decoded payload of tx.vout[n], NULL if the output carries no app data. The outputs
+ * are decoded once on first use and kept with the transaction, so the validation,
+ * mempool and wallet code don't run ParseReserve() and protobuf again for every lookup.
+ */
+const CAppPayload* GetAppPayload(const CTransaction& tx, const unsigned int n);
+/** Asset id an asset output is about, false for app outputs and asset data that can't be parsed */
+bool GetPayloadAssetId(const CAppPayload& payload, uint256& assetId);
+
 bool ExistAppName(const std::string& strAppName, const bool fWithMempool = true);
 bool ExistAppId(const uint256& appId, const bool fWithMempool = true);
 bool ExistShortName(const std::string& strShortName, const bool fWithMempool = true);
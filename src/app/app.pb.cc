@@ -0,0 +1,4176 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: app.proto
+
+#include "app.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace App {
+PROTOBUF_CONSTEXPR RegisterData::RegisterData(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.version_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.adminaddress_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.appname_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.appdesc_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.devtype_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.devname_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.weburl_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.logourl_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.coverurl_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}} {}
+struct RegisterDataDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RegisterDataDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RegisterDataDefaultTypeInternal() {}
+  union {
+    RegisterData _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RegisterDataDefaultTypeInternal _RegisterData_default_instance_;
+PROTOBUF_CONSTEXPR AuthData::AuthData(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.version_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.settype_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.adminaddress_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.useraddress_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.auth_)*/0u} {}
+struct AuthDataDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR AuthDataDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~AuthDataDefaultTypeInternal() {}
+  union {
+    AuthData _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 AuthDataDefaultTypeInternal _AuthData_default_instance_;
+PROTOBUF_CONSTEXPR ExtendData::ExtendData(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.version_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.extenddata_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.auth_)*/0u} {}
+struct ExtendDataDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ExtendDataDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ExtendDataDefaultTypeInternal() {}
+  union {
+    ExtendData _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ExtendDataDefaultTypeInternal _ExtendData_default_instance_;
+PROTOBUF_CONSTEXPR IssueData::IssueData(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.version_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.shortname_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.assetname_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.assetdesc_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.assetunit_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.decimals_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.candyexpired_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.remarks_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.totalamount_)*/int64_t{0}
+  , /*decltype(_impl_.firstissueamount_)*/int64_t{0}
+  , /*decltype(_impl_.firstactualamount_)*/int64_t{0}
+  , /*decltype(_impl_.candyamount_)*/int64_t{0}
+  , /*decltype(_impl_.destory_)*/false
+  , /*decltype(_impl_.paycandy_)*/false} {}
+struct IssueDataDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR IssueDataDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~IssueDataDefaultTypeInternal() {}
+  union {
+    IssueData _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 IssueDataDefaultTypeInternal _IssueData_default_instance_;
+PROTOBUF_CONSTEXPR CommonData::CommonData(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.version_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.assetid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.remarks_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.amount_)*/int64_t{0}} {}
+struct CommonDataDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CommonDataDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CommonDataDefaultTypeInternal() {}
+  union {
+    CommonData _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CommonDataDefaultTypeInternal _CommonData_default_instance_;
+PROTOBUF_CONSTEXPR PutCandyData::PutCandyData(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.version_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.assetid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.expired_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.remarks_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.amount_)*/int64_t{0}} {}
+struct PutCandyDataDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PutCandyDataDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PutCandyDataDefaultTypeInternal() {}
+  union {
+    PutCandyData _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PutCandyDataDefaultTypeInternal _PutCandyData_default_instance_;
+PROTOBUF_CONSTEXPR GetCandyData::GetCandyData(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.version_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.assetid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.remarks_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.amount_)*/int64_t{0}} {}
+struct GetCandyDataDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR GetCandyDataDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~GetCandyDataDefaultTypeInternal() {}
+  union {
+    GetCandyData _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GetCandyDataDefaultTypeInternal _GetCandyData_default_instance_;
+PROTOBUF_CONSTEXPR TransferSafeData::TransferSafeData(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.version_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.remarks_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}} {}
+struct TransferSafeDataDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TransferSafeDataDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TransferSafeDataDefaultTypeInternal() {}
+  union {
+    TransferSafeData _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TransferSafeDataDefaultTypeInternal _TransferSafeData_default_instance_;
+}  // namespace App
+static ::_pb::Metadata file_level_metadata_app_2eproto[8];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_app_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_app_2eproto = nullptr;
+
+const uint32_t TableStruct_app_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::App::RegisterData, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::App::RegisterData, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::App::RegisterData, _impl_.version_),
+  PROTOBUF_FIELD_OFFSET(::App::RegisterData, _impl_.adminaddress_),
+  PROTOBUF_FIELD_OFFSET(::App::RegisterData, _impl_.appname_),
+  PROTOBUF_FIELD_OFFSET(::App::RegisterData, _impl_.appdesc_),
+  PROTOBUF_FIELD_OFFSET(::App::RegisterData, _impl_.devtype_),
+  PROTOBUF_FIELD_OFFSET(::App::RegisterData, _impl_.devname_),
+  PROTOBUF_FIELD_OFFSET(::App::RegisterData, _impl_.weburl_),
+  PROTOBUF_FIELD_OFFSET(::App::RegisterData, _impl_.logourl_),
+  PROTOBUF_FIELD_OFFSET(::App::RegisterData, _impl_.coverurl_),
+  0,
+  1,
+  2,
+  3,
+  4,
+  5,
+  6,
+  7,
+  8,
+  PROTOBUF_FIELD_OFFSET(::App::AuthData, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::App::AuthData, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::App::AuthData, _impl_.version_),
+  PROTOBUF_FIELD_OFFSET(::App::AuthData, _impl_.settype_),
+  PROTOBUF_FIELD_OFFSET(::App::AuthData, _impl_.adminaddress_),
+  PROTOBUF_FIELD_OFFSET(::App::AuthData, _impl_.useraddress_),
+  PROTOBUF_FIELD_OFFSET(::App::AuthData, _impl_.auth_),
+  0,
+  1,
+  2,
+  3,
+  4,
+  PROTOBUF_FIELD_OFFSET(::App::ExtendData, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::App::ExtendData, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::App::ExtendData, _impl_.version_),
+  PROTOBUF_FIELD_OFFSET(::App::ExtendData, _impl_.auth_),
+  PROTOBUF_FIELD_OFFSET(::App::ExtendData, _impl_.extenddata_),
+  0,
+  2,
+  1,
+  PROTOBUF_FIELD_OFFSET(::App::IssueData, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::App::IssueData, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::App::IssueData, _impl_.version_),
+  PROTOBUF_FIELD_OFFSET(::App::IssueData, _impl_.shortname_),
+  PROTOBUF_FIELD_OFFSET(::App::IssueData, _impl_.assetname_),
+  PROTOBUF_FIELD_OFFSET(::App::IssueData, _impl_.assetdesc_),
+  PROTOBUF_FIELD_OFFSET(::App::IssueData, _impl_.assetunit_),
+  PROTOBUF_FIELD_OFFSET(::App::IssueData, _impl_.totalamount_),
+  PROTOBUF_FIELD_OFFSET(::App::IssueData, _impl_.firstissueamount_),
+  PROTOBUF_FIELD_OFFSET(::App::IssueData, _impl_.firstactualamount_),
+  PROTOBUF_FIELD_OFFSET(::App::IssueData, _impl_.decimals_),
+  PROTOBUF_FIELD_OFFSET(::App::IssueData, _impl_.destory_),
+  PROTOBUF_FIELD_OFFSET(::App::IssueData, _impl_.paycandy_),
+  PROTOBUF_FIELD_OFFSET(::App::IssueData, _impl_.candyamount_),
+  PROTOBUF_FIELD_OFFSET(::App::IssueData, _impl_.candyexpired_),
+  PROTOBUF_FIELD_OFFSET(::App::IssueData, _impl_.remarks_),
+  0,
+  1,
+  2,
+  3,
+  4,
+  8,
+  9,
+  10,
+  5,
+  12,
+  13,
+  11,
+  6,
+  7,
+  PROTOBUF_FIELD_OFFSET(::App::CommonData, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::App::CommonData, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::App::CommonData, _impl_.version_),
+  PROTOBUF_FIELD_OFFSET(::App::CommonData, _impl_.assetid_),
+  PROTOBUF_FIELD_OFFSET(::App::CommonData, _impl_.amount_),
+  PROTOBUF_FIELD_OFFSET(::App::CommonData, _impl_.remarks_),
+  0,
+  1,
+  3,
+  2,
+  PROTOBUF_FIELD_OFFSET(::App::PutCandyData, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::App::PutCandyData, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::App::PutCandyData, _impl_.version_),
+  PROTOBUF_FIELD_OFFSET(::App::PutCandyData, _impl_.assetid_),
+  PROTOBUF_FIELD_OFFSET(::App::PutCandyData, _impl_.amount_),
+  PROTOBUF_FIELD_OFFSET(::App::PutCandyData, _impl_.expired_),
+  PROTOBUF_FIELD_OFFSET(::App::PutCandyData, _impl_.remarks_),
+  0,
+  1,
+  4,
+  2,
+  3,
+  PROTOBUF_FIELD_OFFSET(::App::GetCandyData, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::App::GetCandyData, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::App::GetCandyData, _impl_.version_),
+  PROTOBUF_FIELD_OFFSET(::App::GetCandyData, _impl_.assetid_),
+  PROTOBUF_FIELD_OFFSET(::App::GetCandyData, _impl_.amount_),
+  PROTOBUF_FIELD_OFFSET(::App::GetCandyData, _impl_.remarks_),
+  0,
+  1,
+  3,
+  2,
+  PROTOBUF_FIELD_OFFSET(::App::TransferSafeData, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::App::TransferSafeData, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::App::TransferSafeData, _impl_.version_),
+  PROTOBUF_FIELD_OFFSET(::App::TransferSafeData, _impl_.remarks_),
+  0,
+  1,
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 15, -1, sizeof(::App::RegisterData)},
+  { 24, 35, -1, sizeof(::App::AuthData)},
+  { 40, 49, -1, sizeof(::App::ExtendData)},
+  { 52, 72, -1, sizeof(::App::IssueData)},
+  { 86, 96, -1, sizeof(::App::CommonData)},
+  { 100, 111, -1, sizeof(::App::PutCandyData)},
+  { 116, 126, -1, sizeof(::App::GetCandyData)},
+  { 130, 138, -1, sizeof(::App::TransferSafeData)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::App::_RegisterData_default_instance_._instance,
+  &::App::_AuthData_default_instance_._instance,
+  &::App::_ExtendData_default_instance_._instance,
+  &::App::_IssueData_default_instance_._instance,
+  &::App::_CommonData_default_instance_._instance,
+  &::App::_PutCandyData_default_instance_._instance,
+  &::App::_GetCandyData_default_instance_._instance,
+  &::App::_TransferSafeData_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_app_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\tapp.proto\022\003App\"\254\001\n\014RegisterData\022\017\n\007ver"
+  "sion\030\001 \002(\014\022\024\n\014adminAddress\030\002 \002(\014\022\017\n\007appN"
+  "ame\030\003 \002(\014\022\017\n\007appDesc\030\004 \002(\014\022\017\n\007devType\030\005 "
+  "\002(\014\022\017\n\007devName\030\006 \002(\014\022\016\n\006webUrl\030\007 \002(\014\022\017\n\007"
+  "logoUrl\030\010 \002(\014\022\020\n\010coverUrl\030\t \002(\014\"e\n\010AuthD"
+  "ata\022\017\n\007version\030\001 \002(\014\022\017\n\007setType\030\002 \002(\014\022\024\n"
+  "\014adminAddress\030\003 \002(\014\022\023\n\013userAddress\030\004 \002(\014"
+  "\022\014\n\004auth\030\005 \002(\r\"\?\n\nExtendData\022\017\n\007version\030"
+  "\001 \002(\014\022\014\n\004auth\030\002 \002(\r\022\022\n\nextendData\030\003 \002(\014\""
+  "\243\002\n\tIssueData\022\017\n\007version\030\001 \002(\014\022\021\n\tshortN"
+  "ame\030\002 \002(\014\022\021\n\tassetName\030\003 \002(\014\022\021\n\tassetDes"
+  "c\030\004 \002(\014\022\021\n\tassetUnit\030\005 \002(\014\022\023\n\013totalAmoun"
+  "t\030\006 \002(\003\022\030\n\020firstIssueAmount\030\007 \002(\003\022\031\n\021fir"
+  "stActualAmount\030\010 \002(\003\022\020\n\010decimals\030\t \002(\014\022\017"
+  "\n\007destory\030\n \002(\010\022\020\n\010payCandy\030\013 \002(\010\022\023\n\013can"
+  "dyAmount\030\014 \002(\003\022\024\n\014candyExpired\030\r \002(\014\022\017\n\007"
+  "remarks\030\016 \002(\014\"O\n\nCommonData\022\017\n\007version\030\001"
+  " \002(\014\022\017\n\007assetId\030\002 \002(\014\022\016\n\006amount\030\003 \002(\003\022\017\n"
+  "\007remarks\030\004 \002(\014\"b\n\014PutCandyData\022\017\n\007versio"
+  "n\030\001 \002(\014\022\017\n\007assetId\030\002 \002(\014\022\016\n\006amount\030\003 \002(\003"
+  "\022\017\n\007expired\030\004 \002(\014\022\017\n\007remarks\030\005 \002(\014\"Q\n\014Ge"
+  "tCandyData\022\017\n\007version\030\001 \002(\014\022\017\n\007assetId\030\002"
+  " \002(\014\022\016\n\006amount\030\003 \002(\003\022\017\n\007remarks\030\004 \002(\014\"4\n"
+  "\020TransferSafeData\022\017\n\007version\030\001 \002(\014\022\017\n\007re"
+  "marks\030\002 \002(\014B\023\n\014org.safe.AppB\003App"
+  ;
+static ::_pbi::once_flag descriptor_table_app_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_app_2eproto = {
+    false, false, 992, descriptor_table_protodef_app_2eproto,
+    "app.proto",
+    &descriptor_table_app_2eproto_once, nullptr, 0, 8,
+    schemas, file_default_instances, TableStruct_app_2eproto::offsets,
+    file_level_metadata_app_2eproto, file_level_enum_descriptors_app_2eproto,
+    file_level_service_descriptors_app_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_app_2eproto_getter() {
+  return &descriptor_table_app_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_app_2eproto(&descriptor_table_app_2eproto);
+namespace App {
+
+// ===================================================================
+
+class RegisterData::_Internal {
+ public:
+  using HasBits = decltype(std::declval<RegisterData>()._impl_._has_bits_);
+  static void set_has_version(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_adminaddress(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_appname(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_appdesc(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_devtype(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_devname(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_weburl(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static void set_has_logourl(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static void set_has_coverurl(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x000001ff) ^ 0x000001ff) != 0;
+  }
+};
+
+RegisterData::RegisterData(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:App.RegisterData)
+}
+RegisterData::RegisterData(const RegisterData& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  RegisterData* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.version_){}
+    , decltype(_impl_.adminaddress_){}
+    , decltype(_impl_.appname_){}
+    , decltype(_impl_.appdesc_){}
+    , decltype(_impl_.devtype_){}
+    , decltype(_impl_.devname_){}
+    , decltype(_impl_.weburl_){}
+    , decltype(_impl_.logourl_){}
+    , decltype(_impl_.coverurl_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.version_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.version_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_version()) {
+    _this->_impl_.version_.Set(from._internal_version(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.adminaddress_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.adminaddress_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_adminaddress()) {
+    _this->_impl_.adminaddress_.Set(from._internal_adminaddress(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.appname_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.appname_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_appname()) {
+    _this->_impl_.appname_.Set(from._internal_appname(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.appdesc_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.appdesc_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_appdesc()) {
+    _this->_impl_.appdesc_.Set(from._internal_appdesc(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.devtype_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.devtype_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_devtype()) {
+    _this->_impl_.devtype_.Set(from._internal_devtype(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.devname_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.devname_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_devname()) {
+    _this->_impl_.devname_.Set(from._internal_devname(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.weburl_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.weburl_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_weburl()) {
+    _this->_impl_.weburl_.Set(from._internal_weburl(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.logourl_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.logourl_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_logourl()) {
+    _this->_impl_.logourl_.Set(from._internal_logourl(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.coverurl_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.coverurl_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_coverurl()) {
+    _this->_impl_.coverurl_.Set(from._internal_coverurl(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:App.RegisterData)
+}
+
+inline void RegisterData::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.version_){}
+    , decltype(_impl_.adminaddress_){}
+    , decltype(_impl_.appname_){}
+    , decltype(_impl_.appdesc_){}
+    , decltype(_impl_.devtype_){}
+    , decltype(_impl_.devname_){}
+    , decltype(_impl_.weburl_){}
+    , decltype(_impl_.logourl_){}
+    , decltype(_impl_.coverurl_){}
+  };
+  _impl_.version_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.version_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.adminaddress_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.adminaddress_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.appname_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.appname_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.appdesc_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.appdesc_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.devtype_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.devtype_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.devname_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.devname_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.weburl_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.weburl_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.logourl_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.logourl_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.coverurl_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.coverurl_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+RegisterData::~RegisterData() {
+  // @@protoc_insertion_point(destructor:App.RegisterData)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void RegisterData::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.version_.Destroy();
+  _impl_.adminaddress_.Destroy();
+  _impl_.appname_.Destroy();
+  _impl_.appdesc_.Destroy();
+  _impl_.devtype_.Destroy();
+  _impl_.devname_.Destroy();
+  _impl_.weburl_.Destroy();
+  _impl_.logourl_.Destroy();
+  _impl_.coverurl_.Destroy();
+}
+
+void RegisterData::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void RegisterData::Clear() {
+// @@protoc_insertion_point(message_clear_start:App.RegisterData)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.version_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.adminaddress_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _impl_.appname_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _impl_.appdesc_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _impl_.devtype_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _impl_.devname_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _impl_.weburl_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _impl_.logourl_.ClearNonDefaultToEmpty();
+    }
+  }
+  if (cached_has_bits & 0x00000100u) {
+    _impl_.coverurl_.ClearNonDefaultToEmpty();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* RegisterData::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required bytes version = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_version();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required bytes adminAddress = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_adminaddress();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required bytes appName = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_appname();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required bytes appDesc = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_appdesc();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required bytes devType = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          auto str = _internal_mutable_devtype();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required bytes devName = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          auto str = _internal_mutable_devname();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required bytes webUrl = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          auto str = _internal_mutable_weburl();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required bytes logoUrl = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          auto str = _internal_mutable_logourl();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required bytes coverUrl = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 74)) {
+          auto str = _internal_mutable_coverurl();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* RegisterData::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:App.RegisterData)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required bytes version = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->WriteBytesMaybeAliased(
+        1, this->_internal_version(), target);
+  }
+
+  // required bytes adminAddress = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->WriteBytesMaybeAliased(
+        2, this->_internal_adminaddress(), target);
+  }
+
+  // required bytes appName = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->WriteBytesMaybeAliased(
+        3, this->_internal_appname(), target);
+  }
+
+  // required bytes appDesc = 4;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->WriteBytesMaybeAliased(
+        4, this->_internal_appdesc(), target);
+  }
+
+  // required bytes devType = 5;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->WriteBytesMaybeAliased(
+        5, this->_internal_devtype(), target);
+  }
+
+  // required bytes devName = 6;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->WriteBytesMaybeAliased(
+        6, this->_internal_devname(), target);
+  }
+
+  // required bytes webUrl = 7;
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->WriteBytesMaybeAliased(
+        7, this->_internal_weburl(), target);
+  }
+
+  // required bytes logoUrl = 8;
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->WriteBytesMaybeAliased(
+        8, this->_internal_logourl(), target);
+  }
+
+  // required bytes coverUrl = 9;
+  if (cached_has_bits & 0x00000100u) {
+    target = stream->WriteBytesMaybeAliased(
+        9, this->_internal_coverurl(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:App.RegisterData)
+  return target;
+}
+
+size_t RegisterData::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:App.RegisterData)
+  size_t total_size = 0;
+
+  if (_internal_has_version()) {
+    // required bytes version = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_version());
+  }
+
+  if (_internal_has_adminaddress()) {
+    // required bytes adminAddress = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_adminaddress());
+  }
+
+  if (_internal_has_appname()) {
+    // required bytes appName = 3;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_appname());
+  }
+
+  if (_internal_has_appdesc()) {
+    // required bytes appDesc = 4;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_appdesc());
+  }
+
+  if (_internal_has_devtype()) {
+    // required bytes devType = 5;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_devtype());
+  }
+
+  if (_internal_has_devname()) {
+    // required bytes devName = 6;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_devname());
+  }
+
+  if (_internal_has_weburl()) {
+    // required bytes webUrl = 7;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_weburl());
+  }
+
+  if (_internal_has_logourl()) {
+    // required bytes logoUrl = 8;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_logourl());
+  }
+
+  if (_internal_has_coverurl()) {
+    // required bytes coverUrl = 9;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_coverurl());
+  }
+
+  return total_size;
+}
+size_t RegisterData::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:App.RegisterData)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x000001ff) ^ 0x000001ff) == 0) {  // All required fields are present.
+    // required bytes version = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_version());
+
+    // required bytes adminAddress = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_adminaddress());
+
+    // required bytes appName = 3;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_appname());
+
+    // required bytes appDesc = 4;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_appdesc());
+
+    // required bytes devType = 5;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_devtype());
+
+    // required bytes devName = 6;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_devname());
+
+    // required bytes webUrl = 7;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_weburl());
+
+    // required bytes logoUrl = 8;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_logourl());
+
+    // required bytes coverUrl = 9;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_coverurl());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RegisterData::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    RegisterData::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*RegisterData::GetClassData() const { return &_class_data_; }
+
+
+void RegisterData::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<RegisterData*>(&to_msg);
+  auto& from = static_cast<const RegisterData&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:App.RegisterData)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_version(from._internal_version());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_adminaddress(from._internal_adminaddress());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_set_appname(from._internal_appname());
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_internal_set_appdesc(from._internal_appdesc());
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_internal_set_devtype(from._internal_devtype());
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_internal_set_devname(from._internal_devname());
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_internal_set_weburl(from._internal_weburl());
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_internal_set_logourl(from._internal_logourl());
+    }
+  }
+  if (cached_has_bits & 0x00000100u) {
+    _this->_internal_set_coverurl(from._internal_coverurl());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void RegisterData::CopyFrom(const RegisterData& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:App.RegisterData)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool RegisterData::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void RegisterData::InternalSwap(RegisterData* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.version_, lhs_arena,
+      &other->_impl_.version_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.adminaddress_, lhs_arena,
+      &other->_impl_.adminaddress_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.appname_, lhs_arena,
+      &other->_impl_.appname_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.appdesc_, lhs_arena,
+      &other->_impl_.appdesc_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.devtype_, lhs_arena,
+      &other->_impl_.devtype_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.devname_, lhs_arena,
+      &other->_impl_.devname_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.weburl_, lhs_arena,
+      &other->_impl_.weburl_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.logourl_, lhs_arena,
+      &other->_impl_.logourl_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.coverurl_, lhs_arena,
+      &other->_impl_.coverurl_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata RegisterData::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_app_2eproto_getter, &descriptor_table_app_2eproto_once,
+      file_level_metadata_app_2eproto[0]);
+}
+
+// ===================================================================
+
+class AuthData::_Internal {
+ public:
+  using HasBits = decltype(std::declval<AuthData>()._impl_._has_bits_);
+  static void set_has_version(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_settype(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_adminaddress(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_useraddress(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_auth(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x0000001f) ^ 0x0000001f) != 0;
+  }
+};
+
+AuthData::AuthData(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:App.AuthData)
+}
+AuthData::AuthData(const AuthData& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  AuthData* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.version_){}
+    , decltype(_impl_.settype_){}
+    , decltype(_impl_.adminaddress_){}
+    , decltype(_impl_.useraddress_){}
+    , decltype(_impl_.auth_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.version_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.version_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_version()) {
+    _this->_impl_.version_.Set(from._internal_version(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.settype_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.settype_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_settype()) {
+    _this->_impl_.settype_.Set(from._internal_settype(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.adminaddress_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.adminaddress_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_adminaddress()) {
+    _this->_impl_.adminaddress_.Set(from._internal_adminaddress(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.useraddress_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.useraddress_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_useraddress()) {
+    _this->_impl_.useraddress_.Set(from._internal_useraddress(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.auth_ = from._impl_.auth_;
+  // @@protoc_insertion_point(copy_constructor:App.AuthData)
+}
+
+inline void AuthData::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.version_){}
+    , decltype(_impl_.settype_){}
+    , decltype(_impl_.adminaddress_){}
+    , decltype(_impl_.useraddress_){}
+    , decltype(_impl_.auth_){0u}
+  };
+  _impl_.version_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.version_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.settype_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.settype_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.adminaddress_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.adminaddress_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.useraddress_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.useraddress_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+AuthData::~AuthData() {
+  // @@protoc_insertion_point(destructor:App.AuthData)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void AuthData::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.version_.Destroy();
+  _impl_.settype_.Destroy();
+  _impl_.adminaddress_.Destroy();
+  _impl_.useraddress_.Destroy();
+}
+
+void AuthData::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void AuthData::Clear() {
+// @@protoc_insertion_point(message_clear_start:App.AuthData)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.version_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.settype_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _impl_.adminaddress_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _impl_.useraddress_.ClearNonDefaultToEmpty();
+    }
+  }
+  _impl_.auth_ = 0u;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* AuthData::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required bytes version = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_version();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required bytes setType = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_settype();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required bytes adminAddress = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_adminaddress();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required bytes userAddress = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_useraddress();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint32 auth = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_auth(&has_bits);
+          _impl_.auth_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* AuthData::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:App.AuthData)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required bytes version = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->WriteBytesMaybeAliased(
+        1, this->_internal_version(), target);
+  }
+
+  // required bytes setType = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->WriteBytesMaybeAliased(
+        2, this->_internal_settype(), target);
+  }
+
+  // required bytes adminAddress = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->WriteBytesMaybeAliased(
+        3, this->_internal_adminaddress(), target);
+  }
+
+  // required bytes userAddress = 4;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->WriteBytesMaybeAliased(
+        4, this->_internal_useraddress(), target);
+  }
+
+  // required uint32 auth = 5;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(5, this->_internal_auth(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:App.AuthData)
+  return target;
+}
+
+size_t AuthData::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:App.AuthData)
+  size_t total_size = 0;
+
+  if (_internal_has_version()) {
+    // required bytes version = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_version());
+  }
+
+  if (_internal_has_settype()) {
+    // required bytes setType = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_settype());
+  }
+
+  if (_internal_has_adminaddress()) {
+    // required bytes adminAddress = 3;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_adminaddress());
+  }
+
+  if (_internal_has_useraddress()) {
+    // required bytes userAddress = 4;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_useraddress());
+  }
+
+  if (_internal_has_auth()) {
+    // required uint32 auth = 5;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_auth());
+  }
+
+  return total_size;
+}
+size_t AuthData::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:App.AuthData)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x0000001f) ^ 0x0000001f) == 0) {  // All required fields are present.
+    // required bytes version = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_version());
+
+    // required bytes setType = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_settype());
+
+    // required bytes adminAddress = 3;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_adminaddress());
+
+    // required bytes userAddress = 4;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_useraddress());
+
+    // required uint32 auth = 5;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_auth());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData AuthData::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    AuthData::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*AuthData::GetClassData() const { return &_class_data_; }
+
+
+void AuthData::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<AuthData*>(&to_msg);
+  auto& from = static_cast<const AuthData&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:App.AuthData)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_version(from._internal_version());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_settype(from._internal_settype());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_set_adminaddress(from._internal_adminaddress());
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_internal_set_useraddress(from._internal_useraddress());
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.auth_ = from._impl_.auth_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void AuthData::CopyFrom(const AuthData& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:App.AuthData)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool AuthData::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void AuthData::InternalSwap(AuthData* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.version_, lhs_arena,
+      &other->_impl_.version_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.settype_, lhs_arena,
+      &other->_impl_.settype_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.adminaddress_, lhs_arena,
+      &other->_impl_.adminaddress_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.useraddress_, lhs_arena,
+      &other->_impl_.useraddress_, rhs_arena
+  );
+  swap(_impl_.auth_, other->_impl_.auth_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata AuthData::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_app_2eproto_getter, &descriptor_table_app_2eproto_once,
+      file_level_metadata_app_2eproto[1]);
+}
+
+// ===================================================================
+
+class ExtendData::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ExtendData>()._impl_._has_bits_);
+  static void set_has_version(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_auth(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_extenddata(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000007) ^ 0x00000007) != 0;
+  }
+};
+
+ExtendData::ExtendData(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:App.ExtendData)
+}
+ExtendData::ExtendData(const ExtendData& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ExtendData* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.version_){}
+    , decltype(_impl_.extenddata_){}
+    , decltype(_impl_.auth_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.version_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.version_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_version()) {
+    _this->_impl_.version_.Set(from._internal_version(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.extenddata_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.extenddata_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_extenddata()) {
+    _this->_impl_.extenddata_.Set(from._internal_extenddata(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.auth_ = from._impl_.auth_;
+  // @@protoc_insertion_point(copy_constructor:App.ExtendData)
+}
+
+inline void ExtendData::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.version_){}
+    , decltype(_impl_.extenddata_){}
+    , decltype(_impl_.auth_){0u}
+  };
+  _impl_.version_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.version_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.extenddata_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.extenddata_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+ExtendData::~ExtendData() {
+  // @@protoc_insertion_point(destructor:App.ExtendData)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ExtendData::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.version_.Destroy();
+  _impl_.extenddata_.Destroy();
+}
+
+void ExtendData::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ExtendData::Clear() {
+// @@protoc_insertion_point(message_clear_start:App.ExtendData)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.version_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.extenddata_.ClearNonDefaultToEmpty();
+    }
+  }
+  _impl_.auth_ = 0u;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ExtendData::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required bytes version = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_version();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint32 auth = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_auth(&has_bits);
+          _impl_.auth_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required bytes extendData = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_extenddata();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ExtendData::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:App.ExtendData)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required bytes version = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->WriteBytesMaybeAliased(
+        1, this->_internal_version(), target);
+  }
+
+  // required uint32 auth = 2;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_auth(), target);
+  }
+
+  // required bytes extendData = 3;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->WriteBytesMaybeAliased(
+        3, this->_internal_extenddata(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:App.ExtendData)
+  return target;
+}
+
+size_t ExtendData::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:App.ExtendData)
+  size_t total_size = 0;
+
+  if (_internal_has_version()) {
+    // required bytes version = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_version());
+  }
+
+  if (_internal_has_extenddata()) {
+    // required bytes extendData = 3;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_extenddata());
+  }
+
+  if (_internal_has_auth()) {
+    // required uint32 auth = 2;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_auth());
+  }
+
+  return total_size;
+}
+size_t ExtendData::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:App.ExtendData)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000007) ^ 0x00000007) == 0) {  // All required fields are present.
+    // required bytes version = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_version());
+
+    // required bytes extendData = 3;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_extenddata());
+
+    // required uint32 auth = 2;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_auth());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ExtendData::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ExtendData::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ExtendData::GetClassData() const { return &_class_data_; }
+
+
+void ExtendData::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ExtendData*>(&to_msg);
+  auto& from = static_cast<const ExtendData&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:App.ExtendData)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_version(from._internal_version());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_extenddata(from._internal_extenddata());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.auth_ = from._impl_.auth_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ExtendData::CopyFrom(const ExtendData& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:App.ExtendData)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ExtendData::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void ExtendData::InternalSwap(ExtendData* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.version_, lhs_arena,
+      &other->_impl_.version_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.extenddata_, lhs_arena,
+      &other->_impl_.extenddata_, rhs_arena
+  );
+  swap(_impl_.auth_, other->_impl_.auth_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ExtendData::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_app_2eproto_getter, &descriptor_table_app_2eproto_once,
+      file_level_metadata_app_2eproto[2]);
+}
+
+// ===================================================================
+
+class IssueData::_Internal {
+ public:
+  using HasBits = decltype(std::declval<IssueData>()._impl_._has_bits_);
+  static void set_has_version(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_shortname(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_assetname(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_assetdesc(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_assetunit(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_totalamount(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
+  }
+  static void set_has_firstissueamount(HasBits* has_bits) {
+    (*has_bits)[0] |= 512u;
+  }
+  static void set_has_firstactualamount(HasBits* has_bits) {
+    (*has_bits)[0] |= 1024u;
+  }
+  static void set_has_decimals(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_destory(HasBits* has_bits) {
+    (*has_bits)[0] |= 4096u;
+  }
+  static void set_has_paycandy(HasBits* has_bits) {
+    (*has_bits)[0] |= 8192u;
+  }
+  static void set_has_candyamount(HasBits* has_bits) {
+    (*has_bits)[0] |= 2048u;
+  }
+  static void set_has_candyexpired(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static void set_has_remarks(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00003fff) ^ 0x00003fff) != 0;
+  }
+};
+
+IssueData::IssueData(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:App.IssueData)
+}
+IssueData::IssueData(const IssueData& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  IssueData* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.version_){}
+    , decltype(_impl_.shortname_){}
+    , decltype(_impl_.assetname_){}
+    , decltype(_impl_.assetdesc_){}
+    , decltype(_impl_.assetunit_){}
+    , decltype(_impl_.decimals_){}
+    , decltype(_impl_.candyexpired_){}
+    , decltype(_impl_.remarks_){}
+    , decltype(_impl_.totalamount_){}
+    , decltype(_impl_.firstissueamount_){}
+    , decltype(_impl_.firstactualamount_){}
+    , decltype(_impl_.candyamount_){}
+    , decltype(_impl_.destory_){}
+    , decltype(_impl_.paycandy_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.version_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.version_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_version()) {
+    _this->_impl_.version_.Set(from._internal_version(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.shortname_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.shortname_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_shortname()) {
+    _this->_impl_.shortname_.Set(from._internal_shortname(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.assetname_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.assetname_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_assetname()) {
+    _this->_impl_.assetname_.Set(from._internal_assetname(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.assetdesc_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.assetdesc_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_assetdesc()) {
+    _this->_impl_.assetdesc_.Set(from._internal_assetdesc(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.assetunit_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.assetunit_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_assetunit()) {
+    _this->_impl_.assetunit_.Set(from._internal_assetunit(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.decimals_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.decimals_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_decimals()) {
+    _this->_impl_.decimals_.Set(from._internal_decimals(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.candyexpired_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.candyexpired_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_candyexpired()) {
+    _this->_impl_.candyexpired_.Set(from._internal_candyexpired(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.remarks_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.remarks_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_remarks()) {
+    _this->_impl_.remarks_.Set(from._internal_remarks(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.totalamount_, &from._impl_.totalamount_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.paycandy_) -
+    reinterpret_cast<char*>(&_impl_.totalamount_)) + sizeof(_impl_.paycandy_));
+  // @@protoc_insertion_point(copy_constructor:App.IssueData)
+}
+
+inline void IssueData::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.version_){}
+    , decltype(_impl_.shortname_){}
+    , decltype(_impl_.assetname_){}
+    , decltype(_impl_.assetdesc_){}
+    , decltype(_impl_.assetunit_){}
+    , decltype(_impl_.decimals_){}
+    , decltype(_impl_.candyexpired_){}
+    , decltype(_impl_.remarks_){}
+    , decltype(_impl_.totalamount_){int64_t{0}}
+    , decltype(_impl_.firstissueamount_){int64_t{0}}
+    , decltype(_impl_.firstactualamount_){int64_t{0}}
+    , decltype(_impl_.candyamount_){int64_t{0}}
+    , decltype(_impl_.destory_){false}
+    , decltype(_impl_.paycandy_){false}
+  };
+  _impl_.version_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.version_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.shortname_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.shortname_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.assetname_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.assetname_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.assetdesc_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.assetdesc_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.assetunit_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.assetunit_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.decimals_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.decimals_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.candyexpired_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.candyexpired_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.remarks_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.remarks_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+IssueData::~IssueData() {
+  // @@protoc_insertion_point(destructor:App.IssueData)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void IssueData::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.version_.Destroy();
+  _impl_.shortname_.Destroy();
+  _impl_.assetname_.Destroy();
+  _impl_.assetdesc_.Destroy();
+  _impl_.assetunit_.Destroy();
+  _impl_.decimals_.Destroy();
+  _impl_.candyexpired_.Destroy();
+  _impl_.remarks_.Destroy();
+}
+
+void IssueData::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void IssueData::Clear() {
+// @@protoc_insertion_point(message_clear_start:App.IssueData)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.version_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.shortname_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _impl_.assetname_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _impl_.assetdesc_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _impl_.assetunit_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _impl_.decimals_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _impl_.candyexpired_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _impl_.remarks_.ClearNonDefaultToEmpty();
+    }
+  }
+  if (cached_has_bits & 0x00003f00u) {
+    ::memset(&_impl_.totalamount_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.paycandy_) -
+        reinterpret_cast<char*>(&_impl_.totalamount_)) + sizeof(_impl_.paycandy_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* IssueData::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required bytes version = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_version();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required bytes shortName = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_shortname();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required bytes assetName = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_assetname();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required bytes assetDesc = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_assetdesc();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required bytes assetUnit = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          auto str = _internal_mutable_assetunit();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required int64 totalAmount = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _Internal::set_has_totalamount(&has_bits);
+          _impl_.totalamount_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required int64 firstIssueAmount = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _Internal::set_has_firstissueamount(&has_bits);
+          _impl_.firstissueamount_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required int64 firstActualAmount = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _Internal::set_has_firstactualamount(&has_bits);
+          _impl_.firstactualamount_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required bytes decimals = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 74)) {
+          auto str = _internal_mutable_decimals();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required bool destory = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 80)) {
+          _Internal::set_has_destory(&has_bits);
+          _impl_.destory_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required bool payCandy = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 88)) {
+          _Internal::set_has_paycandy(&has_bits);
+          _impl_.paycandy_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required int64 candyAmount = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 96)) {
+          _Internal::set_has_candyamount(&has_bits);
+          _impl_.candyamount_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required bytes candyExpired = 13;
+      case 13:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 106)) {
+          auto str = _internal_mutable_candyexpired();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required bytes remarks = 14;
+      case 14:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 114)) {
+          auto str = _internal_mutable_remarks();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* IssueData::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:App.IssueData)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required bytes version = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->WriteBytesMaybeAliased(
+        1, this->_internal_version(), target);
+  }
+
+  // required bytes shortName = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->WriteBytesMaybeAliased(
+        2, this->_internal_shortname(), target);
+  }
+
+  // required bytes assetName = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->WriteBytesMaybeAliased(
+        3, this->_internal_assetname(), target);
+  }
+
+  // required bytes assetDesc = 4;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->WriteBytesMaybeAliased(
+        4, this->_internal_assetdesc(), target);
+  }
+
+  // required bytes assetUnit = 5;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->WriteBytesMaybeAliased(
+        5, this->_internal_assetunit(), target);
+  }
+
+  // required int64 totalAmount = 6;
+  if (cached_has_bits & 0x00000100u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(6, this->_internal_totalamount(), target);
+  }
+
+  // required int64 firstIssueAmount = 7;
+  if (cached_has_bits & 0x00000200u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(7, this->_internal_firstissueamount(), target);
+  }
+
+  // required int64 firstActualAmount = 8;
+  if (cached_has_bits & 0x00000400u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(8, this->_internal_firstactualamount(), target);
+  }
+
+  // required bytes decimals = 9;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->WriteBytesMaybeAliased(
+        9, this->_internal_decimals(), target);
+  }
+
+  // required bool destory = 10;
+  if (cached_has_bits & 0x00001000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(10, this->_internal_destory(), target);
+  }
+
+  // required bool payCandy = 11;
+  if (cached_has_bits & 0x00002000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(11, this->_internal_paycandy(), target);
+  }
+
+  // required int64 candyAmount = 12;
+  if (cached_has_bits & 0x00000800u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(12, this->_internal_candyamount(), target);
+  }
+
+  // required bytes candyExpired = 13;
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->WriteBytesMaybeAliased(
+        13, this->_internal_candyexpired(), target);
+  }
+
+  // required bytes remarks = 14;
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->WriteBytesMaybeAliased(
+        14, this->_internal_remarks(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:App.IssueData)
+  return target;
+}
+
+size_t IssueData::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:App.IssueData)
+  size_t total_size = 0;
+
+  if (_internal_has_version()) {
+    // required bytes version = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_version());
+  }
+
+  if (_internal_has_shortname()) {
+    // required bytes shortName = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_shortname());
+  }
+
+  if (_internal_has_assetname()) {
+    // required bytes assetName = 3;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_assetname());
+  }
+
+  if (_internal_has_assetdesc()) {
+    // required bytes assetDesc = 4;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_assetdesc());
+  }
+
+  if (_internal_has_assetunit()) {
+    // required bytes assetUnit = 5;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_assetunit());
+  }
+
+  if (_internal_has_decimals()) {
+    // required bytes decimals = 9;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_decimals());
+  }
+
+  if (_internal_has_candyexpired()) {
+    // required bytes candyExpired = 13;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_candyexpired());
+  }
+
+  if (_internal_has_remarks()) {
+    // required bytes remarks = 14;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_remarks());
+  }
+
+  if (_internal_has_totalamount()) {
+    // required int64 totalAmount = 6;
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_totalamount());
+  }
+
+  if (_internal_has_firstissueamount()) {
+    // required int64 firstIssueAmount = 7;
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_firstissueamount());
+  }
+
+  if (_internal_has_firstactualamount()) {
+    // required int64 firstActualAmount = 8;
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_firstactualamount());
+  }
+
+  if (_internal_has_candyamount()) {
+    // required int64 candyAmount = 12;
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_candyamount());
+  }
+
+  if (_internal_has_destory()) {
+    // required bool destory = 10;
+    total_size += 1 + 1;
+  }
+
+  if (_internal_has_paycandy()) {
+    // required bool payCandy = 11;
+    total_size += 1 + 1;
+  }
+
+  return total_size;
+}
+size_t IssueData::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:App.IssueData)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00003fff) ^ 0x00003fff) == 0) {  // All required fields are present.
+    // required bytes version = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_version());
+
+    // required bytes shortName = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_shortname());
+
+    // required bytes assetName = 3;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_assetname());
+
+    // required bytes assetDesc = 4;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_assetdesc());
+
+    // required bytes assetUnit = 5;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_assetunit());
+
+    // required bytes decimals = 9;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_decimals());
+
+    // required bytes candyExpired = 13;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_candyexpired());
+
+    // required bytes remarks = 14;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_remarks());
+
+    // required int64 totalAmount = 6;
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_totalamount());
+
+    // required int64 firstIssueAmount = 7;
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_firstissueamount());
+
+    // required int64 firstActualAmount = 8;
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_firstactualamount());
+
+    // required int64 candyAmount = 12;
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_candyamount());
+
+    // required bool destory = 10;
+    total_size += 1 + 1;
+
+    // required bool payCandy = 11;
+    total_size += 1 + 1;
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData IssueData::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    IssueData::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*IssueData::GetClassData() const { return &_class_data_; }
+
+
+void IssueData::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<IssueData*>(&to_msg);
+  auto& from = static_cast<const IssueData&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:App.IssueData)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_version(from._internal_version());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_shortname(from._internal_shortname());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_set_assetname(from._internal_assetname());
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_internal_set_assetdesc(from._internal_assetdesc());
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_internal_set_assetunit(from._internal_assetunit());
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_internal_set_decimals(from._internal_decimals());
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_internal_set_candyexpired(from._internal_candyexpired());
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_internal_set_remarks(from._internal_remarks());
+    }
+  }
+  if (cached_has_bits & 0x00003f00u) {
+    if (cached_has_bits & 0x00000100u) {
+      _this->_impl_.totalamount_ = from._impl_.totalamount_;
+    }
+    if (cached_has_bits & 0x00000200u) {
+      _this->_impl_.firstissueamount_ = from._impl_.firstissueamount_;
+    }
+    if (cached_has_bits & 0x00000400u) {
+      _this->_impl_.firstactualamount_ = from._impl_.firstactualamount_;
+    }
+    if (cached_has_bits & 0x00000800u) {
+      _this->_impl_.candyamount_ = from._impl_.candyamount_;
+    }
+    if (cached_has_bits & 0x00001000u) {
+      _this->_impl_.destory_ = from._impl_.destory_;
+    }
+    if (cached_has_bits & 0x00002000u) {
+      _this->_impl_.paycandy_ = from._impl_.paycandy_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void IssueData::CopyFrom(const IssueData& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:App.IssueData)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool IssueData::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void IssueData::InternalSwap(IssueData* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.version_, lhs_arena,
+      &other->_impl_.version_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.shortname_, lhs_arena,
+      &other->_impl_.shortname_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.assetname_, lhs_arena,
+      &other->_impl_.assetname_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.assetdesc_, lhs_arena,
+      &other->_impl_.assetdesc_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.assetunit_, lhs_arena,
+      &other->_impl_.assetunit_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.decimals_, lhs_arena,
+      &other->_impl_.decimals_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.candyexpired_, lhs_arena,
+      &other->_impl_.candyexpired_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.remarks_, lhs_arena,
+      &other->_impl_.remarks_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(IssueData, _impl_.paycandy_)
+      + sizeof(IssueData::_impl_.paycandy_)
+      - PROTOBUF_FIELD_OFFSET(IssueData, _impl_.totalamount_)>(
+          reinterpret_cast<char*>(&_impl_.totalamount_),
+          reinterpret_cast<char*>(&other->_impl_.totalamount_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata IssueData::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_app_2eproto_getter, &descriptor_table_app_2eproto_once,
+      file_level_metadata_app_2eproto[3]);
+}
+
+// ===================================================================
+
+class CommonData::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CommonData>()._impl_._has_bits_);
+  static void set_has_version(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_assetid(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_amount(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_remarks(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x0000000f) ^ 0x0000000f) != 0;
+  }
+};
+
+CommonData::CommonData(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:App.CommonData)
+}
+CommonData::CommonData(const CommonData& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CommonData* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.version_){}
+    , decltype(_impl_.assetid_){}
+    , decltype(_impl_.remarks_){}
+    , decltype(_impl_.amount_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.version_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.version_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_version()) {
+    _this->_impl_.version_.Set(from._internal_version(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.assetid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.assetid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_assetid()) {
+    _this->_impl_.assetid_.Set(from._internal_assetid(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.remarks_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.remarks_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_remarks()) {
+    _this->_impl_.remarks_.Set(from._internal_remarks(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.amount_ = from._impl_.amount_;
+  // @@protoc_insertion_point(copy_constructor:App.CommonData)
+}
+
+inline void CommonData::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.version_){}
+    , decltype(_impl_.assetid_){}
+    , decltype(_impl_.remarks_){}
+    , decltype(_impl_.amount_){int64_t{0}}
+  };
+  _impl_.version_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.version_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.assetid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.assetid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.remarks_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.remarks_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+CommonData::~CommonData() {
+  // @@protoc_insertion_point(destructor:App.CommonData)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CommonData::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.version_.Destroy();
+  _impl_.assetid_.Destroy();
+  _impl_.remarks_.Destroy();
+}
+
+void CommonData::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CommonData::Clear() {
+// @@protoc_insertion_point(message_clear_start:App.CommonData)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.version_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.assetid_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _impl_.remarks_.ClearNonDefaultToEmpty();
+    }
+  }
+  _impl_.amount_ = int64_t{0};
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CommonData::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required bytes version = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_version();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required bytes assetId = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_assetid();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required int64 amount = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_amount(&has_bits);
+          _impl_.amount_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required bytes remarks = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_remarks();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CommonData::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:App.CommonData)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required bytes version = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->WriteBytesMaybeAliased(
+        1, this->_internal_version(), target);
+  }
+
+  // required bytes assetId = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->WriteBytesMaybeAliased(
+        2, this->_internal_assetid(), target);
+  }
+
+  // required int64 amount = 3;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(3, this->_internal_amount(), target);
+  }
+
+  // required bytes remarks = 4;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->WriteBytesMaybeAliased(
+        4, this->_internal_remarks(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:App.CommonData)
+  return target;
+}
+
+size_t CommonData::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:App.CommonData)
+  size_t total_size = 0;
+
+  if (_internal_has_version()) {
+    // required bytes version = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_version());
+  }
+
+  if (_internal_has_assetid()) {
+    // required bytes assetId = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_assetid());
+  }
+
+  if (_internal_has_remarks()) {
+    // required bytes remarks = 4;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_remarks());
+  }
+
+  if (_internal_has_amount()) {
+    // required int64 amount = 3;
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_amount());
+  }
+
+  return total_size;
+}
+size_t CommonData::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:App.CommonData)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x0000000f) ^ 0x0000000f) == 0) {  // All required fields are present.
+    // required bytes version = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_version());
+
+    // required bytes assetId = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_assetid());
+
+    // required bytes remarks = 4;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_remarks());
+
+    // required int64 amount = 3;
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_amount());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CommonData::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CommonData::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CommonData::GetClassData() const { return &_class_data_; }
+
+
+void CommonData::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CommonData*>(&to_msg);
+  auto& from = static_cast<const CommonData&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:App.CommonData)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_version(from._internal_version());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_assetid(from._internal_assetid());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_set_remarks(from._internal_remarks());
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.amount_ = from._impl_.amount_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CommonData::CopyFrom(const CommonData& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:App.CommonData)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CommonData::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void CommonData::InternalSwap(CommonData* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.version_, lhs_arena,
+      &other->_impl_.version_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.assetid_, lhs_arena,
+      &other->_impl_.assetid_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.remarks_, lhs_arena,
+      &other->_impl_.remarks_, rhs_arena
+  );
+  swap(_impl_.amount_, other->_impl_.amount_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CommonData::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_app_2eproto_getter, &descriptor_table_app_2eproto_once,
+      file_level_metadata_app_2eproto[4]);
+}
+
+// ===================================================================
+
+class PutCandyData::_Internal {
+ public:
+  using HasBits = decltype(std::declval<PutCandyData>()._impl_._has_bits_);
+  static void set_has_version(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_assetid(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_amount(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_expired(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_remarks(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x0000001f) ^ 0x0000001f) != 0;
+  }
+};
+
+PutCandyData::PutCandyData(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:App.PutCandyData)
+}
+PutCandyData::PutCandyData(const PutCandyData& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PutCandyData* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.version_){}
+    , decltype(_impl_.assetid_){}
+    , decltype(_impl_.expired_){}
+    , decltype(_impl_.remarks_){}
+    , decltype(_impl_.amount_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.version_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.version_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_version()) {
+    _this->_impl_.version_.Set(from._internal_version(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.assetid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.assetid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_assetid()) {
+    _this->_impl_.assetid_.Set(from._internal_assetid(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.expired_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.expired_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_expired()) {
+    _this->_impl_.expired_.Set(from._internal_expired(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.remarks_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.remarks_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_remarks()) {
+    _this->_impl_.remarks_.Set(from._internal_remarks(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.amount_ = from._impl_.amount_;
+  // @@protoc_insertion_point(copy_constructor:App.PutCandyData)
+}
+
+inline void PutCandyData::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.version_){}
+    , decltype(_impl_.assetid_){}
+    , decltype(_impl_.expired_){}
+    , decltype(_impl_.remarks_){}
+    , decltype(_impl_.amount_){int64_t{0}}
+  };
+  _impl_.version_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.version_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.assetid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.assetid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.expired_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.expired_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.remarks_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.remarks_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+PutCandyData::~PutCandyData() {
+  // @@protoc_insertion_point(destructor:App.PutCandyData)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void PutCandyData::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.version_.Destroy();
+  _impl_.assetid_.Destroy();
+  _impl_.expired_.Destroy();
+  _impl_.remarks_.Destroy();
+}
+
+void PutCandyData::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void PutCandyData::Clear() {
+// @@protoc_insertion_point(message_clear_start:App.PutCandyData)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.version_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.assetid_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _impl_.expired_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _impl_.remarks_.ClearNonDefaultToEmpty();
+    }
+  }
+  _impl_.amount_ = int64_t{0};
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PutCandyData::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required bytes version = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_version();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required bytes assetId = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_assetid();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required int64 amount = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_amount(&has_bits);
+          _impl_.amount_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required bytes expired = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_expired();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required bytes remarks = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          auto str = _internal_mutable_remarks();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* PutCandyData::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:App.PutCandyData)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required bytes version = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->WriteBytesMaybeAliased(
+        1, this->_internal_version(), target);
+  }
+
+  // required bytes assetId = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->WriteBytesMaybeAliased(
+        2, this->_internal_assetid(), target);
+  }
+
+  // required int64 amount = 3;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(3, this->_internal_amount(), target);
+  }
+
+  // required bytes expired = 4;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->WriteBytesMaybeAliased(
+        4, this->_internal_expired(), target);
+  }
+
+  // required bytes remarks = 5;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->WriteBytesMaybeAliased(
+        5, this->_internal_remarks(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:App.PutCandyData)
+  return target;
+}
+
+size_t PutCandyData::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:App.PutCandyData)
+  size_t total_size = 0;
+
+  if (_internal_has_version()) {
+    // required bytes version = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_version());
+  }
+
+  if (_internal_has_assetid()) {
+    // required bytes assetId = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_assetid());
+  }
+
+  if (_internal_has_expired()) {
+    // required bytes expired = 4;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_expired());
+  }
+
+  if (_internal_has_remarks()) {
+    // required bytes remarks = 5;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_remarks());
+  }
+
+  if (_internal_has_amount()) {
+    // required int64 amount = 3;
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_amount());
+  }
+
+  return total_size;
+}
+size_t PutCandyData::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:App.PutCandyData)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x0000001f) ^ 0x0000001f) == 0) {  // All required fields are present.
+    // required bytes version = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_version());
+
+    // required bytes assetId = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_assetid());
+
+    // required bytes expired = 4;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_expired());
+
+    // required bytes remarks = 5;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_remarks());
+
+    // required int64 amount = 3;
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_amount());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PutCandyData::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PutCandyData::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PutCandyData::GetClassData() const { return &_class_data_; }
+
+
+void PutCandyData::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PutCandyData*>(&to_msg);
+  auto& from = static_cast<const PutCandyData&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:App.PutCandyData)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_version(from._internal_version());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_assetid(from._internal_assetid());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_set_expired(from._internal_expired());
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_internal_set_remarks(from._internal_remarks());
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.amount_ = from._impl_.amount_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void PutCandyData::CopyFrom(const PutCandyData& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:App.PutCandyData)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PutCandyData::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void PutCandyData::InternalSwap(PutCandyData* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.version_, lhs_arena,
+      &other->_impl_.version_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.assetid_, lhs_arena,
+      &other->_impl_.assetid_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.expired_, lhs_arena,
+      &other->_impl_.expired_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.remarks_, lhs_arena,
+      &other->_impl_.remarks_, rhs_arena
+  );
+  swap(_impl_.amount_, other->_impl_.amount_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PutCandyData::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_app_2eproto_getter, &descriptor_table_app_2eproto_once,
+      file_level_metadata_app_2eproto[5]);
+}
+
+// ===================================================================
+
+class GetCandyData::_Internal {
+ public:
+  using HasBits = decltype(std::declval<GetCandyData>()._impl_._has_bits_);
+  static void set_has_version(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_assetid(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_amount(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_remarks(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x0000000f) ^ 0x0000000f) != 0;
+  }
+};
+
+GetCandyData::GetCandyData(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:App.GetCandyData)
+}
+GetCandyData::GetCandyData(const GetCandyData& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  GetCandyData* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.version_){}
+    , decltype(_impl_.assetid_){}
+    , decltype(_impl_.remarks_){}
+    , decltype(_impl_.amount_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.version_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.version_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_version()) {
+    _this->_impl_.version_.Set(from._internal_version(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.assetid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.assetid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_assetid()) {
+    _this->_impl_.assetid_.Set(from._internal_assetid(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.remarks_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.remarks_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_remarks()) {
+    _this->_impl_.remarks_.Set(from._internal_remarks(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.amount_ = from._impl_.amount_;
+  // @@protoc_insertion_point(copy_constructor:App.GetCandyData)
+}
+
+inline void GetCandyData::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.version_){}
+    , decltype(_impl_.assetid_){}
+    , decltype(_impl_.remarks_){}
+    , decltype(_impl_.amount_){int64_t{0}}
+  };
+  _impl_.version_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.version_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.assetid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.assetid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.remarks_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.remarks_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+GetCandyData::~GetCandyData() {
+  // @@protoc_insertion_point(destructor:App.GetCandyData)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void GetCandyData::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.version_.Destroy();
+  _impl_.assetid_.Destroy();
+  _impl_.remarks_.Destroy();
+}
+
+void GetCandyData::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void GetCandyData::Clear() {
+// @@protoc_insertion_point(message_clear_start:App.GetCandyData)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.version_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.assetid_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _impl_.remarks_.ClearNonDefaultToEmpty();
+    }
+  }
+  _impl_.amount_ = int64_t{0};
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* GetCandyData::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required bytes version = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_version();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required bytes assetId = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_assetid();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required int64 amount = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_amount(&has_bits);
+          _impl_.amount_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required bytes remarks = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_remarks();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* GetCandyData::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:App.GetCandyData)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required bytes version = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->WriteBytesMaybeAliased(
+        1, this->_internal_version(), target);
+  }
+
+  // required bytes assetId = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->WriteBytesMaybeAliased(
+        2, this->_internal_assetid(), target);
+  }
+
+  // required int64 amount = 3;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(3, this->_internal_amount(), target);
+  }
+
+  // required bytes remarks = 4;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->WriteBytesMaybeAliased(
+        4, this->_internal_remarks(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:App.GetCandyData)
+  return target;
+}
+
+size_t GetCandyData::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:App.GetCandyData)
+  size_t total_size = 0;
+
+  if (_internal_has_version()) {
+    // required bytes version = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_version());
+  }
+
+  if (_internal_has_assetid()) {
+    // required bytes assetId = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_assetid());
+  }
+
+  if (_internal_has_remarks()) {
+    // required bytes remarks = 4;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_remarks());
+  }
+
+  if (_internal_has_amount()) {
+    // required int64 amount = 3;
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_amount());
+  }
+
+  return total_size;
+}
+size_t GetCandyData::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:App.GetCandyData)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x0000000f) ^ 0x0000000f) == 0) {  // All required fields are present.
+    // required bytes version = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_version());
+
+    // required bytes assetId = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_assetid());
+
+    // required bytes remarks = 4;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_remarks());
+
+    // required int64 amount = 3;
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_amount());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GetCandyData::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    GetCandyData::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetCandyData::GetClassData() const { return &_class_data_; }
+
+
+void GetCandyData::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<GetCandyData*>(&to_msg);
+  auto& from = static_cast<const GetCandyData&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:App.GetCandyData)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_version(from._internal_version());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_assetid(from._internal_assetid());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_set_remarks(from._internal_remarks());
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.amount_ = from._impl_.amount_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void GetCandyData::CopyFrom(const GetCandyData& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:App.GetCandyData)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool GetCandyData::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void GetCandyData::InternalSwap(GetCandyData* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.version_, lhs_arena,
+      &other->_impl_.version_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.assetid_, lhs_arena,
+      &other->_impl_.assetid_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.remarks_, lhs_arena,
+      &other->_impl_.remarks_, rhs_arena
+  );
+  swap(_impl_.amount_, other->_impl_.amount_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata GetCandyData::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_app_2eproto_getter, &descriptor_table_app_2eproto_once,
+      file_level_metadata_app_2eproto[6]);
+}
+
+// ===================================================================
+
+class TransferSafeData::_Internal {
+ public:
+  using HasBits = decltype(std::declval<TransferSafeData>()._impl_._has_bits_);
+  static void set_has_version(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_remarks(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
+
+TransferSafeData::TransferSafeData(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:App.TransferSafeData)
+}
+TransferSafeData::TransferSafeData(const TransferSafeData& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  TransferSafeData* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.version_){}
+    , decltype(_impl_.remarks_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.version_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.version_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_version()) {
+    _this->_impl_.version_.Set(from._internal_version(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.remarks_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.remarks_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_remarks()) {
+    _this->_impl_.remarks_.Set(from._internal_remarks(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:App.TransferSafeData)
+}
+
+inline void TransferSafeData::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.version_){}
+    , decltype(_impl_.remarks_){}
+  };
+  _impl_.version_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.version_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.remarks_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.remarks_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+TransferSafeData::~TransferSafeData() {
+  // @@protoc_insertion_point(destructor:App.TransferSafeData)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void TransferSafeData::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.version_.Destroy();
+  _impl_.remarks_.Destroy();
+}
+
+void TransferSafeData::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void TransferSafeData::Clear() {
+// @@protoc_insertion_point(message_clear_start:App.TransferSafeData)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.version_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.remarks_.ClearNonDefaultToEmpty();
+    }
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* TransferSafeData::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required bytes version = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_version();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required bytes remarks = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_remarks();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* TransferSafeData::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:App.TransferSafeData)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required bytes version = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->WriteBytesMaybeAliased(
+        1, this->_internal_version(), target);
+  }
+
+  // required bytes remarks = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->WriteBytesMaybeAliased(
+        2, this->_internal_remarks(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:App.TransferSafeData)
+  return target;
+}
+
+size_t TransferSafeData::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:App.TransferSafeData)
+  size_t total_size = 0;
+
+  if (_internal_has_version()) {
+    // required bytes version = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_version());
+  }
+
+  if (_internal_has_remarks()) {
+    // required bytes remarks = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_remarks());
+  }
+
+  return total_size;
+}
+size_t TransferSafeData::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:App.TransferSafeData)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
+    // required bytes version = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_version());
+
+    // required bytes remarks = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_remarks());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData TransferSafeData::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    TransferSafeData::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*TransferSafeData::GetClassData() const { return &_class_data_; }
+
+
+void TransferSafeData::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<TransferSafeData*>(&to_msg);
+  auto& from = static_cast<const TransferSafeData&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:App.TransferSafeData)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_version(from._internal_version());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_remarks(from._internal_remarks());
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TransferSafeData::CopyFrom(const TransferSafeData& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:App.TransferSafeData)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TransferSafeData::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void TransferSafeData::InternalSwap(TransferSafeData* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.version_, lhs_arena,
+      &other->_impl_.version_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.remarks_, lhs_arena,
+      &other->_impl_.remarks_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata TransferSafeData::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_app_2eproto_getter, &descriptor_table_app_2eproto_once,
+      file_level_metadata_app_2eproto[7]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace App
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::App::RegisterData*
+Arena::CreateMaybeMessage< ::App::RegisterData >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::App::RegisterData >(arena);
+}
+template<> PROTOBUF_NOINLINE ::App::AuthData*
+Arena::CreateMaybeMessage< ::App::AuthData >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::App::AuthData >(arena);
+}
+template<> PROTOBUF_NOINLINE ::App::ExtendData*
+Arena::CreateMaybeMessage< ::App::ExtendData >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::App::ExtendData >(arena);
+}
+template<> PROTOBUF_NOINLINE ::App::IssueData*
+Arena::CreateMaybeMessage< ::App::IssueData >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::App::IssueData >(arena);
+}
+template<> PROTOBUF_NOINLINE ::App::CommonData*
+Arena::CreateMaybeMessage< ::App::CommonData >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::App::CommonData >(arena);
+}
+template<> PROTOBUF_NOINLINE ::App::PutCandyData*
+Arena::CreateMaybeMessage< ::App::PutCandyData >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::App::PutCandyData >(arena);
+}
+template<> PROTOBUF_NOINLINE ::App::GetCandyData*
+Arena::CreateMaybeMessage< ::App::GetCandyData >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::App::GetCandyData >(arena);
+}
+template<> PROTOBUF_NOINLINE ::App::TransferSafeData*
+Arena::CreateMaybeMessage< ::App::TransferSafeData >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::App::TransferSafeData >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
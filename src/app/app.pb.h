@@ -0,0 +1,4886 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: app.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_app_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_app_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_app_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_app_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_app_2eproto;
+namespace App {
+class AuthData;
+struct AuthDataDefaultTypeInternal;
+extern AuthDataDefaultTypeInternal _AuthData_default_instance_;
+class CommonData;
+struct CommonDataDefaultTypeInternal;
+extern CommonDataDefaultTypeInternal _CommonData_default_instance_;
+class ExtendData;
+struct ExtendDataDefaultTypeInternal;
+extern ExtendDataDefaultTypeInternal _ExtendData_default_instance_;
+class GetCandyData;
+struct GetCandyDataDefaultTypeInternal;
+extern GetCandyDataDefaultTypeInternal _GetCandyData_default_instance_;
+class IssueData;
+struct IssueDataDefaultTypeInternal;
+extern IssueDataDefaultTypeInternal _IssueData_default_instance_;
+class PutCandyData;
+struct PutCandyDataDefaultTypeInternal;
+extern PutCandyDataDefaultTypeInternal _PutCandyData_default_instance_;
+class RegisterData;
+struct RegisterDataDefaultTypeInternal;
+extern RegisterDataDefaultTypeInternal _RegisterData_default_instance_;
+class TransferSafeData;
+struct TransferSafeDataDefaultTypeInternal;
+extern TransferSafeDataDefaultTypeInternal _TransferSafeData_default_instance_;
+}  // namespace App
+PROTOBUF_NAMESPACE_OPEN
+template<> ::App::AuthData* Arena::CreateMaybeMessage<::App::AuthData>(Arena*);
+template<> ::App::CommonData* Arena::CreateMaybeMessage<::App::CommonData>(Arena*);
+template<> ::App::ExtendData* Arena::CreateMaybeMessage<::App::ExtendData>(Arena*);
+template<> ::App::GetCandyData* Arena::CreateMaybeMessage<::App::GetCandyData>(Arena*);
+template<> ::App::IssueData* Arena::CreateMaybeMessage<::App::IssueData>(Arena*);
+template<> ::App::PutCandyData* Arena::CreateMaybeMessage<::App::PutCandyData>(Arena*);
+template<> ::App::RegisterData* Arena::CreateMaybeMessage<::App::RegisterData>(Arena*);
+template<> ::App::TransferSafeData* Arena::CreateMaybeMessage<::App::TransferSafeData>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace App {
+
+// ===================================================================
+
+class RegisterData final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:App.RegisterData) */ {
+ public:
+  inline RegisterData() : RegisterData(nullptr) {}
+  ~RegisterData() override;
+  explicit PROTOBUF_CONSTEXPR RegisterData(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  RegisterData(const RegisterData& from);
+  RegisterData(RegisterData&& from) noexcept
+    : RegisterData() {
+    *this = ::std::move(from);
+  }
+
+  inline RegisterData& operator=(const RegisterData& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RegisterData& operator=(RegisterData&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RegisterData& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RegisterData* internal_default_instance() {
+    return reinterpret_cast<const RegisterData*>(
+               &_RegisterData_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(RegisterData& a, RegisterData& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RegisterData* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RegisterData* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  RegisterData* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RegisterData>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const RegisterData& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RegisterData& from) {
+    RegisterData::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(RegisterData* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "App.RegisterData";
+  }
+  protected:
+  explicit RegisterData(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kVersionFieldNumber = 1,
+    kAdminAddressFieldNumber = 2,
+    kAppNameFieldNumber = 3,
+    kAppDescFieldNumber = 4,
+    kDevTypeFieldNumber = 5,
+    kDevNameFieldNumber = 6,
+    kWebUrlFieldNumber = 7,
+    kLogoUrlFieldNumber = 8,
+    kCoverUrlFieldNumber = 9,
+  };
+  // required bytes version = 1;
+  bool has_version() const;
+  private:
+  bool _internal_has_version() const;
+  public:
+  void clear_version();
+  const std::string& version() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_version(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_version();
+  PROTOBUF_NODISCARD std::string* release_version();
+  void set_allocated_version(std::string* version);
+  private:
+  const std::string& _internal_version() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_version(const std::string& value);
+  std::string* _internal_mutable_version();
+  public:
+
+  // required bytes adminAddress = 2;
+  bool has_adminaddress() const;
+  private:
+  bool _internal_has_adminaddress() const;
+  public:
+  void clear_adminaddress();
+  const std::string& adminaddress() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_adminaddress(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_adminaddress();
+  PROTOBUF_NODISCARD std::string* release_adminaddress();
+  void set_allocated_adminaddress(std::string* adminaddress);
+  private:
+  const std::string& _internal_adminaddress() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_adminaddress(const std::string& value);
+  std::string* _internal_mutable_adminaddress();
+  public:
+
+  // required bytes appName = 3;
+  bool has_appname() const;
+  private:
+  bool _internal_has_appname() const;
+  public:
+  void clear_appname();
+  const std::string& appname() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_appname(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_appname();
+  PROTOBUF_NODISCARD std::string* release_appname();
+  void set_allocated_appname(std::string* appname);
+  private:
+  const std::string& _internal_appname() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_appname(const std::string& value);
+  std::string* _internal_mutable_appname();
+  public:
+
+  // required bytes appDesc = 4;
+  bool has_appdesc() const;
+  private:
+  bool _internal_has_appdesc() const;
+  public:
+  void clear_appdesc();
+  const std::string& appdesc() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_appdesc(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_appdesc();
+  PROTOBUF_NODISCARD std::string* release_appdesc();
+  void set_allocated_appdesc(std::string* appdesc);
+  private:
+  const std::string& _internal_appdesc() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_appdesc(const std::string& value);
+  std::string* _internal_mutable_appdesc();
+  public:
+
+  // required bytes devType = 5;
+  bool has_devtype() const;
+  private:
+  bool _internal_has_devtype() const;
+  public:
+  void clear_devtype();
+  const std::string& devtype() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_devtype(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_devtype();
+  PROTOBUF_NODISCARD std::string* release_devtype();
+  void set_allocated_devtype(std::string* devtype);
+  private:
+  const std::string& _internal_devtype() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_devtype(const std::string& value);
+  std::string* _internal_mutable_devtype();
+  public:
+
+  // required bytes devName = 6;
+  bool has_devname() const;
+  private:
+  bool _internal_has_devname() const;
+  public:
+  void clear_devname();
+  const std::string& devname() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_devname(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_devname();
+  PROTOBUF_NODISCARD std::string* release_devname();
+  void set_allocated_devname(std::string* devname);
+  private:
+  const std::string& _internal_devname() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_devname(const std::string& value);
+  std::string* _internal_mutable_devname();
+  public:
+
+  // required bytes webUrl = 7;
+  bool has_weburl() const;
+  private:
+  bool _internal_has_weburl() const;
+  public:
+  void clear_weburl();
+  const std::string& weburl() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_weburl(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_weburl();
+  PROTOBUF_NODISCARD std::string* release_weburl();
+  void set_allocated_weburl(std::string* weburl);
+  private:
+  const std::string& _internal_weburl() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_weburl(const std::string& value);
+  std::string* _internal_mutable_weburl();
+  public:
+
+  // required bytes logoUrl = 8;
+  bool has_logourl() const;
+  private:
+  bool _internal_has_logourl() const;
+  public:
+  void clear_logourl();
+  const std::string& logourl() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_logourl(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_logourl();
+  PROTOBUF_NODISCARD std::string* release_logourl();
+  void set_allocated_logourl(std::string* logourl);
+  private:
+  const std::string& _internal_logourl() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_logourl(const std::string& value);
+  std::string* _internal_mutable_logourl();
+  public:
+
+  // required bytes coverUrl = 9;
+  bool has_coverurl() const;
+  private:
+  bool _internal_has_coverurl() const;
+  public:
+  void clear_coverurl();
+  const std::string& coverurl() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_coverurl(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_coverurl();
+  PROTOBUF_NODISCARD std::string* release_coverurl();
+  void set_allocated_coverurl(std::string* coverurl);
+  private:
+  const std::string& _internal_coverurl() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_coverurl(const std::string& value);
+  std::string* _internal_mutable_coverurl();
+  public:
+
+  // @@protoc_insertion_point(class_scope:App.RegisterData)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr version_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr adminaddress_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr appname_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr appdesc_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr devtype_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr devname_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr weburl_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr logourl_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr coverurl_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_app_2eproto;
+};
+// -------------------------------------------------------------------
+
+class AuthData final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:App.AuthData) */ {
+ public:
+  inline AuthData() : AuthData(nullptr) {}
+  ~AuthData() override;
+  explicit PROTOBUF_CONSTEXPR AuthData(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  AuthData(const AuthData& from);
+  AuthData(AuthData&& from) noexcept
+    : AuthData() {
+    *this = ::std::move(from);
+  }
+
+  inline AuthData& operator=(const AuthData& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline AuthData& operator=(AuthData&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const AuthData& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const AuthData* internal_default_instance() {
+    return reinterpret_cast<const AuthData*>(
+               &_AuthData_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(AuthData& a, AuthData& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(AuthData* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(AuthData* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  AuthData* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<AuthData>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const AuthData& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const AuthData& from) {
+    AuthData::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(AuthData* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "App.AuthData";
+  }
+  protected:
+  explicit AuthData(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kVersionFieldNumber = 1,
+    kSetTypeFieldNumber = 2,
+    kAdminAddressFieldNumber = 3,
+    kUserAddressFieldNumber = 4,
+    kAuthFieldNumber = 5,
+  };
+  // required bytes version = 1;
+  bool has_version() const;
+  private:
+  bool _internal_has_version() const;
+  public:
+  void clear_version();
+  const std::string& version() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_version(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_version();
+  PROTOBUF_NODISCARD std::string* release_version();
+  void set_allocated_version(std::string* version);
+  private:
+  const std::string& _internal_version() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_version(const std::string& value);
+  std::string* _internal_mutable_version();
+  public:
+
+  // required bytes setType = 2;
+  bool has_settype() const;
+  private:
+  bool _internal_has_settype() const;
+  public:
+  void clear_settype();
+  const std::string& settype() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_settype(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_settype();
+  PROTOBUF_NODISCARD std::string* release_settype();
+  void set_allocated_settype(std::string* settype);
+  private:
+  const std::string& _internal_settype() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_settype(const std::string& value);
+  std::string* _internal_mutable_settype();
+  public:
+
+  // required bytes adminAddress = 3;
+  bool has_adminaddress() const;
+  private:
+  bool _internal_has_adminaddress() const;
+  public:
+  void clear_adminaddress();
+  const std::string& adminaddress() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_adminaddress(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_adminaddress();
+  PROTOBUF_NODISCARD std::string* release_adminaddress();
+  void set_allocated_adminaddress(std::string* adminaddress);
+  private:
+  const std::string& _internal_adminaddress() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_adminaddress(const std::string& value);
+  std::string* _internal_mutable_adminaddress();
+  public:
+
+  // required bytes userAddress = 4;
+  bool has_useraddress() const;
+  private:
+  bool _internal_has_useraddress() const;
+  public:
+  void clear_useraddress();
+  const std::string& useraddress() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_useraddress(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_useraddress();
+  PROTOBUF_NODISCARD std::string* release_useraddress();
+  void set_allocated_useraddress(std::string* useraddress);
+  private:
+  const std::string& _internal_useraddress() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_useraddress(const std::string& value);
+  std::string* _internal_mutable_useraddress();
+  public:
+
+  // required uint32 auth = 5;
+  bool has_auth() const;
+  private:
+  bool _internal_has_auth() const;
+  public:
+  void clear_auth();
+  uint32_t auth() const;
+  void set_auth(uint32_t value);
+  private:
+  uint32_t _internal_auth() const;
+  void _internal_set_auth(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:App.AuthData)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr version_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr settype_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr adminaddress_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr useraddress_;
+    uint32_t auth_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_app_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ExtendData final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:App.ExtendData) */ {
+ public:
+  inline ExtendData() : ExtendData(nullptr) {}
+  ~ExtendData() override;
+  explicit PROTOBUF_CONSTEXPR ExtendData(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ExtendData(const ExtendData& from);
+  ExtendData(ExtendData&& from) noexcept
+    : ExtendData() {
+    *this = ::std::move(from);
+  }
+
+  inline ExtendData& operator=(const ExtendData& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ExtendData& operator=(ExtendData&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ExtendData& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ExtendData* internal_default_instance() {
+    return reinterpret_cast<const ExtendData*>(
+               &_ExtendData_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(ExtendData& a, ExtendData& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ExtendData* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ExtendData* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ExtendData* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ExtendData>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ExtendData& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ExtendData& from) {
+    ExtendData::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ExtendData* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "App.ExtendData";
+  }
+  protected:
+  explicit ExtendData(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kVersionFieldNumber = 1,
+    kExtendDataFieldNumber = 3,
+    kAuthFieldNumber = 2,
+  };
+  // required bytes version = 1;
+  bool has_version() const;
+  private:
+  bool _internal_has_version() const;
+  public:
+  void clear_version();
+  const std::string& version() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_version(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_version();
+  PROTOBUF_NODISCARD std::string* release_version();
+  void set_allocated_version(std::string* version);
+  private:
+  const std::string& _internal_version() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_version(const std::string& value);
+  std::string* _internal_mutable_version();
+  public:
+
+  // required bytes extendData = 3;
+  bool has_extenddata() const;
+  private:
+  bool _internal_has_extenddata() const;
+  public:
+  void clear_extenddata();
+  const std::string& extenddata() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_extenddata(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_extenddata();
+  PROTOBUF_NODISCARD std::string* release_extenddata();
+  void set_allocated_extenddata(std::string* extenddata);
+  private:
+  const std::string& _internal_extenddata() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_extenddata(const std::string& value);
+  std::string* _internal_mutable_extenddata();
+  public:
+
+  // required uint32 auth = 2;
+  bool has_auth() const;
+  private:
+  bool _internal_has_auth() const;
+  public:
+  void clear_auth();
+  uint32_t auth() const;
+  void set_auth(uint32_t value);
+  private:
+  uint32_t _internal_auth() const;
+  void _internal_set_auth(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:App.ExtendData)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr version_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr extenddata_;
+    uint32_t auth_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_app_2eproto;
+};
+// -------------------------------------------------------------------
+
+class IssueData final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:App.IssueData) */ {
+ public:
+  inline IssueData() : IssueData(nullptr) {}
+  ~IssueData() override;
+  explicit PROTOBUF_CONSTEXPR IssueData(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  IssueData(const IssueData& from);
+  IssueData(IssueData&& from) noexcept
+    : IssueData() {
+    *this = ::std::move(from);
+  }
+
+  inline IssueData& operator=(const IssueData& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline IssueData& operator=(IssueData&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const IssueData& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const IssueData* internal_default_instance() {
+    return reinterpret_cast<const IssueData*>(
+               &_IssueData_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(IssueData& a, IssueData& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(IssueData* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(IssueData* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  IssueData* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<IssueData>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const IssueData& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const IssueData& from) {
+    IssueData::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(IssueData* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "App.IssueData";
+  }
+  protected:
+  explicit IssueData(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kVersionFieldNumber = 1,
+    kShortNameFieldNumber = 2,
+    kAssetNameFieldNumber = 3,
+    kAssetDescFieldNumber = 4,
+    kAssetUnitFieldNumber = 5,
+    kDecimalsFieldNumber = 9,
+    kCandyExpiredFieldNumber = 13,
+    kRemarksFieldNumber = 14,
+    kTotalAmountFieldNumber = 6,
+    kFirstIssueAmountFieldNumber = 7,
+    kFirstActualAmountFieldNumber = 8,
+    kCandyAmountFieldNumber = 12,
+    kDestoryFieldNumber = 10,
+    kPayCandyFieldNumber = 11,
+  };
+  // required bytes version = 1;
+  bool has_version() const;
+  private:
+  bool _internal_has_version() const;
+  public:
+  void clear_version();
+  const std::string& version() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_version(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_version();
+  PROTOBUF_NODISCARD std::string* release_version();
+  void set_allocated_version(std::string* version);
+  private:
+  const std::string& _internal_version() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_version(const std::string& value);
+  std::string* _internal_mutable_version();
+  public:
+
+  // required bytes shortName = 2;
+  bool has_shortname() const;
+  private:
+  bool _internal_has_shortname() const;
+  public:
+  void clear_shortname();
+  const std::string& shortname() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_shortname(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_shortname();
+  PROTOBUF_NODISCARD std::string* release_shortname();
+  void set_allocated_shortname(std::string* shortname);
+  private:
+  const std::string& _internal_shortname() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_shortname(const std::string& value);
+  std::string* _internal_mutable_shortname();
+  public:
+
+  // required bytes assetName = 3;
+  bool has_assetname() const;
+  private:
+  bool _internal_has_assetname() const;
+  public:
+  void clear_assetname();
+  const std::string& assetname() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_assetname(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_assetname();
+  PROTOBUF_NODISCARD std::string* release_assetname();
+  void set_allocated_assetname(std::string* assetname);
+  private:
+  const std::string& _internal_assetname() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_assetname(const std::string& value);
+  std::string* _internal_mutable_assetname();
+  public:
+
+  // required bytes assetDesc = 4;
+  bool has_assetdesc() const;
+  private:
+  bool _internal_has_assetdesc() const;
+  public:
+  void clear_assetdesc();
+  const std::string& assetdesc() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_assetdesc(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_assetdesc();
+  PROTOBUF_NODISCARD std::string* release_assetdesc();
+  void set_allocated_assetdesc(std::string* assetdesc);
+  private:
+  const std::string& _internal_assetdesc() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_assetdesc(const std::string& value);
+  std::string* _internal_mutable_assetdesc();
+  public:
+
+  // required bytes assetUnit = 5;
+  bool has_assetunit() const;
+  private:
+  bool _internal_has_assetunit() const;
+  public:
+  void clear_assetunit();
+  const std::string& assetunit() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_assetunit(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_assetunit();
+  PROTOBUF_NODISCARD std::string* release_assetunit();
+  void set_allocated_assetunit(std::string* assetunit);
+  private:
+  const std::string& _internal_assetunit() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_assetunit(const std::string& value);
+  std::string* _internal_mutable_assetunit();
+  public:
+
+  // required bytes decimals = 9;
+  bool has_decimals() const;
+  private:
+  bool _internal_has_decimals() const;
+  public:
+  void clear_decimals();
+  const std::string& decimals() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_decimals(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_decimals();
+  PROTOBUF_NODISCARD std::string* release_decimals();
+  void set_allocated_decimals(std::string* decimals);
+  private:
+  const std::string& _internal_decimals() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_decimals(const std::string& value);
+  std::string* _internal_mutable_decimals();
+  public:
+
+  // required bytes candyExpired = 13;
+  bool has_candyexpired() const;
+  private:
+  bool _internal_has_candyexpired() const;
+  public:
+  void clear_candyexpired();
+  const std::string& candyexpired() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_candyexpired(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_candyexpired();
+  PROTOBUF_NODISCARD std::string* release_candyexpired();
+  void set_allocated_candyexpired(std::string* candyexpired);
+  private:
+  const std::string& _internal_candyexpired() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_candyexpired(const std::string& value);
+  std::string* _internal_mutable_candyexpired();
+  public:
+
+  // required bytes remarks = 14;
+  bool has_remarks() const;
+  private:
+  bool _internal_has_remarks() const;
+  public:
+  void clear_remarks();
+  const std::string& remarks() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_remarks(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_remarks();
+  PROTOBUF_NODISCARD std::string* release_remarks();
+  void set_allocated_remarks(std::string* remarks);
+  private:
+  const std::string& _internal_remarks() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_remarks(const std::string& value);
+  std::string* _internal_mutable_remarks();
+  public:
+
+  // required int64 totalAmount = 6;
+  bool has_totalamount() const;
+  private:
+  bool _internal_has_totalamount() const;
+  public:
+  void clear_totalamount();
+  int64_t totalamount() const;
+  void set_totalamount(int64_t value);
+  private:
+  int64_t _internal_totalamount() const;
+  void _internal_set_totalamount(int64_t value);
+  public:
+
+  // required int64 firstIssueAmount = 7;
+  bool has_firstissueamount() const;
+  private:
+  bool _internal_has_firstissueamount() const;
+  public:
+  void clear_firstissueamount();
+  int64_t firstissueamount() const;
+  void set_firstissueamount(int64_t value);
+  private:
+  int64_t _internal_firstissueamount() const;
+  void _internal_set_firstissueamount(int64_t value);
+  public:
+
+  // required int64 firstActualAmount = 8;
+  bool has_firstactualamount() const;
+  private:
+  bool _internal_has_firstactualamount() const;
+  public:
+  void clear_firstactualamount();
+  int64_t firstactualamount() const;
+  void set_firstactualamount(int64_t value);
+  private:
+  int64_t _internal_firstactualamount() const;
+  void _internal_set_firstactualamount(int64_t value);
+  public:
+
+  // required int64 candyAmount = 12;
+  bool has_candyamount() const;
+  private:
+  bool _internal_has_candyamount() const;
+  public:
+  void clear_candyamount();
+  int64_t candyamount() const;
+  void set_candyamount(int64_t value);
+  private:
+  int64_t _internal_candyamount() const;
+  void _internal_set_candyamount(int64_t value);
+  public:
+
+  // required bool destory = 10;
+  bool has_destory() const;
+  private:
+  bool _internal_has_destory() const;
+  public:
+  void clear_destory();
+  bool destory() const;
+  void set_destory(bool value);
+  private:
+  bool _internal_destory() const;
+  void _internal_set_destory(bool value);
+  public:
+
+  // required bool payCandy = 11;
+  bool has_paycandy() const;
+  private:
+  bool _internal_has_paycandy() const;
+  public:
+  void clear_paycandy();
+  bool paycandy() const;
+  void set_paycandy(bool value);
+  private:
+  bool _internal_paycandy() const;
+  void _internal_set_paycandy(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:App.IssueData)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr version_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr shortname_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr assetname_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr assetdesc_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr assetunit_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr decimals_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr candyexpired_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr remarks_;
+    int64_t totalamount_;
+    int64_t firstissueamount_;
+    int64_t firstactualamount_;
+    int64_t candyamount_;
+    bool destory_;
+    bool paycandy_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_app_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CommonData final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:App.CommonData) */ {
+ public:
+  inline CommonData() : CommonData(nullptr) {}
+  ~CommonData() override;
+  explicit PROTOBUF_CONSTEXPR CommonData(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CommonData(const CommonData& from);
+  CommonData(CommonData&& from) noexcept
+    : CommonData() {
+    *this = ::std::move(from);
+  }
+
+  inline CommonData& operator=(const CommonData& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CommonData& operator=(CommonData&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CommonData& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CommonData* internal_default_instance() {
+    return reinterpret_cast<const CommonData*>(
+               &_CommonData_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
+
+  friend void swap(CommonData& a, CommonData& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CommonData* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CommonData* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CommonData* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CommonData>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CommonData& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CommonData& from) {
+    CommonData::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CommonData* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "App.CommonData";
+  }
+  protected:
+  explicit CommonData(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kVersionFieldNumber = 1,
+    kAssetIdFieldNumber = 2,
+    kRemarksFieldNumber = 4,
+    kAmountFieldNumber = 3,
+  };
+  // required bytes version = 1;
+  bool has_version() const;
+  private:
+  bool _internal_has_version() const;
+  public:
+  void clear_version();
+  const std::string& version() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_version(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_version();
+  PROTOBUF_NODISCARD std::string* release_version();
+  void set_allocated_version(std::string* version);
+  private:
+  const std::string& _internal_version() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_version(const std::string& value);
+  std::string* _internal_mutable_version();
+  public:
+
+  // required bytes assetId = 2;
+  bool has_assetid() const;
+  private:
+  bool _internal_has_assetid() const;
+  public:
+  void clear_assetid();
+  const std::string& assetid() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_assetid(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_assetid();
+  PROTOBUF_NODISCARD std::string* release_assetid();
+  void set_allocated_assetid(std::string* assetid);
+  private:
+  const std::string& _internal_assetid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_assetid(const std::string& value);
+  std::string* _internal_mutable_assetid();
+  public:
+
+  // required bytes remarks = 4;
+  bool has_remarks() const;
+  private:
+  bool _internal_has_remarks() const;
+  public:
+  void clear_remarks();
+  const std::string& remarks() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_remarks(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_remarks();
+  PROTOBUF_NODISCARD std::string* release_remarks();
+  void set_allocated_remarks(std::string* remarks);
+  private:
+  const std::string& _internal_remarks() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_remarks(const std::string& value);
+  std::string* _internal_mutable_remarks();
+  public:
+
+  // required int64 amount = 3;
+  bool has_amount() const;
+  private:
+  bool _internal_has_amount() const;
+  public:
+  void clear_amount();
+  int64_t amount() const;
+  void set_amount(int64_t value);
+  private:
+  int64_t _internal_amount() const;
+  void _internal_set_amount(int64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:App.CommonData)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr version_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr assetid_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr remarks_;
+    int64_t amount_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_app_2eproto;
+};
+// -------------------------------------------------------------------
+
+class PutCandyData final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:App.PutCandyData) */ {
+ public:
+  inline PutCandyData() : PutCandyData(nullptr) {}
+  ~PutCandyData() override;
+  explicit PROTOBUF_CONSTEXPR PutCandyData(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PutCandyData(const PutCandyData& from);
+  PutCandyData(PutCandyData&& from) noexcept
+    : PutCandyData() {
+    *this = ::std::move(from);
+  }
+
+  inline PutCandyData& operator=(const PutCandyData& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PutCandyData& operator=(PutCandyData&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PutCandyData& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PutCandyData* internal_default_instance() {
+    return reinterpret_cast<const PutCandyData*>(
+               &_PutCandyData_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    5;
+
+  friend void swap(PutCandyData& a, PutCandyData& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PutCandyData* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PutCandyData* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PutCandyData* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PutCandyData>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PutCandyData& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PutCandyData& from) {
+    PutCandyData::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PutCandyData* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "App.PutCandyData";
+  }
+  protected:
+  explicit PutCandyData(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kVersionFieldNumber = 1,
+    kAssetIdFieldNumber = 2,
+    kExpiredFieldNumber = 4,
+    kRemarksFieldNumber = 5,
+    kAmountFieldNumber = 3,
+  };
+  // required bytes version = 1;
+  bool has_version() const;
+  private:
+  bool _internal_has_version() const;
+  public:
+  void clear_version();
+  const std::string& version() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_version(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_version();
+  PROTOBUF_NODISCARD std::string* release_version();
+  void set_allocated_version(std::string* version);
+  private:
+  const std::string& _internal_version() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_version(const std::string& value);
+  std::string* _internal_mutable_version();
+  public:
+
+  // required bytes assetId = 2;
+  bool has_assetid() const;
+  private:
+  bool _internal_has_assetid() const;
+  public:
+  void clear_assetid();
+  const std::string& assetid() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_assetid(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_assetid();
+  PROTOBUF_NODISCARD std::string* release_assetid();
+  void set_allocated_assetid(std::string* assetid);
+  private:
+  const std::string& _internal_assetid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_assetid(const std::string& value);
+  std::string* _internal_mutable_assetid();
+  public:
+
+  // required bytes expired = 4;
+  bool has_expired() const;
+  private:
+  bool _internal_has_expired() const;
+  public:
+  void clear_expired();
+  const std::string& expired() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_expired(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_expired();
+  PROTOBUF_NODISCARD std::string* release_expired();
+  void set_allocated_expired(std::string* expired);
+  private:
+  const std::string& _internal_expired() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_expired(const std::string& value);
+  std::string* _internal_mutable_expired();
+  public:
+
+  // required bytes remarks = 5;
+  bool has_remarks() const;
+  private:
+  bool _internal_has_remarks() const;
+  public:
+  void clear_remarks();
+  const std::string& remarks() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_remarks(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_remarks();
+  PROTOBUF_NODISCARD std::string* release_remarks();
+  void set_allocated_remarks(std::string* remarks);
+  private:
+  const std::string& _internal_remarks() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_remarks(const std::string& value);
+  std::string* _internal_mutable_remarks();
+  public:
+
+  // required int64 amount = 3;
+  bool has_amount() const;
+  private:
+  bool _internal_has_amount() const;
+  public:
+  void clear_amount();
+  int64_t amount() const;
+  void set_amount(int64_t value);
+  private:
+  int64_t _internal_amount() const;
+  void _internal_set_amount(int64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:App.PutCandyData)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr version_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr assetid_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr expired_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr remarks_;
+    int64_t amount_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_app_2eproto;
+};
+// -------------------------------------------------------------------
+
+class GetCandyData final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:App.GetCandyData) */ {
+ public:
+  inline GetCandyData() : GetCandyData(nullptr) {}
+  ~GetCandyData() override;
+  explicit PROTOBUF_CONSTEXPR GetCandyData(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  GetCandyData(const GetCandyData& from);
+  GetCandyData(GetCandyData&& from) noexcept
+    : GetCandyData() {
+    *this = ::std::move(from);
+  }
+
+  inline GetCandyData& operator=(const GetCandyData& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline GetCandyData& operator=(GetCandyData&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GetCandyData& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const GetCandyData* internal_default_instance() {
+    return reinterpret_cast<const GetCandyData*>(
+               &_GetCandyData_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    6;
+
+  friend void swap(GetCandyData& a, GetCandyData& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(GetCandyData* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GetCandyData* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  GetCandyData* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<GetCandyData>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const GetCandyData& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GetCandyData& from) {
+    GetCandyData::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(GetCandyData* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "App.GetCandyData";
+  }
+  protected:
+  explicit GetCandyData(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kVersionFieldNumber = 1,
+    kAssetIdFieldNumber = 2,
+    kRemarksFieldNumber = 4,
+    kAmountFieldNumber = 3,
+  };
+  // required bytes version = 1;
+  bool has_version() const;
+  private:
+  bool _internal_has_version() const;
+  public:
+  void clear_version();
+  const std::string& version() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_version(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_version();
+  PROTOBUF_NODISCARD std::string* release_version();
+  void set_allocated_version(std::string* version);
+  private:
+  const std::string& _internal_version() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_version(const std::string& value);
+  std::string* _internal_mutable_version();
+  public:
+
+  // required bytes assetId = 2;
+  bool has_assetid() const;
+  private:
+  bool _internal_has_assetid() const;
+  public:
+  void clear_assetid();
+  const std::string& assetid() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_assetid(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_assetid();
+  PROTOBUF_NODISCARD std::string* release_assetid();
+  void set_allocated_assetid(std::string* assetid);
+  private:
+  const std::string& _internal_assetid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_assetid(const std::string& value);
+  std::string* _internal_mutable_assetid();
+  public:
+
+  // required bytes remarks = 4;
+  bool has_remarks() const;
+  private:
+  bool _internal_has_remarks() const;
+  public:
+  void clear_remarks();
+  const std::string& remarks() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_remarks(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_remarks();
+  PROTOBUF_NODISCARD std::string* release_remarks();
+  void set_allocated_remarks(std::string* remarks);
+  private:
+  const std::string& _internal_remarks() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_remarks(const std::string& value);
+  std::string* _internal_mutable_remarks();
+  public:
+
+  // required int64 amount = 3;
+  bool has_amount() const;
+  private:
+  bool _internal_has_amount() const;
+  public:
+  void clear_amount();
+  int64_t amount() const;
+  void set_amount(int64_t value);
+  private:
+  int64_t _internal_amount() const;
+  void _internal_set_amount(int64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:App.GetCandyData)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr version_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr assetid_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr remarks_;
+    int64_t amount_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_app_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TransferSafeData final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:App.TransferSafeData) */ {
+ public:
+  inline TransferSafeData() : TransferSafeData(nullptr) {}
+  ~TransferSafeData() override;
+  explicit PROTOBUF_CONSTEXPR TransferSafeData(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  TransferSafeData(const TransferSafeData& from);
+  TransferSafeData(TransferSafeData&& from) noexcept
+    : TransferSafeData() {
+    *this = ::std::move(from);
+  }
+
+  inline TransferSafeData& operator=(const TransferSafeData& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TransferSafeData& operator=(TransferSafeData&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TransferSafeData& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TransferSafeData* internal_default_instance() {
+    return reinterpret_cast<const TransferSafeData*>(
+               &_TransferSafeData_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    7;
+
+  friend void swap(TransferSafeData& a, TransferSafeData& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TransferSafeData* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TransferSafeData* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TransferSafeData* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TransferSafeData>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const TransferSafeData& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TransferSafeData& from) {
+    TransferSafeData::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TransferSafeData* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "App.TransferSafeData";
+  }
+  protected:
+  explicit TransferSafeData(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kVersionFieldNumber = 1,
+    kRemarksFieldNumber = 2,
+  };
+  // required bytes version = 1;
+  bool has_version() const;
+  private:
+  bool _internal_has_version() const;
+  public:
+  void clear_version();
+  const std::string& version() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_version(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_version();
+  PROTOBUF_NODISCARD std::string* release_version();
+  void set_allocated_version(std::string* version);
+  private:
+  const std::string& _internal_version() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_version(const std::string& value);
+  std::string* _internal_mutable_version();
+  public:
+
+  // required bytes remarks = 2;
+  bool has_remarks() const;
+  private:
+  bool _internal_has_remarks() const;
+  public:
+  void clear_remarks();
+  const std::string& remarks() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_remarks(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_remarks();
+  PROTOBUF_NODISCARD std::string* release_remarks();
+  void set_allocated_remarks(std::string* remarks);
+  private:
+  const std::string& _internal_remarks() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_remarks(const std::string& value);
+  std::string* _internal_mutable_remarks();
+  public:
+
+  // @@protoc_insertion_point(class_scope:App.TransferSafeData)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr version_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr remarks_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_app_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// RegisterData
+
+// required bytes version = 1;
+inline bool RegisterData::_internal_has_version() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool RegisterData::has_version() const {
+  return _internal_has_version();
+}
+inline void RegisterData::clear_version() {
+  _impl_.version_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& RegisterData::version() const {
+  // @@protoc_insertion_point(field_get:App.RegisterData.version)
+  return _internal_version();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RegisterData::set_version(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.version_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:App.RegisterData.version)
+}
+inline std::string* RegisterData::mutable_version() {
+  std::string* _s = _internal_mutable_version();
+  // @@protoc_insertion_point(field_mutable:App.RegisterData.version)
+  return _s;
+}
+inline const std::string& RegisterData::_internal_version() const {
+  return _impl_.version_.Get();
+}
+inline void RegisterData::_internal_set_version(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.version_.Set(value, GetArenaForAllocation());
+}
+inline std::string* RegisterData::_internal_mutable_version() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.version_.Mutable(GetArenaForAllocation());
+}
+inline std::string* RegisterData::release_version() {
+  // @@protoc_insertion_point(field_release:App.RegisterData.version)
+  if (!_internal_has_version()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.version_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.version_.IsDefault()) {
+    _impl_.version_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void RegisterData::set_allocated_version(std::string* version) {
+  if (version != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.version_.SetAllocated(version, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.version_.IsDefault()) {
+    _impl_.version_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:App.RegisterData.version)
+}
+
+// required bytes adminAddress = 2;
+inline bool RegisterData::_internal_has_adminaddress() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool RegisterData::has_adminaddress() const {
+  return _internal_has_adminaddress();
+}
+inline void RegisterData::clear_adminaddress() {
+  _impl_.adminaddress_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& RegisterData::adminaddress() const {
+  // @@protoc_insertion_point(field_get:App.RegisterData.adminAddress)
+  return _internal_adminaddress();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RegisterData::set_adminaddress(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.adminaddress_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:App.RegisterData.adminAddress)
+}
+inline std::string* RegisterData::mutable_adminaddress() {
+  std::string* _s = _internal_mutable_adminaddress();
+  // @@protoc_insertion_point(field_mutable:App.RegisterData.adminAddress)
+  return _s;
+}
+inline const std::string& RegisterData::_internal_adminaddress() const {
+  return _impl_.adminaddress_.Get();
+}
+inline void RegisterData::_internal_set_adminaddress(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.adminaddress_.Set(value, GetArenaForAllocation());
+}
+inline std::string* RegisterData::_internal_mutable_adminaddress() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.adminaddress_.Mutable(GetArenaForAllocation());
+}
+inline std::string* RegisterData::release_adminaddress() {
+  // @@protoc_insertion_point(field_release:App.RegisterData.adminAddress)
+  if (!_internal_has_adminaddress()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.adminaddress_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.adminaddress_.IsDefault()) {
+    _impl_.adminaddress_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void RegisterData::set_allocated_adminaddress(std::string* adminaddress) {
+  if (adminaddress != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.adminaddress_.SetAllocated(adminaddress, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.adminaddress_.IsDefault()) {
+    _impl_.adminaddress_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:App.RegisterData.adminAddress)
+}
+
+// required bytes appName = 3;
+inline bool RegisterData::_internal_has_appname() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool RegisterData::has_appname() const {
+  return _internal_has_appname();
+}
+inline void RegisterData::clear_appname() {
+  _impl_.appname_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const std::string& RegisterData::appname() const {
+  // @@protoc_insertion_point(field_get:App.RegisterData.appName)
+  return _internal_appname();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RegisterData::set_appname(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000004u;
+ _impl_.appname_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:App.RegisterData.appName)
+}
+inline std::string* RegisterData::mutable_appname() {
+  std::string* _s = _internal_mutable_appname();
+  // @@protoc_insertion_point(field_mutable:App.RegisterData.appName)
+  return _s;
+}
+inline const std::string& RegisterData::_internal_appname() const {
+  return _impl_.appname_.Get();
+}
+inline void RegisterData::_internal_set_appname(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.appname_.Set(value, GetArenaForAllocation());
+}
+inline std::string* RegisterData::_internal_mutable_appname() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  return _impl_.appname_.Mutable(GetArenaForAllocation());
+}
+inline std::string* RegisterData::release_appname() {
+  // @@protoc_insertion_point(field_release:App.RegisterData.appName)
+  if (!_internal_has_appname()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  auto* p = _impl_.appname_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.appname_.IsDefault()) {
+    _impl_.appname_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void RegisterData::set_allocated_appname(std::string* appname) {
+  if (appname != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.appname_.SetAllocated(appname, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.appname_.IsDefault()) {
+    _impl_.appname_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:App.RegisterData.appName)
+}
+
+// required bytes appDesc = 4;
+inline bool RegisterData::_internal_has_appdesc() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool RegisterData::has_appdesc() const {
+  return _internal_has_appdesc();
+}
+inline void RegisterData::clear_appdesc() {
+  _impl_.appdesc_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline const std::string& RegisterData::appdesc() const {
+  // @@protoc_insertion_point(field_get:App.RegisterData.appDesc)
+  return _internal_appdesc();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RegisterData::set_appdesc(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000008u;
+ _impl_.appdesc_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:App.RegisterData.appDesc)
+}
+inline std::string* RegisterData::mutable_appdesc() {
+  std::string* _s = _internal_mutable_appdesc();
+  // @@protoc_insertion_point(field_mutable:App.RegisterData.appDesc)
+  return _s;
+}
+inline const std::string& RegisterData::_internal_appdesc() const {
+  return _impl_.appdesc_.Get();
+}
+inline void RegisterData::_internal_set_appdesc(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.appdesc_.Set(value, GetArenaForAllocation());
+}
+inline std::string* RegisterData::_internal_mutable_appdesc() {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  return _impl_.appdesc_.Mutable(GetArenaForAllocation());
+}
+inline std::string* RegisterData::release_appdesc() {
+  // @@protoc_insertion_point(field_release:App.RegisterData.appDesc)
+  if (!_internal_has_appdesc()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  auto* p = _impl_.appdesc_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.appdesc_.IsDefault()) {
+    _impl_.appdesc_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void RegisterData::set_allocated_appdesc(std::string* appdesc) {
+  if (appdesc != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  _impl_.appdesc_.SetAllocated(appdesc, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.appdesc_.IsDefault()) {
+    _impl_.appdesc_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:App.RegisterData.appDesc)
+}
+
+// required bytes devType = 5;
+inline bool RegisterData::_internal_has_devtype() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool RegisterData::has_devtype() const {
+  return _internal_has_devtype();
+}
+inline void RegisterData::clear_devtype() {
+  _impl_.devtype_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline const std::string& RegisterData::devtype() const {
+  // @@protoc_insertion_point(field_get:App.RegisterData.devType)
+  return _internal_devtype();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RegisterData::set_devtype(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000010u;
+ _impl_.devtype_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:App.RegisterData.devType)
+}
+inline std::string* RegisterData::mutable_devtype() {
+  std::string* _s = _internal_mutable_devtype();
+  // @@protoc_insertion_point(field_mutable:App.RegisterData.devType)
+  return _s;
+}
+inline const std::string& RegisterData::_internal_devtype() const {
+  return _impl_.devtype_.Get();
+}
+inline void RegisterData::_internal_set_devtype(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.devtype_.Set(value, GetArenaForAllocation());
+}
+inline std::string* RegisterData::_internal_mutable_devtype() {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  return _impl_.devtype_.Mutable(GetArenaForAllocation());
+}
+inline std::string* RegisterData::release_devtype() {
+  // @@protoc_insertion_point(field_release:App.RegisterData.devType)
+  if (!_internal_has_devtype()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000010u;
+  auto* p = _impl_.devtype_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.devtype_.IsDefault()) {
+    _impl_.devtype_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void RegisterData::set_allocated_devtype(std::string* devtype) {
+  if (devtype != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000010u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000010u;
+  }
+  _impl_.devtype_.SetAllocated(devtype, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.devtype_.IsDefault()) {
+    _impl_.devtype_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:App.RegisterData.devType)
+}
+
+// required bytes devName = 6;
+inline bool RegisterData::_internal_has_devname() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool RegisterData::has_devname() const {
+  return _internal_has_devname();
+}
+inline void RegisterData::clear_devname() {
+  _impl_.devname_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline const std::string& RegisterData::devname() const {
+  // @@protoc_insertion_point(field_get:App.RegisterData.devName)
+  return _internal_devname();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RegisterData::set_devname(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000020u;
+ _impl_.devname_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:App.RegisterData.devName)
+}
+inline std::string* RegisterData::mutable_devname() {
+  std::string* _s = _internal_mutable_devname();
+  // @@protoc_insertion_point(field_mutable:App.RegisterData.devName)
+  return _s;
+}
+inline const std::string& RegisterData::_internal_devname() const {
+  return _impl_.devname_.Get();
+}
+inline void RegisterData::_internal_set_devname(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.devname_.Set(value, GetArenaForAllocation());
+}
+inline std::string* RegisterData::_internal_mutable_devname() {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  return _impl_.devname_.Mutable(GetArenaForAllocation());
+}
+inline std::string* RegisterData::release_devname() {
+  // @@protoc_insertion_point(field_release:App.RegisterData.devName)
+  if (!_internal_has_devname()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000020u;
+  auto* p = _impl_.devname_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.devname_.IsDefault()) {
+    _impl_.devname_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void RegisterData::set_allocated_devname(std::string* devname) {
+  if (devname != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000020u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000020u;
+  }
+  _impl_.devname_.SetAllocated(devname, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.devname_.IsDefault()) {
+    _impl_.devname_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:App.RegisterData.devName)
+}
+
+// required bytes webUrl = 7;
+inline bool RegisterData::_internal_has_weburl() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool RegisterData::has_weburl() const {
+  return _internal_has_weburl();
+}
+inline void RegisterData::clear_weburl() {
+  _impl_.weburl_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline const std::string& RegisterData::weburl() const {
+  // @@protoc_insertion_point(field_get:App.RegisterData.webUrl)
+  return _internal_weburl();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RegisterData::set_weburl(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000040u;
+ _impl_.weburl_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:App.RegisterData.webUrl)
+}
+inline std::string* RegisterData::mutable_weburl() {
+  std::string* _s = _internal_mutable_weburl();
+  // @@protoc_insertion_point(field_mutable:App.RegisterData.webUrl)
+  return _s;
+}
+inline const std::string& RegisterData::_internal_weburl() const {
+  return _impl_.weburl_.Get();
+}
+inline void RegisterData::_internal_set_weburl(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.weburl_.Set(value, GetArenaForAllocation());
+}
+inline std::string* RegisterData::_internal_mutable_weburl() {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  return _impl_.weburl_.Mutable(GetArenaForAllocation());
+}
+inline std::string* RegisterData::release_weburl() {
+  // @@protoc_insertion_point(field_release:App.RegisterData.webUrl)
+  if (!_internal_has_weburl()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000040u;
+  auto* p = _impl_.weburl_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.weburl_.IsDefault()) {
+    _impl_.weburl_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void RegisterData::set_allocated_weburl(std::string* weburl) {
+  if (weburl != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000040u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000040u;
+  }
+  _impl_.weburl_.SetAllocated(weburl, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.weburl_.IsDefault()) {
+    _impl_.weburl_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:App.RegisterData.webUrl)
+}
+
+// required bytes logoUrl = 8;
+inline bool RegisterData::_internal_has_logourl() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  return value;
+}
+inline bool RegisterData::has_logourl() const {
+  return _internal_has_logourl();
+}
+inline void RegisterData::clear_logourl() {
+  _impl_.logourl_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline const std::string& RegisterData::logourl() const {
+  // @@protoc_insertion_point(field_get:App.RegisterData.logoUrl)
+  return _internal_logourl();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RegisterData::set_logourl(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000080u;
+ _impl_.logourl_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:App.RegisterData.logoUrl)
+}
+inline std::string* RegisterData::mutable_logourl() {
+  std::string* _s = _internal_mutable_logourl();
+  // @@protoc_insertion_point(field_mutable:App.RegisterData.logoUrl)
+  return _s;
+}
+inline const std::string& RegisterData::_internal_logourl() const {
+  return _impl_.logourl_.Get();
+}
+inline void RegisterData::_internal_set_logourl(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.logourl_.Set(value, GetArenaForAllocation());
+}
+inline std::string* RegisterData::_internal_mutable_logourl() {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  return _impl_.logourl_.Mutable(GetArenaForAllocation());
+}
+inline std::string* RegisterData::release_logourl() {
+  // @@protoc_insertion_point(field_release:App.RegisterData.logoUrl)
+  if (!_internal_has_logourl()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000080u;
+  auto* p = _impl_.logourl_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.logourl_.IsDefault()) {
+    _impl_.logourl_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void RegisterData::set_allocated_logourl(std::string* logourl) {
+  if (logourl != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000080u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000080u;
+  }
+  _impl_.logourl_.SetAllocated(logourl, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.logourl_.IsDefault()) {
+    _impl_.logourl_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:App.RegisterData.logoUrl)
+}
+
+// required bytes coverUrl = 9;
+inline bool RegisterData::_internal_has_coverurl() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
+  return value;
+}
+inline bool RegisterData::has_coverurl() const {
+  return _internal_has_coverurl();
+}
+inline void RegisterData::clear_coverurl() {
+  _impl_.coverurl_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000100u;
+}
+inline const std::string& RegisterData::coverurl() const {
+  // @@protoc_insertion_point(field_get:App.RegisterData.coverUrl)
+  return _internal_coverurl();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RegisterData::set_coverurl(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000100u;
+ _impl_.coverurl_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:App.RegisterData.coverUrl)
+}
+inline std::string* RegisterData::mutable_coverurl() {
+  std::string* _s = _internal_mutable_coverurl();
+  // @@protoc_insertion_point(field_mutable:App.RegisterData.coverUrl)
+  return _s;
+}
+inline const std::string& RegisterData::_internal_coverurl() const {
+  return _impl_.coverurl_.Get();
+}
+inline void RegisterData::_internal_set_coverurl(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000100u;
+  _impl_.coverurl_.Set(value, GetArenaForAllocation());
+}
+inline std::string* RegisterData::_internal_mutable_coverurl() {
+  _impl_._has_bits_[0] |= 0x00000100u;
+  return _impl_.coverurl_.Mutable(GetArenaForAllocation());
+}
+inline std::string* RegisterData::release_coverurl() {
+  // @@protoc_insertion_point(field_release:App.RegisterData.coverUrl)
+  if (!_internal_has_coverurl()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000100u;
+  auto* p = _impl_.coverurl_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.coverurl_.IsDefault()) {
+    _impl_.coverurl_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void RegisterData::set_allocated_coverurl(std::string* coverurl) {
+  if (coverurl != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000100u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000100u;
+  }
+  _impl_.coverurl_.SetAllocated(coverurl, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.coverurl_.IsDefault()) {
+    _impl_.coverurl_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:App.RegisterData.coverUrl)
+}
+
+// -------------------------------------------------------------------
+
+// AuthData
+
+// required bytes version = 1;
+inline bool AuthData::_internal_has_version() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool AuthData::has_version() const {
+  return _internal_has_version();
+}
+inline void AuthData::clear_version() {
+  _impl_.version_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& AuthData::version() const {
+  // @@protoc_insertion_point(field_get:App.AuthData.version)
+  return _internal_version();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void AuthData::set_version(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.version_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:App.AuthData.version)
+}
+inline std::string* AuthData::mutable_version() {
+  std::string* _s = _internal_mutable_version();
+  // @@protoc_insertion_point(field_mutable:App.AuthData.version)
+  return _s;
+}
+inline const std::string& AuthData::_internal_version() const {
+  return _impl_.version_.Get();
+}
+inline void AuthData::_internal_set_version(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.version_.Set(value, GetArenaForAllocation());
+}
+inline std::string* AuthData::_internal_mutable_version() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.version_.Mutable(GetArenaForAllocation());
+}
+inline std::string* AuthData::release_version() {
+  // @@protoc_insertion_point(field_release:App.AuthData.version)
+  if (!_internal_has_version()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.version_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.version_.IsDefault()) {
+    _impl_.version_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void AuthData::set_allocated_version(std::string* version) {
+  if (version != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.version_.SetAllocated(version, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.version_.IsDefault()) {
+    _impl_.version_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:App.AuthData.version)
+}
+
+// required bytes setType = 2;
+inline bool AuthData::_internal_has_settype() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool AuthData::has_settype() const {
+  return _internal_has_settype();
+}
+inline void AuthData::clear_settype() {
+  _impl_.settype_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& AuthData::settype() const {
+  // @@protoc_insertion_point(field_get:App.AuthData.setType)
+  return _internal_settype();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void AuthData::set_settype(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.settype_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:App.AuthData.setType)
+}
+inline std::string* AuthData::mutable_settype() {
+  std::string* _s = _internal_mutable_settype();
+  // @@protoc_insertion_point(field_mutable:App.AuthData.setType)
+  return _s;
+}
+inline const std::string& AuthData::_internal_settype() const {
+  return _impl_.settype_.Get();
+}
+inline void AuthData::_internal_set_settype(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.settype_.Set(value, GetArenaForAllocation());
+}
+inline std::string* AuthData::_internal_mutable_settype() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.settype_.Mutable(GetArenaForAllocation());
+}
+inline std::string* AuthData::release_settype() {
+  // @@protoc_insertion_point(field_release:App.AuthData.setType)
+  if (!_internal_has_settype()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.settype_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.settype_.IsDefault()) {
+    _impl_.settype_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void AuthData::set_allocated_settype(std::string* settype) {
+  if (settype != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.settype_.SetAllocated(settype, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.settype_.IsDefault()) {
+    _impl_.settype_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:App.AuthData.setType)
+}
+
+// required bytes adminAddress = 3;
+inline bool AuthData::_internal_has_adminaddress() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool AuthData::has_adminaddress() const {
+  return _internal_has_adminaddress();
+}
+inline void AuthData::clear_adminaddress() {
+  _impl_.adminaddress_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const std::string& AuthData::adminaddress() const {
+  // @@protoc_insertion_point(field_get:App.AuthData.adminAddress)
+  return _internal_adminaddress();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void AuthData::set_adminaddress(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000004u;
+ _impl_.adminaddress_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:App.AuthData.adminAddress)
+}
+inline std::string* AuthData::mutable_adminaddress() {
+  std::string* _s = _internal_mutable_adminaddress();
+  // @@protoc_insertion_point(field_mutable:App.AuthData.adminAddress)
+  return _s;
+}
+inline const std::string& AuthData::_internal_adminaddress() const {
+  return _impl_.adminaddress_.Get();
+}
+inline void AuthData::_internal_set_adminaddress(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.adminaddress_.Set(value, GetArenaForAllocation());
+}
+inline std::string* AuthData::_internal_mutable_adminaddress() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  return _impl_.adminaddress_.Mutable(GetArenaForAllocation());
+}
+inline std::string* AuthData::release_adminaddress() {
+  // @@protoc_insertion_point(field_release:App.AuthData.adminAddress)
+  if (!_internal_has_adminaddress()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  auto* p = _impl_.adminaddress_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.adminaddress_.IsDefault()) {
+    _impl_.adminaddress_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void AuthData::set_allocated_adminaddress(std::string* adminaddress) {
+  if (adminaddress != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.adminaddress_.SetAllocated(adminaddress, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.adminaddress_.IsDefault()) {
+    _impl_.adminaddress_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:App.AuthData.adminAddress)
+}
+
+// required bytes userAddress = 4;
+inline bool AuthData::_internal_has_useraddress() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool AuthData::has_useraddress() const {
+  return _internal_has_useraddress();
+}
+inline void AuthData::clear_useraddress() {
+  _impl_.useraddress_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline const std::string& AuthData::useraddress() const {
+  // @@protoc_insertion_point(field_get:App.AuthData.userAddress)
+  return _internal_useraddress();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void AuthData::set_useraddress(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000008u;
+ _impl_.useraddress_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:App.AuthData.userAddress)
+}
+inline std::string* AuthData::mutable_useraddress() {
+  std::string* _s = _internal_mutable_useraddress();
+  // @@protoc_insertion_point(field_mutable:App.AuthData.userAddress)
+  return _s;
+}
+inline const std::string& AuthData::_internal_useraddress() const {
+  return _impl_.useraddress_.Get();
+}
+inline void AuthData::_internal_set_useraddress(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.useraddress_.Set(value, GetArenaForAllocation());
+}
+inline std::string* AuthData::_internal_mutable_useraddress() {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  return _impl_.useraddress_.Mutable(GetArenaForAllocation());
+}
+inline std::string* AuthData::release_useraddress() {
+  // @@protoc_insertion_point(field_release:App.AuthData.userAddress)
+  if (!_internal_has_useraddress()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  auto* p = _impl_.useraddress_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.useraddress_.IsDefault()) {
+    _impl_.useraddress_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void AuthData::set_allocated_useraddress(std::string* useraddress) {
+  if (useraddress != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  _impl_.useraddress_.SetAllocated(useraddress, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.useraddress_.IsDefault()) {
+    _impl_.useraddress_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:App.AuthData.userAddress)
+}
+
+// required uint32 auth = 5;
+inline bool AuthData::_internal_has_auth() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool AuthData::has_auth() const {
+  return _internal_has_auth();
+}
+inline void AuthData::clear_auth() {
+  _impl_.auth_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline uint32_t AuthData::_internal_auth() const {
+  return _impl_.auth_;
+}
+inline uint32_t AuthData::auth() const {
+  // @@protoc_insertion_point(field_get:App.AuthData.auth)
+  return _internal_auth();
+}
+inline void AuthData::_internal_set_auth(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.auth_ = value;
+}
+inline void AuthData::set_auth(uint32_t value) {
+  _internal_set_auth(value);
+  // @@protoc_insertion_point(field_set:App.AuthData.auth)
+}
+
+// -------------------------------------------------------------------
+
+// ExtendData
+
+// required bytes version = 1;
+inline bool ExtendData::_internal_has_version() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool ExtendData::has_version() const {
+  return _internal_has_version();
+}
+inline void ExtendData::clear_version() {
+  _impl_.version_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& ExtendData::version() const {
+  // @@protoc_insertion_point(field_get:App.ExtendData.version)
+  return _internal_version();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ExtendData::set_version(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.version_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:App.ExtendData.version)
+}
+inline std::string* ExtendData::mutable_version() {
+  std::string* _s = _internal_mutable_version();
+  // @@protoc_insertion_point(field_mutable:App.ExtendData.version)
+  return _s;
+}
+inline const std::string& ExtendData::_internal_version() const {
+  return _impl_.version_.Get();
+}
+inline void ExtendData::_internal_set_version(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.version_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ExtendData::_internal_mutable_version() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.version_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ExtendData::release_version() {
+  // @@protoc_insertion_point(field_release:App.ExtendData.version)
+  if (!_internal_has_version()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.version_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.version_.IsDefault()) {
+    _impl_.version_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void ExtendData::set_allocated_version(std::string* version) {
+  if (version != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.version_.SetAllocated(version, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.version_.IsDefault()) {
+    _impl_.version_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:App.ExtendData.version)
+}
+
+// required uint32 auth = 2;
+inline bool ExtendData::_internal_has_auth() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool ExtendData::has_auth() const {
+  return _internal_has_auth();
+}
+inline void ExtendData::clear_auth() {
+  _impl_.auth_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint32_t ExtendData::_internal_auth() const {
+  return _impl_.auth_;
+}
+inline uint32_t ExtendData::auth() const {
+  // @@protoc_insertion_point(field_get:App.ExtendData.auth)
+  return _internal_auth();
+}
+inline void ExtendData::_internal_set_auth(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.auth_ = value;
+}
+inline void ExtendData::set_auth(uint32_t value) {
+  _internal_set_auth(value);
+  // @@protoc_insertion_point(field_set:App.ExtendData.auth)
+}
+
+// required bytes extendData = 3;
+inline bool ExtendData::_internal_has_extenddata() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool ExtendData::has_extenddata() const {
+  return _internal_has_extenddata();
+}
+inline void ExtendData::clear_extenddata() {
+  _impl_.extenddata_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& ExtendData::extenddata() const {
+  // @@protoc_insertion_point(field_get:App.ExtendData.extendData)
+  return _internal_extenddata();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ExtendData::set_extenddata(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.extenddata_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:App.ExtendData.extendData)
+}
+inline std::string* ExtendData::mutable_extenddata() {
+  std::string* _s = _internal_mutable_extenddata();
+  // @@protoc_insertion_point(field_mutable:App.ExtendData.extendData)
+  return _s;
+}
+inline const std::string& ExtendData::_internal_extenddata() const {
+  return _impl_.extenddata_.Get();
+}
+inline void ExtendData::_internal_set_extenddata(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.extenddata_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ExtendData::_internal_mutable_extenddata() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.extenddata_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ExtendData::release_extenddata() {
+  // @@protoc_insertion_point(field_release:App.ExtendData.extendData)
+  if (!_internal_has_extenddata()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.extenddata_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.extenddata_.IsDefault()) {
+    _impl_.extenddata_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void ExtendData::set_allocated_extenddata(std::string* extenddata) {
+  if (extenddata != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.extenddata_.SetAllocated(extenddata, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.extenddata_.IsDefault()) {
+    _impl_.extenddata_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:App.ExtendData.extendData)
+}
+
+// -------------------------------------------------------------------
+
+// IssueData
+
+// required bytes version = 1;
+inline bool IssueData::_internal_has_version() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool IssueData::has_version() const {
+  return _internal_has_version();
+}
+inline void IssueData::clear_version() {
+  _impl_.version_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& IssueData::version() const {
+  // @@protoc_insertion_point(field_get:App.IssueData.version)
+  return _internal_version();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void IssueData::set_version(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.version_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:App.IssueData.version)
+}
+inline std::string* IssueData::mutable_version() {
+  std::string* _s = _internal_mutable_version();
+  // @@protoc_insertion_point(field_mutable:App.IssueData.version)
+  return _s;
+}
+inline const std::string& IssueData::_internal_version() const {
+  return _impl_.version_.Get();
+}
+inline void IssueData::_internal_set_version(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.version_.Set(value, GetArenaForAllocation());
+}
+inline std::string* IssueData::_internal_mutable_version() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.version_.Mutable(GetArenaForAllocation());
+}
+inline std::string* IssueData::release_version() {
+  // @@protoc_insertion_point(field_release:App.IssueData.version)
+  if (!_internal_has_version()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.version_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.version_.IsDefault()) {
+    _impl_.version_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void IssueData::set_allocated_version(std::string* version) {
+  if (version != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.version_.SetAllocated(version, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.version_.IsDefault()) {
+    _impl_.version_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:App.IssueData.version)
+}
+
+// required bytes shortName = 2;
+inline bool IssueData::_internal_has_shortname() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool IssueData::has_shortname() const {
+  return _internal_has_shortname();
+}
+inline void IssueData::clear_shortname() {
+  _impl_.shortname_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& IssueData::shortname() const {
+  // @@protoc_insertion_point(field_get:App.IssueData.shortName)
+  return _internal_shortname();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void IssueData::set_shortname(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.shortname_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:App.IssueData.shortName)
+}
+inline std::string* IssueData::mutable_shortname() {
+  std::string* _s = _internal_mutable_shortname();
+  // @@protoc_insertion_point(field_mutable:App.IssueData.shortName)
+  return _s;
+}
+inline const std::string& IssueData::_internal_shortname() const {
+  return _impl_.shortname_.Get();
+}
+inline void IssueData::_internal_set_shortname(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.shortname_.Set(value, GetArenaForAllocation());
+}
+inline std::string* IssueData::_internal_mutable_shortname() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.shortname_.Mutable(GetArenaForAllocation());
+}
+inline std::string* IssueData::release_shortname() {
+  // @@protoc_insertion_point(field_release:App.IssueData.shortName)
+  if (!_internal_has_shortname()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.shortname_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.shortname_.IsDefault()) {
+    _impl_.shortname_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void IssueData::set_allocated_shortname(std::string* shortname) {
+  if (shortname != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.shortname_.SetAllocated(shortname, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.shortname_.IsDefault()) {
+    _impl_.shortname_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:App.IssueData.shortName)
+}
+
+// required bytes assetName = 3;
+inline bool IssueData::_internal_has_assetname() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool IssueData::has_assetname() const {
+  return _internal_has_assetname();
+}
+inline void IssueData::clear_assetname() {
+  _impl_.assetname_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const std::string& IssueData::assetname() const {
+  // @@protoc_insertion_point(field_get:App.IssueData.assetName)
+  return _internal_assetname();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void IssueData::set_assetname(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000004u;
+ _impl_.assetname_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:App.IssueData.assetName)
+}
+inline std::string* IssueData::mutable_assetname() {
+  std::string* _s = _internal_mutable_assetname();
+  // @@protoc_insertion_point(field_mutable:App.IssueData.assetName)
+  return _s;
+}
+inline const std::string& IssueData::_internal_assetname() const {
+  return _impl_.assetname_.Get();
+}
+inline void IssueData::_internal_set_assetname(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.assetname_.Set(value, GetArenaForAllocation());
+}
+inline std::string* IssueData::_internal_mutable_assetname() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  return _impl_.assetname_.Mutable(GetArenaForAllocation());
+}
+inline std::string* IssueData::release_assetname() {
+  // @@protoc_insertion_point(field_release:App.IssueData.assetName)
+  if (!_internal_has_assetname()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  auto* p = _impl_.assetname_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.assetname_.IsDefault()) {
+    _impl_.assetname_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void IssueData::set_allocated_assetname(std::string* assetname) {
+  if (assetname != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.assetname_.SetAllocated(assetname, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.assetname_.IsDefault()) {
+    _impl_.assetname_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:App.IssueData.assetName)
+}
+
+// required bytes assetDesc = 4;
+inline bool IssueData::_internal_has_assetdesc() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool IssueData::has_assetdesc() const {
+  return _internal_has_assetdesc();
+}
+inline void IssueData::clear_assetdesc() {
+  _impl_.assetdesc_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline const std::string& IssueData::assetdesc() const {
+  // @@protoc_insertion_point(field_get:App.IssueData.assetDesc)
+  return _internal_assetdesc();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void IssueData::set_assetdesc(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000008u;
+ _impl_.assetdesc_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:App.IssueData.assetDesc)
+}
+inline std::string* IssueData::mutable_assetdesc() {
+  std::string* _s = _internal_mutable_assetdesc();
+  // @@protoc_insertion_point(field_mutable:App.IssueData.assetDesc)
+  return _s;
+}
+inline const std::string& IssueData::_internal_assetdesc() const {
+  return _impl_.assetdesc_.Get();
+}
+inline void IssueData::_internal_set_assetdesc(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.assetdesc_.Set(value, GetArenaForAllocation());
+}
+inline std::string* IssueData::_internal_mutable_assetdesc() {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  return _impl_.assetdesc_.Mutable(GetArenaForAllocation());
+}
+inline std::string* IssueData::release_assetdesc() {
+  // @@protoc_insertion_point(field_release:App.IssueData.assetDesc)
+  if (!_internal_has_assetdesc()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  auto* p = _impl_.assetdesc_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.assetdesc_.IsDefault()) {
+    _impl_.assetdesc_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void IssueData::set_allocated_assetdesc(std::string* assetdesc) {
+  if (assetdesc != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  _impl_.assetdesc_.SetAllocated(assetdesc, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.assetdesc_.IsDefault()) {
+    _impl_.assetdesc_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:App.IssueData.assetDesc)
+}
+
+// required bytes assetUnit = 5;
+inline bool IssueData::_internal_has_assetunit() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool IssueData::has_assetunit() const {
+  return _internal_has_assetunit();
+}
+inline void IssueData::clear_assetunit() {
+  _impl_.assetunit_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline const std::string& IssueData::assetunit() const {
+  // @@protoc_insertion_point(field_get:App.IssueData.assetUnit)
+  return _internal_assetunit();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void IssueData::set_assetunit(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000010u;
+ _impl_.assetunit_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:App.IssueData.assetUnit)
+}
+inline std::string* IssueData::mutable_assetunit() {
+  std::string* _s = _internal_mutable_assetunit();
+  // @@protoc_insertion_point(field_mutable:App.IssueData.assetUnit)
+  return _s;
+}
+inline const std::string& IssueData::_internal_assetunit() const {
+  return _impl_.assetunit_.Get();
+}
+inline void IssueData::_internal_set_assetunit(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.assetunit_.Set(value, GetArenaForAllocation());
+}
+inline std::string* IssueData::_internal_mutable_assetunit() {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  return _impl_.assetunit_.Mutable(GetArenaForAllocation());
+}
+inline std::string* IssueData::release_assetunit() {
+  // @@protoc_insertion_point(field_release:App.IssueData.assetUnit)
+  if (!_internal_has_assetunit()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000010u;
+  auto* p = _impl_.assetunit_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.assetunit_.IsDefault()) {
+    _impl_.assetunit_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void IssueData::set_allocated_assetunit(std::string* assetunit) {
+  if (assetunit != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000010u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000010u;
+  }
+  _impl_.assetunit_.SetAllocated(assetunit, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.assetunit_.IsDefault()) {
+    _impl_.assetunit_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:App.IssueData.assetUnit)
+}
+
+// required int64 totalAmount = 6;
+inline bool IssueData::_internal_has_totalamount() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
+  return value;
+}
+inline bool IssueData::has_totalamount() const {
+  return _internal_has_totalamount();
+}
+inline void IssueData::clear_totalamount() {
+  _impl_.totalamount_ = int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00000100u;
+}
+inline int64_t IssueData::_internal_totalamount() const {
+  return _impl_.totalamount_;
+}
+inline int64_t IssueData::totalamount() const {
+  // @@protoc_insertion_point(field_get:App.IssueData.totalAmount)
+  return _internal_totalamount();
+}
+inline void IssueData::_internal_set_totalamount(int64_t value) {
+  _impl_._has_bits_[0] |= 0x00000100u;
+  _impl_.totalamount_ = value;
+}
+inline void IssueData::set_totalamount(int64_t value) {
+  _internal_set_totalamount(value);
+  // @@protoc_insertion_point(field_set:App.IssueData.totalAmount)
+}
+
+// required int64 firstIssueAmount = 7;
+inline bool IssueData::_internal_has_firstissueamount() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000200u) != 0;
+  return value;
+}
+inline bool IssueData::has_firstissueamount() const {
+  return _internal_has_firstissueamount();
+}
+inline void IssueData::clear_firstissueamount() {
+  _impl_.firstissueamount_ = int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00000200u;
+}
+inline int64_t IssueData::_internal_firstissueamount() const {
+  return _impl_.firstissueamount_;
+}
+inline int64_t IssueData::firstissueamount() const {
+  // @@protoc_insertion_point(field_get:App.IssueData.firstIssueAmount)
+  return _internal_firstissueamount();
+}
+inline void IssueData::_internal_set_firstissueamount(int64_t value) {
+  _impl_._has_bits_[0] |= 0x00000200u;
+  _impl_.firstissueamount_ = value;
+}
+inline void IssueData::set_firstissueamount(int64_t value) {
+  _internal_set_firstissueamount(value);
+  // @@protoc_insertion_point(field_set:App.IssueData.firstIssueAmount)
+}
+
+// required int64 firstActualAmount = 8;
+inline bool IssueData::_internal_has_firstactualamount() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000400u) != 0;
+  return value;
+}
+inline bool IssueData::has_firstactualamount() const {
+  return _internal_has_firstactualamount();
+}
+inline void IssueData::clear_firstactualamount() {
+  _impl_.firstactualamount_ = int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00000400u;
+}
+inline int64_t IssueData::_internal_firstactualamount() const {
+  return _impl_.firstactualamount_;
+}
+inline int64_t IssueData::firstactualamount() const {
+  // @@protoc_insertion_point(field_get:App.IssueData.firstActualAmount)
+  return _internal_firstactualamount();
+}
+inline void IssueData::_internal_set_firstactualamount(int64_t value) {
+  _impl_._has_bits_[0] |= 0x00000400u;
+  _impl_.firstactualamount_ = value;
+}
+inline void IssueData::set_firstactualamount(int64_t value) {
+  _internal_set_firstactualamount(value);
+  // @@protoc_insertion_point(field_set:App.IssueData.firstActualAmount)
+}
+
+// required bytes decimals = 9;
+inline bool IssueData::_internal_has_decimals() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool IssueData::has_decimals() const {
+  return _internal_has_decimals();
+}
+inline void IssueData::clear_decimals() {
+  _impl_.decimals_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline const std::string& IssueData::decimals() const {
+  // @@protoc_insertion_point(field_get:App.IssueData.decimals)
+  return _internal_decimals();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void IssueData::set_decimals(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000020u;
+ _impl_.decimals_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:App.IssueData.decimals)
+}
+inline std::string* IssueData::mutable_decimals() {
+  std::string* _s = _internal_mutable_decimals();
+  // @@protoc_insertion_point(field_mutable:App.IssueData.decimals)
+  return _s;
+}
+inline const std::string& IssueData::_internal_decimals() const {
+  return _impl_.decimals_.Get();
+}
+inline void IssueData::_internal_set_decimals(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.decimals_.Set(value, GetArenaForAllocation());
+}
+inline std::string* IssueData::_internal_mutable_decimals() {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  return _impl_.decimals_.Mutable(GetArenaForAllocation());
+}
+inline std::string* IssueData::release_decimals() {
+  // @@protoc_insertion_point(field_release:App.IssueData.decimals)
+  if (!_internal_has_decimals()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000020u;
+  auto* p = _impl_.decimals_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.decimals_.IsDefault()) {
+    _impl_.decimals_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void IssueData::set_allocated_decimals(std::string* decimals) {
+  if (decimals != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000020u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000020u;
+  }
+  _impl_.decimals_.SetAllocated(decimals, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.decimals_.IsDefault()) {
+    _impl_.decimals_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:App.IssueData.decimals)
+}
+
+// required bool destory = 10;
+inline bool IssueData::_internal_has_destory() const {
+  bool value = (_impl_._has_bits_[0] & 0x00001000u) != 0;
+  return value;
+}
+inline bool IssueData::has_destory() const {
+  return _internal_has_destory();
+}
+inline void IssueData::clear_destory() {
+  _impl_.destory_ = false;
+  _impl_._has_bits_[0] &= ~0x00001000u;
+}
+inline bool IssueData::_internal_destory() const {
+  return _impl_.destory_;
+}
+inline bool IssueData::destory() const {
+  // @@protoc_insertion_point(field_get:App.IssueData.destory)
+  return _internal_destory();
+}
+inline void IssueData::_internal_set_destory(bool value) {
+  _impl_._has_bits_[0] |= 0x00001000u;
+  _impl_.destory_ = value;
+}
+inline void IssueData::set_destory(bool value) {
+  _internal_set_destory(value);
+  // @@protoc_insertion_point(field_set:App.IssueData.destory)
+}
+
+// required bool payCandy = 11;
+inline bool IssueData::_internal_has_paycandy() const {
+  bool value = (_impl_._has_bits_[0] & 0x00002000u) != 0;
+  return value;
+}
+inline bool IssueData::has_paycandy() const {
+  return _internal_has_paycandy();
+}
+inline void IssueData::clear_paycandy() {
+  _impl_.paycandy_ = false;
+  _impl_._has_bits_[0] &= ~0x00002000u;
+}
+inline bool IssueData::_internal_paycandy() const {
+  return _impl_.paycandy_;
+}
+inline bool IssueData::paycandy() const {
+  // @@protoc_insertion_point(field_get:App.IssueData.payCandy)
+  return _internal_paycandy();
+}
+inline void IssueData::_internal_set_paycandy(bool value) {
+  _impl_._has_bits_[0] |= 0x00002000u;
+  _impl_.paycandy_ = value;
+}
+inline void IssueData::set_paycandy(bool value) {
+  _internal_set_paycandy(value);
+  // @@protoc_insertion_point(field_set:App.IssueData.payCandy)
+}
+
+// required int64 candyAmount = 12;
+inline bool IssueData::_internal_has_candyamount() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000800u) != 0;
+  return value;
+}
+inline bool IssueData::has_candyamount() const {
+  return _internal_has_candyamount();
+}
+inline void IssueData::clear_candyamount() {
+  _impl_.candyamount_ = int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00000800u;
+}
+inline int64_t IssueData::_internal_candyamount() const {
+  return _impl_.candyamount_;
+}
+inline int64_t IssueData::candyamount() const {
+  // @@protoc_insertion_point(field_get:App.IssueData.candyAmount)
+  return _internal_candyamount();
+}
+inline void IssueData::_internal_set_candyamount(int64_t value) {
+  _impl_._has_bits_[0] |= 0x00000800u;
+  _impl_.candyamount_ = value;
+}
+inline void IssueData::set_candyamount(int64_t value) {
+  _internal_set_candyamount(value);
+  // @@protoc_insertion_point(field_set:App.IssueData.candyAmount)
+}
+
+// required bytes candyExpired = 13;
+inline bool IssueData::_internal_has_candyexpired() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool IssueData::has_candyexpired() const {
+  return _internal_has_candyexpired();
+}
+inline void IssueData::clear_candyexpired() {
+  _impl_.candyexpired_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline const std::string& IssueData::candyexpired() const {
+  // @@protoc_insertion_point(field_get:App.IssueData.candyExpired)
+  return _internal_candyexpired();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void IssueData::set_candyexpired(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000040u;
+ _impl_.candyexpired_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:App.IssueData.candyExpired)
+}
+inline std::string* IssueData::mutable_candyexpired() {
+  std::string* _s = _internal_mutable_candyexpired();
+  // @@protoc_insertion_point(field_mutable:App.IssueData.candyExpired)
+  return _s;
+}
+inline const std::string& IssueData::_internal_candyexpired() const {
+  return _impl_.candyexpired_.Get();
+}
+inline void IssueData::_internal_set_candyexpired(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.candyexpired_.Set(value, GetArenaForAllocation());
+}
+inline std::string* IssueData::_internal_mutable_candyexpired() {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  return _impl_.candyexpired_.Mutable(GetArenaForAllocation());
+}
+inline std::string* IssueData::release_candyexpired() {
+  // @@protoc_insertion_point(field_release:App.IssueData.candyExpired)
+  if (!_internal_has_candyexpired()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000040u;
+  auto* p = _impl_.candyexpired_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.candyexpired_.IsDefault()) {
+    _impl_.candyexpired_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void IssueData::set_allocated_candyexpired(std::string* candyexpired) {
+  if (candyexpired != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000040u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000040u;
+  }
+  _impl_.candyexpired_.SetAllocated(candyexpired, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.candyexpired_.IsDefault()) {
+    _impl_.candyexpired_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:App.IssueData.candyExpired)
+}
+
+// required bytes remarks = 14;
+inline bool IssueData::_internal_has_remarks() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  return value;
+}
+inline bool IssueData::has_remarks() const {
+  return _internal_has_remarks();
+}
+inline void IssueData::clear_remarks() {
+  _impl_.remarks_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline const std::string& IssueData::remarks() const {
+  // @@protoc_insertion_point(field_get:App.IssueData.remarks)
+  return _internal_remarks();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void IssueData::set_remarks(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000080u;
+ _impl_.remarks_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:App.IssueData.remarks)
+}
+inline std::string* IssueData::mutable_remarks() {
+  std::string* _s = _internal_mutable_remarks();
+  // @@protoc_insertion_point(field_mutable:App.IssueData.remarks)
+  return _s;
+}
+inline const std::string& IssueData::_internal_remarks() const {
+  return _impl_.remarks_.Get();
+}
+inline void IssueData::_internal_set_remarks(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.remarks_.Set(value, GetArenaForAllocation());
+}
+inline std::string* IssueData::_internal_mutable_remarks() {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  return _impl_.remarks_.Mutable(GetArenaForAllocation());
+}
+inline std::string* IssueData::release_remarks() {
+  // @@protoc_insertion_point(field_release:App.IssueData.remarks)
+  if (!_internal_has_remarks()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000080u;
+  auto* p = _impl_.remarks_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.remarks_.IsDefault()) {
+    _impl_.remarks_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void IssueData::set_allocated_remarks(std::string* remarks) {
+  if (remarks != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000080u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000080u;
+  }
+  _impl_.remarks_.SetAllocated(remarks, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.remarks_.IsDefault()) {
+    _impl_.remarks_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:App.IssueData.remarks)
+}
+
+// -------------------------------------------------------------------
+
+// CommonData
+
+// required bytes version = 1;
+inline bool CommonData::_internal_has_version() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CommonData::has_version() const {
+  return _internal_has_version();
+}
+inline void CommonData::clear_version() {
+  _impl_.version_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& CommonData::version() const {
+  // @@protoc_insertion_point(field_get:App.CommonData.version)
+  return _internal_version();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CommonData::set_version(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.version_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:App.CommonData.version)
+}
+inline std::string* CommonData::mutable_version() {
+  std::string* _s = _internal_mutable_version();
+  // @@protoc_insertion_point(field_mutable:App.CommonData.version)
+  return _s;
+}
+inline const std::string& CommonData::_internal_version() const {
+  return _impl_.version_.Get();
+}
+inline void CommonData::_internal_set_version(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.version_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CommonData::_internal_mutable_version() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.version_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CommonData::release_version() {
+  // @@protoc_insertion_point(field_release:App.CommonData.version)
+  if (!_internal_has_version()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.version_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.version_.IsDefault()) {
+    _impl_.version_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CommonData::set_allocated_version(std::string* version) {
+  if (version != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.version_.SetAllocated(version, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.version_.IsDefault()) {
+    _impl_.version_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:App.CommonData.version)
+}
+
+// required bytes assetId = 2;
+inline bool CommonData::_internal_has_assetid() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CommonData::has_assetid() const {
+  return _internal_has_assetid();
+}
+inline void CommonData::clear_assetid() {
+  _impl_.assetid_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& CommonData::assetid() const {
+  // @@protoc_insertion_point(field_get:App.CommonData.assetId)
+  return _internal_assetid();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CommonData::set_assetid(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.assetid_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:App.CommonData.assetId)
+}
+inline std::string* CommonData::mutable_assetid() {
+  std::string* _s = _internal_mutable_assetid();
+  // @@protoc_insertion_point(field_mutable:App.CommonData.assetId)
+  return _s;
+}
+inline const std::string& CommonData::_internal_assetid() const {
+  return _impl_.assetid_.Get();
+}
+inline void CommonData::_internal_set_assetid(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.assetid_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CommonData::_internal_mutable_assetid() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.assetid_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CommonData::release_assetid() {
+  // @@protoc_insertion_point(field_release:App.CommonData.assetId)
+  if (!_internal_has_assetid()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.assetid_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.assetid_.IsDefault()) {
+    _impl_.assetid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CommonData::set_allocated_assetid(std::string* assetid) {
+  if (assetid != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.assetid_.SetAllocated(assetid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.assetid_.IsDefault()) {
+    _impl_.assetid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:App.CommonData.assetId)
+}
+
+// required int64 amount = 3;
+inline bool CommonData::_internal_has_amount() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool CommonData::has_amount() const {
+  return _internal_has_amount();
+}
+inline void CommonData::clear_amount() {
+  _impl_.amount_ = int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline int64_t CommonData::_internal_amount() const {
+  return _impl_.amount_;
+}
+inline int64_t CommonData::amount() const {
+  // @@protoc_insertion_point(field_get:App.CommonData.amount)
+  return _internal_amount();
+}
+inline void CommonData::_internal_set_amount(int64_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.amount_ = value;
+}
+inline void CommonData::set_amount(int64_t value) {
+  _internal_set_amount(value);
+  // @@protoc_insertion_point(field_set:App.CommonData.amount)
+}
+
+// required bytes remarks = 4;
+inline bool CommonData::_internal_has_remarks() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool CommonData::has_remarks() const {
+  return _internal_has_remarks();
+}
+inline void CommonData::clear_remarks() {
+  _impl_.remarks_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const std::string& CommonData::remarks() const {
+  // @@protoc_insertion_point(field_get:App.CommonData.remarks)
+  return _internal_remarks();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CommonData::set_remarks(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000004u;
+ _impl_.remarks_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:App.CommonData.remarks)
+}
+inline std::string* CommonData::mutable_remarks() {
+  std::string* _s = _internal_mutable_remarks();
+  // @@protoc_insertion_point(field_mutable:App.CommonData.remarks)
+  return _s;
+}
+inline const std::string& CommonData::_internal_remarks() const {
+  return _impl_.remarks_.Get();
+}
+inline void CommonData::_internal_set_remarks(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.remarks_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CommonData::_internal_mutable_remarks() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  return _impl_.remarks_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CommonData::release_remarks() {
+  // @@protoc_insertion_point(field_release:App.CommonData.remarks)
+  if (!_internal_has_remarks()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  auto* p = _impl_.remarks_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.remarks_.IsDefault()) {
+    _impl_.remarks_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CommonData::set_allocated_remarks(std::string* remarks) {
+  if (remarks != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.remarks_.SetAllocated(remarks, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.remarks_.IsDefault()) {
+    _impl_.remarks_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:App.CommonData.remarks)
+}
+
+// -------------------------------------------------------------------
+
+// PutCandyData
+
+// required bytes version = 1;
+inline bool PutCandyData::_internal_has_version() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool PutCandyData::has_version() const {
+  return _internal_has_version();
+}
+inline void PutCandyData::clear_version() {
+  _impl_.version_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& PutCandyData::version() const {
+  // @@protoc_insertion_point(field_get:App.PutCandyData.version)
+  return _internal_version();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PutCandyData::set_version(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.version_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:App.PutCandyData.version)
+}
+inline std::string* PutCandyData::mutable_version() {
+  std::string* _s = _internal_mutable_version();
+  // @@protoc_insertion_point(field_mutable:App.PutCandyData.version)
+  return _s;
+}
+inline const std::string& PutCandyData::_internal_version() const {
+  return _impl_.version_.Get();
+}
+inline void PutCandyData::_internal_set_version(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.version_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PutCandyData::_internal_mutable_version() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.version_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PutCandyData::release_version() {
+  // @@protoc_insertion_point(field_release:App.PutCandyData.version)
+  if (!_internal_has_version()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.version_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.version_.IsDefault()) {
+    _impl_.version_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void PutCandyData::set_allocated_version(std::string* version) {
+  if (version != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.version_.SetAllocated(version, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.version_.IsDefault()) {
+    _impl_.version_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:App.PutCandyData.version)
+}
+
+// required bytes assetId = 2;
+inline bool PutCandyData::_internal_has_assetid() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool PutCandyData::has_assetid() const {
+  return _internal_has_assetid();
+}
+inline void PutCandyData::clear_assetid() {
+  _impl_.assetid_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& PutCandyData::assetid() const {
+  // @@protoc_insertion_point(field_get:App.PutCandyData.assetId)
+  return _internal_assetid();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PutCandyData::set_assetid(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.assetid_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:App.PutCandyData.assetId)
+}
+inline std::string* PutCandyData::mutable_assetid() {
+  std::string* _s = _internal_mutable_assetid();
+  // @@protoc_insertion_point(field_mutable:App.PutCandyData.assetId)
+  return _s;
+}
+inline const std::string& PutCandyData::_internal_assetid() const {
+  return _impl_.assetid_.Get();
+}
+inline void PutCandyData::_internal_set_assetid(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.assetid_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PutCandyData::_internal_mutable_assetid() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.assetid_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PutCandyData::release_assetid() {
+  // @@protoc_insertion_point(field_release:App.PutCandyData.assetId)
+  if (!_internal_has_assetid()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.assetid_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.assetid_.IsDefault()) {
+    _impl_.assetid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void PutCandyData::set_allocated_assetid(std::string* assetid) {
+  if (assetid != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.assetid_.SetAllocated(assetid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.assetid_.IsDefault()) {
+    _impl_.assetid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:App.PutCandyData.assetId)
+}
+
+// required int64 amount = 3;
+inline bool PutCandyData::_internal_has_amount() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool PutCandyData::has_amount() const {
+  return _internal_has_amount();
+}
+inline void PutCandyData::clear_amount() {
+  _impl_.amount_ = int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline int64_t PutCandyData::_internal_amount() const {
+  return _impl_.amount_;
+}
+inline int64_t PutCandyData::amount() const {
+  // @@protoc_insertion_point(field_get:App.PutCandyData.amount)
+  return _internal_amount();
+}
+inline void PutCandyData::_internal_set_amount(int64_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.amount_ = value;
+}
+inline void PutCandyData::set_amount(int64_t value) {
+  _internal_set_amount(value);
+  // @@protoc_insertion_point(field_set:App.PutCandyData.amount)
+}
+
+// required bytes expired = 4;
+inline bool PutCandyData::_internal_has_expired() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool PutCandyData::has_expired() const {
+  return _internal_has_expired();
+}
+inline void PutCandyData::clear_expired() {
+  _impl_.expired_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const std::string& PutCandyData::expired() const {
+  // @@protoc_insertion_point(field_get:App.PutCandyData.expired)
+  return _internal_expired();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PutCandyData::set_expired(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000004u;
+ _impl_.expired_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:App.PutCandyData.expired)
+}
+inline std::string* PutCandyData::mutable_expired() {
+  std::string* _s = _internal_mutable_expired();
+  // @@protoc_insertion_point(field_mutable:App.PutCandyData.expired)
+  return _s;
+}
+inline const std::string& PutCandyData::_internal_expired() const {
+  return _impl_.expired_.Get();
+}
+inline void PutCandyData::_internal_set_expired(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.expired_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PutCandyData::_internal_mutable_expired() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  return _impl_.expired_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PutCandyData::release_expired() {
+  // @@protoc_insertion_point(field_release:App.PutCandyData.expired)
+  if (!_internal_has_expired()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  auto* p = _impl_.expired_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.expired_.IsDefault()) {
+    _impl_.expired_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void PutCandyData::set_allocated_expired(std::string* expired) {
+  if (expired != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.expired_.SetAllocated(expired, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.expired_.IsDefault()) {
+    _impl_.expired_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:App.PutCandyData.expired)
+}
+
+// required bytes remarks = 5;
+inline bool PutCandyData::_internal_has_remarks() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool PutCandyData::has_remarks() const {
+  return _internal_has_remarks();
+}
+inline void PutCandyData::clear_remarks() {
+  _impl_.remarks_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline const std::string& PutCandyData::remarks() const {
+  // @@protoc_insertion_point(field_get:App.PutCandyData.remarks)
+  return _internal_remarks();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PutCandyData::set_remarks(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000008u;
+ _impl_.remarks_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:App.PutCandyData.remarks)
+}
+inline std::string* PutCandyData::mutable_remarks() {
+  std::string* _s = _internal_mutable_remarks();
+  // @@protoc_insertion_point(field_mutable:App.PutCandyData.remarks)
+  return _s;
+}
+inline const std::string& PutCandyData::_internal_remarks() const {
+  return _impl_.remarks_.Get();
+}
+inline void PutCandyData::_internal_set_remarks(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.remarks_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PutCandyData::_internal_mutable_remarks() {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  return _impl_.remarks_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PutCandyData::release_remarks() {
+  // @@protoc_insertion_point(field_release:App.PutCandyData.remarks)
+  if (!_internal_has_remarks()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  auto* p = _impl_.remarks_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.remarks_.IsDefault()) {
+    _impl_.remarks_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void PutCandyData::set_allocated_remarks(std::string* remarks) {
+  if (remarks != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  _impl_.remarks_.SetAllocated(remarks, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.remarks_.IsDefault()) {
+    _impl_.remarks_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:App.PutCandyData.remarks)
+}
+
+// -------------------------------------------------------------------
+
+// GetCandyData
+
+// required bytes version = 1;
+inline bool GetCandyData::_internal_has_version() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool GetCandyData::has_version() const {
+  return _internal_has_version();
+}
+inline void GetCandyData::clear_version() {
+  _impl_.version_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& GetCandyData::version() const {
+  // @@protoc_insertion_point(field_get:App.GetCandyData.version)
+  return _internal_version();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GetCandyData::set_version(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.version_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:App.GetCandyData.version)
+}
+inline std::string* GetCandyData::mutable_version() {
+  std::string* _s = _internal_mutable_version();
+  // @@protoc_insertion_point(field_mutable:App.GetCandyData.version)
+  return _s;
+}
+inline const std::string& GetCandyData::_internal_version() const {
+  return _impl_.version_.Get();
+}
+inline void GetCandyData::_internal_set_version(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.version_.Set(value, GetArenaForAllocation());
+}
+inline std::string* GetCandyData::_internal_mutable_version() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.version_.Mutable(GetArenaForAllocation());
+}
+inline std::string* GetCandyData::release_version() {
+  // @@protoc_insertion_point(field_release:App.GetCandyData.version)
+  if (!_internal_has_version()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.version_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.version_.IsDefault()) {
+    _impl_.version_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void GetCandyData::set_allocated_version(std::string* version) {
+  if (version != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.version_.SetAllocated(version, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.version_.IsDefault()) {
+    _impl_.version_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:App.GetCandyData.version)
+}
+
+// required bytes assetId = 2;
+inline bool GetCandyData::_internal_has_assetid() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool GetCandyData::has_assetid() const {
+  return _internal_has_assetid();
+}
+inline void GetCandyData::clear_assetid() {
+  _impl_.assetid_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& GetCandyData::assetid() const {
+  // @@protoc_insertion_point(field_get:App.GetCandyData.assetId)
+  return _internal_assetid();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GetCandyData::set_assetid(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.assetid_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:App.GetCandyData.assetId)
+}
+inline std::string* GetCandyData::mutable_assetid() {
+  std::string* _s = _internal_mutable_assetid();
+  // @@protoc_insertion_point(field_mutable:App.GetCandyData.assetId)
+  return _s;
+}
+inline const std::string& GetCandyData::_internal_assetid() const {
+  return _impl_.assetid_.Get();
+}
+inline void GetCandyData::_internal_set_assetid(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.assetid_.Set(value, GetArenaForAllocation());
+}
+inline std::string* GetCandyData::_internal_mutable_assetid() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.assetid_.Mutable(GetArenaForAllocation());
+}
+inline std::string* GetCandyData::release_assetid() {
+  // @@protoc_insertion_point(field_release:App.GetCandyData.assetId)
+  if (!_internal_has_assetid()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.assetid_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.assetid_.IsDefault()) {
+    _impl_.assetid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void GetCandyData::set_allocated_assetid(std::string* assetid) {
+  if (assetid != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.assetid_.SetAllocated(assetid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.assetid_.IsDefault()) {
+    _impl_.assetid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:App.GetCandyData.assetId)
+}
+
+// required int64 amount = 3;
+inline bool GetCandyData::_internal_has_amount() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool GetCandyData::has_amount() const {
+  return _internal_has_amount();
+}
+inline void GetCandyData::clear_amount() {
+  _impl_.amount_ = int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline int64_t GetCandyData::_internal_amount() const {
+  return _impl_.amount_;
+}
+inline int64_t GetCandyData::amount() const {
+  // @@protoc_insertion_point(field_get:App.GetCandyData.amount)
+  return _internal_amount();
+}
+inline void GetCandyData::_internal_set_amount(int64_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.amount_ = value;
+}
+inline void GetCandyData::set_amount(int64_t value) {
+  _internal_set_amount(value);
+  // @@protoc_insertion_point(field_set:App.GetCandyData.amount)
+}
+
+// required bytes remarks = 4;
+inline bool GetCandyData::_internal_has_remarks() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool GetCandyData::has_remarks() const {
+  return _internal_has_remarks();
+}
+inline void GetCandyData::clear_remarks() {
+  _impl_.remarks_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const std::string& GetCandyData::remarks() const {
+  // @@protoc_insertion_point(field_get:App.GetCandyData.remarks)
+  return _internal_remarks();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GetCandyData::set_remarks(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000004u;
+ _impl_.remarks_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:App.GetCandyData.remarks)
+}
+inline std::string* GetCandyData::mutable_remarks() {
+  std::string* _s = _internal_mutable_remarks();
+  // @@protoc_insertion_point(field_mutable:App.GetCandyData.remarks)
+  return _s;
+}
+inline const std::string& GetCandyData::_internal_remarks() const {
+  return _impl_.remarks_.Get();
+}
+inline void GetCandyData::_internal_set_remarks(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.remarks_.Set(value, GetArenaForAllocation());
+}
+inline std::string* GetCandyData::_internal_mutable_remarks() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  return _impl_.remarks_.Mutable(GetArenaForAllocation());
+}
+inline std::string* GetCandyData::release_remarks() {
+  // @@protoc_insertion_point(field_release:App.GetCandyData.remarks)
+  if (!_internal_has_remarks()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  auto* p = _impl_.remarks_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.remarks_.IsDefault()) {
+    _impl_.remarks_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void GetCandyData::set_allocated_remarks(std::string* remarks) {
+  if (remarks != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.remarks_.SetAllocated(remarks, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.remarks_.IsDefault()) {
+    _impl_.remarks_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:App.GetCandyData.remarks)
+}
+
+// -------------------------------------------------------------------
+
+// TransferSafeData
+
+// required bytes version = 1;
+inline bool TransferSafeData::_internal_has_version() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool TransferSafeData::has_version() const {
+  return _internal_has_version();
+}
+inline void TransferSafeData::clear_version() {
+  _impl_.version_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& TransferSafeData::version() const {
+  // @@protoc_insertion_point(field_get:App.TransferSafeData.version)
+  return _internal_version();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void TransferSafeData::set_version(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.version_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:App.TransferSafeData.version)
+}
+inline std::string* TransferSafeData::mutable_version() {
+  std::string* _s = _internal_mutable_version();
+  // @@protoc_insertion_point(field_mutable:App.TransferSafeData.version)
+  return _s;
+}
+inline const std::string& TransferSafeData::_internal_version() const {
+  return _impl_.version_.Get();
+}
+inline void TransferSafeData::_internal_set_version(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.version_.Set(value, GetArenaForAllocation());
+}
+inline std::string* TransferSafeData::_internal_mutable_version() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.version_.Mutable(GetArenaForAllocation());
+}
+inline std::string* TransferSafeData::release_version() {
+  // @@protoc_insertion_point(field_release:App.TransferSafeData.version)
+  if (!_internal_has_version()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.version_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.version_.IsDefault()) {
+    _impl_.version_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void TransferSafeData::set_allocated_version(std::string* version) {
+  if (version != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.version_.SetAllocated(version, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.version_.IsDefault()) {
+    _impl_.version_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:App.TransferSafeData.version)
+}
+
+// required bytes remarks = 2;
+inline bool TransferSafeData::_internal_has_remarks() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool TransferSafeData::has_remarks() const {
+  return _internal_has_remarks();
+}
+inline void TransferSafeData::clear_remarks() {
+  _impl_.remarks_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& TransferSafeData::remarks() const {
+  // @@protoc_insertion_point(field_get:App.TransferSafeData.remarks)
+  return _internal_remarks();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void TransferSafeData::set_remarks(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.remarks_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:App.TransferSafeData.remarks)
+}
+inline std::string* TransferSafeData::mutable_remarks() {
+  std::string* _s = _internal_mutable_remarks();
+  // @@protoc_insertion_point(field_mutable:App.TransferSafeData.remarks)
+  return _s;
+}
+inline const std::string& TransferSafeData::_internal_remarks() const {
+  return _impl_.remarks_.Get();
+}
+inline void TransferSafeData::_internal_set_remarks(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.remarks_.Set(value, GetArenaForAllocation());
+}
+inline std::string* TransferSafeData::_internal_mutable_remarks() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.remarks_.Mutable(GetArenaForAllocation());
+}
+inline std::string* TransferSafeData::release_remarks() {
+  // @@protoc_insertion_point(field_release:App.TransferSafeData.remarks)
+  if (!_internal_has_remarks()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.remarks_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.remarks_.IsDefault()) {
+    _impl_.remarks_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void TransferSafeData::set_allocated_remarks(std::string* remarks) {
+  if (remarks != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.remarks_.SetAllocated(remarks, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.remarks_.IsDefault()) {
+    _impl_.remarks_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:App.TransferSafeData.remarks)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace App
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_app_2eproto
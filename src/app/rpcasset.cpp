@@ -16,13 +16,13 @@
 #include "main.h"
 #include "masternode-sync.h"
 #include "txmempool.h"
+#include "candyengine.h"
+#include "assetamount.h"
 #include <boost/regex.hpp>
+#include <boost/algorithm/string.hpp>
 
 using namespace std;
 
-extern std::mutex g_mutexAllCandyInfo;
-extern std::vector<CCandy_BlockTime_Info> gAllCandyInfoVec;
-
 void EnsureWalletIsUnlocked();
 bool EnsureWalletIsAvailable(bool avoidException);
 
@@ -123,12 +123,7 @@ UniValue issueasset(const UniValue& params, bool fHelp)
             throw JSONRPCError(RPC_INVALID_PARAMETER, "Need candy information");
 
         nCandyAmount = AmountFromValue(params[9], nAssetDecimals, true);
-        char totalAmountStr[64] = "",candyAmountStr[64]="";
-        snprintf(totalAmountStr,sizeof(totalAmountStr),"%" PRId64,nAssetTotalAmount);
-        snprintf(candyAmountStr,sizeof(candyAmountStr),"%" PRId64,nCandyAmount);
-        string candyMinStr = numtofloatstring(totalAmountStr,3); // 1‰
-        string candyMaxStr = numtofloatstring(totalAmountStr,1); // 10%
-        if(compareFloatString(candyAmountStr,candyMinStr)<0 || compareFloatString(candyAmountStr,candyMaxStr)>0)
+        if(!IsCandyAmountInRange(nCandyAmount, nAssetTotalAmount))
             throw JSONRPCError(INVALID_CANDYAMOUNT, "Candy amount out of range (min: 0.001 * total, max: 0.1 * total)");
         if(nCandyAmount >= nFirstIssueAmount)
             throw JSONRPCError(CANDY_EXCEED_FIRST, "Candy amout exceed first issue amount");
@@ -518,12 +513,7 @@ UniValue putcandy(const UniValue& params, bool fHelp)
         throw JSONRPCError(INSUFFICIENT_AUTH_FOR_APPCMD, "You are not the admin");
 
     CAmount nAmount = AmountFromValue(params[1], assetInfo.assetData.nDecimals, true);
-    char totalAmountStr[64] = "",candyAmountStr[64]="";
-    snprintf(totalAmountStr,sizeof(totalAmountStr),"%" PRId64,assetInfo.assetData.nTotalAmount);
-    snprintf(candyAmountStr,sizeof(candyAmountStr),"%" PRId64,nAmount);
-    string candyMinStr = numtofloatstring(totalAmountStr,3); // 1‰
-    string candyMaxStr = numtofloatstring(totalAmountStr,1); // 10%
-    if(compareFloatString(candyAmountStr,candyMinStr)<0 || compareFloatString(candyAmountStr,candyMaxStr)>0)
+    if(!IsCandyAmountInRange(nAmount, assetInfo.assetData.nTotalAmount))
         throw JSONRPCError(INVALID_CANDYAMOUNT, "Candy amount out of range (min: 0.001 * total, max: 0.1 * total)");
 
     uint16_t nExpired = (uint16_t)params[2].get_int();
@@ -810,31 +800,8 @@ UniValue getcandy(const UniValue& params, bool fHelp)
         }
 
         //erase candy
-        std::lock_guard<std::mutex> lock(g_mutexAllCandyInfo);
-        int size = gAllCandyInfoVec.size();
-        bool found = false;
-        for(int i=0;i<size;i++)
-        {
-            CCandy_BlockTime_Info& info = gAllCandyInfoVec[i];
-            if(assetId!=info.assetId)
-                continue;
-            if(candyInfo.nAmount!=info.candyinfo.nAmount)
-                continue;
-            if(candyInfo.nExpired!=info.candyinfo.nExpired)
-                continue;
-            if(assetIdCandyInfo.out.n!=info.outpoint.n)
-                continue;
-            if(assetIdCandyInfo.out.hash!=info.outpoint.hash)
-                continue;
-            if(nTxHeight!=info.nHeight)
-                continue;
-            found = true;
-            gAllCandyInfoVec.erase(gAllCandyInfoVec.begin()+i);
-            break;
-        }
-        if(!found){
+        if(!candyinfostore.Erase(assetIdCandyInfo.out))
             LogPrintf("erase candy not found,height:%d,assetId:%s\n", nTxHeight,assetId.ToString());
-        }
     }
 
     return ret;
@@ -1112,102 +1079,169 @@ UniValue getlocalassetinfo(const UniValue& params, bool fHelp)
     return ret;
 }
 
+static std::string AssetTxCursorToString(const CAssetTxCursor& cursor)
+{
+    return strprintf("%d-%s", cursor.nHeight, cursor.txId.GetHex());
+}
+
+static bool AssetTxCursorFromString(const std::string& strCursor, CAssetTxCursor& cursor)
+{
+    std::vector<std::string> vStr;
+    boost::split(vStr, strCursor, boost::is_any_of("-"));
+    if(vStr.size() != 2 || !IsHex(vStr[1]) || vStr[1].size() != 64)
+        return false;
+
+    int32_t nHeight = 0;
+    if(!ParseInt32(vStr[0], &nHeight) || nHeight < 0)
+        return false;
+
+    cursor.nHeight = nHeight;
+    cursor.txId = uint256S(vStr[1]);
+    return true;
+}
+
+static size_t ParseAssetTxCount(const UniValue& param)
+{
+    int nParamCount = param.get_int();
+    if(nParamCount <= 0)
+        throw JSONRPCError(RPC_INVALID_PARAMETER, "Invalid count, must be positive");
+    return nParamCount;
+}
+
+static CAssetTxCursor ParseAssetTxCursor(const UniValue& param)
+{
+    CAssetTxCursor cursor;
+    if(!AssetTxCursorFromString(param.get_str(), cursor))
+        throw JSONRPCError(RPC_INVALID_PARAMETER, "Invalid cursor");
+    return cursor;
+}
+
+/** Adds the txids ForEachAssetTx() visits to a page of at most nCount, only the wallet ones if pwallet is set */
+class CAssetTxPage
+{
+private:
+    UniValue& txList;
+    size_t nCount;
+    bool& fVisited;
+    CWallet* pwallet;
+
+public:
+    CAssetTxPage(UniValue& txList, const size_t nCount, bool& fVisited, CWallet* pwallet = NULL)
+        : txList(txList), nCount(nCount), fVisited(fVisited), pwallet(pwallet) {}
+
+    bool operator()(const uint256& txId)
+    {
+        if(txList.size() >= nCount)
+            return false;
+        fVisited = true;
+        if(pwallet)
+        {
+            LOCK(pwallet->cs_wallet);
+            if(!pwallet->mapWallet.count(txId))
+                return true;
+        }
+        txList.push_back(txId.GetHex());
+        return true;
+    }
+};
+
 UniValue getassetidtxids(const UniValue& params, bool fHelp)
 {
-    if (fHelp || params.size() != 2)
+    if (fHelp || params.size() < 2 || params.size() > 4)
         throw runtime_error(
-            "getassetidtxids \"assetId\" txClass\n"
-            "\nReturns list of transactions by specified asset id and transaction type.\n"
+            "getassetidtxids \"assetId\" txClass ( count \"cursor\" )\n"
+            "\nReturns list of transactions by specified asset id and transaction type, in block height order.\n"
             "\nArguments:\n"
             "1. \"assetId\"             (string, required) The asset id for transaction lookup\n"
             "2. txClass                 (numeric, required) The transaction type (1=all, 2=normal, 3=locked)\n"
+            "3. count                   (numeric, optional) The maximum number of transactions to return, all of them by default\n"
+            "4. \"cursor\"              (string, optional) The nextCursor of the previous page, start from the first transaction if omitted\n"
             "\nResult:\n"
             "{\n"
             "    \"txList\":\n"
             "    [\n"
             "        \"txId\"\n"
             "        ,...\n"
-            "    ]\n"
+            "    ],\n"
+            "    \"nextCursor\": \"xxxxx\"   (string) Cursor of the next page, only present when there are more transactions\n"
             "}\n"
             "\nExamples:\n"
             + HelpExampleCli("getassetidtxids", "\"723468197263af02cdf836aa12033864df0de857780dcb7982262efface6afdd\" 1")
+            + HelpExampleCli("getassetidtxids", "\"723468197263af02cdf836aa12033864df0de857780dcb7982262efface6afdd\" 1 100")
             + HelpExampleRpc("getassetidtxids", "\"723468197263af02cdf836aa12033864df0de857780dcb7982262efface6afdd\", 3")
         );
 
-    LOCK(cs_main);
-
     uint256 assetId = uint256S(TrimString(params[0].get_str()));
     uint8_t nTxClass = (uint8_t)params[1].get_int();
     if(nTxClass < 1 || nTxClass > sporkManager.GetSporkValue(SPORK_105_TX_CLASS_MAX_VALUE))
         throw JSONRPCError(RPC_INVALID_PARAMETER, "Invalid type of transaction");
 
-    vector<COutPoint> vOut;
-    if(!GetTxInfoByAssetIdTxClass(assetId, nTxClass, vOut))
-        throw JSONRPCError(GET_TXID_FAILED, "No transaction available about asset");
+    size_t nCount = params.size() > 2 ? ParseAssetTxCount(params[2]) : std::numeric_limits<size_t>::max();
+    CAssetTxCursor cursor = params.size() > 3 ? ParseAssetTxCursor(params[3]) : CAssetTxCursor();
 
-    std::vector<uint256> vTx;
-    BOOST_FOREACH(const COutPoint& out, vOut)
-    {
-        if(find(vTx.begin(), vTx.end(), out.hash) == vTx.end())
-            vTx.push_back(out.hash);
-    }
+    // the index is read without cs_main
+    UniValue transactionList(UniValue::VARR);
+    bool fVisited = false;
+    bool fMore = ForEachAssetTx(assetId, "", nTxClass, cursor, CAssetTxPage(transactionList, nCount, fVisited));
+    if(!fVisited && params.size() < 4)
+        throw JSONRPCError(GET_TXID_FAILED, "No transaction available about asset");
 
     UniValue ret(UniValue::VOBJ);
-    UniValue transactionList(UniValue::VARR);
-    for(unsigned int i = 0; i < vTx.size(); i++)
-        transactionList.push_back(vTx[i].GetHex());
     ret.push_back(Pair("txList", transactionList));
+    if(fMore)
+        ret.push_back(Pair("nextCursor", AssetTxCursorToString(cursor)));
 
     return ret;
 }
 
 UniValue getaddrassettxids(const UniValue& params, bool fHelp)
 {
-    if (fHelp || params.size() != 3)
+    if (fHelp || params.size() < 3 || params.size() > 5)
         throw runtime_error(
-            "getaddrassettxids \"safeAddress\" \"assetId\" txClass\n"
-            "\nReturns list of transactions by specified address, asset id and transaction type.\n"
+            "getaddrassettxids \"safeAddress\" \"assetId\" txClass ( count \"cursor\" )\n"
+            "\nReturns list of transactions by specified address, asset id and transaction type, in block height order.\n"
             "\nArguments:\n"
             "1. \"safeAddress\"         (string, required) The Safe address for transaction lookup\n"
             "2. \"assetId\"             (string, required) The asset id for transaction lookup\n"
             "3. txClass                 (numeric, required) The transaction type (1=all, 2=normal, 3=locked)\n"
+            "4. count                   (numeric, optional) The maximum number of transactions to return, all of them by default\n"
+            "5. \"cursor\"              (string, optional) The nextCursor of the previous page, start from the first transaction if omitted\n"
             "\nResult:\n"
             "{\n"
             "    \"txList\":\n"
             "    [\n"
             "        \"txId\"\n"
             "        ,...\n"
-            "    ]\n"
+            "    ],\n"
+            "    \"nextCursor\": \"xxxxx\"   (string) Cursor of the next page, only present when there are more transactions\n"
             "}\n"
             "\nExamples:\n"
             + HelpExampleCli("getaddrassettxids", "\"Xg1wCDXKuv4rEfsR9Ldv2qmUHSS9Ds1VCL\" \"723468197263af02cdf836aa12033864df0de857780dcb7982262efface6afdd\" 1")
+            + HelpExampleCli("getaddrassettxids", "\"Xg1wCDXKuv4rEfsR9Ldv2qmUHSS9Ds1VCL\" \"723468197263af02cdf836aa12033864df0de857780dcb7982262efface6afdd\" 1 100")
             + HelpExampleRpc("getaddrassettxids", "\"Xg1wCDXKuv4rEfsR9Ldv2qmUHSS9Ds1VCL\", \"723468197263af02cdf836aa12033864df0de857780dcb7982262efface6afdd\", 3")
         );
 
-    LOCK(cs_main);
-
     string strAddress = TrimString(params[0].get_str());
     uint256 assetId = uint256S(TrimString(params[1].get_str()));
     uint8_t nTxClass = (uint8_t)params[2].get_int();
     if(nTxClass < 1 || nTxClass > sporkManager.GetSporkValue(SPORK_105_TX_CLASS_MAX_VALUE))
         throw JSONRPCError(RPC_INVALID_PARAMETER, "Invalid type of transaction");
+    if(strAddress.empty())
+        throw JSONRPCError(RPC_INVALID_ADDRESS_OR_KEY, "Invalid Safe address");
 
-    vector<COutPoint> vOut;
-    if(!GetTxInfoByAssetIdAddressTxClass(assetId, strAddress, nTxClass, vOut))
-        throw JSONRPCError(GET_TXID_FAILED, "No transaction available about asset with specified address");
+    size_t nCount = params.size() > 3 ? ParseAssetTxCount(params[3]) : std::numeric_limits<size_t>::max();
+    CAssetTxCursor cursor = params.size() > 4 ? ParseAssetTxCursor(params[4]) : CAssetTxCursor();
 
-    UniValue ret(UniValue::VOBJ);
     UniValue transactionList(UniValue::VARR);
+    bool fVisited = false;
+    bool fMore = ForEachAssetTx(assetId, strAddress, nTxClass, cursor, CAssetTxPage(transactionList, nCount, fVisited));
+    if(!fVisited && params.size() < 5)
+        throw JSONRPCError(GET_TXID_FAILED, "No transaction available about asset with specified address");
 
-    vector<uint256> vHash;
-    BOOST_FOREACH(const COutPoint& out, vOut)
-    {
-        if(find(vHash.begin(), vHash.end(), out.hash) == vHash.end())
-            vHash.push_back(out.hash);
-    }
-    for(unsigned int i = 0; i < vHash.size(); i++)
-        transactionList.push_back(vHash[i].GetHex());
+    UniValue ret(UniValue::VOBJ);
     ret.push_back(Pair("txList", transactionList));
+    if(fMore)
+        ret.push_back(Pair("nextCursor", AssetTxCursorToString(cursor)));
 
     return ret;
 }
@@ -1245,109 +1279,23 @@ UniValue getaddrassetbalance(const UniValue& params, bool fHelp)
     if (assetId.IsNull() || !GetAssetInfoByAssetId(assetId, assetInfo))
         throw JSONRPCError(NONEXISTENT_ASSETID, "Non-existent asset id");
 
-    vector<COutPoint> vOut;
-    if (!GetTxInfoByAssetIdAddressTxClass(assetId, strAddress, 1, vOut))
+    CAssetBalance_IndexValue balance;
+    if (!GetAssetBalance(strAddress, assetId, balance))
         throw JSONRPCError(GET_TXID_FAILED, "No transaction available about asset with specified address");
 
-    std::string TotalSendAmount = "";
-    std::string TotalReceiveAmount = "";
-    std::string TotalLockingAmount = "";
-    std::string Totalbalance = "";
-
-    vector<uint256> vHash;
-    BOOST_FOREACH(const COutPoint& out, vOut)
-    {
-        if(find(vHash.begin(), vHash.end(), out.hash) == vHash.end())
-            vHash.push_back(out.hash);
-    }
-
-    vector<uint256>::iterator it = vHash.begin();
-    for (; it != vHash.end(); it++)
-    {
-        CTransaction tx;
-        uint256 hashBlock;
-        if (GetTransaction(*it, tx, Params().GetConsensus(), hashBlock, true))
-        {
-            BOOST_FOREACH(const CTxOut& txout, tx.vout)
-            {
-                if (!txout.IsAsset())
-                    continue;
-
-                CTxDestination tempdest;
-                if (!ExtractDestination(txout.scriptPubKey, tempdest))
-                    continue;
-
-                if (!CBitcoinAddress(tempdest).IsValid())
-                    continue;
-
-                std::string strtempAddress = CBitcoinAddress(tempdest).ToString();
-                if (strtempAddress == strAddress)
-                {
-                    char ctempdata[64] = {0};
-                    sprintf(ctempdata, "%" PRId64, txout.nValue);
-                    TotalReceiveAmount = plusstring(TotalReceiveAmount, ctempdata);
-
-                    if (txout.nUnlockedHeight > chainActive.Height())
-                        TotalLockingAmount = plusstring(TotalLockingAmount, ctempdata);
-                }
-            }
-
-            if (!tx.IsCoinBase())
-            {
-                BOOST_FOREACH(const CTxIn& txin, tx.vin)
-                {
-                    CTransaction temptx;
-                    uint256 hashBlock;
-                    if (!GetTransaction(txin.prevout.hash, temptx, Params().GetConsensus(), hashBlock, true))
-                        continue;
-
-                    const CTxOut& txout = temptx.vout[txin.prevout.n];
-                    if (!txout.IsAsset())
-                        continue;
-
-                    CTxDestination tempdest;
-                    if (!ExtractDestination(txout.scriptPubKey, tempdest))
-                    {
-                        continue;
-                    }
-
-                    if (!CBitcoinAddress(tempdest).IsValid())
-                        continue;
-
-                    std::string strtempAddress = CBitcoinAddress(tempdest).ToString();
-                    if (strtempAddress == strAddress)
-                    {
-                        char ctempdata[64] = {0};
-                        sprintf(ctempdata, "%" PRId64, txout.nValue);
-                        TotalSendAmount = plusstring(TotalSendAmount, ctempdata);
-                    }
-                }
-            }
-        }
-    }
+    const CAssetAmount& TotalReceiveAmount = balance.nReceived;
+    const CAssetAmount& TotalSendAmount = balance.nSent;
+    CAssetAmount TotalLockingAmount = balance.GetLockedAmount(chainActive.Height());
 
-    Totalbalance = minusstring(TotalReceiveAmount, TotalSendAmount);
+    CAssetAmount Totalbalance = TotalReceiveAmount;
+    if (!Totalbalance.Sub(TotalSendAmount))
+        throw JSONRPCError(RPC_INTERNAL_ERROR, "Asset amount overflow");
 
     UniValue ret(UniValue::VOBJ);
-    if (TotalReceiveAmount.length() <= assetInfo.assetData.nDecimals)
-        ret.push_back(Pair("ReceiveAmount",  StrValueFromAmount(atol(TotalReceiveAmount.c_str()), assetInfo.assetData.nDecimals)));
-    else
-        ret.push_back(Pair("ReceiveAmount",  numtofloatstring(TotalReceiveAmount, assetInfo.assetData.nDecimals)));
-
-    if (TotalSendAmount.length() <= assetInfo.assetData.nDecimals)
-        ret.push_back(Pair("SendAmount",  StrValueFromAmount(atol(TotalSendAmount.c_str()), assetInfo.assetData.nDecimals)));
-    else
-        ret.push_back(Pair("SendAmount",  numtofloatstring(TotalSendAmount, assetInfo.assetData.nDecimals)));
-
-    if (Totalbalance.length() <= assetInfo.assetData.nDecimals)
-        ret.push_back(Pair("totalAmount",  StrValueFromAmount(atol(Totalbalance.c_str()), assetInfo.assetData.nDecimals)));
-    else
-         ret.push_back(Pair("totalAmount",  numtofloatstring(Totalbalance, assetInfo.assetData.nDecimals)));
-
-    if (TotalLockingAmount.length() <= assetInfo.assetData.nDecimals)
-        ret.push_back(Pair("lockAmount",  StrValueFromAmount(atol(TotalLockingAmount.c_str()), assetInfo.assetData.nDecimals)));
-    else
-        ret.push_back(Pair("lockAmount",  numtofloatstring(TotalLockingAmount, assetInfo.assetData.nDecimals)));
+    ret.push_back(Pair("ReceiveAmount", TotalReceiveAmount.ToString(assetInfo.assetData.nDecimals)));
+    ret.push_back(Pair("SendAmount", TotalSendAmount.ToString(assetInfo.assetData.nDecimals)));
+    ret.push_back(Pair("totalAmount", Totalbalance.ToString(assetInfo.assetData.nDecimals)));
+    ret.push_back(Pair("lockAmount", TotalLockingAmount.ToString(assetInfo.assetData.nDecimals)));
 
     return ret;
 }
@@ -1837,12 +1785,38 @@ UniValue getaddresscandylist(const UniValue& params, bool fHelp)
     return entry;
 }
 
+static std::string CandyCursorToString(const CCandy_BlockTime_Info& info)
+{
+    return strprintf("%d-%s-%s-%u", info.blocktime, info.assetId.GetHex(), info.outpoint.hash.GetHex(), info.outpoint.n);
+}
+
+static bool CandyCursorFromString(const std::string& strCursor, CCandy_BlockTime_Info& info)
+{
+    std::vector<std::string> vStr;
+    boost::split(vStr, strCursor, boost::is_any_of("-"));
+    if(vStr.size() != 4 || !IsHex(vStr[1]) || vStr[1].size() != 64 || !IsHex(vStr[2]) || vStr[2].size() != 64)
+        return false;
+
+    int64_t nBlockTime = 0;
+    int32_t n = 0;
+    if(!ParseInt64(vStr[0], &nBlockTime) || !ParseInt32(vStr[3], &n) || n < 0)
+        return false;
+
+    info.blocktime = nBlockTime;
+    info.assetId = uint256S(vStr[1]);
+    info.outpoint = COutPoint(uint256S(vStr[2]), n);
+    return true;
+}
+
 UniValue getavailablecandylist(const UniValue& params, bool fHelp)
 {
-    if (fHelp || params.size() != 0)
+    if (fHelp || params.size() > 2)
         throw runtime_error(
-            "getavailablecandylist\n"
+            "getavailablecandylist ( count \"cursor\" )\n"
             "\nReturns available candy list which can be gotten.\n"
+            "\nArguments:\n"
+            "1. count                      (numeric, optional) The maximum number of candies to return, all of them by default\n"
+            "2. \"cursor\"                   (string, optional) The nextCursor of the previous page, start from the newest candy if omitted\n"
             "\nResult:\n"
             "{\n"
             "   \"candyList\": \n"
@@ -1860,27 +1834,45 @@ UniValue getavailablecandylist(const UniValue& params, bool fHelp)
             "           \"assetCandyAmount\": xxxxx\n"
             "           \"candyExpired\": xxxxx\n"
             "       }\n"
-            "   ]\n"
+            "   ],\n"
+            "   \"nextCursor\": \"xxxxx\"     (string) Cursor of the next page, only present when the page is full\n"
             "}\n"
             "\nExamples:\n"
             + HelpExampleCli("getavailablecandylist", "")
-            + HelpExampleRpc("getavailablecandylist", "")
+            + HelpExampleCli("getavailablecandylist", "20")
+            + HelpExampleCli("getavailablecandylist", "20 \"1546272000-<assetId>-<txid>-0\"")
+            + HelpExampleRpc("getavailablecandylist", "20")
         );
 
-    vector<CCandy_BlockTime_Info> tempAllCandyInfoVec;
+    size_t nCount = std::numeric_limits<size_t>::max();
+    if(params.size() > 0)
+    {
+        int nParamCount = params[0].get_int();
+        if(nParamCount <= 0)
+            throw JSONRPCError(RPC_INVALID_PARAMETER, "Invalid count, must be positive");
+        nCount = nParamCount;
+    }
+
+    CCandy_BlockTime_Info cursor(uint256(), CAssetData(), CCandyInfo(), COutPoint(), 0, 0);
+    bool fCursor = false;
+    if(params.size() > 1)
     {
-        std::lock_guard<std::mutex> lock(g_mutexAllCandyInfo);
-        tempAllCandyInfoVec.assign(gAllCandyInfoVec.begin(), gAllCandyInfoVec.end());
+        if(!CandyCursorFromString(params[1].get_str(), cursor))
+            throw JSONRPCError(RPC_INVALID_PARAMETER, "Invalid cursor");
+        fCursor = true;
     }
 
-    if(tempAllCandyInfoVec.empty())
+    vector<CCandy_BlockTime_Info> vCandyInfo;
+    candyinfostore.GetPageAfter(fCursor ? &cursor : NULL, nCount, vCandyInfo);
+
+    if(vCandyInfo.empty() && !fCursor && !candyengine.IsIdle())
         throw JSONRPCError(COLLECTING_CANDYLIST, "Collecting available candy list, please wait...");
 
     UniValue ret(UniValue::VOBJ);
     UniValue candyList(UniValue::VARR);
-    for(unsigned int i = 0; i < tempAllCandyInfoVec.size(); i++)
+    for(unsigned int i = 0; i < vCandyInfo.size(); i++)
     {
-        const CCandy_BlockTime_Info& info = tempAllCandyInfoVec[i];
+        const CCandy_BlockTime_Info& info = vCandyInfo[i];
 
         UniValue candyObj(UniValue::VOBJ);
         candyObj.push_back(Pair("putTime", info.blocktime));
@@ -1891,6 +1883,8 @@ UniValue getavailablecandylist(const UniValue& params, bool fHelp)
     }
 
     ret.push_back(Pair("candyList", candyList));
+    if(!vCandyInfo.empty() && vCandyInfo.size() == nCount)
+        ret.push_back(Pair("nextCursor", CandyCursorToString(vCandyInfo.back())));
     return ret;
 }
 
@@ -2127,58 +2121,49 @@ UniValue transfermanyasset(const UniValue& params, bool fHelp)
 
 UniValue getassetlocaltxlist(const UniValue& params, bool fHelp)
 {
-    if (fHelp || params.size() != 2)
+    if (fHelp || params.size() < 2 || params.size() > 4)
         throw runtime_error(
-            "getassetlocaltxlist \"assetId\" txClass\n"
-            "\nReturns list of local transactions by specified asset id and transaction type.\n"
+            "getassetlocaltxlist \"assetId\" txClass ( count \"cursor\" )\n"
+            "\nReturns list of local transactions by specified asset id and transaction type, in block height order.\n"
             "\nArguments:\n"
             "1. \"assetId\"             (string, required) The asset id for transaction lookup\n"
             "2. txClass                 (numeric, required) The transaction type (1=all, 2=normal, 3=locked,4=issue,5=addissue,6=destory)\n"
+            "3. count                   (numeric, optional) The maximum number of transactions to return, all of them by default\n"
+            "4. \"cursor\"              (string, optional) The nextCursor of the previous page, start from the first transaction if omitted\n"
             "\nResult:\n"
             "{\n"
             "    \"txList\":\n"
             "    [\n"
             "        \"txId\"\n"
             "        ,...\n"
-            "    ]\n"
+            "    ],\n"
+            "    \"nextCursor\": \"xxxxx\"   (string) Cursor of the next page, only present when there are more transactions\n"
             "}\n"
             "\nExamples:\n"
             + HelpExampleCli("getassetlocaltxlist", "\"723468197263af02cdf836aa12033864df0de857780dcb7982262efface6afdd\" 1")
+            + HelpExampleCli("getassetlocaltxlist", "\"723468197263af02cdf836aa12033864df0de857780dcb7982262efface6afdd\" 1 100")
             + HelpExampleRpc("getassetlocaltxlist", "\"723468197263af02cdf836aa12033864df0de857780dcb7982262efface6afdd\", 3")
         );
 
-    LOCK2(cs_main, pwalletMain->cs_wallet);
-
     uint256 assetId = uint256S(TrimString(params[0].get_str()));
     uint8_t nTxClass = (uint8_t)params[1].get_int();
     if(nTxClass < 1 || nTxClass > sporkManager.GetSporkValue(SPORK_105_TX_CLASS_MAX_VALUE))
         throw JSONRPCError(RPC_INVALID_PARAMETER, "Invalid type of transaction");
 
-    vector<COutPoint> vOut;
-    if(!GetTxInfoByAssetIdTxClass(assetId, nTxClass, vOut))
-        throw JSONRPCError(GET_TXID_FAILED, "No transaction available about asset");
+    size_t nCount = params.size() > 2 ? ParseAssetTxCount(params[2]) : std::numeric_limits<size_t>::max();
+    CAssetTxCursor cursor = params.size() > 3 ? ParseAssetTxCursor(params[3]) : CAssetTxCursor();
 
-    std::vector<uint256> vTx;
-    BOOST_FOREACH(const COutPoint& out, vOut)
-    {
-        if(find(vTx.begin(), vTx.end(), out.hash) == vTx.end())
-            vTx.push_back(out.hash);
-    }
-
-    std::vector<uint256> vlocalTx;
-    std::vector<uint256>::iterator it = vTx.begin();
-    for (; it != vTx.end(); it++)
-    {
-        std::map<uint256, CWalletTx>::iterator tempit = pwalletMain->mapWallet.find(*it);
-        if (tempit != pwalletMain->mapWallet.end())
-            vlocalTx.push_back(*it);
-    }
+    // cs_wallet is only taken per transaction, the index is read without cs_main
+    UniValue transactionList(UniValue::VARR);
+    bool fVisited = false;
+    bool fMore = ForEachAssetTx(assetId, "", nTxClass, cursor, CAssetTxPage(transactionList, nCount, fVisited, pwalletMain));
+    if(!fVisited && params.size() < 4)
+        throw JSONRPCError(GET_TXID_FAILED, "No transaction available about asset");
 
     UniValue ret(UniValue::VOBJ);
-    UniValue transactionList(UniValue::VARR);
-    for(unsigned int i = 0; i < vlocalTx.size(); i++)
-        transactionList.push_back(vlocalTx[i].GetHex());
     ret.push_back(Pair("txList", transactionList));
+    if(fMore)
+        ret.push_back(Pair("nextCursor", AssetTxCursorToString(cursor)));
 
     return ret;
 }
@@ -0,0 +1,169 @@
+// Copyright (c) 2018-2019 The Safe Core developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#ifndef SAFE_APPINDEX_H
+#define SAFE_APPINDEX_H
+
+#include "app/app.h"
+#include "primitives/transaction.h"
+#include "serialize.h"
+#include "uint256.h"
+
+#include <string>
+
+struct CAppTx_IndexKey
+{
+    uint256 appId;
+    std::string strAddress;
+    uint8_t nTxClass;
+    COutPoint out;
+
+    CAppTx_IndexKey(const uint256& appId = uint256(), const std::string& strAddress = "", const uint8_t& nTxClass = 0, const COutPoint& out = COutPoint())
+        : appId(appId), strAddress(strAddress), nTxClass(nTxClass), out(out) {
+    }
+
+    ADD_SERIALIZE_METHODS;
+
+    template <typename Stream, typename Operation>
+    inline void SerializationOp(Stream& s, Operation ser_action, int nType, int nVersion)
+    {
+        READWRITE(appId);
+        READWRITE(LIMITED_STRING(strAddress, MAX_ADDRESS_SIZE));
+        READWRITE(nTxClass);
+        READWRITE(out);
+    }
+
+    friend bool operator==(const CAppTx_IndexKey& a, const CAppTx_IndexKey& b)
+    {
+        return (a.appId == b.appId && a.strAddress == b.strAddress && a.nTxClass == b.nTxClass && a.out == b.out);
+    }
+};
+
+struct CAssetTx_IndexKey
+{
+    uint256 assetId;
+    std::string strAddress;
+    uint8_t nTxClass;
+    COutPoint out;
+
+    CAssetTx_IndexKey(const uint256& assetId = uint256(), const std::string& strAddress = "", const uint8_t& nTxClass = 0, const COutPoint& out = COutPoint())
+        : assetId(assetId), strAddress(strAddress), nTxClass(nTxClass), out(out) {
+    }
+
+    ADD_SERIALIZE_METHODS;
+
+    template <typename Stream, typename Operation>
+    inline void SerializationOp(Stream& s, Operation ser_action, int nType, int nVersion)
+    {
+        READWRITE(assetId);
+        READWRITE(LIMITED_STRING(strAddress, MAX_ADDRESS_SIZE));
+        READWRITE(nTxClass);
+        READWRITE(out);
+    }
+
+    friend bool operator==(const CAssetTx_IndexKey& a, const CAssetTx_IndexKey& b)
+    {
+        return (a.assetId == b.assetId && a.strAddress == b.strAddress && a.nTxClass == b.nTxClass && a.out == b.out);
+    }
+};
+
+/** CAssetTx_IndexKey ordered by height, the height is big endian so the keys of an asset sort by it */
+struct CAssetTxHeight_IndexKey
+{
+    uint256 assetId;
+    int nHeight;
+    COutPoint out;
+    std::string strAddress;
+    uint8_t nTxClass;
+
+    CAssetTxHeight_IndexKey(const uint256& assetId = uint256(), const int& nHeight = 0, const COutPoint& out = COutPoint())
+        : assetId(assetId), nHeight(nHeight), out(out), strAddress(""), nTxClass(0) {
+    }
+
+    CAssetTxHeight_IndexKey(const CAssetTx_IndexKey& key, const int& nHeight)
+        : assetId(key.assetId), nHeight(nHeight), out(key.out), strAddress(key.strAddress), nTxClass(key.nTxClass) {
+    }
+
+    size_t GetSerializeSize(int nType, int nVersion) const {
+        return 32 + 4 + 36 + ::GetSerializeSize(strAddress, nType, nVersion) + 1;
+    }
+    template<typename Stream>
+    void Serialize(Stream& s, int nType, int nVersion) const {
+        assetId.Serialize(s, nType, nVersion);
+        ser_writedata32be(s, nHeight);
+        out.Serialize(s, nType, nVersion);
+        ::Serialize(s, strAddress, nType, nVersion);
+        ser_writedata8(s, nTxClass);
+    }
+    template<typename Stream>
+    void Unserialize(Stream& s, int nType, int nVersion) {
+        assetId.Unserialize(s, nType, nVersion);
+        nHeight = ser_readdata32be(s);
+        out.Unserialize(s, nType, nVersion);
+        ::Unserialize(s, LIMITED_STRING(strAddress, MAX_ADDRESS_SIZE), nType, nVersion);
+        nTxClass = ser_readdata8(s);
+    }
+};
+
+/** CAssetTx_IndexKey ordered by address and height */
+struct CAddressAssetTxHeight_IndexKey
+{
+    uint256 assetId;
+    std::string strAddress;
+    int nHeight;
+    COutPoint out;
+    uint8_t nTxClass;
+
+    CAddressAssetTxHeight_IndexKey(const uint256& assetId = uint256(), const std::string& strAddress = "", const int& nHeight = 0, const COutPoint& out = COutPoint())
+        : assetId(assetId), strAddress(strAddress), nHeight(nHeight), out(out), nTxClass(0) {
+    }
+
+    CAddressAssetTxHeight_IndexKey(const CAssetTx_IndexKey& key, const int& nHeight)
+        : assetId(key.assetId), strAddress(key.strAddress), nHeight(nHeight), out(key.out), nTxClass(key.nTxClass) {
+    }
+
+    size_t GetSerializeSize(int nType, int nVersion) const {
+        return 32 + ::GetSerializeSize(strAddress, nType, nVersion) + 4 + 36 + 1;
+    }
+    template<typename Stream>
+    void Serialize(Stream& s, int nType, int nVersion) const {
+        assetId.Serialize(s, nType, nVersion);
+        ::Serialize(s, strAddress, nType, nVersion);
+        ser_writedata32be(s, nHeight);
+        out.Serialize(s, nType, nVersion);
+        ser_writedata8(s, nTxClass);
+    }
+    template<typename Stream>
+    void Unserialize(Stream& s, int nType, int nVersion) {
+        assetId.Unserialize(s, nType, nVersion);
+        ::Unserialize(s, LIMITED_STRING(strAddress, MAX_ADDRESS_SIZE), nType, nVersion);
+        nHeight = ser_readdata32be(s);
+        out.Unserialize(s, nType, nVersion);
+        nTxClass = ser_readdata8(s);
+    }
+};
+
+//! CAssetTxCursor height of the transactions in the mempool, they come after the confirmed ones
+static const int ASSETTX_CURSOR_MEMPOOL_HEIGHT = 0x7fffffff;
+
+/** Where a paged listing of asset transactions continues: after transaction txId at nHeight, from the start if txId is null */
+struct CAssetTxCursor
+{
+    int nHeight;
+    uint256 txId;
+
+    CAssetTxCursor(const int& nHeight = 0, const uint256& txId = uint256()) : nHeight(nHeight), txId(txId) {
+    }
+
+    ADD_SERIALIZE_METHODS;
+
+    template <typename Stream, typename Operation>
+    inline void SerializationOp(Stream& s, Operation ser_action, int nType, int nVersion)
+    {
+        READWRITE(nHeight);
+        READWRITE(txId);
+    }
+};
+
+#endif // SAFE_APPINDEX_H
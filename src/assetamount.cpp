@@ -0,0 +1,138 @@
+// Copyright (c) 2018-2019 The Safe Core developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "assetamount.h"
+
+#include <algorithm>
+#include <limits>
+
+typedef unsigned __int128 uvalue_type;
+
+static const CAssetAmount::value_type MAX_VALUE = (CAssetAmount::value_type)(~(uvalue_type)0 >> 1);
+static const CAssetAmount::value_type MIN_VALUE = -MAX_VALUE - 1;
+
+static uvalue_type Magnitude(const CAssetAmount::value_type n)
+{
+    return n < 0 ? (uvalue_type)0 - (uvalue_type)n : (uvalue_type)n;
+}
+
+bool CAssetAmount::Add(const CAssetAmount& other)
+{
+    if ((other.nValue > 0 && nValue > MAX_VALUE - other.nValue) || (other.nValue < 0 && nValue < MIN_VALUE - other.nValue))
+        return false;
+    nValue += other.nValue;
+    return true;
+}
+
+bool CAssetAmount::Sub(const CAssetAmount& other)
+{
+    if ((other.nValue < 0 && nValue > MAX_VALUE + other.nValue) || (other.nValue > 0 && nValue < MIN_VALUE + other.nValue))
+        return false;
+    nValue -= other.nValue;
+    return true;
+}
+
+bool CAssetAmount::Mul(const int64_t n)
+{
+    if (nValue == 0 || n == 0)
+    {
+        nValue = 0;
+        return true;
+    }
+
+    const bool fNegative = (nValue < 0) != (n < 0);
+    const uvalue_type nLimit = fNegative ? Magnitude(MIN_VALUE) : (uvalue_type)MAX_VALUE;
+    const uvalue_type a = Magnitude(nValue), b = Magnitude(n);
+    if (a > nLimit / b)
+        return false;
+
+    const uvalue_type nResult = a * b;
+    nValue = fNegative ? (value_type)((uvalue_type)0 - nResult) : (value_type)nResult;
+    return true;
+}
+
+bool CAssetAmount::Div(const int64_t n)
+{
+    if (n == 0 || (n == -1 && nValue == MIN_VALUE))
+        return false;
+    nValue /= n;
+    return true;
+}
+
+bool CAssetAmount::GetAmount(CAmount& nAmountOut) const
+{
+    if (nValue > std::numeric_limits<CAmount>::max() || nValue < std::numeric_limits<CAmount>::min())
+        return false;
+    nAmountOut = (CAmount)nValue;
+    return true;
+}
+
+std::string CAssetAmount::ToString(const int nDecimals) const
+{
+    // built from the last digit on, the number of decimals comes from the asset data and is not bounded here
+    std::string str;
+    str.reserve(42 + std::max(nDecimals, 0));
+
+    uvalue_type n = Magnitude(nValue);
+    int nDigits = 0;
+    do {
+        if (nDigits == nDecimals && nDecimals > 0)
+            str += '.';
+        str += '0' + (char)(n % 10);
+        n /= 10;
+        nDigits++;
+    } while (n != 0 || nDigits <= nDecimals);
+
+    if (nValue < 0)
+        str += '-';
+    return std::string(str.rbegin(), str.rend());
+}
+
+bool CAssetAmount::Parse(const std::string& str, const int nDecimals, CAssetAmount& amountOut)
+{
+    if (nDecimals < 0 || nDecimals > MAX_ASSETAMOUNT_DECIMALS)
+        return false;
+
+    size_t nPos = 0;
+    const bool fNegative = !str.empty() && str[0] == '-';
+    if (fNegative)
+        nPos++;
+
+    uvalue_type n = 0;
+    const uvalue_type nLimit = fNegative ? Magnitude(MIN_VALUE) : (uvalue_type)MAX_VALUE;
+    int nIntDigits = 0, nFracDigits = 0;
+    bool fPoint = false;
+    for (; nPos < str.size(); nPos++)
+    {
+        const char c = str[nPos];
+        if (c == '.')
+        {
+            if (fPoint)
+                return false;
+            fPoint = true;
+            continue;
+        }
+        if (c < '0' || c > '9')
+            return false;
+        if (fPoint && ++nFracDigits > nDecimals)
+            return false;
+        if (!fPoint)
+            nIntDigits++;
+        if (n > (nLimit - (c - '0')) / 10)
+            return false;
+        n = n * 10 + (c - '0');
+    }
+    if (nIntDigits == 0 && nFracDigits == 0)
+        return false;
+
+    for (; nFracDigits < nDecimals; nFracDigits++)
+    {
+        if (n > nLimit / 10)
+            return false;
+        n *= 10;
+    }
+
+    amountOut.nValue = fNegative ? (value_type)((uvalue_type)0 - n) : (value_type)n;
+    return true;
+}
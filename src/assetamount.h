@@ -0,0 +1,86 @@
+// Copyright (c) 2018-2019 The Safe Core developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#ifndef SAFE_ASSETAMOUNT_H
+#define SAFE_ASSETAMOUNT_H
+
+#include "amount.h"
+#include "serialize.h"
+
+#include <stdint.h>
+#include <string>
+
+//! maximum number of decimals accepted by CAssetAmount::Parse()
+static const int MAX_ASSETAMOUNT_DECIMALS = 30;
+
+/**
+ * Fixed-point asset amount with 128 bits of room.
+ *
+ * The value is counted in the smallest unit of the asset, like CAmount, the number
+ * of decimals is only used to parse and format it. Sums of many outputs and
+ * products like total * ratio don't fit in 64 bits, so the arithmetic is done on
+ * 128 bits and every operation reports an overflow instead of wrapping around.
+ */
+class CAssetAmount
+{
+public:
+    typedef __int128 value_type;
+
+private:
+    value_type nValue;
+
+public:
+    constexpr CAssetAmount() : nValue(0) {}
+    constexpr explicit CAssetAmount(const CAmount nValueIn) : nValue(nValueIn) {}
+
+    static constexpr CAssetAmount FromRaw(const value_type nValueIn) { return CAssetAmount(nValueIn, 0); }
+
+    constexpr value_type GetRaw() const { return nValue; }
+    constexpr bool IsZero() const { return nValue == 0; }
+    constexpr bool IsNegative() const { return nValue < 0; }
+
+    /** Add, subtract or multiply in place. On overflow false is returned and the value is left unchanged */
+    bool Add(const CAssetAmount& other);
+    bool Sub(const CAssetAmount& other);
+    bool Mul(const int64_t n);
+    /** Divide in place, rounding toward zero. Returns false for n == 0 */
+    bool Div(const int64_t n);
+
+    /** Returns false if the value doesn't fit in a CAmount */
+    bool GetAmount(CAmount& nAmountOut) const;
+
+    /** Format with nDecimals digits after the point, e.g. "-12.3400" for -123400 with 4 decimals, none if nDecimals <= 0 */
+    std::string ToString(const int nDecimals) const;
+    /**
+     * Parse a decimal string with at most nDecimals digits after the point. Leading and
+     * trailing spaces, exponents and empty parts ("", ".", "-") are rejected.
+     */
+    static bool Parse(const std::string& str, const int nDecimals, CAssetAmount& amountOut);
+
+    ADD_SERIALIZE_METHODS;
+
+    template <typename Stream, typename Operation>
+    inline void SerializationOp(Stream& s, Operation ser_action, int nType, int nVersion)
+    {
+        // two's complement, the high 64 bits first
+        uint64_t nHigh = (uint64_t)((unsigned __int128)nValue >> 64);
+        uint64_t nLow = (uint64_t)nValue;
+        READWRITE(nHigh);
+        READWRITE(nLow);
+        if (ser_action.ForRead())
+            nValue = (value_type)(((unsigned __int128)nHigh << 64) | nLow);
+    }
+
+    friend constexpr bool operator==(const CAssetAmount& a, const CAssetAmount& b) { return a.nValue == b.nValue; }
+    friend constexpr bool operator!=(const CAssetAmount& a, const CAssetAmount& b) { return a.nValue != b.nValue; }
+    friend constexpr bool operator<(const CAssetAmount& a, const CAssetAmount& b) { return a.nValue < b.nValue; }
+    friend constexpr bool operator>(const CAssetAmount& a, const CAssetAmount& b) { return a.nValue > b.nValue; }
+    friend constexpr bool operator<=(const CAssetAmount& a, const CAssetAmount& b) { return a.nValue <= b.nValue; }
+    friend constexpr bool operator>=(const CAssetAmount& a, const CAssetAmount& b) { return a.nValue >= b.nValue; }
+
+private:
+    constexpr CAssetAmount(const value_type nValueIn, int) : nValue(nValueIn) {}
+};
+
+#endif // SAFE_ASSETAMOUNT_H
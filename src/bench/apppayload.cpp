@@ -0,0 +1,78 @@
+// Copyright (c) 2018-2019 The Safe Core developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "bench.h"
+#include "app/app.h"
+#include "primitives/transaction.h"
+
+#include <vector>
+
+// A block full of asset transfers: every tx pays the recipient and the change
+static const int BLOCK_TXS = 200;
+// CheckAppTransaction, ConnectBlock, add_AssetTx_Index and add_AssetSupply_Index
+static const int CONSUMERS = 4;
+
+static std::vector<CMutableTransaction> CreateTransfers()
+{
+    const uint256 assetId = uint256S("5a3e1b8c2d9f47e6a1b0c3d2e5f4a7b6c9d8e1f0a3b2c5d4e7f6a9b8c1d0e3f2");
+    CAppHeader header(g_nAppHeaderVersion, uint256S(g_strSafeAssetId), TRANSFER_ASSET_CMD);
+
+    std::vector<CMutableTransaction> vTx(BLOCK_TXS);
+    for (int i = 0; i < BLOCK_TXS; i++) {
+        vTx[i].vin.resize(1);
+        vTx[i].vin[0].prevout.n = i;
+        vTx[i].vout.resize(2);
+        for (int n = 0; n < 2; n++) {
+            CCommonData transferData(assetId, 1000000 + i * 2 + n, "transfer");
+            vTx[i].vout[n].nValue = 1000000 + i * 2 + n;
+            vTx[i].vout[n].vReserve = FillCommonData(header, transferData);
+        }
+    }
+    return vTx;
+}
+
+// Every consumer runs ParseReserve() and protobuf on its own
+static void AppPayloadParse(benchmark::State& state)
+{
+    const std::vector<CMutableTransaction> vMutableTx = CreateTransfers();
+    CAmount nSum = 0;
+    while (state.KeepRunning()) {
+        std::vector<CTransaction> vTx(vMutableTx.begin(), vMutableTx.end());
+        for (int c = 0; c < CONSUMERS; c++) {
+            for (const CTransaction& tx : vTx) {
+                for (unsigned int i = 0; i < tx.vout.size(); i++) {
+                    CAppHeader header;
+                    std::vector<unsigned char> vData;
+                    if (!ParseReserve(tx.vout[i].vReserve, header, vData))
+                        continue;
+                    CCommonData transferData;
+                    if (ParseCommonData(vData, transferData))
+                        nSum += transferData.nAmount;
+                }
+            }
+        }
+    }
+}
+
+// The first consumer decodes the transaction, the others share the result
+static void AppPayloadCached(benchmark::State& state)
+{
+    const std::vector<CMutableTransaction> vMutableTx = CreateTransfers();
+    CAmount nSum = 0;
+    while (state.KeepRunning()) {
+        std::vector<CTransaction> vTx(vMutableTx.begin(), vMutableTx.end());
+        for (int c = 0; c < CONSUMERS; c++) {
+            for (const CTransaction& tx : vTx) {
+                for (unsigned int i = 0; i < tx.vout.size(); i++) {
+                    const CAppPayload* pPayload = GetAppPayload(tx, i);
+                    if (pPayload && pPayload->fDataValid)
+                        nSum += pPayload->commonData.nAmount;
+                }
+            }
+        }
+    }
+}
+
+BENCHMARK(AppPayloadParse);
+BENCHMARK(AppPayloadCached);
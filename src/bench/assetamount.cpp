@@ -0,0 +1,127 @@
+// Copyright (c) 2018-2019 The Safe Core developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "bench.h"
+#include "assetamount.h"
+
+#include <string.h>
+#include <string>
+#include <vector>
+
+// The decimal string arithmetic CAssetAmount replaced, kept here as the baseline
+static const int M = 2000;
+static int numA[M];
+static int numB[M];
+
+static void resetNum(int* num, const std::string& str)
+{
+    memset(num, 0, M * sizeof(int));
+    for (uint32_t i = 0; i < str.length(); i++)
+        num[i] = str[str.length() - i - 1] - '0';
+}
+
+static std::string getNumString(int* num)
+{
+    std::string numString = "";
+    bool isBegin = false;
+    for (int i = M - 1; i >= 0 ; i--)
+    {
+        if (num[i] != 0)
+            isBegin = true;
+        if (isBegin)
+            numString += num[i] + '0';
+    }
+    return numString;
+}
+
+static std::string plusstring(const std::string& numAStr, const std::string& numBStr)
+{
+    resetNum(numA, numAStr);
+    resetNum(numB, numBStr);
+    for (int i = 0; i < M - 1; i++)
+    {
+        numA[i] += numB[i];
+        if (numA[i] > 9)
+        {
+            numA[i] -= 10;
+            numA[i+1]++;
+        }
+    }
+    return getNumString(numA);
+}
+
+static std::string mulstring(const std::string& numAStr, const std::string& numBStr)
+{
+    resetNum(numA, numAStr);
+    resetNum(numB, numBStr);
+
+    std::vector<std::string> vnums;
+    for (uint32_t i = 0; i < numBStr.length(); i++)
+    {
+        int tempnum[M];
+        memset(tempnum, 0, M * sizeof(int));
+        for (uint32_t j = i; j < numAStr.length() + i; j++)
+        {
+            tempnum[j] += numA[j - i] * numB[i] % 10;
+            tempnum[j + 1] = numA[j - i] * numB[i] / 10;
+            if (tempnum[j] > 9)
+            {
+                tempnum[j] -= 10;
+                tempnum[j + 1]++;
+            }
+        }
+        vnums.push_back(getNumString(tempnum));
+    }
+
+    std::string strresult = vnums[0];
+    for (uint32_t i = 1; i < vnums.size(); i++)
+        strresult = plusstring(strresult, vnums[i]);
+    return strresult;
+}
+
+// Sum the values of 100 asset outputs, like getaddrassetbalance does
+static void AssetAmountSumString(benchmark::State& state)
+{
+    while (state.KeepRunning()) {
+        std::string strTotal = "";
+        for (int i = 0; i < 100; i++) {
+            char buf[64];
+            snprintf(buf, sizeof(buf), "%d", 123456789 + i);
+            strTotal = plusstring(strTotal, buf);
+        }
+    }
+}
+
+static void AssetAmountSum(benchmark::State& state)
+{
+    while (state.KeepRunning()) {
+        CAssetAmount total;
+        for (int i = 0; i < 100; i++)
+            total.Add(CAssetAmount(123456789 + i));
+        std::string strTotal = total.ToString(8);
+    }
+}
+
+// total * ratio, like the candy amount shown while issuing an asset
+static void AssetAmountMulString(benchmark::State& state)
+{
+    while (state.KeepRunning()) {
+        std::string strResult = mulstring("2000000000000000000", "37");
+    }
+}
+
+static void AssetAmountMul(benchmark::State& state)
+{
+    while (state.KeepRunning()) {
+        CAssetAmount amount(MAX_ASSETS);
+        amount.Mul(37);
+        amount.Div(1000);
+        std::string strResult = amount.ToString(10);
+    }
+}
+
+BENCHMARK(AssetAmountSumString);
+BENCHMARK(AssetAmountSum);
+BENCHMARK(AssetAmountMulString);
+BENCHMARK(AssetAmountMul);
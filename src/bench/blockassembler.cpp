@@ -0,0 +1,70 @@
+// Copyright (c) 2018-2019 The Safe Core developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "bench.h"
+#include "arith_uint256.h"
+#include "coins.h"
+#include "miner.h"
+#include "policy/policy.h"
+#include "txmempool.h"
+
+#include <vector>
+
+// Most transactions spend confirmed coins, every eighth one starts a chain of
+// four, sometimes with a child paying for its parents
+static void FillMemPool(CTxMemPool& pool, int nTxs)
+{
+    CCoinsView viewDummy;
+    CCoinsViewCache view(&viewDummy);
+    CScript scriptPubKey = CScript() << OP_DUP << OP_HASH160 << std::vector<unsigned char>(20, 0x5a) << OP_EQUALVERIFY << OP_CHECKSIG;
+    uint32_t nRand = 0x2545f491;
+    uint256 hashPrev;
+    for (int i = 0; i < nTxs; i++) {
+        nRand ^= nRand << 13;
+        nRand ^= nRand >> 17;
+        nRand ^= nRand << 5;
+
+        CMutableTransaction tx;
+        tx.vin.resize(1);
+        tx.vin[0].scriptSig = CScript() << OP_1;
+        if (i % 8 > 4)
+            tx.vin[0].prevout = COutPoint(hashPrev, 0);
+        else
+            tx.vin[0].prevout = COutPoint(ArithToUint256(arith_uint256(i + 1)), 0);
+        tx.vout.resize(1);
+        tx.vout[0].scriptPubKey = scriptPubKey;
+        tx.vout[0].nValue = 10 * COIN;
+
+        CAmount nFee = 1000 + nRand % 100000;
+        if (i % 8 == 7 && nRand % 2)
+            nFee *= 10;
+        hashPrev = tx.GetHash();
+        pool.addUnchecked(hashPrev, CTxMemPoolEntry(tx, nFee, 0, 0.0, 1, i % 8 <= 4, 0, false, 1, LockPoints()), view);
+    }
+}
+
+static void BlockAssemblerPackages(benchmark::State& state, int nTxs)
+{
+    CTxMemPool pool(CFeeRate(0));
+    FillMemPool(pool, nTxs);
+
+    LOCK(pool.cs);
+    while (state.KeepRunning()) {
+        CBlockTxSelection selection;
+        SelectBlockTransactions(pool, 1000, 0, DEFAULT_BLOCK_MAX_SIZE, NULL, selection);
+    }
+}
+
+static void BlockAssembler10k(benchmark::State& state)
+{
+    BlockAssemblerPackages(state, 10000);
+}
+
+static void BlockAssembler100k(benchmark::State& state)
+{
+    BlockAssemblerPackages(state, 100000);
+}
+
+BENCHMARK(BlockAssembler10k);
+BENCHMARK(BlockAssembler100k);
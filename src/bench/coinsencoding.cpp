@@ -0,0 +1,109 @@
+// Copyright (c) 2018-2019 The Safe Core developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "bench.h"
+#include "app/app.h"
+#include "arith_uint256.h"
+#include "clientversion.h"
+#include "coins.h"
+#include "dbwrapper.h"
+#include "streams.h"
+
+#include <vector>
+
+#include <boost/filesystem.hpp>
+
+// Coins of 1000 txs as the coins database writes them while syncing: mostly plain
+// outputs, every tenth tx is locked and every twentieth an asset transfer
+static std::vector<CCoins> CreateCoins()
+{
+    const uint256 assetId = uint256S("5a3e1b8c2d9f47e6a1b0c3d2e5f4a7b6c9d8e1f0a3b2c5d4e7f6a9b8c1d0e3f2");
+    CAppHeader header(g_nAppHeaderVersion, uint256S(g_strSafeAssetId), TRANSFER_ASSET_CMD);
+    CScript scriptPubKey = CScript() << OP_DUP << OP_HASH160 << std::vector<unsigned char>(20, 0x5a) << OP_EQUALVERIFY << OP_CHECKSIG;
+
+    std::vector<CCoins> vCoins;
+    for (int i = 0; i < 1000; i++) {
+        CMutableTransaction tx;
+        tx.vin.resize(1);
+        tx.vin[0].prevout = COutPoint(ArithToUint256(arith_uint256(i + 1)), 0);
+        tx.vout.resize(2);
+        for (int n = 0; n < 2; n++) {
+            tx.vout[n].nValue = 1000000 + i * 2 + n;
+            tx.vout[n].scriptPubKey = scriptPubKey;
+            if (i % 10 == 3)
+                tx.vout[n].nUnlockedHeight = 600000 + i;
+            if (i % 20 == 9)
+                tx.vout[n].vReserve = FillCommonData(header, CCommonData(assetId, tx.vout[n].nValue, "transfer"));
+        }
+        vCoins.push_back(CCoins(tx, 500000 + i));
+    }
+    return vCoins;
+}
+
+static void CoinsLegacyEncoding(benchmark::State& state)
+{
+    std::vector<CCoins> vCoins = CreateCoins();
+    while (state.KeepRunning()) {
+        for (unsigned int i = 0; i < vCoins.size(); i++) {
+            CDataStream ss(SER_DISK, CLIENT_VERSION);
+            ss << CLegacyCoinsFormat(vCoins[i]);
+            CCoins coins;
+            CLegacyCoinsFormat legacyCoins(coins);
+            ss >> legacyCoins;
+        }
+    }
+}
+
+static void CoinsCompactEncoding(benchmark::State& state)
+{
+    std::vector<CCoins> vCoins = CreateCoins();
+    while (state.KeepRunning()) {
+        for (unsigned int i = 0; i < vCoins.size(); i++) {
+            CDataStream ss(SER_DISK, CLIENT_VERSION);
+            ss << vCoins[i];
+            CCoins coins;
+            ss >> coins;
+        }
+    }
+}
+
+// The chainstate side of a sync: a flush writes the coins in one batch and the next
+// blocks read them back, through an in-memory LevelDB so that disk speed stays out
+static void CoinsLegacyFlushRead(benchmark::State& state)
+{
+    std::vector<CCoins> vCoins = CreateCoins();
+    CDBWrapper db(boost::filesystem::temp_directory_path() / "bench_coins_legacy", 8 << 20, true);
+    while (state.KeepRunning()) {
+        CDBBatch batch(&db.GetObfuscateKey());
+        for (unsigned int i = 0; i < vCoins.size(); i++)
+            batch.Write(std::make_pair('c', i), CLegacyCoinsFormat(vCoins[i]));
+        db.WriteBatch(batch);
+        for (unsigned int i = 0; i < vCoins.size(); i++) {
+            CCoins coins;
+            CLegacyCoinsFormat legacyCoins(coins);
+            db.Read(std::make_pair('c', i), legacyCoins);
+        }
+    }
+}
+
+static void CoinsCompactFlushRead(benchmark::State& state)
+{
+    std::vector<CCoins> vCoins = CreateCoins();
+    CDBWrapper db(boost::filesystem::temp_directory_path() / "bench_coins_compact", 8 << 20, true);
+    while (state.KeepRunning()) {
+        CDBBatch batch(&db.GetObfuscateKey());
+        for (unsigned int i = 0; i < vCoins.size(); i++)
+            batch.Write(std::make_pair('C', i), vCoins[i]);
+        db.WriteBatch(batch);
+        for (unsigned int i = 0; i < vCoins.size(); i++) {
+            CCoins coins;
+            db.Read(std::make_pair('C', i), coins);
+        }
+    }
+}
+
+BENCHMARK(CoinsLegacyEncoding);
+BENCHMARK(CoinsCompactEncoding);
+BENCHMARK(CoinsLegacyFlushRead);
+BENCHMARK(CoinsCompactFlushRead);
@@ -0,0 +1,84 @@
+// Copyright (c) 2018-2019 The Safe Core developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "bench.h"
+#include "app/app.h"
+#include "arith_uint256.h"
+#include "coins.h"
+#include "primitives/block.h"
+#include "streams.h"
+#include "txmempool.h"
+#include "version.h"
+
+#include <vector>
+
+// Most outputs only carry the "safe" marker, every tenth tx is an asset transfer
+static const int BLOCK_TXS = 1000;
+
+volatile size_t nReserveUsage = 0; // volatile, global so not optimized away
+
+static CBlock CreateBlock()
+{
+    const uint256 assetId = uint256S("5a3e1b8c2d9f47e6a1b0c3d2e5f4a7b6c9d8e1f0a3b2c5d4e7f6a9b8c1d0e3f2");
+    CAppHeader header(g_nAppHeaderVersion, uint256S(g_strSafeAssetId), TRANSFER_ASSET_CMD);
+    CScript scriptPubKey = CScript() << OP_DUP << OP_HASH160 << std::vector<unsigned char>(20, 0x5a) << OP_EQUALVERIFY << OP_CHECKSIG;
+
+    CBlock block;
+    for (int i = 0; i < BLOCK_TXS; i++) {
+        CMutableTransaction tx;
+        tx.vin.resize(1);
+        tx.vin[0].prevout = COutPoint(ArithToUint256(arith_uint256(i + 1)), 0);
+        tx.vin[0].scriptSig = CScript() << OP_1;
+        tx.vout.resize(2);
+        for (int n = 0; n < 2; n++) {
+            tx.vout[n].nValue = 1000000 + i * 2 + n;
+            tx.vout[n].scriptPubKey = scriptPubKey;
+            if (i % 10 == 9)
+                tx.vout[n].vReserve = FillCommonData(header, CCommonData(assetId, tx.vout[n].nValue, "transfer"));
+        }
+        block.vtx.push_back(tx);
+    }
+    return block;
+}
+
+static void DeserializeBlockReserve(benchmark::State& state)
+{
+    CDataStream stream(SER_NETWORK, PROTOCOL_VERSION);
+    stream << CreateBlock();
+    while (state.KeepRunning()) {
+        CDataStream streamCopy(stream.begin(), stream.end(), SER_NETWORK, PROTOCOL_VERSION);
+        CBlock block;
+        streamCopy >> block;
+    }
+}
+
+static void MempoolReserve(benchmark::State& state)
+{
+    const CBlock block = CreateBlock();
+    CCoinsView viewDummy;
+    CCoinsViewCache view(&viewDummy);
+    CTxMemPool pool(CFeeRate(0));
+    while (state.KeepRunning()) {
+        for (unsigned int i = 0; i < block.vtx.size(); i++)
+            pool.addUnchecked(block.vtx[i].GetHash(), CTxMemPoolEntry(block.vtx[i], 1000, 0, 0.0, 1, true, 0, false, 1, LockPoints()), view);
+        nReserveUsage = pool.DynamicMemoryUsage();
+        pool.clear();
+    }
+}
+
+static void CCoinsCacheReserve(benchmark::State& state)
+{
+    const CBlock block = CreateBlock();
+    CCoinsView viewDummy;
+    while (state.KeepRunning()) {
+        CCoinsViewCache cache(&viewDummy);
+        for (unsigned int i = 0; i < block.vtx.size(); i++)
+            *cache.ModifyCoins(block.vtx[i].GetHash()) = CCoins(block.vtx[i], 1);
+        nReserveUsage = cache.DynamicMemoryUsage();
+    }
+}
+
+BENCHMARK(DeserializeBlockReserve);
+BENCHMARK(MempoolReserve);
+BENCHMARK(CCoinsCacheReserve);
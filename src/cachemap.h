@@ -142,6 +142,20 @@ public:
         return true;
     }
 
+    /**
+     * Mark an item as most recently used so that it is pruned last,
+     * which turns the insertion ordered cache into an LRU cache
+     */
+    bool Touch(const K& key)
+    {
+        map_it it = mapIndex.find(key);
+        if(it == mapIndex.end()) {
+            return false;
+        }
+        listItems.splice(listItems.begin(), listItems, it->second);
+        return true;
+    }
+
     void Erase(const K& key)
     {
         map_it it = mapIndex.find(key);
@@ -0,0 +1,81 @@
+// Copyright (c) 2018-2019 The Safe Core developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "candyaddress.h"
+
+#include "base58.h"
+
+#include <algorithm>
+
+namespace {
+
+class CCandyAddressKeyVisitor : public boost::static_visitor<bool>
+{
+private:
+    CCandyAddressKey* pKey;
+
+public:
+    CCandyAddressKeyVisitor(CCandyAddressKey* pKeyIn) : pKey(pKeyIn) {}
+
+    bool operator()(const CKeyID& id) const
+    {
+        *pKey = CCandyAddressKey(1, id);
+        return true;
+    }
+
+    bool operator()(const CScriptID& id) const
+    {
+        *pKey = CCandyAddressKey(2, id);
+        return true;
+    }
+
+    bool operator()(const CNoDestination& no) const
+    {
+        return false;
+    }
+};
+
+} // anon namespace
+
+bool CCandyAddressKey::SetDestination(const CTxDestination& dest)
+{
+    return boost::apply_visitor(CCandyAddressKeyVisitor(this), dest);
+}
+
+bool CCandyAddressKey::SetString(const std::string& strAddress)
+{
+    uint160 hashBytes;
+    int type = 0;
+    if (!CBitcoinAddress(strAddress).GetIndexKey(hashBytes, type))
+        return false;
+
+    nType = (uint8_t)type;
+    hash = hashBytes;
+    return true;
+}
+
+std::string CCandyAddressKey::ToString() const
+{
+    if (nType == 1)
+        return CBitcoinAddress(CKeyID(hash)).ToString();
+    if (nType == 2)
+        return CBitcoinAddress(CScriptID(hash)).ToString();
+    return "";
+}
+
+void MergeAddressAmounts(std::vector<CAddressAmount>& vAddressAmount)
+{
+    std::sort(vAddressAmount.begin(), vAddressAmount.end());
+
+    std::vector<CAddressAmount>::iterator itOut = vAddressAmount.begin();
+    for (std::vector<CAddressAmount>::const_iterator it = vAddressAmount.begin(); it != vAddressAmount.end(); )
+    {
+        CAddressAmount merged = *it;
+        for (it++; it != vAddressAmount.end() && it->key == merged.key; it++)
+            merged.nAmount += it->nAmount;
+        if (merged.nAmount != 0)
+            *itOut++ = merged;
+    }
+    vAddressAmount.erase(itOut, vAddressAmount.end());
+}
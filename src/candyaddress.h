@@ -0,0 +1,91 @@
+// Copyright (c) 2018-2019 The Safe Core developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#ifndef SAFE_CANDYADDRESS_H
+#define SAFE_CANDYADDRESS_H
+
+#include "amount.h"
+#include "script/standard.h"
+#include "uint256.h"
+
+#include <stdint.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+/**
+ * Binary address used by the candy balances: the address type (1 = pubkey hash,
+ * 2 = script hash, like the address index) followed by the hash160. Blocks only
+ * ever produce these 21 bytes, base58 is used for the RPC and the UI.
+ */
+struct CCandyAddressKey
+{
+    uint8_t nType;
+    uint160 hash;
+
+    CCandyAddressKey() : nType(0) {}
+    CCandyAddressKey(const uint8_t nTypeIn, const uint160& hashIn) : nType(nTypeIn), hash(hashIn) {}
+
+    bool IsNull() const { return nType == 0; }
+
+    /** Set from a pubkey hash or script hash destination */
+    bool SetDestination(const CTxDestination& dest);
+    /** Set from a base58 address, false if it is not a valid address of this chain */
+    bool SetString(const std::string& strAddress);
+    std::string ToString() const;
+
+    friend bool operator<(const CCandyAddressKey& a, const CCandyAddressKey& b)
+    {
+        return a.nType < b.nType || (a.nType == b.nType && a.hash < b.hash);
+    }
+
+    friend bool operator==(const CCandyAddressKey& a, const CCandyAddressKey& b)
+    {
+        return a.nType == b.nType && a.hash == b.hash;
+    }
+
+    friend bool operator!=(const CCandyAddressKey& a, const CCandyAddressKey& b)
+    {
+        return !(a == b);
+    }
+};
+
+/** Record of the candy balance files (delta.log, all.dat and the change files) */
+struct CAddressAmount
+{
+    CCandyAddressKey key;
+    //! keeps nAmount aligned, always zero so that the files are deterministic
+    uint8_t vchReserved[3];
+    CAmount nAmount;
+
+    CAddressAmount() : nAmount(0)
+    {
+        memset(vchReserved, 0x00, sizeof(vchReserved));
+    }
+
+    CAddressAmount(const CCandyAddressKey& keyIn, const CAmount& nAmountIn) : key(keyIn), nAmount(nAmountIn)
+    {
+        memset(vchReserved, 0x00, sizeof(vchReserved));
+    }
+
+    friend bool operator<(const CAddressAmount& a, const CAddressAmount& b)
+    {
+        return a.key < b.key;
+    }
+
+    friend bool operator==(const CAddressAmount& a, const CAddressAmount& b)
+    {
+        return a.key == b.key;
+    }
+};
+
+static_assert(sizeof(CAddressAmount) == 32, "CAddressAmount is written to disk as is");
+
+/**
+ * Turn the amounts of a block, collected in any order and possibly several per
+ * address, into one entry per address sorted by key. Zero sums are dropped.
+ */
+void MergeAddressAmounts(std::vector<CAddressAmount>& vAddressAmount);
+
+#endif // SAFE_CANDYADDRESS_H
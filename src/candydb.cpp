@@ -0,0 +1,1123 @@
+// Copyright (c) 2018-2019 The Safe Core developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "candydb.h"
+
+#include "init.h"
+#include "ui_interface.h"
+#include "util.h"
+#include "utilstrencodings.h"
+#include "utiltime.h"
+#include "validation.h"
+
+#include <algorithm>
+
+#include <boost/filesystem.hpp>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include <boost/thread.hpp>
+
+using namespace std;
+
+#define BATCH_COUNT         10000
+
+static const uint32_t DELTA_LOG_MAGIC = 0x53414645;
+//! version 1 held CLegacyAddressAmount entries
+static const uint32_t DELTA_LOG_VERSION = 2;
+//! upper bound of addresses touched by one block, guards against a corrupt record
+static const uint32_t MAX_DELTA_LOG_RECORD_COUNT = 10000000;
+
+//! all.dat and the change files start with a header, the legacy snapshots have none
+static const uint32_t SNAPSHOT_MAGIC = 0xCA4D1E5A;
+static const uint32_t SNAPSHOT_VERSION = 1;
+
+struct CSnapshotHeader
+{
+    uint32_t nMagic;
+    uint32_t nVersion;
+};
+
+/** Entry of the files written before the binary address keys, sorted by strcmp */
+struct CLegacyAddressAmount
+{
+    char szAddress[36];
+    CAmount nAmount;
+};
+
+/** delta.log starts with this header */
+struct CDeltaLogHeader
+{
+    uint32_t nMagic;
+    uint32_t nVersion;
+    int nBaseHeight;
+};
+
+/** Every appended block is a record followed by nCount CAddressAmount entries */
+struct CDeltaLogRecord
+{
+    uint32_t nMagic;
+    int nHeight;
+    int nLastCandyHeight;
+    uint32_t nCount;
+};
+
+struct CDeltaLogBlock
+{
+    CDeltaLogRecord record;
+    vector<CAddressAmount> vAmount;
+};
+
+static bool LessAddress(const CAddressAmount& data, const CCandyAddressKey& key)
+{
+    return data.key < key;
+}
+
+/** Convert legacy entries to sorted binary keys, an entry that is no valid address is dropped */
+static void ConvertLegacyAmounts(const vector<CLegacyAddressAmount>& vLegacy, vector<CAddressAmount>& vAmount)
+{
+    vAmount.clear();
+    vAmount.reserve(vLegacy.size());
+    for(vector<CLegacyAddressAmount>::const_iterator it = vLegacy.begin(); it != vLegacy.end(); it++)
+    {
+        string strAddress(it->szAddress, strnlen(it->szAddress, sizeof(it->szAddress)));
+        CCandyAddressKey key;
+        if(!key.SetString(strAddress))
+        {
+            LogPrintf("%s: drop invalid address %s\n", __func__, SanitizeString(strAddress));
+            continue;
+        }
+        vAmount.push_back(CAddressAmount(key, it->nAmount));
+    }
+    MergeAddressAmounts(vAmount);
+}
+
+/** Read-only mapping of a sorted CAddressAmount snapshot, a missing file maps as empty */
+class CCandyBalanceFile
+{
+private:
+    boost::interprocess::file_mapping mapping;
+    boost::interprocess::mapped_region region;
+    const CAddressAmount* pBegin;
+    size_t nCount;
+
+public:
+    CCandyBalanceFile() : pBegin(NULL), nCount(0) {}
+
+    bool Open(const boost::filesystem::path& path)
+    {
+        try {
+            if(!boost::filesystem::exists(path))
+                return true;
+
+            uintmax_t nSize = boost::filesystem::file_size(path);
+            if(nSize == 0)
+                return true;
+            if(nSize < sizeof(CSnapshotHeader) || (nSize - sizeof(CSnapshotHeader)) % sizeof(CAddressAmount))
+                return error("%s: invalid size of %s", __func__, path.string());
+
+            boost::interprocess::file_mapping(path.string().c_str(), boost::interprocess::read_only).swap(mapping);
+            boost::interprocess::mapped_region(mapping, boost::interprocess::read_only).swap(region);
+        } catch (const boost::interprocess::interprocess_exception& e) {
+            return error("%s: map %s failed: %s", __func__, path.string(), e.what());
+        } catch (const boost::filesystem::filesystem_error& e) {
+            return error("%s: %s", __func__, e.what());
+        }
+
+        const CSnapshotHeader* pHeader = static_cast<const CSnapshotHeader*>(region.get_address());
+        if(pHeader->nMagic != SNAPSHOT_MAGIC || pHeader->nVersion != SNAPSHOT_VERSION)
+            return error("%s: invalid header in %s", __func__, path.string());
+
+        pBegin = reinterpret_cast<const CAddressAmount*>(static_cast<const char*>(region.get_address()) + sizeof(CSnapshotHeader));
+        nCount = (region.get_size() - sizeof(CSnapshotHeader)) / sizeof(CAddressAmount);
+        return true;
+    }
+
+    const CAddressAmount* begin() const { return pBegin; }
+    const CAddressAmount* end() const { return pBegin + nCount; }
+
+    /** Add nSign * amount of every sorted vKey to vAmount, moving forward through the file only */
+    void AddAmounts(const vector<CCandyAddressKey>& vKey, vector<CAmount>& vAmount, int nSign) const
+    {
+        const CAddressAmount* it = pBegin;
+        const CAddressAmount* pEnd = pBegin + nCount;
+        for(size_t i = 0; i < vKey.size() && it != pEnd; i++)
+        {
+            it = std::lower_bound(it, pEnd, vKey[i], LessAddress);
+            if(it != pEnd && it->key == vKey[i])
+                vAmount[i] += nSign * it->nAmount;
+        }
+    }
+};
+
+/** Buffered writer of a snapshot, entries must come in key order and zero amounts are skipped */
+class CSnapshotWriter
+{
+private:
+    FILE* pFile;
+    vector<CAddressAmount> vBuffer;
+    bool fError;
+
+    void Flush()
+    {
+        if(!vBuffer.empty() && fwrite(&vBuffer[0], sizeof(CAddressAmount), vBuffer.size(), pFile) != vBuffer.size())
+            fError = true;
+        vBuffer.clear();
+    }
+
+public:
+    CSnapshotWriter() : pFile(NULL), fError(false) {}
+
+    ~CSnapshotWriter()
+    {
+        if(pFile)
+            fclose(pFile);
+    }
+
+    bool Open(const boost::filesystem::path& path)
+    {
+        pFile = fopen(path.string().data(), "wb");
+        if(!pFile)
+            return false;
+
+        CSnapshotHeader header;
+        header.nMagic = SNAPSHOT_MAGIC;
+        header.nVersion = SNAPSHOT_VERSION;
+        if(fwrite(&header, sizeof(CSnapshotHeader), 1, pFile) != 1)
+            fError = true;
+        vBuffer.reserve(BATCH_COUNT);
+        return !fError;
+    }
+
+    void Write(const CAddressAmount& data)
+    {
+        if(data.nAmount == 0)
+            return;
+        vBuffer.push_back(data);
+        if(vBuffer.size() >= BATCH_COUNT)
+            Flush();
+    }
+
+    bool Commit()
+    {
+        Flush();
+        if(!fError)
+            FileCommit(pFile);
+        fclose(pFile);
+        pFile = NULL;
+        return !fError;
+    }
+};
+
+CCandyBalanceDB candybalancedb;
+
+/** Merge-join the snapshot strSrcFile with mapAmount into strDestFile */
+static bool MergeFileAndMap(const string& strSrcFile, const map<CCandyAddressKey, CAmount>& mapAmount, const string& strDestFile)
+{
+    CCandyBalanceFile src;
+    if(!src.Open(strSrcFile))
+        return error("%s: open %s failed", __func__, strSrcFile);
+
+    CSnapshotWriter writer;
+    if(!writer.Open(strDestFile))
+        return error("%s: open %s failed", __func__, strDestFile);
+
+    const CAddressAmount* it = src.begin();
+    map<CCandyAddressKey, CAmount>::const_iterator mapit = mapAmount.begin();
+    while(it != src.end() || mapit != mapAmount.end())
+    {
+        if(mapit == mapAmount.end() || (it != src.end() && it->key < mapit->first))
+        {
+            writer.Write(*it);
+            it++;
+        }
+        else if(it == src.end() || mapit->first < it->key)
+        {
+            writer.Write(CAddressAmount(mapit->first, mapit->second));
+            mapit++;
+        }
+        else
+        {
+            writer.Write(CAddressAmount(it->key, it->nAmount + mapit->second));
+            it++;
+            mapit++;
+        }
+    }
+
+    if(!writer.Commit())
+        return error("%s: write %s failed", __func__, strDestFile);
+    return true;
+}
+
+/** Whether path is a snapshot written before the binary address keys, a missing or empty file is not */
+static bool IsLegacySnapshot(const boost::filesystem::path& path)
+{
+    FILE* pFile = fopen(path.string().data(), "rb");
+    if(!pFile)
+        return false;
+
+    CSnapshotHeader header;
+    size_t nRead = fread(&header, 1, sizeof(CSnapshotHeader), pFile);
+    fclose(pFile);
+    return nRead > 0 && (nRead < sizeof(CSnapshotHeader) || header.nMagic != SNAPSHOT_MAGIC);
+}
+
+/** Rewrite a legacy snapshot with binary keys, through a temp file so that it can be redone after a crash */
+static bool UpgradeSnapshot(const boost::filesystem::path& path)
+{
+    FILE* pFile = fopen(path.string().data(), "rb");
+    if(!pFile)
+        return error("%s: open %s failed", __func__, path.string());
+
+    long nSize = 0;
+    if(fseek(pFile, 0L, SEEK_END) || (nSize = ftell(pFile)) < 0 || fseek(pFile, 0L, SEEK_SET) || nSize % sizeof(CLegacyAddressAmount))
+    {
+        fclose(pFile);
+        return error("%s: invalid size of %s", __func__, path.string());
+    }
+
+    vector<CLegacyAddressAmount> vLegacy(nSize / sizeof(CLegacyAddressAmount));
+    bool fRead = vLegacy.empty() || fread(&vLegacy[0], sizeof(CLegacyAddressAmount), vLegacy.size(), pFile) == vLegacy.size();
+    fclose(pFile);
+    if(!fRead)
+        return error("%s: read %s failed", __func__, path.string());
+
+    vector<CAddressAmount> vAmount;
+    ConvertLegacyAmounts(vLegacy, vAmount);
+
+    boost::filesystem::path pathTemp = path.string() + ".temp";
+    CSnapshotWriter writer;
+    if(!writer.Open(pathTemp))
+        return error("%s: open %s failed", __func__, pathTemp.string());
+    for(vector<CAddressAmount>::const_iterator it = vAmount.begin(); it != vAmount.end(); it++)
+        writer.Write(*it);
+    if(!writer.Commit() || !RenameOver(pathTemp, path))
+        return error("%s: write %s failed", __func__, path.string());
+    return true;
+}
+
+static void AddAmount(map<CCandyAddressKey, CAmount>& mapAmount, const CCandyAddressKey& key, const CAmount& nAmount)
+{
+    if(nAmount == 0)
+        return;
+
+    map<CCandyAddressKey, CAmount>::iterator it = mapAmount.find(key);
+    if(it == mapAmount.end())
+    {
+        mapAmount.insert(make_pair(key, nAmount));
+        return;
+    }
+
+    it->second += nAmount;
+    if(it->second == 0)
+        mapAmount.erase(it);
+}
+
+/** Merge-join the sorted vKey against mapAmount, adding nSign * amount to vAmount */
+static void AddAmounts(const map<CCandyAddressKey, CAmount>& mapAmount, const vector<CCandyAddressKey>& vKey, vector<CAmount>& vAmount, int nSign)
+{
+    map<CCandyAddressKey, CAmount>::const_iterator it = mapAmount.begin();
+    for(size_t i = 0; i < vKey.size() && it != mapAmount.end(); i++)
+    {
+        if(it->first < vKey[i])
+            it = mapAmount.lower_bound(vKey[i]);
+        if(it != mapAmount.end() && it->first == vKey[i])
+            vAmount[i] += nSign * it->second;
+    }
+}
+
+static bool CreateEmptyFile(const string& strFile)
+{
+    FILE* pFile = fopen(strFile.data(), "ab+");
+    if(!pFile)
+        return error("%s: create empty file %s failed", __func__, strFile);
+    fclose(pFile);
+    return true;
+}
+
+/**
+ * Read the intact prefix of a delta log, a torn record at the end is ignored.
+ * Legacy entries are converted, pVersion tells the version found on disk.
+ */
+static bool ReadDeltaLog(const boost::filesystem::path& path, int& nBaseHeight, vector<CDeltaLogBlock>& vBlock, uint32_t* pVersion = NULL)
+{
+    FILE* pFile = fopen(path.string().data(), "rb");
+    if(!pFile)
+        return error("%s: open %s failed", __func__, path.string());
+
+    CDeltaLogHeader header;
+    if(fread(&header, sizeof(CDeltaLogHeader), 1, pFile) != 1 || header.nMagic != DELTA_LOG_MAGIC || (header.nVersion != 1 && header.nVersion != DELTA_LOG_VERSION))
+    {
+        fclose(pFile);
+        return error("%s: invalid header in %s", __func__, path.string());
+    }
+    nBaseHeight = header.nBaseHeight;
+    if(pVersion)
+        *pVersion = header.nVersion;
+
+    while(true)
+    {
+        CDeltaLogBlock block;
+        if(fread(&block.record, sizeof(CDeltaLogRecord), 1, pFile) != 1)
+            break;
+        if(block.record.nMagic != DELTA_LOG_MAGIC || block.record.nCount > MAX_DELTA_LOG_RECORD_COUNT)
+            break;
+
+        if(header.nVersion == 1)
+        {
+            vector<CLegacyAddressAmount> vLegacy(block.record.nCount);
+            if(block.record.nCount && fread(&vLegacy[0], sizeof(CLegacyAddressAmount), block.record.nCount, pFile) != block.record.nCount)
+                break;
+            ConvertLegacyAmounts(vLegacy, block.vAmount);
+            block.record.nCount = block.vAmount.size();
+        }
+        else
+        {
+            block.vAmount.resize(block.record.nCount);
+            if(block.record.nCount && fread(&block.vAmount[0], sizeof(CAddressAmount), block.record.nCount, pFile) != block.record.nCount)
+                break;
+        }
+
+        vBlock.push_back(CDeltaLogBlock());
+        vBlock.back().record = block.record;
+        vBlock.back().vAmount.swap(block.vAmount);
+    }
+
+    fclose(pFile);
+    return true;
+}
+
+static bool WriteDeltaLogBlock(FILE* pFile, const CDeltaLogRecord& record, const vector<CAddressAmount>& vAmount)
+{
+    if(fwrite(&record, sizeof(CDeltaLogRecord), 1, pFile) != 1)
+        return false;
+    if(!vAmount.empty() && fwrite(&vAmount[0], sizeof(CAddressAmount), vAmount.size(), pFile) != vAmount.size())
+        return false;
+    return true;
+}
+
+static bool WriteDeltaLog(const boost::filesystem::path& path, int nBaseHeight, const vector<CDeltaLogBlock>& vBlock)
+{
+    boost::filesystem::path pathTemp = path.string() + ".new";
+    FILE* pFile = fopen(pathTemp.string().data(), "wb");
+    if(!pFile)
+        return error("%s: open %s failed", __func__, pathTemp.string());
+
+    CDeltaLogHeader header;
+    header.nMagic = DELTA_LOG_MAGIC;
+    header.nVersion = DELTA_LOG_VERSION;
+    header.nBaseHeight = nBaseHeight;
+
+    bool fRet = (fwrite(&header, sizeof(CDeltaLogHeader), 1, pFile) == 1);
+    for(vector<CDeltaLogBlock>::const_iterator it = vBlock.begin(); fRet && it != vBlock.end(); it++)
+        fRet = WriteDeltaLogBlock(pFile, it->record, it->vAmount);
+
+    if(fRet)
+        FileCommit(pFile);
+    fclose(pFile);
+
+    if(!fRet || !RenameOver(pathTemp, path))
+    {
+        boost::filesystem::remove(pathTemp);
+        return error("%s: write %s failed", __func__, path.string());
+    }
+    return true;
+}
+
+static void RemoveTempFiles(const boost::filesystem::path& pathDir)
+{
+    boost::filesystem::directory_iterator end_iter;
+    for(boost::filesystem::directory_iterator iter(pathDir); iter != end_iter; ++iter)
+    {
+        if(boost::filesystem::is_regular_file(iter->status()) && iter->path().extension() == ".temp")
+            boost::filesystem::remove(iter->path());
+    }
+}
+
+/** Put the blocks of the rotated log back in front of the current log */
+static bool FoldDeltaLogs(const boost::filesystem::path& pathOld, const boost::filesystem::path& pathCurrent)
+{
+    int nBaseHeight = 0;
+    vector<CDeltaLogBlock> vBlock;
+    if(!ReadDeltaLog(pathOld, nBaseHeight, vBlock))
+        return false;
+
+    if(boost::filesystem::exists(pathCurrent))
+    {
+        int nCurrentBaseHeight = 0;
+        if(!ReadDeltaLog(pathCurrent, nCurrentBaseHeight, vBlock))
+            return false;
+    }
+
+    if(!WriteDeltaLog(pathCurrent, nBaseHeight, vBlock))
+        return false;
+
+    boost::filesystem::remove(pathOld);
+    return true;
+}
+
+CCandyBalanceDB::CCandyBalanceDB()
+    : pLogFile(NULL),
+      nBaseHeight(0),
+      nLogHeight(0),
+      nDetailHeight(0),
+      nSyncedDetailHeight(0),
+      nRemovedHeight(0),
+      nLogBlocks(0),
+      nLogSize(0),
+      fCompacting(false),
+      nCompactHeight(0),
+      nCompactBlocks(0),
+      fFailed(false)
+{
+}
+
+CCandyBalanceDB::~CCandyBalanceDB()
+{
+    Close();
+}
+
+boost::filesystem::path CCandyBalanceDB::GetChangePath(int nChangeHeight) const
+{
+    return pathDir / (itostr(nChangeHeight) + ".change");
+}
+
+bool CCandyBalanceDB::OpenLog()
+{
+    pLogFile = fopen(GetLogPath().string().data(), "rb+");
+    if(!pLogFile)
+        return error("%s: open %s failed", __func__, GetLogPath().string());
+
+    if(fseek(pLogFile, 0L, SEEK_END) || (nLogSize = ftell(pLogFile)) < 0)
+    {
+        fclose(pLogFile);
+        pLogFile = NULL;
+        return error("%s: seek %s failed", __func__, GetLogPath().string());
+    }
+    return true;
+}
+
+bool CCandyBalanceDB::SyncDetailFile()
+{
+    FILE* pFile = fopen(GetDetailPath().string().data(), "ab");
+    if(!pFile)
+        return error("%s: open %s failed", __func__, GetDetailPath().string());
+    FileCommit(pFile);
+    fclose(pFile);
+
+    nSyncedDetailHeight = nDetailHeight;
+    return true;
+}
+
+bool CCandyBalanceDB::RecoverCompaction()
+{
+    // every snapshot was merged before the commit marker was written, finish the renames
+    if(boost::filesystem::exists(GetCommitPath()))
+    {
+        boost::filesystem::directory_iterator end_iter;
+        for(boost::filesystem::directory_iterator iter(pathDir); iter != end_iter; ++iter)
+        {
+            const boost::filesystem::path& path = iter->path();
+            if(boost::filesystem::is_regular_file(iter->status()) && path.extension() == ".temp" && !RenameOver(path, path.parent_path() / path.stem()))
+                return error("%s: rename %s failed", __func__, path.string());
+        }
+        boost::filesystem::remove(GetOldLogPath());
+        boost::filesystem::remove(GetCommitPath());
+        LogPrintf("%s: finished interrupted compaction\n", __func__);
+        return true;
+    }
+
+    // the snapshots were not replaced, so the rotated blocks are still pending
+    RemoveTempFiles(pathDir);
+    if(!FoldDeltaLogs(GetOldLogPath(), GetLogPath()))
+        return error("%s: restore delta log failed", __func__);
+    LogPrintf("%s: rolled back interrupted compaction\n", __func__);
+    return true;
+}
+
+bool CCandyBalanceDB::UpgradeSnapshots()
+{
+    int64_t nTimeStart = GetTimeMillis();
+    unsigned int nFiles = 0;
+
+    boost::filesystem::directory_iterator end_iter;
+    for(boost::filesystem::directory_iterator iter(pathDir); iter != end_iter; ++iter)
+    {
+        const boost::filesystem::path& path = iter->path();
+        if(!boost::filesystem::is_regular_file(iter->status()) || (path.filename() != "all.dat" && path.extension() != ".change"))
+            continue;
+        if(!IsLegacySnapshot(path))
+            continue;
+        if(!UpgradeSnapshot(path))
+            return error("%s: convert %s failed", __func__, path.string());
+        nFiles++;
+    }
+
+    if(nFiles)
+        LogPrintf("%s: converted %u snapshots to binary addresses, %dms\n", __func__, nFiles, GetTimeMillis() - nTimeStart);
+    return true;
+}
+
+bool CCandyBalanceDB::Open(const boost::filesystem::path& pathDirIn, int nDetailHeightIn)
+{
+    Close();
+
+    boost::unique_lock<boost::shared_mutex> lock(cs);
+
+    pathDir = pathDirIn;
+    nDetailHeight = nDetailHeightIn;
+    nSyncedDetailHeight = 0;
+    nRemovedHeight = 0;
+    nLogBlocks = 0;
+    fCompacting = false;
+    fFailed = false;
+    mapAllDelta.clear();
+    mapChangeDelta.clear();
+    mapCompactAllDelta.clear();
+    mapCompactChangeDelta.clear();
+
+    try {
+        if(!boost::filesystem::exists(pathDir / "all.dat") && !CreateEmptyFile((pathDir / "all.dat").string()))
+            return false;
+
+        if(boost::filesystem::exists(GetOldLogPath()))
+        {
+            if(!RecoverCompaction())
+                return false;
+        }
+        else // left by an interrupted UpgradeSnapshots() or by a compaction that failed to clean up
+        {
+            RemoveTempFiles(pathDir);
+            boost::filesystem::remove(GetCommitPath());
+        }
+
+        // upgrade from the per-block rewrite layout: the snapshots already cover detail.dat
+        if(!boost::filesystem::exists(GetLogPath()) && !WriteDeltaLog(GetLogPath(), nDetailHeight, vector<CDeltaLogBlock>()))
+            return false;
+
+        if(!UpgradeSnapshots())
+            return false;
+    } catch (const boost::filesystem::filesystem_error& e) {
+        return error("%s: %s", __func__, e.what());
+    }
+
+    vector<CDeltaLogBlock> vBlock;
+    uint32_t nVersion = 0;
+    if(!ReadDeltaLog(GetLogPath(), nBaseHeight, vBlock, &nVersion))
+        return false;
+
+    // the snapshots are converted first, so a crash in between converts the log again
+    if(nVersion != DELTA_LOG_VERSION)
+    {
+        if(!WriteDeltaLog(GetLogPath(), nBaseHeight, vBlock))
+            return false;
+        LogPrintf("%s: converted %u blocks of delta.log to binary addresses\n", __func__, vBlock.size());
+    }
+
+    // detail.dat lost blocks the snapshots have, they are written to detail.dat
+    // again and skipped by AppendBlock(), the snapshots cannot be rolled back
+    if(nBaseHeight > nDetailHeight)
+        LogPrintf("%s: snapshots at %d are ahead of detail.dat at %d, replaying the blocks in between to detail.dat only\n", __func__, nBaseHeight, nDetailHeight);
+
+    nLogHeight = nBaseHeight;
+    long nKeepSize = sizeof(CDeltaLogHeader);
+    for(vector<CDeltaLogBlock>::const_iterator it = vBlock.begin(); it != vBlock.end(); it++)
+    {
+        const CDeltaLogRecord& record = it->record;
+        // blocks missing from detail.dat are replayed from disk by LoadChangeInfoToList()
+        if(record.nHeight <= nLogHeight || record.nHeight > nDetailHeight)
+            break;
+
+        for(vector<CAddressAmount>::const_iterator amountit = it->vAmount.begin(); amountit != it->vAmount.end(); amountit++)
+        {
+            AddAmount(mapAllDelta, amountit->key, amountit->nAmount);
+            if(record.nLastCandyHeight > 0)
+                AddAmount(mapChangeDelta[record.nLastCandyHeight], amountit->key, amountit->nAmount);
+        }
+
+        nKeepSize += sizeof(CDeltaLogRecord) + it->vAmount.size() * sizeof(CAddressAmount);
+        nLogHeight = record.nHeight;
+        nLogBlocks++;
+    }
+
+    if(!OpenLog())
+        return false;
+
+    if(nLogSize != nKeepSize)
+    {
+        if(!TruncateFile(pLogFile, nKeepSize) || fseek(pLogFile, 0L, SEEK_END))
+            return error("%s: truncate delta log to %d failed", __func__, nLogHeight);
+        nLogSize = nKeepSize;
+    }
+
+    if(!MapAllFile())
+        return false;
+
+    mapChangeFile.clear();
+    try {
+        boost::filesystem::directory_iterator end_iter;
+        for(boost::filesystem::directory_iterator iter(pathDir); iter != end_iter; ++iter)
+        {
+            if(!boost::filesystem::is_regular_file(iter->status()) || iter->path().extension() != ".change")
+                continue;
+            int nChangeHeight = atoi(iter->path().stem().string());
+            if(nChangeHeight > 0 && !MapChangeFile(nChangeHeight))
+                return false;
+        }
+    } catch (const boost::filesystem::filesystem_error& e) {
+        return error("%s: %s", __func__, e.what());
+    }
+
+    LogPrintf("%s: snapshot height %d, replayed %u blocks up to %d\n", __func__, nBaseHeight, nLogBlocks, nLogHeight);
+    return true;
+}
+
+void CCandyBalanceDB::Close()
+{
+    boost::unique_lock<boost::shared_mutex> lock(cs);
+
+    if(pLogFile)
+    {
+        FileCommit(pLogFile);
+        fclose(pLogFile);
+        pLogFile = NULL;
+    }
+
+    pAllFile.reset();
+    mapChangeFile.clear();
+}
+
+bool CCandyBalanceDB::MapAllFile()
+{
+    // drop the old mapping first, a mapped file cannot be replaced on every platform
+    pAllFile.reset();
+
+    std::shared_ptr<CCandyBalanceFile> pFile = std::make_shared<CCandyBalanceFile>();
+    if(!pFile->Open(pathDir / "all.dat"))
+        return false;
+    pAllFile = pFile;
+    return true;
+}
+
+bool CCandyBalanceDB::MapChangeFile(int nChangeHeight)
+{
+    mapChangeFile.erase(nChangeHeight);
+
+    std::shared_ptr<CCandyBalanceFile> pFile = std::make_shared<CCandyBalanceFile>();
+    if(!pFile->Open(GetChangePath(nChangeHeight)))
+        return false;
+    mapChangeFile[nChangeHeight] = pFile;
+    return true;
+}
+
+bool CCandyBalanceDB::AppendBlock(const CChangeInfo& changeInfo)
+{
+    boost::unique_lock<boost::shared_mutex> lock(cs);
+
+    if(fFailed || !pLogFile)
+        return error("%s: delta log is not open", __func__);
+
+    // already compacted, Open() found it missing from detail.dat
+    if(changeInfo.nHeight > nDetailHeight && changeInfo.nHeight <= nBaseHeight)
+        return true;
+
+    if(changeInfo.nHeight <= nLogHeight)
+        return error("%s: block %d is not above delta log height %d", __func__, changeInfo.nHeight, nLogHeight);
+
+    CDeltaLogRecord record;
+    record.nMagic = DELTA_LOG_MAGIC;
+    record.nHeight = changeInfo.nHeight;
+    record.nLastCandyHeight = changeInfo.nLastCandyHeight;
+    record.nCount = changeInfo.vAddressAmount.size();
+
+    const vector<CAddressAmount>& vAmount = changeInfo.vAddressAmount;
+    if(!WriteDeltaLogBlock(pLogFile, record, vAmount) || fflush(pLogFile))
+    {
+        // drop the partial record so that a retry appends the block again
+        if(!TruncateFile(pLogFile, nLogSize) || fseek(pLogFile, 0L, SEEK_END))
+        {
+            fFailed = true;
+            return error("%s: restore delta log failed at %d", __func__, changeInfo.nHeight);
+        }
+        return error("%s: append block %d to delta log failed", __func__, changeInfo.nHeight);
+    }
+    nLogSize += sizeof(CDeltaLogRecord) + vAmount.size() * sizeof(CAddressAmount);
+
+    for(vector<CAddressAmount>::const_iterator it = vAmount.begin(); it != vAmount.end(); it++)
+    {
+        AddAmount(mapAllDelta, it->key, it->nAmount);
+        if(changeInfo.nLastCandyHeight > 0)
+            AddAmount(mapChangeDelta[changeInfo.nLastCandyHeight], it->key, it->nAmount);
+    }
+
+    nLogHeight = changeInfo.nHeight;
+    nLogBlocks++;
+    return true;
+}
+
+bool CCandyBalanceDB::Sync()
+{
+    boost::unique_lock<boost::shared_mutex> lock(cs);
+
+    if(!pLogFile)
+        return error("%s: delta log is not open", __func__);
+
+    FileCommit(pLogFile);
+    return SyncDetailFile();
+}
+
+void CCandyBalanceDB::SetDetailHeight(int nHeight)
+{
+    boost::unique_lock<boost::shared_mutex> lock(cs);
+    nDetailHeight = nHeight;
+}
+
+int CCandyBalanceDB::GetDetailHeight() const
+{
+    boost::shared_lock<boost::shared_mutex> lock(cs);
+    return nDetailHeight;
+}
+
+int CCandyBalanceDB::GetLogHeight() const
+{
+    boost::shared_lock<boost::shared_mutex> lock(cs);
+    return nLogHeight;
+}
+
+void CCandyBalanceDB::SetChangeHeights(const std::vector<int>& vHeight)
+{
+    boost::unique_lock<boost::shared_mutex> lock(cs);
+    vChangeHeight = vHeight;
+    sort(vChangeHeight.begin(), vChangeHeight.end());
+    vChangeHeight.erase(unique(vChangeHeight.begin(), vChangeHeight.end()), vChangeHeight.end());
+}
+
+void CCandyBalanceDB::AddChangeHeight(int nHeight)
+{
+    boost::unique_lock<boost::shared_mutex> lock(cs);
+    std::vector<int>::iterator it = lower_bound(vChangeHeight.begin(), vChangeHeight.end(), nHeight);
+    if(it == vChangeHeight.end() || *it != nHeight)
+        vChangeHeight.insert(it, nHeight);
+}
+
+bool CCandyBalanceDB::GetAmountByHeight(int nCandyHeight, const CCandyAddressKey& key, CAmount& nAmount) const
+{
+    std::vector<CAmount> vAmount;
+    if(!GetAmountsByHeight(nCandyHeight, std::vector<CCandyAddressKey>(1, key), vAmount))
+        return false;
+
+    nAmount = vAmount[0];
+    return true;
+}
+
+bool CCandyBalanceDB::GetAmountsByHeight(int nCandyHeight, const std::vector<CCandyAddressKey>& vKey, std::vector<CAmount>& vAmount) const
+{
+    boost::shared_lock<boost::shared_mutex> lock(cs);
+
+    std::vector<int>::const_iterator heightit = lower_bound(vChangeHeight.begin(), vChangeHeight.end(), nCandyHeight);
+    if(heightit == vChangeHeight.end() || *heightit != nCandyHeight)
+        return error("%s: get change files failed at %d", __func__, nCandyHeight);
+
+    if(!pAllFile)
+        return error("%s: all.dat is not open", __func__);
+
+    vAmount.assign(vKey.size(), 0);
+
+    // 1. balance after the last appended block
+    pAllFile->AddAmounts(vKey, vAmount, 1);
+    AddAmounts(mapCompactAllDelta, vKey, vAmount, 1);
+    AddAmounts(mapAllDelta, vKey, vAmount, 1);
+
+    // 2. take back every change since nCandyHeight
+    for(; heightit != vChangeHeight.end(); heightit++)
+    {
+        std::map<int, std::shared_ptr<const CCandyBalanceFile> >::const_iterator fileit = mapChangeFile.find(*heightit);
+        if(fileit != mapChangeFile.end())
+            fileit->second->AddAmounts(vKey, vAmount, -1);
+
+        std::map<int, amount_m_t>::const_iterator it = mapCompactChangeDelta.find(*heightit);
+        if(it != mapCompactChangeDelta.end())
+            AddAmounts(it->second, vKey, vAmount, -1);
+
+        it = mapChangeDelta.find(*heightit);
+        if(it != mapChangeDelta.end())
+            AddAmounts(it->second, vKey, vAmount, -1);
+    }
+
+    return true;
+}
+
+void CCandyBalanceDB::RemoveChangeBefore(int nHeight)
+{
+    boost::unique_lock<boost::shared_mutex> lock(cs);
+
+    if(nHeight < 0 || nHeight <= nRemovedHeight)
+        return;
+    nRemovedHeight = nHeight;
+
+    mapChangeDelta.erase(mapChangeDelta.begin(), mapChangeDelta.lower_bound(nHeight));
+    mapChangeFile.erase(mapChangeFile.begin(), mapChangeFile.lower_bound(nHeight));
+
+    // the files left behind are removed with the next candy height
+    try {
+        if(!boost::filesystem::exists(pathDir) || !boost::filesystem::is_directory(pathDir))
+            return;
+
+        string strFileName = "";
+        boost::filesystem::directory_iterator end_iter;
+        for(boost::filesystem::directory_iterator iter(pathDir); iter != end_iter; ++iter)
+        {
+            boost::this_thread::interruption_point();
+
+            if(!boost::filesystem::is_regular_file(iter->status()))
+                continue;
+
+            // a running compaction still owns its temp files
+            if(fCompacting && iter->path().extension() == ".temp")
+                continue;
+
+            strFileName = iter->path().filename().string();
+
+            int nTempHeight = atoi(strFileName);
+            if(nTempHeight == 0 && (strFileName[0] > '9' || strFileName[0] < '0'))
+                continue;
+
+            if(nTempHeight >= nHeight)
+                continue;
+
+            boost::filesystem::remove(iter->path());
+        }
+    } catch (const boost::filesystem::filesystem_error& e) {
+        LogPrintf("%s: %s\n", __func__, e.what());
+    }
+}
+
+bool CCandyBalanceDB::NeedCompact() const
+{
+    boost::shared_lock<boost::shared_mutex> lock(cs);
+
+    if(fFailed || fCompacting || !pLogFile || nLogBlocks == 0 || nLogHeight != nDetailHeight)
+        return false;
+
+    return nLogBlocks >= DEFAULT_CANDY_COMPACT_BLOCKS || nLogSize >= MAX_CANDY_DELTA_LOG_SIZE;
+}
+
+bool CCandyBalanceDB::AbortCompaction()
+{
+    if(pLogFile)
+    {
+        fclose(pLogFile);
+        pLogFile = NULL;
+    }
+
+    bool fRet = true;
+    try {
+        RemoveTempFiles(pathDir);
+        boost::filesystem::remove(GetCommitPath());
+        fRet = FoldDeltaLogs(GetOldLogPath(), GetLogPath()) && OpenLog();
+    } catch (const boost::filesystem::filesystem_error& e) {
+        fRet = error("%s: %s", __func__, e.what());
+    }
+
+    for(amount_m_t::const_iterator it = mapCompactAllDelta.begin(); it != mapCompactAllDelta.end(); it++)
+        AddAmount(mapAllDelta, it->first, it->second);
+    for(std::map<int, amount_m_t>::const_iterator it = mapCompactChangeDelta.begin(); it != mapCompactChangeDelta.end(); it++)
+    {
+        if(it->first < nRemovedHeight)
+            continue;
+        for(amount_m_t::const_iterator amountit = it->second.begin(); amountit != it->second.end(); amountit++)
+            AddAmount(mapChangeDelta[it->first], amountit->first, amountit->second);
+    }
+
+    mapCompactAllDelta.clear();
+    mapCompactChangeDelta.clear();
+    nLogBlocks += nCompactBlocks;
+    fCompacting = false;
+
+    if(!fRet)
+    {
+        fFailed = true;
+        return error("%s: restore delta log failed, restart to roll back the compaction", __func__);
+    }
+    return true;
+}
+
+bool CCandyBalanceDB::Compact()
+{
+    int64_t nTimeStart = GetTimeMillis();
+    int nRemovedHeightStart = 0;
+
+    // 1. rotate the log and freeze the deltas it covers
+    {
+        boost::unique_lock<boost::shared_mutex> lock(cs);
+
+        if(fFailed || fCompacting || !pLogFile || nLogBlocks == 0 || nLogHeight != nDetailHeight)
+            return true;
+
+        // the snapshots will cover nLogHeight, detail.dat must not lose it on a power loss
+        if(nSyncedDetailHeight < nLogHeight && !SyncDetailFile())
+            return error("%s: sync detail.dat at %d failed", __func__, nLogHeight);
+
+        FileCommit(pLogFile);
+        fclose(pLogFile);
+        pLogFile = NULL;
+
+        bool fRotated = false;
+        try {
+            fRotated = RenameOver(GetLogPath(), GetOldLogPath()) && WriteDeltaLog(GetLogPath(), nLogHeight, vector<CDeltaLogBlock>()) && OpenLog();
+        } catch (const boost::filesystem::filesystem_error& e) {
+            LogPrintf("%s: %s\n", __func__, e.what());
+        }
+
+        if(!fRotated)
+        {
+            if(pLogFile)
+            {
+                fclose(pLogFile);
+                pLogFile = NULL;
+            }
+
+            bool fRestored = false;
+            try {
+                fRestored = (!boost::filesystem::exists(GetOldLogPath()) || FoldDeltaLogs(GetOldLogPath(), GetLogPath())) && OpenLog();
+            } catch (const boost::filesystem::filesystem_error& e) {
+                LogPrintf("%s: %s\n", __func__, e.what());
+            }
+            if(!fRestored)
+            {
+                fFailed = true;
+                return error("%s: restore delta log failed, restart to roll back the compaction", __func__);
+            }
+            return error("%s: rotate delta log failed at %d", __func__, nLogHeight);
+        }
+
+        fCompacting = true;
+        nCompactHeight = nLogHeight;
+        nCompactBlocks = nLogBlocks;
+        nLogBlocks = 0;
+        mapCompactAllDelta.swap(mapAllDelta);
+        mapCompactChangeDelta.swap(mapChangeDelta);
+        nRemovedHeightStart = nRemovedHeight;
+    }
+
+    // 2. merge the frozen deltas into temp snapshots, readers and writers keep going
+    bool fSuccess = true;
+    try {
+        // a marker left by an earlier compaction would finish this one on the next start
+        boost::filesystem::remove(GetCommitPath());
+
+        fSuccess = MergeFileAndMap((pathDir / "all.dat").string(), mapCompactAllDelta, (pathDir / "all.dat.temp").string());
+        for(std::map<int, amount_m_t>::const_iterator it = mapCompactChangeDelta.begin(); fSuccess && it != mapCompactChangeDelta.end(); it++)
+        {
+            if(it->first < nRemovedHeightStart)
+                continue;
+
+            string strChangeFile = GetChangePath(it->first).string();
+            if(!boost::filesystem::exists(strChangeFile) && !CreateEmptyFile(strChangeFile))
+                fSuccess = false;
+            else
+                fSuccess = MergeFileAndMap(strChangeFile, it->second, strChangeFile + ".temp");
+        }
+
+        if(fSuccess)
+        {
+            FILE* pCommitFile = fopen(GetCommitPath().string().data(), "wb");
+            fSuccess = (pCommitFile != NULL);
+            if(pCommitFile)
+            {
+                FileCommit(pCommitFile);
+                fclose(pCommitFile);
+            }
+        }
+    } catch (const boost::filesystem::filesystem_error& e) {
+        fSuccess = error("%s: %s", __func__, e.what());
+    }
+
+    // 3. swap the snapshots in
+    boost::unique_lock<boost::shared_mutex> lock(cs);
+
+    if(!fSuccess)
+    {
+        AbortCompaction();
+        return error("%s: merge delta log into snapshots failed at %d", __func__, nCompactHeight);
+    }
+
+    // the commit marker is on disk, from here on a failure is finished by Open() on the next start
+    pAllFile.reset();
+    if(!RenameOver(pathDir / "all.dat.temp", pathDir / "all.dat") || !MapAllFile())
+    {
+        fFailed = true;
+        return error("%s: rename all.dat.temp failed, restart to finish the compaction", __func__);
+    }
+
+    for(std::map<int, amount_m_t>::const_iterator it = mapCompactChangeDelta.begin(); it != mapCompactChangeDelta.end(); it++)
+    {
+        if(it->first < nRemovedHeightStart)
+            continue;
+
+        boost::filesystem::path pathChange = GetChangePath(it->first);
+        boost::filesystem::path pathTemp = pathChange.string() + ".temp";
+        mapChangeFile.erase(it->first);
+        if(it->first < nRemovedHeight)
+        {
+            try {
+                boost::filesystem::remove(pathTemp);
+            } catch (const boost::filesystem::filesystem_error& e) {
+                LogPrintf("%s: %s\n", __func__, e.what());
+            }
+        }
+        else if(!RenameOver(pathTemp, pathChange) || !MapChangeFile(it->first))
+        {
+            fFailed = true;
+            return error("%s: rename %s failed, restart to finish the compaction", __func__, pathTemp.string());
+        }
+    }
+
+    // a leftover delta.log.old is finished by Open(), a leftover marker is dropped there
+    try {
+        boost::filesystem::remove(GetOldLogPath());
+        boost::filesystem::remove(GetCommitPath());
+    } catch (const boost::filesystem::filesystem_error& e) {
+        LogPrintf("%s: %s\n", __func__, e.what());
+    }
+
+    nBaseHeight = nCompactHeight;
+    mapCompactAllDelta.clear();
+    mapCompactChangeDelta.clear();
+    fCompacting = false;
+
+    LogPrintf("%s: compacted %u blocks up to %d, %dms\n", __func__, nCompactBlocks, nCompactHeight, GetTimeMillis() - nTimeStart);
+    return true;
+}
+
+bool CCandyBalanceDB::IsFailed() const
+{
+    boost::shared_lock<boost::shared_mutex> lock(cs);
+    return fFailed;
+}
+
+/** Shut down like AbortNode(), Open() recovers the store on the next start */
+static void AbortCandyBalance(const std::string& strMessage)
+{
+    strMiscWarning = strMessage;
+    LogPrintf("*** %s\n", strMessage);
+    uiInterface.ThreadSafeMessageBox(_("Error: A fatal internal error occurred, see debug.log for details"), "", CClientUIInterface::MSG_ERROR);
+    StartShutdown();
+}
+
+void ThreadCompactCandyBalance()
+{
+    SetThreadPriority(THREAD_PRIORITY_BELOW_NORMAL);
+    RenameThread("safe-candy-compact");
+
+    while (true)
+    {
+        boost::this_thread::interruption_point();
+        if (candybalancedb.NeedCompact() && !candybalancedb.Compact() && candybalancedb.IsFailed())
+        {
+            AbortCandyBalance("Failed to compact the candy balance snapshots");
+            return;
+        }
+        MilliSleep(1000);
+    }
+}
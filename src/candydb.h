@@ -0,0 +1,157 @@
+// Copyright (c) 2018-2019 The Safe Core developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#ifndef SAFE_CANDYDB_H
+#define SAFE_CANDYDB_H
+
+#include "amount.h"
+#include "candyaddress.h"
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <boost/filesystem/path.hpp>
+#include <boost/thread/shared_mutex.hpp>
+
+struct CChangeInfo;
+class CCandyBalanceFile;
+
+//! blocks appended to delta.log before the snapshots are compacted
+static const unsigned int DEFAULT_CANDY_COMPACT_BLOCKS = 1000;
+//! size of delta.log (bytes) that forces a compaction
+static const long MAX_CANDY_DELTA_LOG_SIZE = 64 * 1024 * 1024;
+
+/**
+ * Log-structured store of the per-address SAFE balances used for candy.
+ *
+ * height/all.dat and height/<candy height>.change are CAddressAmount snapshots sorted
+ * by the binary address key, they are only rewritten by Compact(). Every block in
+ * between is appended to height/delta.log and folded into an in-memory delta index,
+ * so writing a block costs O(changed addresses) instead of a full copy of all.dat.
+ *
+ * Snapshots written before the binary keys held base58 strings without a header,
+ * Open() converts them once.
+ *
+ * The snapshots are kept memory mapped and looked up in place. Readers share the
+ * lock with each other, it is only taken exclusively to update the in-memory
+ * state and to swap in compacted snapshots.
+ */
+class CCandyBalanceDB
+{
+private:
+    typedef std::map<CCandyAddressKey, CAmount> amount_m_t;
+
+    mutable boost::shared_mutex cs;
+
+    boost::filesystem::path pathDir;
+    FILE* pLogFile;
+
+    //! the snapshot files contain every block up to this height
+    int nBaseHeight;
+    //! last block appended to delta.log
+    int nLogHeight;
+    //! last block recorded in detail.dat, blocks above it may still be rewritten
+    int nDetailHeight;
+    //! detail.dat was flushed to disk up to this block
+    int nSyncedDetailHeight;
+    //! change files below this height have been removed
+    int nRemovedHeight;
+    //! blocks appended to delta.log since the last compaction
+    unsigned int nLogBlocks;
+    long nLogSize;
+
+    //! deltas of the blocks appended after nBaseHeight
+    amount_m_t mapAllDelta;
+    std::map<int, amount_m_t> mapChangeDelta;
+
+    //! deltas being merged into the snapshots by a running compaction
+    bool fCompacting;
+    int nCompactHeight;
+    unsigned int nCompactBlocks;
+    amount_m_t mapCompactAllDelta;
+    std::map<int, amount_m_t> mapCompactChangeDelta;
+
+    //! delta.log or a snapshot could not be restored, nothing is written until a restart
+    bool fFailed;
+
+    //! sorted candy heights, each of them has a change file (it may still be empty)
+    std::vector<int> vChangeHeight;
+    //! mapped snapshots
+    std::shared_ptr<const CCandyBalanceFile> pAllFile;
+    std::map<int, std::shared_ptr<const CCandyBalanceFile> > mapChangeFile;
+
+    boost::filesystem::path GetLogPath() const { return pathDir / "delta.log"; }
+    boost::filesystem::path GetOldLogPath() const { return pathDir / "delta.log.old"; }
+    boost::filesystem::path GetCommitPath() const { return pathDir / "delta.log.commit"; }
+    boost::filesystem::path GetDetailPath() const { return pathDir / "detail.dat"; }
+    boost::filesystem::path GetChangePath(int nChangeHeight) const;
+
+    bool OpenLog();
+    bool SyncDetailFile();
+    bool RecoverCompaction();
+    bool AbortCompaction();
+    bool UpgradeSnapshots();
+    bool MapAllFile();
+    bool MapChangeFile(int nChangeHeight);
+
+public:
+    CCandyBalanceDB();
+    ~CCandyBalanceDB();
+
+    /**
+     * Open the store in pathDirIn and replay delta.log on top of the snapshots.
+     * Blocks above nDetailHeightIn are dropped, they are replayed by LoadChangeInfoToList().
+     * delta.log can also end below nDetailHeightIn after a power loss, see GetLogHeight().
+     * If detail.dat lost blocks the snapshots already have, AppendBlock() skips them
+     * while LoadChangeInfoToList() writes them to detail.dat again.
+     */
+    bool Open(const boost::filesystem::path& pathDirIn, int nDetailHeightIn);
+    void Close();
+
+    /** Append the address deltas of one block, must be called in height order */
+    bool AppendBlock(const CChangeInfo& changeInfo);
+    /** Flush the appended blocks and detail.dat to disk */
+    bool Sync();
+    /** Record that detail.dat now covers nHeight */
+    void SetDetailHeight(int nHeight);
+    int GetDetailHeight() const;
+    /** Last block appended to delta.log or compacted, the blocks above it have to be appended again */
+    int GetLogHeight() const;
+
+    /** Replace the cached candy heights, called with the block tree index on startup */
+    void SetChangeHeights(const std::vector<int>& vHeight);
+    void AddChangeHeight(int nHeight);
+
+    /**
+     * Balance of key at candy height nCandyHeight, that is the balance after the
+     * last appended block minus the changes of every candy period from nCandyHeight on.
+     */
+    bool GetAmountByHeight(int nCandyHeight, const CCandyAddressKey& key, CAmount& nAmount) const;
+    /**
+     * Batched GetAmountByHeight() for keys sorted in ascending order. Every snapshot
+     * and delta is walked once alongside vKey, vAmount[i] is the balance of vKey[i].
+     */
+    bool GetAmountsByHeight(int nCandyHeight, const std::vector<CCandyAddressKey>& vKey, std::vector<CAmount>& vAmount) const;
+
+    /** Remove the change files (and their pending deltas) below nHeight */
+    void RemoveChangeBefore(int nHeight);
+
+    bool NeedCompact() const;
+    /**
+     * Merge the pending deltas into the snapshot files. Only the final renames
+     * are done under the lock, so this runs off the block-writing path.
+     * detail.dat is flushed first, the snapshots never get ahead of it on disk.
+     */
+    bool Compact();
+    /** A failed append or compaction left the store to be recovered by Open() on the next start */
+    bool IsFailed() const;
+};
+
+extern CCandyBalanceDB candybalancedb;
+
+void ThreadCompactCandyBalance();
+
+#endif // SAFE_CANDYDB_H
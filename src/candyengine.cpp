@@ -0,0 +1,505 @@
+// Copyright (c) 2018-2019 The Safe Core developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#if defined(HAVE_CONFIG_H)
+#include "config/safe-chain.h"
+#include "config/safe-config.h"
+#endif
+
+#include "candyengine.h"
+
+#include "base58.h"
+#include "chain.h"
+#include "init.h"
+#include "main.h"
+#include "rpc/server.h"
+#include "ui_interface.h"
+#include "util.h"
+#include "utiltime.h"
+#ifdef ENABLE_WALLET
+#include "wallet/wallet.h"
+#endif
+
+#include <algorithm>
+
+#include <boost/thread.hpp>
+
+extern bool fGetCandyInfoStart;
+extern bool fHaveGUI;
+extern unsigned int nCandyPageCount;
+
+CCandyInfoStore candyinfostore;
+CCandyEngine candyengine;
+
+struct CompareCandyJobHeight
+{
+    bool operator()(const CCandyJob& a, const CCandyJob& b) const
+    {
+        return a.nHeight > b.nHeight;
+    }
+};
+
+bool CCandyInfoStore::IsInFirstPage(info_set_t::const_iterator itInfo, const unsigned int nPageCount) const
+{
+    info_set_t::const_iterator it = setInfo.begin();
+    for (unsigned int i = 0; i < nPageCount && it != setInfo.end(); i++, it++)
+    {
+        if (it == itInfo)
+            return true;
+    }
+    return false;
+}
+
+bool CCandyInfoStore::Insert(const CCandy_BlockTime_Info& info, const unsigned int nPageCount, bool& fFirstPage)
+{
+    boost::unique_lock<boost::shared_mutex> lock(cs);
+    fFirstPage = false;
+    if (mapByOut.count(info.outpoint))
+        return false;
+
+    info_set_t::iterator it = setInfo.insert(info).first;
+    mapByOut.insert(std::make_pair(info.outpoint, it));
+    fFirstPage = IsInFirstPage(it, nPageCount);
+    return true;
+}
+
+void CCandyInfoStore::Erase(const std::set<COutPoint>& setOut, const unsigned int nPageCount, bool& fFirstPage)
+{
+    boost::unique_lock<boost::shared_mutex> lock(cs);
+    fFirstPage = false;
+    for (std::set<COutPoint>::const_iterator it = setOut.begin(); it != setOut.end(); it++)
+    {
+        std::map<COutPoint, info_set_t::iterator>::iterator mi = mapByOut.find(*it);
+        if (mi == mapByOut.end())
+            continue;
+
+        if (!fFirstPage)
+            fFirstPage = IsInFirstPage(mi->second, nPageCount);
+        setInfo.erase(mi->second);
+        mapByOut.erase(mi);
+    }
+}
+
+bool CCandyInfoStore::Erase(const COutPoint& out)
+{
+    boost::unique_lock<boost::shared_mutex> lock(cs);
+    std::map<COutPoint, info_set_t::iterator>::iterator mi = mapByOut.find(out);
+    if (mi == mapByOut.end())
+        return false;
+
+    setInfo.erase(mi->second);
+    mapByOut.erase(mi);
+    return true;
+}
+
+size_t CCandyInfoStore::Size() const
+{
+    boost::shared_lock<boost::shared_mutex> lock(cs);
+    return setInfo.size();
+}
+
+bool CCandyInfoStore::Empty() const
+{
+    boost::shared_lock<boost::shared_mutex> lock(cs);
+    return setInfo.empty();
+}
+
+void CCandyInfoStore::GetPage(const size_t nOffset, const size_t nCount, std::vector<CCandy_BlockTime_Info>& vInfo) const
+{
+    vInfo.clear();
+
+    boost::shared_lock<boost::shared_mutex> lock(cs);
+    if (nOffset >= setInfo.size())
+        return;
+
+    info_set_t::const_iterator it = setInfo.begin();
+    std::advance(it, nOffset);
+    for (; it != setInfo.end() && vInfo.size() < nCount; it++)
+        vInfo.push_back(*it);
+}
+
+void CCandyInfoStore::GetPageAfter(const CCandy_BlockTime_Info* pCursor, const size_t nCount, std::vector<CCandy_BlockTime_Info>& vInfo) const
+{
+    vInfo.clear();
+
+    boost::shared_lock<boost::shared_mutex> lock(cs);
+    info_set_t::const_iterator it = pCursor ? setInfo.upper_bound(*pCursor) : setInfo.begin();
+    for (; it != setInfo.end() && vInfo.size() < nCount; it++)
+        vInfo.push_back(*it);
+}
+
+CCandyEngine::CCandyEngine() : nRunning(0), fLoaded(false)
+{
+}
+
+void CCandyEngine::RefreshAddress()
+{
+    std::shared_ptr<CCandyWalletAddresses> pNewAddress = std::make_shared<CCandyWalletAddresses>();
+#ifdef ENABLE_WALLET
+    if (pwalletMain)
+    {
+        std::map<CKeyID, int64_t> mapKeyBirth;
+        {
+            LOCK(pwalletMain->cs_wallet);
+            pwalletMain->GetKeyBirthTimes(mapKeyBirth);
+        }
+
+        // the key ids come sorted, and they all are pubkey hash addresses
+        pNewAddress->vKey.reserve(mapKeyBirth.size());
+        pNewAddress->vAddress.reserve(mapKeyBirth.size());
+        for (std::map<CKeyID, int64_t>::const_iterator it = mapKeyBirth.begin(); it != mapKeyBirth.end(); it++)
+        {
+            CCandyAddressKey key;
+            key.SetDestination(it->first);
+            pNewAddress->vKey.push_back(key);
+            pNewAddress->vAddress.push_back(CBitcoinAddress(it->first).ToString());
+        }
+    }
+#endif
+
+    std::lock_guard<std::mutex> lock(cs);
+    pAddress = pNewAddress;
+}
+
+void CCandyEngine::QueueJobs(const std::vector<CCandyJob>& vJob)
+{
+    if (vJob.empty())
+        return;
+
+    RefreshAddress();
+
+    std::lock_guard<std::mutex> lock(cs);
+    for (std::vector<CCandyJob>::const_iterator it = vJob.begin(); it != vJob.end(); it++)
+    {
+        if (mapKnown.count(it->out))
+            continue;
+        mapKnown.insert(std::make_pair(it->out, *it));
+        queueJob.push_back(*it);
+    }
+    condJob.notify_all();
+}
+
+bool CCandyEngine::LoadAll()
+{
+    {
+        // blocks connected from now on arrive through SyncTransaction, the overlap is dropped by mapKnown
+        std::lock_guard<std::mutex> lock(cs);
+        fLoaded = true;
+    }
+
+    std::map<CPutCandy_IndexKey, CPutCandy_IndexValue> mapCandy;
+    GetAssetIdCandyInfoList(mapCandy);
+
+    std::vector<CCandyJob> vJob;
+    {
+        LOCK(cs_main);
+        int nCurrentHeight = chainActive.Height();
+        for (std::map<CPutCandy_IndexKey, CPutCandy_IndexValue>::const_iterator it = mapCandy.begin(); it != mapCandy.end(); it++)
+        {
+            const CPutCandy_IndexKey& key = it->first;
+            const CPutCandy_IndexValue& value = it->second;
+            if (IsCandyExpired(value.nHeight, key.candyInfo.nExpired, nCurrentHeight))
+                continue;
+
+            BlockMap::const_iterator mi = mapBlockIndex.find(value.blockHash);
+            if (mi == mapBlockIndex.end() || !chainActive.Contains(mi->second))
+                continue;
+
+            vJob.push_back(CCandyJob(key.assetId, key.out, key.candyInfo, value.blockHash, value.nHeight, mi->second->GetBlockTime()));
+        }
+    }
+
+    // the newest candies fill the first page, evaluate them first
+    std::sort(vJob.begin(), vJob.end(), CompareCandyJobHeight());
+    QueueJobs(vJob);
+
+    LogPrintf("CCandyEngine::%s: queued %u candies\n", __func__, vJob.size());
+    return true;
+}
+
+void CCandyEngine::NotifyCandyHeight(const int nCandyHeight)
+{
+    {
+        std::lock_guard<std::mutex> lock(cs);
+        if (!mapWaiting.count(nCandyHeight))
+            return;
+    }
+
+    RefreshAddress();
+
+    std::lock_guard<std::mutex> lock(cs);
+    std::pair<std::multimap<int, CCandyJob>::iterator, std::multimap<int, CCandyJob>::iterator> range = mapWaiting.equal_range(nCandyHeight);
+    if (range.first == range.second)
+        return;
+
+    for (std::multimap<int, CCandyJob>::iterator it = range.first; it != range.second; it++)
+        queueJob.push_back(it->second);
+    mapWaiting.erase(range.first, range.second);
+    condJob.notify_all();
+}
+
+bool CCandyEngine::IsIdle()
+{
+    std::lock_guard<std::mutex> lock(cs);
+    return fLoaded && queueJob.empty() && nRunning == 0;
+}
+
+void CCandyEngine::GetJobCounts(size_t& nQueued, size_t& nWaiting)
+{
+    std::lock_guard<std::mutex> lock(cs);
+    nQueued = queueJob.size();
+    nWaiting = mapWaiting.size();
+}
+
+void CCandyEngine::SyncTransaction(const CTransaction& tx, const CBlock* pblock)
+{
+    if (!pblock)
+        return;
+
+    {
+        std::lock_guard<std::mutex> lock(cs);
+        if (!fLoaded)
+            return;
+    }
+
+    std::vector<CCandyJob> vJob;
+    int nHeight = -1;
+    for (unsigned int i = 0; i < tx.vout.size(); i++)
+    {
+        const CTxOut& txout = tx.vout[i];
+        uint32_t nAppCmd = 0;
+        if (!txout.IsAsset(&nAppCmd) || nAppCmd != PUT_CANDY_CMD)
+            continue;
+
+        CAppHeader header;
+        std::vector<unsigned char> vData;
+        if (!ParseReserve(txout.vReserve, header, vData))
+            continue;
+
+        CPutCandyData candyData;
+        if (!ParsePutCandyData(vData, candyData) || candyData.assetId.IsNull())
+            continue;
+
+        if (nHeight < 0)
+        {
+            // called from ConnectTip with cs_main held
+            BlockMap::const_iterator mi = mapBlockIndex.find(pblock->GetHash());
+            if (mi == mapBlockIndex.end())
+                return;
+            nHeight = mi->second->nHeight;
+        }
+
+        vJob.push_back(CCandyJob(candyData.assetId, COutPoint(tx.GetHash(), i), CCandyInfo(candyData.nAmount, candyData.nExpired),
+                                 pblock->GetHash(), nHeight, pblock->GetBlockTime()));
+    }
+
+    if (vJob.empty())
+        return;
+
+    // the balances of a new candy height are not written yet, these wait for NotifyCandyHeight()
+    std::lock_guard<std::mutex> lock(cs);
+    for (std::vector<CCandyJob>::const_iterator it = vJob.begin(); it != vJob.end(); it++)
+    {
+        if (mapKnown.count(it->out))
+            continue;
+        mapKnown.insert(std::make_pair(it->out, *it));
+        mapWaiting.insert(std::make_pair(it->nHeight, *it));
+    }
+}
+
+void CCandyEngine::UpdatedBlockTip(const CBlockIndex* pindexNew, const CBlockIndex* pindexFork, bool fInitialDownload)
+{
+    if (!pindexNew)
+        return;
+
+    int nCurrentHeight = pindexNew->nHeight;
+    int nForkHeight = pindexFork ? pindexFork->nHeight : -1;
+
+    std::vector<COutPoint> vRemove;
+    {
+        LOCK(cs_main);
+        std::lock_guard<std::mutex> lock(cs);
+        if (!fLoaded)
+            return;
+
+        for (std::map<COutPoint, CCandyJob>::const_iterator it = mapKnown.begin(); it != mapKnown.end(); it++)
+        {
+            const CCandyJob& job = it->second;
+            if (IsCandyExpired(job.nHeight, job.candyInfo.nExpired, nCurrentHeight))
+            {
+                vRemove.push_back(it->first);
+                continue;
+            }
+
+            // candies above the fork point may have been disconnected by a reorg
+            if (job.nHeight > nForkHeight)
+            {
+                BlockMap::const_iterator mi = mapBlockIndex.find(job.blockHash);
+                if (mi == mapBlockIndex.end() || !chainActive.Contains(mi->second))
+                    vRemove.push_back(it->first);
+            }
+        }
+    }
+
+    if (!vRemove.empty())
+        RemoveCandies(vRemove);
+}
+
+void CCandyEngine::RemoveCandies(const std::vector<COutPoint>& vOut)
+{
+    std::set<COutPoint> setOut(vOut.begin(), vOut.end());
+    {
+        std::lock_guard<std::mutex> lock(cs);
+        for (std::deque<CCandyJob>::iterator it = queueJob.begin(); it != queueJob.end(); )
+        {
+            if (setOut.count(it->out))
+                it = queueJob.erase(it);
+            else
+                it++;
+        }
+
+        for (std::multimap<int, CCandyJob>::iterator it = mapWaiting.begin(); it != mapWaiting.end(); )
+        {
+            if (setOut.count(it->second.out))
+                mapWaiting.erase(it++);
+            else
+                it++;
+        }
+
+        for (std::set<COutPoint>::const_iterator it = setOut.begin(); it != setOut.end(); it++)
+            mapKnown.erase(*it);
+    }
+
+    bool fUpdateUI = false;
+    candyinfostore.Erase(setOut, nCandyPageCount, fUpdateUI);
+
+    if (fUpdateUI && fHaveGUI)
+        uiInterface.CandyVecPut();
+}
+
+bool CCandyEngine::Evaluate(const CCandyJob& job, const address_ptr_t& pAddressIn)
+{
+    if (job.candyInfo.nAmount <= 0 || !pAddressIn || pAddressIn->vKey.empty())
+        return false;
+
+    if (IsCandyExpired(job.nHeight, job.candyInfo.nExpired, g_nChainHeight))
+        return false;
+
+    CAssetId_AssetInfo_IndexValue assetInfo;
+    if (!GetAssetInfoByAssetId(job.assetId, assetInfo, false))
+        return false;
+
+    CAmount nTotalSafe = 0;
+    if (!GetTotalAmountByHeight(job.nHeight, nTotalSafe) || nTotalSafe <= 0)
+        return false;
+
+    CAmount dbamount = 0;
+    CAmount memamount = 0;
+    if (!GetGetCandyTotalAmount(job.assetId, job.out, dbamount, memamount))
+        return false;
+
+    const std::vector<std::string>& vAddress = pAddressIn->vAddress;
+    std::vector<CAmount> vSafe;
+    if (!GetAddressAmountsByHeight(job.nHeight, pAddressIn->vKey, vSafe))
+        return false;
+
+    CAmount nMinCandyAmount = AmountFromValue("0.0001", assetInfo.assetData.nDecimals, true);
+    CAmount nNowGetCandyTotalAmount = 0;
+    bool fFound = false;
+    for (size_t i = 0; i < vAddress.size(); i++)
+    {
+        boost::this_thread::interruption_point();
+
+        const CAmount& nSafe = vSafe[i];
+        if (nSafe < 1 * COIN || nSafe > nTotalSafe)
+            continue;
+
+        CAmount nTempAmount = 0;
+        CAmount nCandyAmount = (CAmount)(1.0 * nSafe / nTotalSafe * job.candyInfo.nAmount);
+        if (nCandyAmount >= nMinCandyAmount && !GetGetCandyAmount(job.assetId, job.out, vAddress[i], nTempAmount))
+        {
+            fFound = true;
+            nNowGetCandyTotalAmount += nCandyAmount;
+        }
+    }
+
+    if (!fFound || nNowGetCandyTotalAmount + dbamount + memamount > job.candyInfo.nAmount)
+        return false;
+
+    CCandy_BlockTime_Info info(job.assetId, assetInfo.assetData, job.candyInfo, job.out, job.nBlockTime, job.nHeight);
+    bool fUpdateUI = false;
+    {
+        // a reorg may have dropped the candy while it was evaluated
+        std::lock_guard<std::mutex> lock(cs);
+        if (!mapKnown.count(job.out))
+            return false;
+
+        candyinfostore.Insert(info, nCandyPageCount, fUpdateUI);
+    }
+
+    if (fUpdateUI && fHaveGUI)
+        uiInterface.CandyVecPut();
+
+    return true;
+}
+
+void CCandyEngine::ThreadWorker()
+{
+    RenameThread("safe-candy-worker");
+
+    while (true)
+    {
+        boost::this_thread::interruption_point();
+
+        CCandyJob job;
+        address_ptr_t pAddressJob;
+        {
+            std::unique_lock<std::mutex> lock(cs);
+            if (queueJob.empty())
+            {
+                condJob.wait_for(lock, std::chrono::milliseconds(100));
+                continue;
+            }
+
+            job = queueJob.front();
+            queueJob.pop_front();
+
+            // checked under the lock, so NotifyCandyHeight() can't run between the check and the insert
+            CAmount nTotalSafe = 0;
+            if (!GetTotalAmountByHeight(job.nHeight, nTotalSafe))
+            {
+                mapWaiting.insert(std::make_pair(job.nHeight, job));
+                continue;
+            }
+
+            pAddressJob = pAddress;
+            nRunning++;
+        }
+
+        try {
+            Evaluate(job, pAddressJob);
+        } catch (const boost::thread_interrupted&) {
+            std::lock_guard<std::mutex> lock(cs);
+            nRunning--;
+            throw;
+        }
+
+        std::lock_guard<std::mutex> lock(cs);
+        nRunning--;
+    }
+}
+
+void ThreadGetAllCandyInfo()
+{
+    SetThreadPriority(THREAD_PRIORITY_BELOW_NORMAL);
+    RenameThread("safe-get-allcandy");
+
+    while (!fGetCandyInfoStart)
+    {
+        boost::this_thread::interruption_point();
+        MilliSleep(100);
+    }
+
+    candyengine.LoadAll();
+}
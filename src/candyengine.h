@@ -0,0 +1,160 @@
+// Copyright (c) 2018-2019 The Safe Core developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#ifndef SAFE_CANDYENGINE_H
+#define SAFE_CANDYENGINE_H
+
+#include "validation.h"
+#include "validationinterface.h"
+
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <vector>
+
+#include <boost/thread/shared_mutex.hpp>
+
+//! default number of threads evaluating candies for the wallet
+static const int DEFAULT_CANDY_THREADS = 2;
+//! maximum number of threads evaluating candies for the wallet
+static const int MAX_CANDY_THREADS = 16;
+
+/** Addresses of the wallet sorted by key, vAddress[i] is the base58 form of vKey[i] */
+struct CCandyWalletAddresses
+{
+    std::vector<CCandyAddressKey> vKey;
+    std::vector<std::string> vAddress;
+};
+
+/** Newest candies first, ties are ordered by asset id and outpoint */
+struct CompareCandyBlockTime
+{
+    bool operator()(const CCandy_BlockTime_Info& a, const CCandy_BlockTime_Info& b) const
+    {
+        if (a.blocktime != b.blocktime)
+            return a.blocktime > b.blocktime;
+        if (a.assetId != b.assetId)
+            return a.assetId < b.assetId;
+        return a.outpoint < b.outpoint;
+    }
+};
+
+/**
+ * The candies the wallet can get, newest first.
+ *
+ * Candies are inserted and erased in O(log n) and looked up by outpoint. Pages are
+ * read either by offset or after a cursor entry, the cursor stays valid when the
+ * entry itself has been erased in the meantime. Readers share the lock, so paging
+ * through the list doesn't hold up the candy engine.
+ */
+class CCandyInfoStore
+{
+private:
+    typedef std::set<CCandy_BlockTime_Info, CompareCandyBlockTime> info_set_t;
+
+    mutable boost::shared_mutex cs;
+    info_set_t setInfo;
+    std::map<COutPoint, info_set_t::iterator> mapByOut;
+
+    bool IsInFirstPage(info_set_t::const_iterator itInfo, const unsigned int nPageCount) const;
+
+public:
+    /** Returns false if the candy is already stored. fFirstPage is set if it is one of the first nPageCount entries */
+    bool Insert(const CCandy_BlockTime_Info& info, const unsigned int nPageCount, bool& fFirstPage);
+    /** Erase the candies of setOut, fFirstPage is set if one of them was on the first page */
+    void Erase(const std::set<COutPoint>& setOut, const unsigned int nPageCount, bool& fFirstPage);
+    bool Erase(const COutPoint& out);
+
+    size_t Size() const;
+    bool Empty() const;
+
+    /** Read nCount candies starting at position nOffset */
+    void GetPage(const size_t nOffset, const size_t nCount, std::vector<CCandy_BlockTime_Info>& vInfo) const;
+    /** Read nCount candies ordered after cursor, or from the first one when pCursor is NULL */
+    void GetPageAfter(const CCandy_BlockTime_Info* pCursor, const size_t nCount, std::vector<CCandy_BlockTime_Info>& vInfo) const;
+};
+
+extern CCandyInfoStore candyinfostore;
+
+/** One put-candy output to be evaluated against the addresses of the wallet */
+struct CCandyJob
+{
+    uint256 assetId;
+    COutPoint out;
+    CCandyInfo candyInfo;
+    uint256 blockHash;
+    int nHeight;
+    int64_t nBlockTime;
+
+    CCandyJob(const uint256& assetId = uint256(), const COutPoint& out = COutPoint(), const CCandyInfo& candyInfo = CCandyInfo(),
+              const uint256& blockHash = uint256(), const int nHeight = 0, const int64_t nBlockTime = 0)
+        : assetId(assetId), out(out), candyInfo(candyInfo), blockHash(blockHash), nHeight(nHeight), nBlockTime(nBlockTime) {
+    }
+};
+
+/**
+ * Finds the candies the wallet can still get.
+ *
+ * The put-candy index is read once when the masternode list is synced. After that
+ * only the candies of newly connected blocks are evaluated, and candies leave the
+ * available list when they expire or their block is disconnected.
+ *
+ * A candy is evaluated against the balances of its own height, so candies wait in
+ * mapWaiting until ThreadCalculateAddressAmount has written those balances. The
+ * candies that are ready are spread over a pool of worker threads.
+ */
+class CCandyEngine : public CValidationInterface
+{
+private:
+    typedef std::shared_ptr<const CCandyWalletAddresses> address_ptr_t;
+
+    std::mutex cs;
+    std::condition_variable condJob;
+
+    //! candies ready to be evaluated
+    std::deque<CCandyJob> queueJob;
+    //! candies waiting for the balances of their height
+    std::multimap<int, CCandyJob> mapWaiting;
+    //! every candy the engine has seen, by outpoint, so repeated events are dropped
+    std::map<COutPoint, CCandyJob> mapKnown;
+    //! sorted addresses of the wallet, taken again whenever new candies are queued
+    address_ptr_t pAddress;
+    //! jobs taken by a worker and not finished yet
+    int nRunning;
+    bool fLoaded;
+
+    void QueueJobs(const std::vector<CCandyJob>& vJob);
+    void RefreshAddress();
+    bool Evaluate(const CCandyJob& job, const address_ptr_t& pAddressIn);
+    void RemoveCandies(const std::vector<COutPoint>& vOut);
+
+protected:
+    void SyncTransaction(const CTransaction& tx, const CBlock* pblock);
+    void UpdatedBlockTip(const CBlockIndex* pindexNew, const CBlockIndex* pindexFork, bool fInitialDownload);
+
+public:
+    CCandyEngine();
+
+    /** Queue every unexpired candy of the put-candy index */
+    bool LoadAll();
+    /** The balances of nCandyHeight have been written, evaluate the candies waiting for them */
+    void NotifyCandyHeight(const int nCandyHeight);
+    /** True once LoadAll() is done and no candy is queued or being evaluated */
+    bool IsIdle();
+    /** Number of candies queued for evaluation and waiting for the balances of their height */
+    void GetJobCounts(size_t& nQueued, size_t& nWaiting);
+
+    void ThreadWorker();
+};
+
+extern CCandyEngine candyengine;
+
+/** Wait for the masternode sync, then load the available candies once */
+void ThreadGetAllCandyInfo();
+
+#endif // SAFE_CANDYENGINE_H
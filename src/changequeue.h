@@ -0,0 +1,171 @@
+// Copyright (c) 2018-2019 The Safe Core developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#ifndef SAFE_CHANGEQUEUE_H
+#define SAFE_CHANGEQUEUE_H
+
+#include "utiltime.h"
+
+#include <algorithm>
+#include <deque>
+#include <vector>
+
+#include <boost/thread/condition_variable.hpp>
+#include <boost/thread/locks.hpp>
+#include <boost/thread/mutex.hpp>
+
+/** Depth and throughput of the queue between ConnectBlock() and ThreadWriteChangeInfo() */
+struct CChangeInfoQueueStats
+{
+    int nDepth;                 //! blocks queued or being written
+    int nMaxDepth;
+    int nCapacity;
+    int64_t nProducerWaits;     //! times block connection waited for the writer
+    int64_t nProducerWaitTime;  //! microseconds spent in those waits
+    int64_t nWrittenBlocks;
+    int64_t nWriteBatches;
+    int64_t nSyncs;
+
+    CChangeInfoQueueStats() : nDepth(0), nMaxDepth(0), nCapacity(0), nProducerWaits(0), nProducerWaitTime(0), nWrittenBlocks(0), nWriteBatches(0), nSyncs(0) {}
+};
+
+/**
+ * Per block changes handed from block connection to a single writer thread.
+ * The type T must have an nHeight member and be movable.
+ *
+ * The newest nKeep blocks stay queued so that a reorg can still replace them
+ * before they are written. Producers wait once nCapacity blocks are queued or
+ * being written, until the writer finishes a batch or shutdown is requested.
+ */
+template <typename T>
+class CBlockChangeQueue
+{
+private:
+    //! Mutex to protect the inner state
+    boost::mutex mutex;
+
+    //! The writer blocks on this until more than nKeep blocks are queued
+    boost::condition_variable condWriter;
+
+    //! Producers block on this while the queue is full
+    boost::condition_variable condProducer;
+
+    std::deque<T> queue;
+
+    //! Blocks popped by the writer and not written yet
+    int nWriting;
+
+    const int nKeep;
+    const int nCapacity;
+
+    //! Polled while a producer waits, the shutdown is not signalled
+    bool (* const fnShutdownRequested)();
+
+    CChangeInfoQueueStats stats;
+
+    int GetDepth() const
+    {
+        return int(queue.size()) + nWriting;
+    }
+
+public:
+    CBlockChangeQueue(const int nKeepIn, const int nCapacityIn, bool (*fnShutdownRequestedIn)()) :
+        nWriting(0), nKeep(nKeepIn), nCapacity(nCapacityIn), fnShutdownRequested(fnShutdownRequestedIn) {}
+
+    /** Block until there is room for nBlocks more blocks, at most the capacity, or shutdown is requested */
+    void WaitForSpace(const int nBlocks)
+    {
+        boost::unique_lock<boost::mutex> lock(mutex);
+        const int nWanted = std::min(nBlocks, nCapacity);
+        if (GetDepth() + nWanted <= nCapacity)
+            return;
+
+        int64_t nStart = GetTimeMicros();
+        stats.nProducerWaits++;
+        while (GetDepth() + nWanted > nCapacity && !fnShutdownRequested())
+            condProducer.timed_wait(lock, boost::posix_time::milliseconds(100));
+        stats.nProducerWaitTime += GetTimeMicros() - nStart;
+    }
+
+    /** Drop the queued blocks from nHeight on, false if nHeight is below all of them */
+    bool Truncate(const int nHeight)
+    {
+        boost::unique_lock<boost::mutex> lock(mutex);
+        if (!queue.empty() && nHeight < queue.front().nHeight)
+            return false;
+
+        for (typename std::deque<T>::iterator it = queue.begin(); it != queue.end(); it++)
+        {
+            if (it->nHeight == nHeight)
+            {
+                queue.erase(it, queue.end());
+                break;
+            }
+        }
+        return true;
+    }
+
+    /** Queue a block after the others, the caller made room with WaitForSpace() */
+    void Push(T&& item)
+    {
+        boost::unique_lock<boost::mutex> lock(mutex);
+        queue.push_back(std::move(item));
+        stats.nMaxDepth = std::max(stats.nMaxDepth, GetDepth());
+        if (int(queue.size()) > nKeep)
+            condWriter.notify_one();
+    }
+
+    /**
+     * Wait for blocks beyond the kept ones and move at most nMaxBlocks of them
+     * (0 = all) to vItems, oldest first. They count against the capacity until
+     * FinishWriting() is called.
+     */
+    void PopForWriting(std::vector<T>& vItems, const int nMaxBlocks)
+    {
+        boost::unique_lock<boost::mutex> lock(mutex);
+        while (int(queue.size()) <= nKeep)
+            condWriter.wait(lock);
+
+        int nBlocks = int(queue.size()) - nKeep;
+        if (nMaxBlocks > 0)
+            nBlocks = std::min(nBlocks, nMaxBlocks);
+
+        vItems.reserve(vItems.size() + nBlocks);
+        for (int i = 0; i < nBlocks; i++)
+        {
+            vItems.push_back(std::move(queue.front()));
+            queue.pop_front();
+        }
+        nWriting = nBlocks;
+    }
+
+    void FinishWriting(const int nBlocks, const bool fSynced)
+    {
+        boost::unique_lock<boost::mutex> lock(mutex);
+        nWriting = 0;
+        stats.nWrittenBlocks += nBlocks;
+        stats.nWriteBatches++;
+        if (fSynced)
+            stats.nSyncs++;
+        condProducer.notify_all();
+    }
+
+    void Clear()
+    {
+        boost::unique_lock<boost::mutex> lock(mutex);
+        queue.clear();
+        condProducer.notify_all();
+    }
+
+    CChangeInfoQueueStats GetStats()
+    {
+        boost::unique_lock<boost::mutex> lock(mutex);
+        CChangeInfoQueueStats ret = stats;
+        ret.nDepth = GetDepth();
+        ret.nCapacity = nCapacity;
+        return ret;
+    }
+};
+
+#endif // SAFE_CHANGEQUEUE_H
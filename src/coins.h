@@ -29,7 +29,7 @@ extern int g_nStartSPOSHeight;
  * - VARINT(nVersion)
  * - VARINT(nCode)
  * - unspentness bitvector, for vout[2] and further; least significant byte first
- * - the non-spent CTxOuts (via CTxOutCompressor)
+ * - the non-spent CTxOuts (via CTxOutCompactCompressor)
  * - VARINT(nHeight)
  *
  * The nCode value consists of:
@@ -40,35 +40,38 @@ extern int g_nStartSPOSHeight;
  *   - In case both bit 1 and bit 2 are unset, they encode N-1, as there must be at
  *     least one non-spent output).
  *
- * Example: 0104835800816115944e077fe7c803cfa57f29b36bf87c1d358bb85e
- *          <><><--------------------------------------------><---->
- *          |  \                  |                             /
- *    version   code             vout[1]                  height
+ * Example: 010400835800816115944e077fe7c803cfa57f29b36bf87c1d358bb85e
+ *          <><><----------------------------------------------><---->
+ *          |  \                   |                              /
+ *    version   code              vout[1]                   height
  *
  *    - version = 1
  *    - code = 4 (vout[1] is not spent, and 0 non-zero bytes of bitvector follow)
  *    - unspentness bitvector: as 0 non-zero bytes follow, it has length 0
- *    - vout[1]: 835800816115944e077fe7c803cfa57f29b36bf87c1d35
+ *    - vout[1]: 00835800816115944e077fe7c803cfa57f29b36bf87c1d35
+ *               * 00: no unlock height, "safe" reserve
  *               * 8358: compact amount representation for 60000000000 (600 SAFE)
  *               * 00: special txout type pay-to-pubkey-hash
  *               * 816115944e077fe7c803cfa57f29b36bf87c1d35: address uint160
  *    - height = 203998
  *
  *
- * Example: 0109044086ef97d5790061b01caab50f1b8e9c50a5057eb43c2d9563a4eebbd123008c988f1a4a4de2161e0f50aac7f17e7f9555caa486af3b
- *          <><><--><--------------------------------------------------><----------------------------------------------><---->
- *         /  \   \                     |                                                           |                     /
- *  version  code  unspentness       vout[4]                                                     vout[16]           height
+ * Example: 010904400086ef97d5790061b01caab50f1b8e9c50a5057eb43c2d9563a4ee00bbd123008c988f1a4a4de2161e0f50aac7f17e7f9555caa486af3b
+ *          <><><--><----------------------------------------------------><------------------------------------------------><---->
+ *         /  \   \                      |                                                            |                      /
+ *  version  code  unspentness         vout[4]                                                      vout[16]            height
  *
  *  - version = 1
  *  - code = 9 (coinbase, neither vout[0] or vout[1] are unspent,
  *                2 (1, +1 because both bit 1 and bit 2 are unset) non-zero bitvector bytes follow)
  *  - unspentness bitvector: bits 2 (0x04) and 14 (0x4000) are set, so vout[2+2] and vout[14+2] are unspent
- *  - vout[4]: 86ef97d5790061b01caab50f1b8e9c50a5057eb43c2d9563a4ee
+ *  - vout[4]: 0086ef97d5790061b01caab50f1b8e9c50a5057eb43c2d9563a4ee
+ *             * 00: no unlock height, "safe" reserve
  *             * 86ef97d579: compact amount representation for 234925952 (2.35 SAFE)
  *             * 00: special txout type pay-to-pubkey-hash
  *             * 61b01caab50f1b8e9c50a5057eb43c2d9563a4ee: address uint160
- *  - vout[16]: bbd123008c988f1a4a4de2161e0f50aac7f17e7f9555caa4
+ *  - vout[16]: 00bbd123008c988f1a4a4de2161e0f50aac7f17e7f9555caa4
+ *              * 00: no unlock height, "safe" reserve
  *              * bbd123: compact amount representation for 110397 (0.001 SAFE)
  *              * 00: special txout type pay-to-pubkey-hash
  *              * 8c988f1a4a4de2161e0f50aac7f17e7f9555caa4: address uint160
@@ -171,6 +174,22 @@ public:
     }
 
     unsigned int GetSerializeSize(int nType, int nVersion) const {
+        return GetSerializeSizeWith<CTxOutCompactCompressor>(nType, nVersion);
+    }
+
+    template<typename Stream>
+    void Serialize(Stream &s, int nType, int nVersion) const {
+        SerializeWith<CTxOutCompactCompressor>(s, nType, nVersion);
+    }
+
+    template<typename Stream>
+    void Unserialize(Stream &s, int nType, int nVersion) {
+        UnserializeWith<CTxOutCompactCompressor>(s, nType, nVersion);
+    }
+
+    //! Serialization with the given txout wrapper, see CLegacyCoinsFormat
+    template<typename TxOutCompressor>
+    unsigned int GetSerializeSizeWith(int nType, int nVersion) const {
         unsigned int nSize = 0;
         unsigned int nMaskSize = 0, nMaskCode = 0;
         CalcMaskSize(nMaskSize, nMaskCode);
@@ -187,14 +206,14 @@ public:
         // txouts themself
         for (unsigned int i = 0; i < vout.size(); i++)
             if (!vout[i].IsNull())
-                nSize += ::GetSerializeSize(CTxOutCompressor(REF(vout[i])), nType, nVersion);
+                nSize += ::GetSerializeSize(TxOutCompressor(REF(vout[i])), nType, nVersion);
         // height
         nSize += ::GetSerializeSize(VARINT(nHeight), nType, nVersion);
         return nSize;
     }
 
-    template<typename Stream>
-    void Serialize(Stream &s, int nType, int nVersion) const {
+    template<typename TxOutCompressor, typename Stream>
+    void SerializeWith(Stream &s, int nType, int nVersion) const {
         unsigned int nMaskSize = 0, nMaskCode = 0;
         CalcMaskSize(nMaskSize, nMaskCode);
         bool fFirst = vout.size() > 0 && !vout[0].IsNull();
@@ -216,14 +235,14 @@ public:
         // txouts themself
         for (unsigned int i = 0; i < vout.size(); i++) {
             if (!vout[i].IsNull())
-                ::Serialize(s, CTxOutCompressor(REF(vout[i])), nType, nVersion);
+                ::Serialize(s, TxOutCompressor(REF(vout[i])), nType, nVersion);
         }
         // coinbase height
         ::Serialize(s, VARINT(nHeight), nType, nVersion);
     }
 
-    template<typename Stream>
-    void Unserialize(Stream &s, int nType, int nVersion) {
+    template<typename TxOutCompressor, typename Stream>
+    void UnserializeWith(Stream &s, int nType, int nVersion) {
         unsigned int nCode = 0;
         // version
         ::Unserialize(s, VARINT(this->nVersion), nType, nVersion);
@@ -249,7 +268,7 @@ public:
         vout.assign(vAvail.size(), CTxOut());
         for (unsigned int i = 0; i < vAvail.size(); i++) {
             if (vAvail[i])
-                ::Unserialize(s, REF(CTxOutCompressor(vout[i])), nType, nVersion);
+                ::Unserialize(s, REF(TxOutCompressor(vout[i])), nType, nVersion);
         }
         // coinbase height
         ::Unserialize(s, VARINT(nHeight), nType, nVersion);
@@ -277,11 +296,40 @@ public:
         size_t ret = memusage::DynamicUsage(vout);
         BOOST_FOREACH(const CTxOut &out, vout) {
             ret += RecursiveDynamicUsage(out.scriptPubKey);
+            ret += memusage::DynamicUsage(out.vReserve);
         }
         return ret;
     }
 };
 
+/**
+ * Coins record in the layout of databases written before CTxOutCompactCompressor, where
+ * every txout carries its unlock height and reserve in full. CCoinsViewDB::Upgrade() reads
+ * it to convert the database.
+ */
+class CLegacyCoinsFormat
+{
+private:
+    CCoins &coins;
+
+public:
+    CLegacyCoinsFormat(CCoins &coinsIn) : coins(coinsIn) { }
+
+    unsigned int GetSerializeSize(int nType, int nVersion) const {
+        return coins.GetSerializeSizeWith<CTxOutCompressor>(nType, nVersion);
+    }
+
+    template<typename Stream>
+    void Serialize(Stream &s, int nType, int nVersion) const {
+        coins.SerializeWith<CTxOutCompressor>(s, nType, nVersion);
+    }
+
+    template<typename Stream>
+    void Unserialize(Stream &s, int nType, int nVersion) {
+        coins.UnserializeWith<CTxOutCompressor>(s, nType, nVersion);
+    }
+};
+
 class CCoinsKeyHasher
 {
 private:
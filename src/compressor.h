@@ -122,4 +122,79 @@ public:
     }
 };
 
+/** Flags of CTxOutCompactCompressor */
+enum
+{
+    //! nUnlockedHeight is positive and follows as a VARINT
+    TXOUT_COMPACT_UNLOCKED_HEIGHT = (1U << 0),
+    //! nUnlockedHeight is negative and follows as a plain int64
+    TXOUT_COMPACT_NEGATIVE_UNLOCKED_HEIGHT = (1U << 1),
+    //! vReserve is not the plain "safe" marker and follows in full
+    TXOUT_COMPACT_RESERVE = (1U << 2),
+
+    TXOUT_COMPACT_KNOWN_FLAGS = TXOUT_COMPACT_UNLOCKED_HEIGHT | TXOUT_COMPACT_NEGATIVE_UNLOCKED_HEIGHT | TXOUT_COMPACT_RESERVE
+};
+
+/**
+ * Wrapper for CTxOut in the coins database.
+ *
+ * A flag byte comes first, then the amount and script as in CTxOutCompressor. The unlock
+ * height and the reserve only follow when they differ from the 0 and "safe" marker of plain
+ * outputs, so such an output takes 12 bytes less than before. Unknown flags are rejected, so a later
+ * format can add fields behind new flags. Undo data keeps the CTxOutCompressor layout.
+ */
+class CTxOutCompactCompressor
+{
+private:
+    CTxOut &txout;
+
+public:
+    CTxOutCompactCompressor(CTxOut &txoutIn) : txout(txoutIn) { }
+
+    ADD_SERIALIZE_METHODS;
+
+    template <typename Stream, typename Operation>
+    inline void SerializationOp(Stream& s, Operation ser_action, int nType, int nVersion) {
+        unsigned char nFlags = 0;
+        if (!ser_action.ForRead()) {
+            if (txout.nUnlockedHeight > 0)
+                nFlags |= TXOUT_COMPACT_UNLOCKED_HEIGHT;
+            else if (txout.nUnlockedHeight < 0)
+                nFlags |= TXOUT_COMPACT_NEGATIVE_UNLOCKED_HEIGHT;
+            if (!txout.HasDefaultReserve())
+                nFlags |= TXOUT_COMPACT_RESERVE;
+        }
+        READWRITE(nFlags);
+        if (nFlags & ~TXOUT_COMPACT_KNOWN_FLAGS)
+            throw std::ios_base::failure("Unknown compact txout flags");
+
+        if (!ser_action.ForRead()) {
+            uint64_t nVal = CTxOutCompressor::CompressAmount(txout.nValue);
+            READWRITE(VARINT(nVal));
+        } else {
+            uint64_t nVal = 0;
+            READWRITE(VARINT(nVal));
+            txout.nValue = CTxOutCompressor::DecompressAmount(nVal);
+        }
+        CScriptCompressor cscript(REF(txout.scriptPubKey));
+        READWRITE(cscript);
+
+        if (nFlags & TXOUT_COMPACT_UNLOCKED_HEIGHT) {
+            uint64_t nHeight = txout.nUnlockedHeight;
+            READWRITE(VARINT(nHeight));
+            if (ser_action.ForRead())
+                txout.nUnlockedHeight = nHeight;
+        } else if (nFlags & TXOUT_COMPACT_NEGATIVE_UNLOCKED_HEIGHT) {
+            READWRITE(txout.nUnlockedHeight);
+        } else if (ser_action.ForRead()) {
+            txout.nUnlockedHeight = 0;
+        }
+
+        if (nFlags & TXOUT_COMPACT_RESERVE)
+            READWRITE(txout.vReserve);
+        else if (ser_action.ForRead())
+            txout.SetDefaultReserve();
+    }
+};
+
 #endif // BITCOIN_COMPRESSOR_H
@@ -13,6 +13,8 @@
 
 #include "addrman.h"
 #include "amount.h"
+#include "candydb.h"
+#include "candyengine.h"
 #include "chain.h"
 #include "chainparams.h"
 #include "checkpoints.h"
@@ -106,11 +108,8 @@ extern int g_nStartSPOSHeight;
 extern unsigned int g_nMasternodeSPosCount;
 extern unsigned int g_nMasternodeCanBeSelectedTime;
 extern unsigned int g_nMasternodeMinCount;
-extern std::mutex g_mutexAllPayeeInfo;
-extern std::map<std::string,CMasternodePayee_IndexValue> gAllPayeeInfoMap;
 extern int64_t g_nAllowMasterNodeSyncErrorTime;
 extern int g_nLogMaxCnt;
-extern int g_nLocalStartSavePayeeHeight;
 extern int g_nCanSelectMasternodeHeight;
 extern int g_nMinerBlockTimeout;
 extern int g_nAdjustMiningRewardHeight;
@@ -293,6 +292,7 @@ void PrepareShutdown()
         delete pblocktree;
         pblocktree = NULL;
     }
+    candybalancedb.Close();
 #ifdef ENABLE_WALLET
     if (pwalletMain)
         pwalletMain->Flush(true);
@@ -436,6 +436,7 @@ std::string HelpMessage(HelpMessageMode mode)
     strUsage += HelpMessageOpt("-prune=<n>", strprintf(_("Reduce storage requirements by pruning (deleting) old blocks. This mode is incompatible with -txindex and -rescan. "
             "Warning: Reverting this setting requires re-downloading the entire blockchain. "
             "(default: 0 = disable pruning blocks, >%u = target size in MiB to use for block files)"), MIN_DISK_SPACE_FOR_BLOCK_FILES / 1024 / 1024));
+    strUsage += HelpMessageOpt("-changesyncblocks=<n>", strprintf(_("Flush the candy change files to disk after writing at most <n> blocks, 0 leaves it to the OS (default: %u)"), DEFAULT_CHANGE_SYNC_BLOCKS));
     strUsage += HelpMessageOpt("-reindex-chainstate", _("Rebuild chain state from the currently indexed blocks"));
     strUsage += HelpMessageOpt("-reindex", _("Rebuild chain state and block index from the blk*.dat files on disk"));
 #ifndef WIN32
@@ -493,6 +494,7 @@ std::string HelpMessage(HelpMessageMode mode)
 #ifdef ENABLE_WALLET
     strUsage += HelpMessageGroup(_("Wallet options:"));
     strUsage += HelpMessageOpt("-disablewallet", _("Do not load the wallet and disable wallet RPC calls"));
+    strUsage += HelpMessageOpt("-candythreads=<n>", strprintf(_("Set the number of threads looking for candies the wallet can get (1 to %d, default: %d)"), MAX_CANDY_THREADS, DEFAULT_CANDY_THREADS));
     strUsage += HelpMessageOpt("-keypool=<n>", strprintf(_("Set key pool size to <n> (default: %u)"), DEFAULT_KEYPOOL_SIZE));
     strUsage += HelpMessageOpt("-fallbackfee=<amt>", strprintf(_("A fee rate (in %s/KB) that will be used when fee estimation has insufficient data (default: %s)"),
         CURRENCY_UNIT, FormatMoney(DEFAULT_LEGACY_FALLBACK_FEE)));
@@ -1291,10 +1293,12 @@ bool AppInit2(boost::thread_group& threadGroup, CScheduler& scheduler, bool have
     LogPrintf("Using at most %i connections (%i file descriptors available)\n", nMaxConnections, nFD);
     std::ostringstream strErrors;
 
-    LogPrintf("Using %u threads for script verification\n", nScriptCheckThreads);
+    LogPrintf("Using %u threads for script and app verification\n", nScriptCheckThreads);
     if (nScriptCheckThreads) {
-        for (int i=0; i<nScriptCheckThreads-1; i++)
+        for (int i=0; i<nScriptCheckThreads-1; i++) {
             threadGroup.create_thread(&ThreadScriptCheck);
+            threadGroup.create_thread(&ThreadAppCheck);
+        }
     }
 
     if (mapArgs.count("-sporkkey")) // spork priv key
@@ -1595,6 +1599,12 @@ bool AppInit2(boost::thread_group& threadGroup, CScheduler& scheduler, bool have
                 pcoinscatcher = new CCoinsViewErrorCatcher(pcoinsdbview);
                 pcoinsTip = new CCoinsViewCache(pcoinscatcher);
 
+                // Convert the coins database written before the compact txout encoding
+                if (!pcoinsdbview->Upgrade()) {
+                    strLoadError = _("Error upgrading chainstate database");
+                    break;
+                }
+
                 if (fReindex) {
                     pblocktree->WriteReindexing(true);
                     //If we're reindexing in prune mode, wipe away unusable block files and all undo data files
@@ -1625,6 +1635,13 @@ bool AppInit2(boost::thread_group& threadGroup, CScheduler& scheduler, bool have
                     break;
                 }
 
+                // Build the address indexes, the height ordered asset tx indexes and the asset supply and balance indexes on databases created before them,
+                // after the -txindex check as the asset transactions are read through the tx index if there is one
+                if (!pblocktree->Upgrade_AddressTx_Index() || !pblocktree->Upgrade_AssetTxHeight_Index() || !UpgradeAssetSupplyIndex() || !UpgradeAssetBalanceIndex()) {
+                    strLoadError = _("Error upgrading block database");
+                    break;
+                }
+
                 // Check for changed -prune state.  What we are concerned about is a user who has pruned blocks
                 // in the past, but is now trying to run unpruned.
                 if (fHavePruned && !fPruneMode) {
@@ -1902,12 +1919,16 @@ bool AppInit2(boost::thread_group& threadGroup, CScheduler& scheduler, bool have
 	// ********************************************************* Step 10: start candy module
 	if (!VerifyDetailFile())
 		return error("Verify detail.dat failed. Exiting");
-	if (!LoadChangeInfoToList())
-		return error("Load change info failed. Exiting.");
 	if (!LoadCandyHeightToList())
 		return error("Load candy height failed. Exiting.");
+	if (!OpenCandyBalanceDB())
+		return error("Open candy balance db failed. Exiting.");
 
+	// the writer drains the blocks LoadChangeInfoToList() replays while it replays them
 	threadGroup.create_thread(boost::bind(&ThreadWriteChangeInfo));
+	if (!LoadChangeInfoToList())
+		return error("Load change info failed. Exiting.");
+	threadGroup.create_thread(boost::bind(&ThreadCompactCandyBalance));
 	threadGroup.create_thread(boost::bind(&ThreadCalculateAddressAmount));
 
 
@@ -2114,21 +2135,6 @@ bool AppInit2(boost::thread_group& threadGroup, CScheduler& scheduler, bool have
     // Generate coins in the background
     GenerateBitcoins(GetBoolArg("-gen", DEFAULT_GENERATE), GetArg("-genproclimit", DEFAULT_GENERATE_THREADS), chainparams, connman);
 
-    {
-        std::lock_guard<std::mutex> lock(g_mutexAllPayeeInfo);
-        if(!pblocktree->Read_MasternodePayee_Index(gAllPayeeInfoMap))
-        {
-            LogPrintf("SPOS_Warning:init read masternode payee fail\n");
-        }
-        if(!pblocktree->Read_LocalStartSavePayeeHeight_Index(g_nLocalStartSavePayeeHeight))
-        {
-            LogPrintf("SPOS_Warning:init read local start save payee height fail\n");
-        }else
-        {
-            LogPrintf("SPOS_Message:read local start save payee height(%d) succ\n",g_nLocalStartSavePayeeHeight);
-        }
-    }
-
 #if SCN_CURRENT == SCN__main
     GenerateBitcoinsBySPOS(fMasterNode, GetArg("-genproclimit", DEFAULT_GENERATE_THREADS), chainparams, connman);
 #elif SCN_CURRENT == SCN__dev || SCN_CURRENT == SCN__test
@@ -2150,7 +2156,11 @@ bool AppInit2(boost::thread_group& threadGroup, CScheduler& scheduler, bool have
         // Run a thread to flush wallet periodically
         threadGroup.create_thread(boost::bind(&ThreadFlushWalletDB, boost::ref(pwalletMain->strWalletFile)));
 
-        // Run a thread to get available candy list
+        // Find the available candies of the wallet, on block events and on a small worker pool
+        int nCandyThreads = std::max(1, std::min((int)GetArg("-candythreads", DEFAULT_CANDY_THREADS), MAX_CANDY_THREADS));
+        RegisterValidationInterface(&candyengine);
+        for (int i = 0; i < nCandyThreads; i++)
+            threadGroup.create_thread(boost::bind(&CCandyEngine::ThreadWorker, &candyengine));
         threadGroup.create_thread(boost::bind(&ThreadGetAllCandyInfo));
     }
 #endif
@@ -38,7 +38,7 @@ int64_t g_nStartNewLoopTimeMS = 0;
 int g_nSposGeneratedIndex = -2;
 unsigned int g_nMasternodeMinCount = 3;
 int64_t g_nLastSelectMasterNodeHeight = 0;
-std::vector<CMasternode> g_vecResultMasternodes;
+std::shared_ptr<const std::vector<CMasternode> > g_pResultMasternodes = std::make_shared<const std::vector<CMasternode> >();
 int g_nSelectGlobalDefaultValue = -999;
 int g_nSelectMasterNodeSucc = 1;
 int g_nSelectMasterNodeReset = 0;
@@ -361,7 +361,7 @@ CAmount GetTxAdditionalFee(const CTransaction& tx)
     CAmount nFee = 0;
     BOOST_FOREACH(const CTxOut& txout, tx.vout)
     {
-        const std::vector<unsigned char>& vReserve = txout.vReserve;
+        const CTxOutReserve& vReserve = txout.vReserve;
         unsigned int nSize = vReserve.size();
         if(nSize > TXOUT_RESERVE_MAX_SIZE)
             return -1;
@@ -1,6 +1,7 @@
 #ifndef MAIN_H
 #define MAIN_H
 
+#include <memory>
 #include <vector>
 #include "amount.h"
 
@@ -45,7 +46,7 @@ extern int g_nSaveMasternodePayeeHeight;
 extern unsigned int g_nMasternodeSPosCount;
 extern int64_t g_nStartNewLoopTimeMS;
 extern int g_nSposGeneratedIndex;
-extern std::vector<CMasternode> g_vecResultMasternodes;
+extern std::shared_ptr<const std::vector<CMasternode> > g_pResultMasternodes; // immutable, replaced under cs_spos
 extern int g_nSelectMasterNodeRet;
 
 extern int64_t g_nFirstSelectMasterNodeTime;
@@ -67,6 +67,9 @@ CMasternodeMan::CMasternodeMan()
   fMasternodesRemoved(false),
   vecDirtyGovernanceObjectHashes(),
   nLastWatchdogVoteTime(0),
+  listRankCache(),
+  nRankCacheHits(0),
+  nRankCacheMisses(0),
   mapSeenMasternodeBroadcast(),
   mapSeenMasternodePing(),
   nDsqCount(0)
@@ -80,6 +83,7 @@ bool CMasternodeMan::Add(CMasternode &mn)
 
     LogPrint("masternode", "CMasternodeMan::Add -- Adding new Masternode: addr=%s, %i now\n", mn.addr.ToString(), size() + 1);
     mapMasternodes[mn.vin.prevout] = mn;
+    listRankCache.clear();
     fMasternodesAdded = true;
     return true;
 }
@@ -195,6 +199,7 @@ void CMasternodeMan::CheckAndRemove(CConnman& connman)
                 // and finally remove it from the list
                 it->second.FlagGovernanceItemsAsDirty();
                 mapMasternodes.erase(it++);
+                listRankCache.clear();
                 fMasternodesRemoved = true;
             } else {
                 bool fAsk = (nAskForMnbRecovery > 0) &&
@@ -350,6 +355,7 @@ void CMasternodeMan::Clear()
 {
     LOCK(cs);
     mapMasternodes.clear();
+    listRankCache.clear();
     mAskedUsForMasternodeList.clear();
     mWeAskedForMasternodeList.clear();
     mWeAskedForMasternodeListEntry.clear();
@@ -641,6 +647,43 @@ bool CMasternodeMan::GetMasternodeScores(const uint256& nBlockHash, CMasternodeM
     return !vecMasternodeScoresRet.empty();
 }
 
+const CMasternodeMan::CMasternodeRanks* CMasternodeMan::GetRanks(const uint256& nBlockHash, int nMinProtocol)
+{
+    AssertLockHeld(cs);
+
+    // scores are calculated differently before DIP0001
+    const bool fDIP0001 = fDIP0001WasLockedIn;
+    for (std::list<CMasternodeRanks>::iterator it = listRankCache.begin(); it != listRankCache.end(); ++it) {
+        if (it->nBlockHash == nBlockHash && it->nMinProtocol == nMinProtocol && it->fDIP0001 == fDIP0001) {
+            listRankCache.splice(listRankCache.begin(), listRankCache, it);
+            nRankCacheHits++;
+            return &listRankCache.front();
+        }
+    }
+    nRankCacheMisses++;
+
+    score_pair_vec_t vecMasternodeScores;
+    if (!GetMasternodeScores(nBlockHash, vecMasternodeScores, nMinProtocol))
+        return NULL;
+
+    if (listRankCache.size() >= RANK_CACHE_SIZE)
+        listRankCache.pop_back();
+    listRankCache.push_front(CMasternodeRanks());
+    CMasternodeRanks& ranks = listRankCache.front();
+    ranks.nBlockHash = nBlockHash;
+    ranks.nMinProtocol = nMinProtocol;
+    ranks.fDIP0001 = fDIP0001;
+    ranks.vecOutpoints.reserve(vecMasternodeScores.size());
+    ranks.mapRanks.reserve(vecMasternodeScores.size());
+    int nRank = 0;
+    for (auto& scorePair : vecMasternodeScores) {
+        nRank++;
+        ranks.vecOutpoints.push_back(scorePair.second->vin.prevout);
+        ranks.mapRanks.emplace(scorePair.second->vin.prevout, nRank);
+    }
+    return &ranks;
+}
+
 bool CMasternodeMan::GetMasternodeRank(const COutPoint& outpoint, int& nRankRet, int nBlockHeight, int nMinProtocol)
 {
     nRankRet = -1;
@@ -657,20 +700,16 @@ bool CMasternodeMan::GetMasternodeRank(const COutPoint& outpoint, int& nRankRet,
 
     LOCK(cs);
 
-    score_pair_vec_t vecMasternodeScores;
-    if (!GetMasternodeScores(nBlockHash, vecMasternodeScores, nMinProtocol))
+    const CMasternodeRanks* pranks = GetRanks(nBlockHash, nMinProtocol);
+    if (!pranks)
         return false;
 
-    int nRank = 0;
-    for (auto& scorePair : vecMasternodeScores) {
-        nRank++;
-        if(scorePair.second->vin.prevout == outpoint) {
-            nRankRet = nRank;
-            return true;
-        }
-    }
+    std::unordered_map<COutPoint, int, OutPointRankHasher>::const_iterator it = pranks->mapRanks.find(outpoint);
+    if (it == pranks->mapRanks.end())
+        return false;
 
-    return false;
+    nRankRet = it->second;
+    return true;
 }
 
 bool CMasternodeMan::GetMasternodeRanks(CMasternodeMan::rank_pair_vec_t& vecMasternodeRanksRet, int nBlockHeight, int nMinProtocol)
@@ -689,17 +728,31 @@ bool CMasternodeMan::GetMasternodeRanks(CMasternodeMan::rank_pair_vec_t& vecMast
 
     LOCK(cs);
 
-    score_pair_vec_t vecMasternodeScores;
-    if (!GetMasternodeScores(nBlockHash, vecMasternodeScores, nMinProtocol))
-        return false;
+    // a ranked masternode that is gone means the cache missed a change of the list
+    for (int nTry = 0; nTry < 2; nTry++) {
+        const CMasternodeRanks* pranks = GetRanks(nBlockHash, nMinProtocol);
+        if (!pranks)
+            return false;
 
-    int nRank = 0;
-    for (auto& scorePair : vecMasternodeScores) {
-        nRank++;
-        vecMasternodeRanksRet.push_back(std::make_pair(nRank, *scorePair.second));
+        vecMasternodeRanksRet.clear();
+        vecMasternodeRanksRet.reserve(pranks->vecOutpoints.size());
+        int nRank = 0;
+        for (const auto& outpoint : pranks->vecOutpoints) {
+            std::map<COutPoint, CMasternode>::const_iterator it = mapMasternodes.find(outpoint);
+            if (it == mapMasternodes.end())
+                break;
+            nRank++;
+            vecMasternodeRanksRet.push_back(std::make_pair(nRank, it->second));
+        }
+        if (nRank == (int)pranks->vecOutpoints.size())
+            return true;
+
+        LogPrintf("CMasternodeMan::%s -- WARNING: stale rank cache for block %s, ranking again\n", __func__, nBlockHash.ToString());
+        listRankCache.clear();
     }
 
-    return true;
+    vecMasternodeRanksRet.clear();
+    return false;
 }
 
 bool CMasternodeMan::GetMasternodeByRank(int nRankIn, masternode_info_t& mnInfoRet, int nBlockHeight, int nMinProtocol)
@@ -718,20 +771,23 @@ bool CMasternodeMan::GetMasternodeByRank(int nRankIn, masternode_info_t& mnInfoR
 
     LOCK(cs);
 
-    score_pair_vec_t vecMasternodeScores;
-    if (!GetMasternodeScores(nBlockHash, vecMasternodeScores, nMinProtocol))
-        return false;
+    // a ranked masternode that is gone means the cache missed a change of the list
+    for (int nTry = 0; nTry < 2; nTry++) {
+        const CMasternodeRanks* pranks = GetRanks(nBlockHash, nMinProtocol);
+        if (!pranks)
+            return false;
 
-    if ((int)vecMasternodeScores.size() < nRankIn)
-        return false;
+        if (nRankIn < 1 || (int)pranks->vecOutpoints.size() < nRankIn)
+            return false;
 
-    int nRank = 0;
-    for (auto& scorePair : vecMasternodeScores) {
-        nRank++;
-        if(nRank == nRankIn) {
-            mnInfoRet = *scorePair.second;
+        std::map<COutPoint, CMasternode>::const_iterator it = mapMasternodes.find(pranks->vecOutpoints[nRankIn - 1]);
+        if (it != mapMasternodes.end()) {
+            mnInfoRet = it->second;
             return true;
         }
+
+        LogPrintf("CMasternodeMan::%s -- WARNING: stale rank cache for block %s, ranking again\n", __func__, nBlockHash.ToString());
+        listRankCache.clear();
     }
 
     return false;
@@ -1403,7 +1459,8 @@ std::string CMasternodeMan::ToString() const
             ", peers who asked us for Masternode list: " << (int)mAskedUsForMasternodeList.size() <<
             ", peers we asked for Masternode list: " << (int)mWeAskedForMasternodeList.size() <<
             ", entries in Masternode list we asked for: " << (int)mWeAskedForMasternodeListEntry.size() <<
-            ", nDsqCount: " << (int)nDsqCount;
+            ", nDsqCount: " << (int)nDsqCount <<
+            ", rank cache hits/misses: " << nRankCacheHits << "/" << nRankCacheMisses;
 
     return info.str();
 }
@@ -1423,6 +1480,7 @@ void CMasternodeMan::UpdateMasternodeList(CMasternodeBroadcast mnb, CConnman& co
         }
     } else {
         CMasternodeBroadcast mnbOld = mapSeenMasternodeBroadcast[CMasternodeBroadcast(*pmn).GetHash()].second;
+        listRankCache.clear();
         if(pmn->UpdateFromNewBroadcast(mnb, connman)) {
             masternodeSync.BumpAssetLastTime("CMasternodeMan::UpdateMasternodeList - seen");
             mapSeenMasternodeBroadcast.erase(mnbOld.GetHash());
@@ -1485,6 +1543,7 @@ bool CMasternodeMan::CheckMnbAndUpdateMasternodeList(CNode* pfrom, CMasternodeBr
         CMasternode* pmn = Find(mnb.vin.prevout);
         if(pmn) {
             CMasternodeBroadcast mnbOld = mapSeenMasternodeBroadcast[CMasternodeBroadcast(*pmn).GetHash()].second;
+            listRankCache.clear();
             if(!mnb.Update(pmn, nDos, connman)) {
                 LogPrint("masternode", "CMasternodeMan::CheckMnbAndUpdateMasternodeList -- Update() failed, masternode=%s\n", mnb.vin.prevout.ToStringShort());
                 return false;
@@ -1666,17 +1725,23 @@ void CMasternodeMan::GetFullMasternodeData(std::map<COutPoint, CMasternode> &map
 
     if(fFilterSpent)
     {
-        std::map<std::string, std::pair<COutPoint,CMasternode> > mapAddressMasternodes;
-        for (auto& mnpair : mapMasternodes)
+        // the last outpoint of a collateral address wins, only eligible masternodes are copied out
+        std::map<std::string, std::map<COutPoint, CMasternode>::const_iterator> mapAddressMasternodes;
+        for (std::map<COutPoint, CMasternode>::const_iterator it = mapMasternodes.begin(); it != mapMasternodes.end(); ++it)
         {
-            std::string strPubKeyCollateralAddress = mnpair.second.pubKeyCollateralAddress.GetID().ToString();
-            mapAddressMasternodes[strPubKeyCollateralAddress] = make_pair(mnpair.first,mnpair.second);
+            std::string strPubKeyCollateralAddress = it->second.pubKeyCollateralAddress.GetID().ToString();
+            mapAddressMasternodes[strPubKeyCollateralAddress] = it;
         }
         int nLogOldCnt = 0,nLogPayNotFoundCnt = 0;
         for(auto& payeeInfo : mapAllPayeeInfo)
         {
-            if(!fOfficialMasterNode && mapAddressMasternodes.count(payeeInfo.first)<=0)
+            std::map<std::string, std::map<COutPoint, CMasternode>::const_iterator>::const_iterator addrit = mapAddressMasternodes.find(payeeInfo.first);
+            if(addrit == mapAddressMasternodes.end())
             {
+                // an official payee without a masternode has no collateral to check
+                if(fOfficialMasterNode)
+                    continue;
+
                 nLogPayNotFoundCnt++;
                 if(nLogPayNotFoundCnt<=g_nLogMaxCnt)
                 {
@@ -1691,7 +1756,7 @@ void CMasternodeMan::GetFullMasternodeData(std::map<COutPoint, CMasternode> &map
                 continue;
             }
 
-            std::pair<COutPoint,CMasternode>& mnpair = mapAddressMasternodes[payeeInfo.first];
+            const std::pair<const COutPoint, CMasternode>& mnpair = *addrit->second;
             bool fSelfMasternode = activeMasternode.pubKeyMasternode == mnpair.second.pubKeyMasternode;
             if(!fOfficialMasterNode && nHeight-payeeInfo.second.nHeight>=g_nCanSelectMasternodeHeight)
             {
@@ -1717,19 +1782,22 @@ void CMasternodeMan::GetFullMasternodeData(std::map<COutPoint, CMasternode> &map
                 }
                 continue;
             }
-            mnpair.second.nTxHeight = -1;
-            CMasternode::CollateralStatus err = CMasternode::CheckCollateral(mnpair.first,mnpair.second.nTxHeight);
-            unsigned int canBeSelectTime = mnpair.second.getCanbeSelectTime(nHeight);
+            std::map<COutPoint, CMasternode>::iterator outit = mapOutMasternodes.insert(mnpair).first;
+            CMasternode& mn = outit->second;
+            mn.nTxHeight = -1;
+            CMasternode::CollateralStatus err = CMasternode::CheckCollateral(mnpair.first,mn.nTxHeight);
+            unsigned int canBeSelectTime = mn.getCanbeSelectTime(nHeight);
             if (err == CMasternode::COLLATERAL_OK && (fOfficialMasterNode || canBeSelectTime > g_nMasternodeCanBeSelectedTime))
             {
-                mapOutMasternodes[mnpair.first] = mnpair.second;
                 if(fSelfMasternode)
                     LogPrintf("SPOS_Message:meeted active masternode:%s,output:%s,err:%d,canBeSelectTime:%d,nProtocolVersion:%d,height:%d\n",
-                       mnpair.second.addr.ToStringIP(),mnpair.first.ToString(), err, canBeSelectTime,mnpair.second.nProtocolVersion,nHeight);
-            }else if(fSelfMasternode)
+                       mn.addr.ToStringIP(),mnpair.first.ToString(), err, canBeSelectTime,mn.nProtocolVersion,nHeight);
+            }else
             {
-                LogPrintf("SPOS_Message:not meeted active masternode:%s,output:%s,err:%d,canBeSelectTime:%d,nProtocolVersion:%d,height:%d\n",
-                       mnpair.second.addr.ToStringIP(),mnpair.first.ToString(), err, canBeSelectTime,mnpair.second.nProtocolVersion,nHeight);
+                if(fSelfMasternode)
+                    LogPrintf("SPOS_Message:not meeted active masternode:%s,output:%s,err:%d,canBeSelectTime:%d,nProtocolVersion:%d,height:%d\n",
+                       mn.addr.ToStringIP(),mnpair.first.ToString(), err, canBeSelectTime,mn.nProtocolVersion,nHeight);
+                mapOutMasternodes.erase(outit);
             }
         }
         LogPrintf("SPOS_Message:after GetFullMasternodeData,old masternode count:%d,pay not found count:%d\n",nLogOldCnt,nLogPayNotFoundCnt);
@@ -9,6 +9,9 @@
 #include "masternode.h"
 #include "sync.h"
 
+#include <list>
+#include <unordered_map>
+
 using namespace std;
 
 class CMasternodeMan;
@@ -42,6 +45,22 @@ private:
     static const int MNB_RECOVERY_WAIT_SECONDS      = 60;
     static const int MNB_RECOVERY_RETRY_SECONDS     = 3 * 60 * 60;
 
+    static const size_t RANK_CACHE_SIZE         = 8;
+
+    struct OutPointRankHasher
+    {
+        size_t operator()(const COutPoint& outpoint) const { return outpoint.hash.GetCheapHash() ^ outpoint.n; }
+    };
+
+    /// Masternodes with at least nMinProtocol ranked for a block hash, best first
+    struct CMasternodeRanks
+    {
+        uint256 nBlockHash;
+        int nMinProtocol;
+        bool fDIP0001;
+        std::vector<COutPoint> vecOutpoints;
+        std::unordered_map<COutPoint, int, OutPointRankHasher> mapRanks;
+    };
 
     // critical section to protect the inner data structures
     mutable CCriticalSection cs;
@@ -75,11 +94,18 @@ private:
 
     int64_t nLastWatchdogVoteTime;
 
+    // recently used rank tables, most recent first, dropped whenever the list changes
+    std::list<CMasternodeRanks> listRankCache;
+    int64_t nRankCacheHits;
+    int64_t nRankCacheMisses;
+
     friend class CMasternodeSync;
     /// Find an entry
     CMasternode* Find(const COutPoint& outpoint);
 
     bool GetMasternodeScores(const uint256& nBlockHash, score_pair_vec_t& vecMasternodeScoresRet, int nMinProtocol = 0);
+    /// Ranks for nBlockHash from the cache, computed on a miss; NULL if there is no masternode to rank
+    const CMasternodeRanks* GetRanks(const uint256& nBlockHash, int nMinProtocol);
 
 public:
     // Keep track of all broadcasts I've seen
@@ -117,6 +143,9 @@ public:
 
         READWRITE(mapSeenMasternodeBroadcast);
         READWRITE(mapSeenMasternodePing);
+        if(ser_action.ForRead()) {
+            listRankCache.clear();
+        }
         if(ser_action.ForRead() && (strVersion != SERIALIZATION_VERSION_STRING)) {
             Clear();
         }
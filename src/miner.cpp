@@ -38,7 +38,7 @@
 #include <boost/tuple/tuple.hpp>
 #include <boost/lexical_cast.hpp>
 
-#include <queue>
+#include <algorithm>
 
 using namespace std;
 
@@ -61,7 +61,7 @@ extern CActiveMasternode activeMasternode;
 extern unsigned int g_nMasternodeSPosCount;
 extern unsigned int g_nMasternodeCanBeSelectedTime;
 extern int64_t g_nStartNewLoopTimeMS;
-extern std::vector<CMasternode> g_vecResultMasternodes;
+extern std::shared_ptr<const std::vector<CMasternode> > g_pResultMasternodes;
 extern std::map<CNetAddr, LocalServiceInfo> mapLocalHost;
 extern CCriticalSection cs_spos;
 extern int g_nTimeoutPushForwardHeight;
@@ -79,17 +79,6 @@ uint32_t nSposSleeptime = 50;
 
 
 
-class ScoreCompare
-{
-public:
-    ScoreCompare() {}
-
-    bool operator()(const CTxMemPool::txiter a, const CTxMemPool::txiter b)
-    {
-        return CompareTxMemPoolEntryByScore()(*b,*a); // Convert to less than
-    }
-};
-
 int64_t UpdateTime(CBlockHeader* pblock, const Consensus::Params& consensusParams, const CBlockIndex* pindexPrev)
 {
     int64_t nOldTime = pblock->nTime;
@@ -107,6 +96,613 @@ int64_t UpdateTime(CBlockHeader* pblock, const Consensus::Params& consensusParam
     return nNewTime - nOldTime;
 }
 
+// Container for tracking updates to ancestor feerate as we include (parent)
+// transactions in a block
+struct CTxMemPoolModifiedEntry {
+    CTxMemPoolModifiedEntry(CTxMemPool::txiter entry)
+    {
+        iter = entry;
+        nSizeWithAncestors = entry->GetSizeWithAncestors();
+        nModFeesWithAncestors = entry->GetModFeesWithAncestors();
+        nSigOpCountWithAncestors = entry->GetSigOpCountWithAncestors();
+    }
+
+    CTxMemPool::txiter iter;
+    uint64_t nSizeWithAncestors;
+    CAmount nModFeesWithAncestors;
+    unsigned int nSigOpCountWithAncestors;
+};
+
+// This matches the calculation in CompareTxMemPoolEntryByAncestorFee,
+// except operating on CTxMemPoolModifiedEntry.
+struct CompareModifiedEntry {
+    bool operator()(const CTxMemPoolModifiedEntry &a, const CTxMemPoolModifiedEntry &b) const
+    {
+        double f1 = (double)a.nModFeesWithAncestors * b.nSizeWithAncestors;
+        double f2 = (double)b.nModFeesWithAncestors * a.nSizeWithAncestors;
+        if (f1 == f2) {
+            return CTxMemPool::CompareIteratorByHash()(a.iter, b.iter);
+        }
+        return f1 > f2;
+    }
+};
+
+// A transaction has more ancestors than any of its in-mempool parents, so
+// ordering a package by ancestor count puts every parent before its children.
+struct CompareTxIterByAncestorCount {
+    bool operator()(const CTxMemPool::txiter &a, const CTxMemPool::txiter &b) const
+    {
+        if (a->GetCountWithAncestors() != b->GetCountWithAncestors())
+            return a->GetCountWithAncestors() < b->GetCountWithAncestors();
+        return CTxMemPool::CompareIteratorByHash()(a, b);
+    }
+};
+
+struct modifiedentry_iter {
+    typedef CTxMemPool::txiter result_type;
+    result_type operator() (const CTxMemPoolModifiedEntry &entry) const
+    {
+        return entry.iter;
+    }
+};
+
+typedef boost::multi_index_container<
+    CTxMemPoolModifiedEntry,
+    boost::multi_index::indexed_by<
+        boost::multi_index::ordered_unique<
+            modifiedentry_iter,
+            CTxMemPool::CompareIteratorByHash
+        >,
+        // sorted by modified ancestor fee rate
+        boost::multi_index::ordered_non_unique<
+            // Reuse same tag from CTxMemPool's similar index
+            boost::multi_index::tag<ancestor_score>,
+            boost::multi_index::identity<CTxMemPoolModifiedEntry>,
+            CompareModifiedEntry
+        >
+    >
+> indexed_modified_transaction_set;
+
+typedef indexed_modified_transaction_set::nth_index<0>::type::iterator modtxiter;
+typedef indexed_modified_transaction_set::index<ancestor_score>::type::iterator modtxscoreiter;
+
+struct update_for_parent_inclusion
+{
+    update_for_parent_inclusion(CTxMemPool::txiter it) : iter(it) {}
+
+    void operator() (CTxMemPoolModifiedEntry &e)
+    {
+        e.nModFeesWithAncestors -= iter->GetModifiedFee();
+        e.nSizeWithAncestors -= iter->GetTxSize();
+        e.nSigOpCountWithAncestors -= iter->GetSigOpCount();
+    }
+
+    CTxMemPool::txiter iter;
+};
+
+// Limit the number of attempts to add transactions to the block when it is
+// close to full; this is just a simple heuristic to finish quickly if the
+// mempool has a lot of entries.
+static const int64_t MAX_CONSECUTIVE_FAILURES = 1000;
+
+/** Generate the transaction set of a new block: first the high-priority
+ *  transactions up to -blockprioritysize, then the mempool packages (a
+ *  transaction with its unconfirmed ancestors) by ancestor feerate. */
+class BlockAssembler
+{
+private:
+    CTxMemPool& pool;
+    const int nHeight;
+    const int64_t nLockTimeCutoff;
+    const CCoinsViewCache* pAppView;
+    CBlockTxSelection& selection;
+
+    // Configuration parameters for the block size
+    unsigned int nBlockMaxSize, nBlockMinSize, nBlockMaxSigOps;
+    bool fPrintPriority;
+
+    // Information on the current status of the block
+    CTxMemPool::setEntries inBlock;
+    // Transactions (and so their descendants) that cannot be in the block
+    CTxMemPool::setEntries failedTx;
+    // Get-candy amounts claimed by the block so far, like ConnectBlock keeps them
+    std::map<CPutCandy_IndexKey, CAmount> mapAssetGetCandy;
+    // ... and with the claims of the tx that passed TestAppTx() last, they
+    // replace mapAssetGetCandy once that tx is added to the block
+    std::map<CPutCandy_IndexKey, CAmount> mapTxGetCandy;
+    bool fTxGetCandy;
+    bool blockFinished;
+    int lastFewTxs;
+
+public:
+    BlockAssembler(CTxMemPool& _pool, int _nHeight, int64_t _nLockTimeCutoff, unsigned int _nBlockMaxSize,
+                   const CCoinsViewCache* _pAppView, CBlockTxSelection& _selection);
+
+    void AddTransactions();
+
+private:
+    /** Add a tx to the block, with the get-candy claims TestAppTx() staged */
+    void AddToBlock(CTxMemPool::txiter iter);
+    /** Test if a tx would fit in the block */
+    bool TestForBlock(CTxMemPool::txiter iter);
+    /** Check an app or asset tx the way ConnectBlock will */
+    bool TestAppTx(CTxMemPool::txiter iter);
+    /** Check the app and asset txs of a sorted package, their get-candy claims are kept only if all pass */
+    bool TestPackageAppTxs(const std::vector<CTxMemPool::txiter>& sortedEntries, CTxMemPool::txiter& failedIter);
+
+    /** Add transactions based on tx "priority" */
+    void addPriorityTxs();
+    /** Add transactions based on feerate including unconfirmed ancestors */
+    void addPackageTxs();
+
+    /** Remove confirmed (inBlock) entries from given set */
+    void onlyUnconfirmed(CTxMemPool::setEntries& testSet);
+    /** Test if a new package would "fit" in the block */
+    bool TestPackage(uint64_t packageSize, unsigned int packageSigOps);
+    /** Test if a set of transactions are all final and none of them failed before */
+    bool TestPackageTransactions(const CTxMemPool::setEntries& package);
+    /** Return true if given transaction from mapTx has already been evaluated,
+      * or if the transaction's cached data in mapTx is incorrect. */
+    bool SkipMapTxEntry(CTxMemPool::txiter it, indexed_modified_transaction_set& mapModifiedTx);
+    /** Sort the package in an order that is valid to appear in a block */
+    void SortForBlock(const CTxMemPool::setEntries& package, std::vector<CTxMemPool::txiter>& sortedEntries);
+    /** Add descendants of given transactions to mapModifiedTx with ancestor
+      * state updated assuming given transactions are inBlock. */
+    void UpdatePackagesForAdded(const CTxMemPool::setEntries& alreadyAdded, indexed_modified_transaction_set& mapModifiedTx);
+    /** Return true if a mempool parent of the tx is not in the block yet */
+    bool isStillDependent(CTxMemPool::txiter iter);
+};
+
+BlockAssembler::BlockAssembler(CTxMemPool& _pool, int _nHeight, int64_t _nLockTimeCutoff, unsigned int _nBlockMaxSize,
+                               const CCoinsViewCache* _pAppView, CBlockTxSelection& _selection)
+    : pool(_pool), nHeight(_nHeight), nLockTimeCutoff(_nLockTimeCutoff), pAppView(_pAppView), selection(_selection),
+      nBlockMaxSize(_nBlockMaxSize), fTxGetCandy(false), blockFinished(false), lastFewTxs(0)
+{
+    // Minimum block size you want to create; block will be filled with free transactions
+    // until there are no more or the block reaches this size:
+    nBlockMinSize = GetArg("-blockminsize", DEFAULT_BLOCK_MIN_SIZE);
+    nBlockMinSize = std::min(nBlockMaxSize, nBlockMinSize);
+    nBlockMaxSigOps = MaxBlockSigOps(fDIP0001ActiveAtTip);
+    fPrintPriority = GetBoolArg("-printpriority", DEFAULT_PRINTPRIORITY);
+
+    // Reserve space for coinbase tx
+    selection.nBlockSize = 1000;
+    selection.nBlockSigOps = 100;
+}
+
+void BlockAssembler::AddTransactions()
+{
+    AssertLockHeld(pool.cs);
+    addPriorityTxs();
+    addPackageTxs();
+}
+
+void BlockAssembler::onlyUnconfirmed(CTxMemPool::setEntries& testSet)
+{
+    for (CTxMemPool::setEntries::iterator iit = testSet.begin(); iit != testSet.end(); ) {
+        // Only test txs not already in the block
+        if (inBlock.count(*iit)) {
+            testSet.erase(iit++);
+        }
+        else {
+            iit++;
+        }
+    }
+}
+
+bool BlockAssembler::TestPackage(uint64_t packageSize, unsigned int packageSigOps)
+{
+    if (selection.nBlockSize + packageSize >= nBlockMaxSize)
+        return false;
+    if (selection.nBlockSigOps + packageSigOps >= nBlockMaxSigOps)
+        return false;
+    return true;
+}
+
+bool BlockAssembler::TestPackageTransactions(const CTxMemPool::setEntries& package)
+{
+    BOOST_FOREACH (const CTxMemPool::txiter it, package) {
+        if (failedTx.count(it))
+            return false;
+        if (!IsFinalTx(it->GetTx(), nHeight, nLockTimeCutoff))
+            return false;
+    }
+    return true;
+}
+
+bool BlockAssembler::TestForBlock(CTxMemPool::txiter iter)
+{
+    if (selection.nBlockSize + iter->GetTxSize() >= nBlockMaxSize) {
+        // If the block is so close to full that no more txs will fit
+        // or if we've tried more than 50 times to fill remaining space
+        // then flag that the block is finished
+        if (selection.nBlockSize > nBlockMaxSize - 100 || lastFewTxs > 50) {
+            blockFinished = true;
+            return false;
+        }
+        // Once we're within 1000 bytes of a full block, only look at 50 more txs
+        // to try to fill the remaining space.
+        if (selection.nBlockSize > nBlockMaxSize - 1000) {
+            lastFewTxs++;
+        }
+        return false;
+    }
+
+    if (selection.nBlockSigOps + iter->GetSigOpCount() >= nBlockMaxSigOps) {
+        // If the block has room for no more sig ops then
+        // flag that the block is finished
+        if (selection.nBlockSigOps > nBlockMaxSigOps - 2) {
+            blockFinished = true;
+            return false;
+        }
+        // Otherwise attempt to find another tx with fewer sigops
+        // to put in the block.
+        return false;
+    }
+
+    // Must check that lock times are still valid
+    // This can be removed once MTP is always enforced
+    // as long as reorgs keep the mempool consistent.
+    if (!IsFinalTx(iter->GetTx(), nHeight, nLockTimeCutoff))
+        return false;
+
+    return true;
+}
+
+bool BlockAssembler::TestAppTx(CTxMemPool::txiter iter)
+{
+    fTxGetCandy = false;
+    if (!pAppView)
+        return true;
+
+    const CTransaction& tx = iter->GetTx();
+    bool fAppTx = false;
+    for (unsigned int i = 0; i < tx.vout.size() && !fAppTx; i++)
+        fAppTx = GetAppPayload(tx, i) != NULL;
+    if (!fAppTx)
+        return true;
+
+    // The asset rules (candy totals, expiry, supply...) depend on the block
+    // height and on the rest of the block, the mempool admission is not enough
+    // Claim on a copy: a tx that fails half way through its outputs, or that
+    // is not added after all, must not count against the txs after it
+    CValidationState state;
+    mapTxGetCandy = mapAssetGetCandy;
+    if (!CheckAppTransaction(tx, state, *pAppView, mapTxGetCandy, false)) {
+        LogPrint("asset", "CreateNewBlock(): skip %s, %s\n", tx.GetHash().ToString(), FormatStateMessage(state));
+        return false;
+    }
+    fTxGetCandy = true;
+    return true;
+}
+
+bool BlockAssembler::TestPackageAppTxs(const std::vector<CTxMemPool::txiter>& sortedEntries, CTxMemPool::txiter& failedIter)
+{
+    // Each tx claims on top of the ones before it in the package
+    std::map<CPutCandy_IndexKey, CAmount> mapBlockGetCandy = mapAssetGetCandy;
+    for (size_t i = 0; i < sortedEntries.size(); ++i) {
+        if (!TestAppTx(sortedEntries[i])) {
+            mapAssetGetCandy.swap(mapBlockGetCandy);
+            failedIter = sortedEntries[i];
+            return false;
+        }
+        if (fTxGetCandy) {
+            mapAssetGetCandy.swap(mapTxGetCandy);
+            fTxGetCandy = false;
+        }
+    }
+    return true;
+}
+
+void BlockAssembler::AddToBlock(CTxMemPool::txiter iter)
+{
+    selection.vtx.push_back(iter->GetTx());
+    selection.vTxFees.push_back(iter->GetFee());
+    selection.vTxSigOps.push_back(iter->GetSigOpCount());
+    selection.nBlockSize += iter->GetTxSize();
+    selection.nBlockSigOps += iter->GetSigOpCount();
+    selection.nFees += iter->GetFee();
+    inBlock.insert(iter);
+    if (fTxGetCandy) {
+        mapAssetGetCandy.swap(mapTxGetCandy);
+        fTxGetCandy = false;
+    }
+
+    if (fPrintPriority) {
+        double dPriority = iter->GetPriority(nHeight);
+        CAmount dummy;
+        pool.ApplyDeltas(iter->GetTx().GetHash(), dPriority, dummy);
+        LogPrintf("priority %.1f fee %s txid %s\n",
+                  dPriority,
+                  CFeeRate(iter->GetModifiedFee(), iter->GetTxSize()).ToString(),
+                  iter->GetTx().GetHash().ToString());
+    }
+}
+
+void BlockAssembler::UpdatePackagesForAdded(const CTxMemPool::setEntries& alreadyAdded,
+        indexed_modified_transaction_set& mapModifiedTx)
+{
+    BOOST_FOREACH(const CTxMemPool::txiter it, alreadyAdded) {
+        CTxMemPool::setEntries descendants;
+        pool.CalculateDescendants(it, descendants);
+        // Insert all descendants (not yet in block) into the modified set
+        BOOST_FOREACH(CTxMemPool::txiter desc, descendants) {
+            if (alreadyAdded.count(desc))
+                continue;
+            modtxiter mit = mapModifiedTx.find(desc);
+            if (mit == mapModifiedTx.end()) {
+                CTxMemPoolModifiedEntry modEntry(desc);
+                modEntry.nSizeWithAncestors -= it->GetTxSize();
+                modEntry.nModFeesWithAncestors -= it->GetModifiedFee();
+                modEntry.nSigOpCountWithAncestors -= it->GetSigOpCount();
+                mapModifiedTx.insert(modEntry);
+            } else {
+                mapModifiedTx.modify(mit, update_for_parent_inclusion(it));
+            }
+        }
+    }
+}
+
+// Skip entries in mapTx that are already in a block or are present
+// in mapModifiedTx (which implies that the mapTx ancestor state is
+// stale due to ancestor inclusion in the block)
+// Also skip transactions that we've already failed to add. This can happen if
+// we consider a transaction in mapModifiedTx and it fails: we can then
+// potentially consider it again while walking mapTx.  It's currently
+// guaranteed to fail again, but as a belt-and-suspenders check we put it in
+// failedTx and avoid re-evaluation, since the re-evaluation would be using
+// cached size/sigops/fee values that are not actually correct.
+bool BlockAssembler::SkipMapTxEntry(CTxMemPool::txiter it, indexed_modified_transaction_set& mapModifiedTx)
+{
+    assert (it != pool.mapTx.end());
+    if (mapModifiedTx.count(it) || inBlock.count(it) || failedTx.count(it))
+        return true;
+    return false;
+}
+
+void BlockAssembler::SortForBlock(const CTxMemPool::setEntries& package, std::vector<CTxMemPool::txiter>& sortedEntries)
+{
+    sortedEntries.clear();
+    sortedEntries.insert(sortedEntries.begin(), package.begin(), package.end());
+    std::sort(sortedEntries.begin(), sortedEntries.end(), CompareTxIterByAncestorCount());
+}
+
+// This transaction selection algorithm orders the mempool based
+// on feerate of a transaction including all unconfirmed ancestors.
+// Since we don't remove transactions from the mempool as we select them
+// for block inclusion, we need an alternate method of updating the feerate
+// of a transaction with its not-yet-selected ancestors as we go.
+// This is accomplished by walking the in-mempool descendants of selected
+// transactions and storing a temporary modified state in mapModifiedTxs.
+// Each time through the loop, we compare the best transaction in
+// mapModifiedTxs with the next transaction in the mempool to decide what
+// transaction package to work on next.
+void BlockAssembler::addPackageTxs()
+{
+    // mapModifiedTx will store sorted packages after they are modified
+    // because some of their txs are already in the block
+    indexed_modified_transaction_set mapModifiedTx;
+
+    // Start by adding all descendants of previously added txs to mapModifiedTx
+    // and modifying them for their already included ancestors
+    UpdatePackagesForAdded(inBlock, mapModifiedTx);
+
+    CTxMemPool::indexed_transaction_set::index<ancestor_score>::type::iterator mi = pool.mapTx.get<ancestor_score>().begin();
+    CTxMemPool::txiter iter;
+
+    // Limit the number of attempts to add transactions to the block when it is
+    // close to full; this is just a simple heuristic to finish quickly if the
+    // mempool has a lot of entries.
+    int64_t nConsecutiveFailed = 0;
+
+    while (mi != pool.mapTx.get<ancestor_score>().end() || !mapModifiedTx.empty())
+    {
+        // First try to find a new transaction in mapTx to evaluate.
+        if (mi != pool.mapTx.get<ancestor_score>().end() &&
+                SkipMapTxEntry(pool.mapTx.project<0>(mi), mapModifiedTx)) {
+            ++mi;
+            continue;
+        }
+
+        // Now that mi is not stale, determine which transaction to evaluate:
+        // the next entry from mapTx, or the best from mapModifiedTx?
+        bool fUsingModified = false;
+
+        modtxscoreiter modit = mapModifiedTx.get<ancestor_score>().begin();
+        if (mi == pool.mapTx.get<ancestor_score>().end()) {
+            // We're out of entries in mapTx; use the entry from mapModifiedTx
+            iter = modit->iter;
+            fUsingModified = true;
+        } else {
+            // Try to compare the mapTx entry to the mapModifiedTx entry
+            iter = pool.mapTx.project<0>(mi);
+            if (modit != mapModifiedTx.get<ancestor_score>().end() &&
+                    CompareModifiedEntry()(*modit, CTxMemPoolModifiedEntry(iter))) {
+                // The best entry in mapModifiedTx has higher score
+                // than the one from mapTx.
+                // Switch which transaction (package) to consider
+                iter = modit->iter;
+                fUsingModified = true;
+            } else {
+                // Either no entry in mapModifiedTx, or it's worse than mapTx.
+                // Increment mi for the next loop iteration.
+                ++mi;
+            }
+        }
+
+        // We skip mapTx entries that are inBlock, and mapModifiedTx shouldn't
+        // contain anything that is inBlock.
+        assert(!inBlock.count(iter));
+
+        uint64_t packageSize = iter->GetSizeWithAncestors();
+        CAmount packageFees = iter->GetModFeesWithAncestors();
+        unsigned int packageSigOps = iter->GetSigOpCountWithAncestors();
+        if (fUsingModified) {
+            packageSize = modit->nSizeWithAncestors;
+            packageFees = modit->nModFeesWithAncestors;
+            packageSigOps = modit->nSigOpCountWithAncestors;
+        }
+
+        if (packageFees < ::minRelayTxFee.GetFee(packageSize) && selection.nBlockSize >= nBlockMinSize) {
+            // Everything else we might consider has a lower fee rate
+            return;
+        }
+
+        if (!TestPackage(packageSize, packageSigOps)) {
+            if (fUsingModified) {
+                // Since we always look at the best entry in mapModifiedTx,
+                // we must erase failed entries so that we can consider the
+                // next best entry on the next loop iteration
+                mapModifiedTx.get<ancestor_score>().erase(modit);
+                failedTx.insert(iter);
+            }
+
+            ++nConsecutiveFailed;
+            if (nConsecutiveFailed > MAX_CONSECUTIVE_FAILURES && selection.nBlockSize > nBlockMaxSize - 1000) {
+                // Give up if we're close to full and haven't succeeded in a while
+                break;
+            }
+            continue;
+        }
+
+        CTxMemPool::setEntries ancestors;
+        uint64_t nNoLimit = std::numeric_limits<uint64_t>::max();
+        std::string dummy;
+        pool.CalculateMemPoolAncestors(*iter, ancestors, nNoLimit, nNoLimit, nNoLimit, nNoLimit, dummy, false);
+
+        onlyUnconfirmed(ancestors);
+        ancestors.insert(iter);
+
+        // Test if all tx's are Final and none of them failed
+        if (!TestPackageTransactions(ancestors)) {
+            if (fUsingModified) {
+                mapModifiedTx.get<ancestor_score>().erase(modit);
+            }
+            failedTx.insert(iter);
+            continue;
+        }
+
+        // Package can be added. Sort the entries in a valid order.
+        std::vector<CTxMemPool::txiter> sortedEntries;
+        SortForBlock(ancestors, sortedEntries);
+
+        // The feerate was only checked for the package as a whole: if one of
+        // its app txs fails, none of the package goes in
+        CTxMemPool::txiter failedAppTx;
+        if (!TestPackageAppTxs(sortedEntries, failedAppTx)) {
+            if (fUsingModified) {
+                mapModifiedTx.get<ancestor_score>().erase(modit);
+            }
+            failedTx.insert(failedAppTx);
+            failedTx.insert(iter);
+            continue;
+        }
+
+        // This transaction will make it in; reset the failed counter.
+        nConsecutiveFailed = 0;
+
+        CTxMemPool::setEntries added;
+        for (size_t i = 0; i < sortedEntries.size(); ++i) {
+            AddToBlock(sortedEntries[i]);
+            added.insert(sortedEntries[i]);
+            // Erase from the modified set, if present
+            mapModifiedTx.erase(sortedEntries[i]);
+        }
+
+        // Update transactions that depend on each of these
+        UpdatePackagesForAdded(added, mapModifiedTx);
+    }
+}
+
+bool BlockAssembler::isStillDependent(CTxMemPool::txiter iter)
+{
+    BOOST_FOREACH(CTxMemPool::txiter parent, pool.GetMemPoolParents(iter))
+    {
+        if (!inBlock.count(parent)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void BlockAssembler::addPriorityTxs()
+{
+    // How much of the block should be dedicated to high-priority transactions,
+    // included regardless of the fees they pay
+    unsigned int nBlockPrioritySize = GetArg("-blockprioritysize", DEFAULT_BLOCK_PRIORITY_SIZE);
+    nBlockPrioritySize = std::min(nBlockMaxSize, nBlockPrioritySize);
+
+    if (nBlockPrioritySize == 0) {
+        return;
+    }
+
+    // This vector will be sorted into a priority queue:
+    std::vector<TxCoinAgePriority> vecPriority;
+    TxCoinAgePriorityCompare pricomparer;
+    std::map<CTxMemPool::txiter, double, CTxMemPool::CompareIteratorByHash> waitPriMap;
+    typedef std::map<CTxMemPool::txiter, double, CTxMemPool::CompareIteratorByHash>::iterator waitPriIter;
+    double actualPriority = -1;
+
+    vecPriority.reserve(pool.mapTx.size());
+    for (CTxMemPool::indexed_transaction_set::iterator mi = pool.mapTx.begin();
+         mi != pool.mapTx.end(); ++mi)
+    {
+        double dPriority = mi->GetPriority(nHeight);
+        CAmount dummy;
+        pool.ApplyDeltas(mi->GetTx().GetHash(), dPriority, dummy);
+        vecPriority.push_back(TxCoinAgePriority(dPriority, mi));
+    }
+    std::make_heap(vecPriority.begin(), vecPriority.end(), pricomparer);
+
+    CTxMemPool::txiter iter;
+    while (!vecPriority.empty() && !blockFinished) { // add a tx from priority queue to fill the blockprioritysize
+        iter = vecPriority.front().second;
+        actualPriority = vecPriority.front().first;
+        std::pop_heap(vecPriority.begin(), vecPriority.end(), pricomparer);
+        vecPriority.pop_back();
+
+        // If tx is dependent on other mempool txs which haven't yet been included
+        // then put it in the waitSet
+        if (isStillDependent(iter)) {
+            waitPriMap.insert(std::make_pair(iter, actualPriority));
+            continue;
+        }
+
+        // If we've surpassed our desired priority size or have dropped below
+        // the AllowFreeThreshold, then we're done adding priority txs
+        if (selection.nBlockSize + iter->GetTxSize() >= nBlockPrioritySize || !AllowFree(actualPriority)) {
+            break;
+        }
+
+        // If this tx fits in the block add it, otherwise keep looping
+        if (TestForBlock(iter)) {
+            if (!TestAppTx(iter)) {
+                failedTx.insert(iter);
+                continue;
+            }
+            AddToBlock(iter);
+
+            // This tx was successfully added, so
+            // add transactions that depend on this one to the priority queue to try again
+            BOOST_FOREACH(CTxMemPool::txiter child, pool.GetMemPoolChildren(iter))
+            {
+                waitPriIter wpiter = waitPriMap.find(child);
+                if (wpiter != waitPriMap.end()) {
+                    vecPriority.push_back(TxCoinAgePriority(wpiter->second,child));
+                    std::push_heap(vecPriority.begin(), vecPriority.end(), pricomparer);
+                    waitPriMap.erase(wpiter);
+                }
+            }
+        }
+    }
+}
+
+void SelectBlockTransactions(CTxMemPool& pool, int nHeight, int64_t nLockTimeCutoff, unsigned int nBlockMaxSize,
+                             const CCoinsViewCache* pAppView, CBlockTxSelection& selection)
+{
+    BlockAssembler(pool, nHeight, nLockTimeCutoff, nBlockMaxSize, pAppView, selection).AddTransactions();
+}
+
 CBlockTemplate* CreateNewBlock(const CChainParams& chainparams, const CScript& scriptPubKeyIn)
 {
     // Create new block
@@ -128,35 +724,6 @@ CBlockTemplate* CreateNewBlock(const CChainParams& chainparams, const CScript& s
     // Limit to between 1K and MAX_BLOCK_SIZE-1K for sanity:
     nBlockMaxSize = std::max((unsigned int)1000, std::min((unsigned int)(MaxBlockSize(fDIP0001ActiveAtTip)-1000), nBlockMaxSize));
 
-    // How much of the block should be dedicated to high-priority transactions,
-    // included regardless of the fees they pay
-    unsigned int nBlockPrioritySize = GetArg("-blockprioritysize", DEFAULT_BLOCK_PRIORITY_SIZE);
-    nBlockPrioritySize = std::min(nBlockMaxSize, nBlockPrioritySize);
-
-    // Minimum block size you want to create; block will be filled with free transactions
-    // until there are no more or the block reaches this size:
-    unsigned int nBlockMinSize = GetArg("-blockminsize", DEFAULT_BLOCK_MIN_SIZE);
-    nBlockMinSize = std::min(nBlockMaxSize, nBlockMinSize);
-
-    // Collect memory pool transactions into the block
-    CTxMemPool::setEntries inBlock;
-    CTxMemPool::setEntries waitSet;
-
-    // This vector will be sorted into a priority queue:
-    vector<TxCoinAgePriority> vecPriority;
-    TxCoinAgePriorityCompare pricomparer;
-    std::map<CTxMemPool::txiter, double, CTxMemPool::CompareIteratorByHash> waitPriMap;
-    typedef std::map<CTxMemPool::txiter, double, CTxMemPool::CompareIteratorByHash>::iterator waitPriIter;
-    double actualPriority = -1;
-
-    std::priority_queue<CTxMemPool::txiter, std::vector<CTxMemPool::txiter>, ScoreCompare> clearedTxs;
-    bool fPrintPriority = GetBoolArg("-printpriority", DEFAULT_PRINTPRIORITY);
-    uint64_t nBlockSize = 1000;
-    uint64_t nBlockTx = 0;
-    unsigned int nBlockSigOps = 100;
-    int lastFewTxs = 0;
-    CAmount nFees = 0;
-
     {
         LOCK(cs_main);
 
@@ -179,142 +746,22 @@ CBlockTemplate* CreateNewBlock(const CChainParams& chainparams, const CScript& s
                                 ? nMedianTimePast
                                 : pblock->GetBlockTime();
 
+        CBlockTxSelection selection;
         {
             LOCK(mempool.cs);
 
-            bool fPriorityBlock = nBlockPrioritySize > 0;
-            if (fPriorityBlock) {
-                vecPriority.reserve(mempool.mapTx.size());
-                for (CTxMemPool::indexed_transaction_set::iterator mi = mempool.mapTx.begin();
-                     mi != mempool.mapTx.end(); ++mi)
-                {
-                    double dPriority = mi->GetPriority(nHeight);
-                    CAmount dummy;
-                    mempool.ApplyDeltas(mi->GetTx().GetHash(), dPriority, dummy);
-                    vecPriority.push_back(TxCoinAgePriority(dPriority, mi));
-                }
-                std::make_heap(vecPriority.begin(), vecPriority.end(), pricomparer);
-            }
-
-            CTxMemPool::indexed_transaction_set::nth_index<3>::type::iterator mi = mempool.mapTx.get<3>().begin();
-            CTxMemPool::txiter iter;
-
-            while (mi != mempool.mapTx.get<3>().end() || !clearedTxs.empty())
-            {
-                bool priorityTx = false;
-                if (fPriorityBlock && !vecPriority.empty()) { // add a tx from priority queue to fill the blockprioritysize
-                    priorityTx = true;
-                    iter = vecPriority.front().second;
-                    actualPriority = vecPriority.front().first;
-                    std::pop_heap(vecPriority.begin(), vecPriority.end(), pricomparer);
-                    vecPriority.pop_back();
-                }
-                else if (clearedTxs.empty()) { // add tx with next highest score
-                    iter = mempool.mapTx.project<0>(mi);
-                    mi++;
-                }
-                else {  // try to add a previously postponed child tx
-                    iter = clearedTxs.top();
-                    clearedTxs.pop();
-                }
-
-                if (inBlock.count(iter))
-                    continue; // could have been added to the priorityBlock
-
-                const CTransaction& tx = iter->GetTx();
-
-                bool fOrphan = false;
-                BOOST_FOREACH(CTxMemPool::txiter parent, mempool.GetMemPoolParents(iter))
-                {
-                    if (!inBlock.count(parent)) {
-                        fOrphan = true;
-                        break;
-                    }
-                }
-                if (fOrphan) {
-                    if (priorityTx)
-                        waitPriMap.insert(std::make_pair(iter,actualPriority));
-                    else
-                        waitSet.insert(iter);
-                    continue;
-                }
-
-                unsigned int nTxSize = iter->GetTxSize();
-                if (fPriorityBlock &&
-                    (nBlockSize + nTxSize >= nBlockPrioritySize || !AllowFree(actualPriority))) {
-                    fPriorityBlock = false;
-                    waitPriMap.clear();
-                }
-                if (!priorityTx &&
-                    (iter->GetModifiedFee() < ::minRelayTxFee.GetFee(nTxSize) && nBlockSize >= nBlockMinSize)) {
-                    break;
-                }
-                if (nBlockSize + nTxSize >= nBlockMaxSize) {
-                    if (nBlockSize >  nBlockMaxSize - 100 || lastFewTxs > 50) {
-                        break;
-                    }
-                    // Once we're within 1000 bytes of a full block, only look at 50 more txs
-                    // to try to fill the remaining space.
-                    if (nBlockSize > nBlockMaxSize - 1000) {
-                        lastFewTxs++;
-                    }
-                    continue;
-                }
-
-                if (!IsFinalTx(tx, nHeight, nLockTimeCutoff))
-                    continue;
-
-                unsigned int nTxSigOps = iter->GetSigOpCount();
-                unsigned int nMaxBlockSigOps = MaxBlockSigOps(fDIP0001ActiveAtTip);
-                if (nBlockSigOps + nTxSigOps >= nMaxBlockSigOps) {
-                    if (nBlockSigOps > nMaxBlockSigOps - 2) {
-                        break;
-                    }
-                    continue;
-                }
-
-                CAmount nTxFees = iter->GetFee();
-                // Added
-                pblock->vtx.push_back(tx);
-                pblocktemplate->vTxFees.push_back(nTxFees);
-                pblocktemplate->vTxSigOps.push_back(nTxSigOps);
-                nBlockSize += nTxSize;
-                ++nBlockTx;
-                nBlockSigOps += nTxSigOps;
-                nFees += nTxFees;
-
-                if (fPrintPriority)
-                {
-                    double dPriority = iter->GetPriority(nHeight);
-                    CAmount dummy;
-                    mempool.ApplyDeltas(tx.GetHash(), dPriority, dummy);
-                    LogPrintf("priority %.1f fee %s txid %s\n",
-                              dPriority , CFeeRate(iter->GetModifiedFee(), nTxSize).ToString(), tx.GetHash().ToString());
-                }
-
-                inBlock.insert(iter);
-
-                // Add transactions that depend on this one to the priority queue
-                BOOST_FOREACH(CTxMemPool::txiter child, mempool.GetMemPoolChildren(iter))
-                {
-                    if (fPriorityBlock) {
-                        waitPriIter wpiter = waitPriMap.find(child);
-                        if (wpiter != waitPriMap.end()) {
-                            vecPriority.push_back(TxCoinAgePriority(wpiter->second,child));
-                            std::push_heap(vecPriority.begin(), vecPriority.end(), pricomparer);
-                            waitPriMap.erase(wpiter);
-                        }
-                    }
-                    else {
-                        if (waitSet.count(child)) {
-                            clearedTxs.push(child);
-                            waitSet.erase(child);
-                        }
-                    }
-                }
-            }
+            int64_t nTimeStart = GetTimeMicros();
+            CCoinsViewMemPool viewMemPool(pcoinsTip, mempool);
+            CCoinsViewCache view(&viewMemPool);
+            SelectBlockTransactions(mempool, nHeight, nLockTimeCutoff, nBlockMaxSize, &view, selection);
+            LogPrint("bench", "CreateNewBlock() packages: %.2fms (%u txs)\n", 0.001 * (GetTimeMicros() - nTimeStart), selection.vtx.size());
         }
 
+        pblock->vtx.insert(pblock->vtx.end(), selection.vtx.begin(), selection.vtx.end());
+        pblocktemplate->vTxFees.insert(pblocktemplate->vTxFees.end(), selection.vTxFees.begin(), selection.vTxFees.end());
+        pblocktemplate->vTxSigOps.insert(pblocktemplate->vTxSigOps.end(), selection.vTxSigOps.begin(), selection.vTxSigOps.end());
+        CAmount nFees = selection.nFees;
+
         // NOTE: unlike in bitcoin, we need to pass PREVIOUS block height here
         CAmount blockReward = 0;
         if (nHeight >= g_nStartSPOSHeight)
@@ -343,9 +790,9 @@ CBlockTemplate* CreateNewBlock(const CChainParams& chainparams, const CScript& s
         // LogPrintf("CreateNewBlock -- nBlockHeight %d blockReward %lld txoutMasternode %s txNew %s",
         //             nHeight, blockReward, pblock->txoutMasternode.ToString(), txNew.ToString());
 
-        nLastBlockTx = nBlockTx;
-        nLastBlockSize = nBlockSize;
-        //LogPrintf("CreateNewBlock(): total size %u txs: %u fees: %ld sigops %d\n", nBlockSize, nBlockTx, nFees, nBlockSigOps);
+        nLastBlockTx = selection.vtx.size();
+        nLastBlockSize = selection.nBlockSize;
+        //LogPrintf("CreateNewBlock(): total size %u txs: %u fees: %ld sigops %d\n", selection.nBlockSize, selection.vtx.size(), nFees, selection.nBlockSigOps);
 
         // Update block coinbase
         pblock->vtx[0] = txNew;
@@ -674,7 +1121,7 @@ static void ConsensusUseSPos(const CChainParams& chainparams,CConnman& connman,C
                              ,unsigned int nNewBlockHeight,CBlock *pblock,boost::shared_ptr<CReserveScript>& coinbaseScript
                              ,unsigned int nTransactionsUpdatedLast,int64_t& nNextTime,unsigned int& nSleepMS
                              ,int64_t& nNextLogTime,int64_t& nNextLogAllowTime,unsigned int& nWaitBlockHeight
-                             ,std::vector<CMasternode>& tmpVecResultMasternodes,int nSposGeneratedIndex
+                             ,const std::vector<CMasternode>& tmpVecResultMasternodes,int nSposGeneratedIndex
                              ,int64_t& nStartNewLoopTime,unsigned int& nEmptySposCntHeight,unsigned int& nAbnormalSposCntHeight)
 {
     int index = 0;
@@ -726,13 +1173,13 @@ static void ConsensusUseSPos(const CChainParams& chainparams,CConnman& connman,C
         return;
     }
 
-    CMasternode& mn = tmpVecResultMasternodes[index];
+    const CMasternode& mn = tmpVecResultMasternodes[index];
     string masterIP = mn.addr.ToStringIP();
     string localIP = activeMasternode.service.ToStringIP();
     unsigned int nHeight = pindexPrev->nHeight+1;
     pblock->nNonce = mn.getCanbeSelectTime(nHeight);
 
-    if(activeMasternode.pubKeyMasternode != mn.GetInfo().pubKeyMasternode)
+    if(activeMasternode.pubKeyMasternode != mn.pubKeyMasternode)
     {
         if(nNewBlockHeight != nWaitBlockHeight && pblock->nTime != nNextLogTime)
         {
@@ -925,23 +1372,20 @@ void static SposMiner(const CChainParams& chainparams, CConnman& connman)
 //                LogPrintf("SPOS_Message:Running miner with %u transactions in block (%u bytes),currHeight:%d\n",pblock->vtx.size(),
 //                          ::GetSerializeSize(*pblock, SER_NETWORK, PROTOCOL_VERSION),pindexPrev->nHeight);
 
-                std::vector<CMasternode> tmpVecResultMasternodes;
+                std::shared_ptr<const std::vector<CMasternode> > pResultMasternodes;
                 int nSposGeneratedIndex=0,masternodeSPosCount=0;
                 int64_t nStartNewLoopTime=0;
                 {
                     LOCK(cs_spos);
-                    for(auto& mn:g_vecResultMasternodes)
-                    {
-                        tmpVecResultMasternodes.push_back(mn);
-                        masternodeSPosCount++;
-                    }
+                    pResultMasternodes = g_pResultMasternodes;
+                    masternodeSPosCount = pResultMasternodes->size();
                     nStartNewLoopTime = g_nStartNewLoopTimeMS;
                     nSposGeneratedIndex = g_nSposGeneratedIndex;
                 }
                 if(masternodeSPosCount != 0)
                 {
                     ConsensusUseSPos(chainparams,connman,pindexPrev,nNewBlockHeight,pblock,coinbaseScript,nTransactionsUpdatedLast,nNextBlockTime,
-                                     nSleepMS,nNextLogTime,nNextLogAllowTime,nWaitBlockHeight,tmpVecResultMasternodes,nSposGeneratedIndex,
+                                     nSleepMS,nNextLogTime,nNextLogAllowTime,nWaitBlockHeight,*pResultMasternodes,nSposGeneratedIndex,
                                      nStartNewLoopTime,nEmptySposCntHeight,nAbnormalSposCntHeight);
                 }else if(nLastMasternodeCount != 0)
                 {
@@ -12,9 +12,11 @@
 
 class CBlockIndex;
 class CChainParams;
+class CCoinsViewCache;
 class CConnman;
 class CReserveKey;
 class CScript;
+class CTxMemPool;
 class CWallet;
 namespace Consensus { struct Params; };
 
@@ -30,6 +32,26 @@ struct CBlockTemplate
     std::vector<int64_t> vTxSigOps;
 };
 
+/** The mempool transactions picked for a new block, in block order */
+struct CBlockTxSelection
+{
+    std::vector<CTransaction> vtx;
+    std::vector<CAmount> vTxFees;
+    std::vector<int64_t> vTxSigOps;
+    uint64_t nBlockSize; // including the space reserved for the coinbase
+    unsigned int nBlockSigOps;
+    CAmount nFees;
+
+    CBlockTxSelection() : nBlockSize(0), nBlockSigOps(0), nFees(0) {}
+};
+
+/** Fill selection with the transactions of pool for a block at nHeight, the
+ *  high-priority ones first and then the packages with the best ancestor
+ *  feerate. If pAppView is set the app and asset transactions are checked
+ *  against it like ConnectBlock does. */
+void SelectBlockTransactions(CTxMemPool& pool, int nHeight, int64_t nLockTimeCutoff, unsigned int nBlockMaxSize,
+                             const CCoinsViewCache* pAppView, CBlockTxSelection& selection);
+
 /** Run the miner threads */
 void GenerateBitcoins(bool fGenerate, int nThreads, const CChainParams& chainparams, CConnman& connman);
 
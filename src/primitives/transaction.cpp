@@ -71,11 +71,7 @@ CTxOut::CTxOut(const CAmount& nValueIn, CScript scriptPubKeyIn, const int64_t nU
     scriptPubKey = scriptPubKeyIn;
     nRounds = -10;
     nUnlockedHeight = nUnlockedHeightIn;
-    vReserve.clear();
-    vReserve.push_back('s');
-    vReserve.push_back('a');
-    vReserve.push_back('f');
-    vReserve.push_back('e');
+    SetDefaultReserve();
 }
 
 uint256 CTxOut::GetHash() const
@@ -123,12 +119,15 @@ CTransaction::CTransaction(const CMutableTransaction &tx) : nVersion(tx.nVersion
     UpdateHash();
 }
 
+CTransaction::CTransaction(const CTransaction &tx) : hash(tx.hash), pAppPayloads(std::atomic_load(&tx.pAppPayloads)), nVersion(tx.nVersion), vin(tx.vin), vout(tx.vout), nLockTime(tx.nLockTime) { }
+
 CTransaction& CTransaction::operator=(const CTransaction &tx) {
     *const_cast<int*>(&nVersion) = tx.nVersion;
     *const_cast<std::vector<CTxIn>*>(&vin) = tx.vin;
     *const_cast<std::vector<CTxOut>*>(&vout) = tx.vout;
     *const_cast<unsigned int*>(&nLockTime) = tx.nLockTime;
     *const_cast<uint256*>(&hash) = tx.hash;
+    std::atomic_store(&pAppPayloads, std::atomic_load(&tx.pAppPayloads));
     return *this;
 }
 
@@ -7,10 +7,13 @@
 #define BITCOIN_PRIMITIVES_TRANSACTION_H
 
 #include "amount.h"
+#include "prevector.h"
 #include "script/script.h"
 #include "serialize.h"
 #include "uint256.h"
 
+#include <memory>
+
 #define SAFE_TX_VERSION_1       101
 #define SAFE_TX_VERSION_2       102
 #define SAFE_TX_VERSION_3       103
@@ -31,33 +34,15 @@
 #define GET_CANDY_CMD           206
 #define TRANSFER_SAFE_CMD       300
 
+/** Reserve of a txout. The 12 inline bytes fit in the space of the heap pointer,
+ * so the plain "safe" marker of most outputs never allocates. */
+typedef prevector<12, unsigned char> CTxOutReserve;
+
 extern int g_nProtocolV1Height;
 extern int g_nProtocolV2Height;
 
 bool IsProtocolV0(const int& nHeight);
 
-inline bool VectorEqual(const std::vector<unsigned char>& a, const std::vector<unsigned char>& b)
-{
-    unsigned int a_size = a.size();
-    unsigned int b_size = b.size();
-
-    if(a_size != b_size) // non-equal length
-        return false;
-
-    if(a_size == 0) // all are empty
-        return true;
-
-    for(std::vector<unsigned char>::const_iterator it_a = a.begin(), it_b = b.begin();
-            it_a != a.end(), it_b != b.end();
-            it_a++, it_b++)
-    {
-        if(*it_a != *it_b)
-            return false;
-    }
-
-    return true;
-}
-
 /** An outpoint - a combination of a transaction hash and an index n into its vout */
 class COutPoint
 {
@@ -184,7 +169,7 @@ public:
     CScript scriptPubKey;
     int nRounds;
     int64_t nUnlockedHeight;
-    std::vector<unsigned char> vReserve;
+    CTxOutReserve vReserve;
 
     CTxOut()
     {
@@ -212,6 +197,12 @@ public:
         scriptPubKey.clear();
         nRounds = -10; // an initial value, should be no way to get this by calculations
         nUnlockedHeight = 0;
+        SetDefaultReserve();
+    }
+
+    //! The reserve of plain SAFE outputs, only the "safe" marker
+    void SetDefaultReserve()
+    {
         vReserve.clear();
         vReserve.push_back('s');
         vReserve.push_back('a');
@@ -219,6 +210,12 @@ public:
         vReserve.push_back('e');
     }
 
+    bool HasDefaultReserve() const
+    {
+        return (vReserve.size() == TXOUT_RESERVE_MIN_SIZE &&
+                vReserve[0] == 's' && vReserve[1] == 'a' && vReserve[2] == 'f' && vReserve[3] == 'e');
+    }
+
     bool IsNull() const
     {
         return (nValue == -1);
@@ -229,29 +226,28 @@ public:
         unsigned int nFixedLen = TXOUT_RESERVE_MIN_SIZE + 4 + sizeof(uint16_t) + 20;
         if (vReserve.size() <= nFixedLen)
             return false;
-    
-        unsigned int nOffset = TXOUT_RESERVE_MIN_SIZE;
-    
-        std::vector<unsigned char> vchConAlg;
-        for(unsigned int k = 0; k < 4; k++)
-            vchConAlg.push_back(vReserve[nOffset++]);
-    
-        if (vchConAlg[0] != 's' || vchConAlg[1] != 'p' || vchConAlg[2] != 'o' || vchConAlg[3] != 's')
+
+        const unsigned char* pConAlg = &vReserve[TXOUT_RESERVE_MIN_SIZE];
+        return (pConAlg[0] == 's' && pConAlg[1] == 'p' && pConAlg[2] == 'o' && pConAlg[3] == 's');
+    }
+
+    /** App command of the reserve, read in place. False if the reserve is too short to carry one */
+    bool GetAppCmd(uint32_t& nAppCmd) const
+    {
+        unsigned int nOffset = TXOUT_RESERVE_MIN_SIZE + sizeof(uint16_t) + 32;
+        if(vReserve.size() < nOffset + sizeof(uint32_t))
             return false;
-    
+
+        memcpy(&nAppCmd, &vReserve[nOffset], sizeof(nAppCmd));
         return true;
     }
 
     bool IsAsset(uint32_t* pAppCmd = NULL) const
     {
-        if (IsSPOSSafeOnly())
-            return false;
-
-        unsigned int nOffset = TXOUT_RESERVE_MIN_SIZE + sizeof(uint16_t) + 32;
-        if(vReserve.size() < nOffset + sizeof(uint32_t))
+        uint32_t nAppCmd = 0;
+        if (IsSPOSSafeOnly() || !GetAppCmd(nAppCmd))
             return false;
 
-        uint32_t nAppCmd = *(uint32_t*)&vReserve[nOffset];
         if(pAppCmd)
             *pAppCmd = nAppCmd;
 
@@ -260,14 +256,10 @@ public:
 
     bool IsApp(uint32_t* pAppCmd = NULL) const
     {
-        if (IsSPOSSafeOnly())
+        uint32_t nAppCmd = 0;
+        if (IsSPOSSafeOnly() || !GetAppCmd(nAppCmd))
             return false;
 
-        unsigned int nOffset = TXOUT_RESERVE_MIN_SIZE + sizeof(uint16_t) + 32;
-        if(vReserve.size() < nOffset + sizeof(uint32_t))
-            return false;
-
-        uint32_t nAppCmd = *(uint32_t*)&vReserve[nOffset];
         if(pAppCmd)
             *pAppCmd = nAppCmd;
 
@@ -276,14 +268,10 @@ public:
 
     bool IsSafeOnly(uint32_t* pAppCmd = NULL) const
     {
-        if (IsSPOSSafeOnly())
-            return true;
-    
-        unsigned int nOffset = TXOUT_RESERVE_MIN_SIZE + sizeof(uint16_t) + 32;
-        if(vReserve.size() < nOffset + sizeof(uint32_t))
+        uint32_t nAppCmd = 0;
+        if (IsSPOSSafeOnly() || !GetAppCmd(nAppCmd))
             return true;
 
-        uint32_t nAppCmd = *(uint32_t*)&vReserve[nOffset];
         if(pAppCmd)
             *pAppCmd = nAppCmd;
 
@@ -319,7 +307,7 @@ public:
                 a.scriptPubKey == b.scriptPubKey &&
                 a.nRounds      == b.nRounds &&
                 a.nUnlockedHeight == b.nUnlockedHeight &&
-                VectorEqual(a.vReserve, b.vReserve));
+                a.vReserve     == b.vReserve);
     }
 
     friend bool operator!=(const CTxOut& a, const CTxOut& b)
@@ -335,13 +323,20 @@ struct CMutableTransaction;
 /** The basic transaction that is broadcasted on the network and contained in
  * blocks.  A transaction can contain multiple inputs and outputs.
  */
+class CAppPayload;
+class CTxAppPayloads;
+
 class CTransaction
 {
 private:
     /** Memory only. */
     const uint256 hash;
+    /** Memory only. The decoded app data of vout, filled on demand by GetAppPayload(). */
+    mutable std::shared_ptr<const CTxAppPayloads> pAppPayloads;
     void UpdateHash() const;
 
+    friend const CAppPayload* GetAppPayload(const CTransaction& tx, const unsigned int n);
+
 public:
     // Default transaction version.
     static const int32_t CURRENT_VERSION = SAFE_TX_VERSION_3;
@@ -368,6 +363,7 @@ public:
     /** Convert a CMutableTransaction into a CTransaction. */
     CTransaction(const CMutableTransaction &tx);
 
+    CTransaction(const CTransaction& tx);
     CTransaction& operator=(const CTransaction& tx);
 
     ADD_SERIALIZE_METHODS;
@@ -379,8 +375,10 @@ public:
         READWRITE(*const_cast<std::vector<CTxIn>*>(&vin));
         READWRITE(*const_cast<std::vector<CTxOut>*>(&vout));
         READWRITE(*const_cast<uint32_t*>(&nLockTime));
-        if (ser_action.ForRead())
+        if (ser_action.ForRead()) {
             UpdateHash();
+            std::atomic_store(&pAppPayloads, std::shared_ptr<const CTxAppPayloads>());
+        }
     }
 
     bool IsNull() const {
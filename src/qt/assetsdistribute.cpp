@@ -18,6 +18,7 @@
 #include "rpc/server.h"
 #include "bitcoinunits.h"
 #include "masternode-sync.h"
+#include "assetamount.h"
 #include "walletmodel.h"
 #include "optionsmodel.h"
 #include <QMessageBox>
@@ -266,29 +267,15 @@ void AssetsDistribute::updateCandyValue()
             decimalIndex++;
         }
     }
-    string memoryCandyStr = mulstring(memoryAssetsStr,QString::number(ui->assetsCandyRatioSlider->value()).toStdString());
-
-    int addDecimal = 3;//10% is 1,slider max 100 is 2,total 3
-    int totalDecimal = decimal+addDecimal;
-    int size = memoryCandyStr.size();
-    if(decimal==0||size==0)
+    //10% is 1,slider max 100 is 2,total 3
+    CAssetAmount candyAmount;
+    if(decimal==0||!CAssetAmount::Parse(memoryAssetsStr,0,candyAmount)||!candyAmount.Mul(ui->assetsCandyRatioSlider->value())
+            ||!candyAmount.Div(1000)||candyAmount.IsZero())
     {
         ui->candyTotalValueLabel->clear();
         return;
     }
-    if(size<=totalDecimal)
-    {
-        string resultStr = "0.";
-        int zeroCount = totalDecimal-size;
-        for(int i=0;i<zeroCount;i++)
-            resultStr.push_back('0');
-        resultStr.append(memoryCandyStr.substr(0,decimal-zeroCount));
-        ui->candyTotalValueLabel->setText(QString::fromStdString(resultStr));
-    }else
-    {
-        string resultStr = numtofloatstring(memoryCandyStr,totalDecimal);
-        ui->candyTotalValueLabel->setText(QString::fromStdString(resultStr.substr(0,resultStr.size()-addDecimal)));
-    }
+    ui->candyTotalValueLabel->setText(QString::fromStdString(candyAmount.ToString(decimal)));
 }
 
 void AssetsDistribute::initFirstDistribute()
@@ -12,6 +12,8 @@
 #include "script/sign.h"
 #include "masternode-sync.h"
 #include "txmempool.h"
+#include "candyengine.h"
+#include "assetamount.h"
 #include "askpassphrasedialog.h"
 #include <string.h>
 #include <map>
@@ -25,8 +27,6 @@ using std::map;
 using std::vector;
 
 extern bool gInitByDefault;
-extern std::vector<CCandy_BlockTime_Info> gAllCandyInfoVec;
-extern std::mutex g_mutexAllCandyInfo;
 extern unsigned int nCandyPageCount;
 
 
@@ -539,48 +539,15 @@ void GetCandyWorker::doGetCandy()
 
 void CandyPage::eraseCandy(int rowNum)
 {
-    std::lock_guard<std::mutex> lock(g_mutexAllCandyInfo);
-    int index = (nCurrPage-1)*nPageCount+rowNum;
     int tmpSize = tmpAllCandyInfoVec.size();
-    if(tmpSize<=index)
+    if(rowNum<0||tmpSize<=rowNum)
     {
-        LogPrintf("invalid candy index:%d,tmpAllCandyInfoVec size:%d\n", index,tmpSize);
+        LogPrintf("invalid candy row:%d,tmpAllCandyInfoVec size:%d\n", rowNum,tmpSize);
         return;
     }
-    CCandy_BlockTime_Info& tmpInfo = tmpAllCandyInfoVec[index];
-    int size = gAllCandyInfoVec.size();
-    bool found = false;
-    int removeIndex = 0;
-    for(int i=0;i<size;i++)
-    {
-        CCandy_BlockTime_Info& info = gAllCandyInfoVec[i];
-        if(tmpInfo.assetId!=info.assetId)
-            continue;
-        if(tmpInfo.assetData.strAssetName!=info.assetData.strAssetName)
-            continue;
-        if(tmpInfo.candyinfo.nAmount!=info.candyinfo.nAmount)
-            continue;
-        if(tmpInfo.candyinfo.nExpired!=info.candyinfo.nExpired)
-            continue;
-        if(tmpInfo.outpoint.n!=info.outpoint.n)
-            continue;
-        if(tmpInfo.outpoint.hash!=info.outpoint.hash)
-            continue;
-        if(tmpInfo.nHeight!=info.nHeight)
-            continue;
-        if(tmpInfo.blocktime!=info.blocktime)
-            continue;
-        found = true;
-        removeIndex = i;
-        break;
-    }
-    if(!found)
-    {
+    const CCandy_BlockTime_Info& tmpInfo = tmpAllCandyInfoVec[rowNum];
+    if(!candyinfostore.Erase(tmpInfo.outpoint))
         LogPrintf("erase candy not found,height:%d,assetName:%s\n", tmpInfo.nHeight,tmpInfo.assetData.strAssetName);
-        updatePage();
-        return;
-    }
-    gAllCandyInfoVec.erase(gAllCandyInfoVec.begin()+removeIndex);
     updatePage();
 }
 
@@ -611,8 +578,7 @@ void CandyPage::getCandy()
 void CandyPage::updateGetCandyList()
 {
     //LOCK2(cs_main, pwalletMain->cs_wallet);
-    std::lock_guard<std::mutex> lock(g_mutexAllCandyInfo);
-    int size = gAllCandyInfoVec.size();
+    int size = candyinfostore.Size();
     if(size<=0||size>nPageCount)
         return;
     nCurrPage = 1;
@@ -702,20 +668,11 @@ void CandyPage::on_okButton_clicked()
 
 void CandyPage::updateCandyValue()
 {
-    char amountStr[64] = "";
-#ifdef WIN32
-    snprintf(amountStr,sizeof(amountStr),"%lld",currAssetTotalAmount);
-#else
-    snprintf(amountStr,sizeof(amountStr),"%ld",currAssetTotalAmount);
-#endif
-    string multiStr = mulstring(amountStr,QString::number(ui->candyRatioSlider->value()).toStdString());
-    int addDecimal = 3;//10% is 1,slider max 100 is 2,total 3
-    int totalDecimal = currAssetDecimal+addDecimal;
-    int size = multiStr.size();
-    if( size <= totalDecimal)
-        multiStr = "0" + multiStr;
-    string resultStr = numtofloatstring(multiStr,totalDecimal);
-    ui->candyValueLabel->setText(QString::fromStdString(resultStr.substr(0,resultStr.size()-addDecimal)));
+    //10% is 1,slider max 100 is 2,total 3
+    CAssetAmount candyAmount(currAssetTotalAmount);
+    if(!candyAmount.Mul(ui->candyRatioSlider->value()) || !candyAmount.Div(1000))
+        return;
+    ui->candyValueLabel->setText(QString::fromStdString(candyAmount.ToString(currAssetDecimal)));
     ui->candyValueLabel->setVisible(true);
 }
 
@@ -931,35 +888,18 @@ void CandyPage::copyVec()
 		std::vector<CCandy_BlockTime_Info>().swap(tmpAllCandyInfoVec);
 	}
 
-    int candyInfoVecSize = gAllCandyInfoVec.size();
+    std::vector<CCandy_BlockTime_Info> vPageInfo;
+    candyinfostore.GetPage(nPageCount*(nCurrPage-1), nPageCount, vPageInfo);
+
     int nCurrentHeight = g_nChainHeight;
-    for(int i=0;i<candyInfoVecSize;i++)
+    for(unsigned int i=0;i<vPageInfo.size();i++)
     {
-        CCandy_BlockTime_Info& info = gAllCandyInfoVec[i];
+        const CCandy_BlockTime_Info& info = vPageInfo[i];
         int displayHeight = info.nHeight+1;
         if(displayHeight>nCurrentHeight)
             continue;
-
-        if (info.nHeight >= g_nStartSPOSHeight)
-        {
-            if(info.candyinfo.nExpired * SPOS_BLOCKS_PER_MONTH + info.nHeight  - 3 * SPOS_BLOCKS_PER_DAY < nCurrentHeight)
-                continue;
-        }
-        else
-        {
-            if (info.candyinfo.nExpired * BLOCKS_PER_MONTH + info.nHeight >= g_nStartSPOSHeight)
-            {
-                int nSPOSLaveHeight = (info.candyinfo.nExpired * BLOCKS_PER_MONTH + info.nHeight - g_nStartSPOSHeight) * (Params().GetConsensus().nPowTargetSpacing / Params().GetConsensus().nSPOSTargetSpacing);
-                int nTrueBlockHeight = g_nStartSPOSHeight + nSPOSLaveHeight;
-                if (nTrueBlockHeight < nCurrentHeight)
-                    continue;
-            }
-            else
-            {
-                if(info.candyinfo.nExpired * BLOCKS_PER_MONTH + info.nHeight < nCurrentHeight)
-                    continue;
-            }
-        }
+        if(IsCandyExpired(info.nHeight, info.candyinfo.nExpired, nCurrentHeight))
+            continue;
 
         tmpAllCandyInfoVec.push_back(info);
     }
@@ -967,8 +907,7 @@ void CandyPage::copyVec()
 
 void CandyPage::updateCurrentPage()
 {
-    std::lock_guard<std::mutex> lock(g_mutexAllCandyInfo);
-    if(gAllCandyInfoVec.size()<=0)
+    if(candyinfostore.Empty())
         return;
     updatePage();
 }
@@ -976,20 +915,25 @@ void CandyPage::updateCurrentPage()
 void CandyPage::updatePage(bool gotoLastPage)
 {
     ui->tableWidgetGetCandy->clearContents();
-    copyVec();
-    int candyInfoVecSize = tmpAllCandyInfoVec.size();
-    if(candyInfoVecSize<=0)
+    int candyInfoSize = candyinfostore.Size();
+    if(candyInfoSize<=0)
+    {
+        tmpAllCandyInfoVec.clear();
         return;
-    int lastPage = candyInfoVecSize / nPageCount;
-    if(candyInfoVecSize%nPageCount!=0)
+    }
+    int lastPage = candyInfoSize / nPageCount;
+    if(candyInfoSize%nPageCount!=0)
         lastPage++;
     if(gotoLastPage)
         nCurrPage = lastPage;
     if(nCurrPage>lastPage)
         nCurrPage = lastPage;
+    if(nCurrPage<1)
+        nCurrPage = 1;
+    copyVec();
     int row = 0;
 
-    for(int i=nPageCount*(nCurrPage-1);i<candyInfoVecSize&&i<nPageCount*nCurrPage;i++)
+    for(unsigned int i=0;i<tmpAllCandyInfoVec.size();i++)
     {
         CCandy_BlockTime_Info& info = tmpAllCandyInfoVec[i];
         QString dateStr = GUIUtil::dateTimeStr(info.blocktime);
@@ -1003,8 +947,7 @@ void CandyPage::updatePage(bool gotoLastPage)
 
 void CandyPage::on_firstBtn_clicked()
 {
-    std::lock_guard<std::mutex> lock(g_mutexAllCandyInfo);
-    if(gAllCandyInfoVec.size()<=0)
+    if(candyinfostore.Empty())
         return;
     nCurrPage = 1;
     updatePage();
@@ -1012,8 +955,7 @@ void CandyPage::on_firstBtn_clicked()
 
 void CandyPage::on_nextBtn_clicked()
 {
-    std::lock_guard<std::mutex> lock(g_mutexAllCandyInfo);
-    if(gAllCandyInfoVec.size()<=0)
+    if(candyinfostore.Empty())
         return;
     nCurrPage++;
     updatePage();
@@ -1021,8 +963,7 @@ void CandyPage::on_nextBtn_clicked()
 
 void CandyPage::on_priorBtn_clicked()
 {
-    std::lock_guard<std::mutex> lock(g_mutexAllCandyInfo);
-    if(gAllCandyInfoVec.size()<=0)
+    if(candyinfostore.Empty())
         return;
     if(nCurrPage==1)
         return;
@@ -1032,16 +973,14 @@ void CandyPage::on_priorBtn_clicked()
 
 void CandyPage::on_lastBtn_clicked()
 {
-    std::lock_guard<std::mutex> lock(g_mutexAllCandyInfo);
-    if(gAllCandyInfoVec.size()<=0)
+    if(candyinfostore.Empty())
         return;
     updatePage(true);
 }
 
 void CandyPage::on_skipBtn_clicked()
 {
-    std::lock_guard<std::mutex> lock(g_mutexAllCandyInfo);
-    if(gAllCandyInfoVec.size()<=0)
+    if(candyinfostore.Empty())
         return;
     nCurrPage = ui->spinBox->value();
     updatePage();
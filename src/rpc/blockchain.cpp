@@ -17,6 +17,7 @@
 #include "rpc/server.h"
 #include "streams.h"
 #include "sync.h"
+#include "txdb.h"
 #include "txmempool.h"
 #include "util.h"
 #include "utilstrencodings.h"
@@ -991,6 +992,80 @@ UniValue getmempoolinfo(const UniValue& params, bool fHelp)
     return mempoolInfoToJSON();
 }
 
+UniValue getassetcacheinfo(const UniValue& params, bool fHelp)
+{
+    if (fHelp || params.size() != 0)
+        throw runtime_error(
+            "getassetcacheinfo\n"
+            "\nReturns the statistics of the asset and app metadata caches.\n"
+            "\nResult:\n"
+            "{\n"
+            "  \"name\": {                 (string) The cached index: appinfo, appname, assetinfo, shortname, assetname or getcandycount\n"
+            "    \"size\": xxxxx,           (numeric) Number of cached entries\n"
+            "    \"maxsize\": xxxxx,        (numeric) Maximum number of cached entries\n"
+            "    \"hits\": xxxxx,           (numeric) Lookups answered by the cache\n"
+            "    \"misses\": xxxxx          (numeric) Lookups that read the block tree database\n"
+            "  },\n"
+            "  ...\n"
+            "}\n"
+            "\nExamples:\n"
+            + HelpExampleCli("getassetcacheinfo", "")
+            + HelpExampleRpc("getassetcacheinfo", "")
+        );
+
+    std::map<std::string, CIndexCacheStats> mapStats;
+    pblocktree->GetAppAssetCacheStats(mapStats);
+
+    UniValue ret(UniValue::VOBJ);
+    for (std::map<std::string, CIndexCacheStats>::const_iterator it = mapStats.begin(); it != mapStats.end(); ++it)
+    {
+        UniValue obj(UniValue::VOBJ);
+        obj.push_back(Pair("size", (int64_t)it->second.nSize));
+        obj.push_back(Pair("maxsize", (int64_t)it->second.nMaxSize));
+        obj.push_back(Pair("hits", (uint64_t)it->second.nHits));
+        obj.push_back(Pair("misses", (uint64_t)it->second.nMisses));
+        ret.push_back(Pair(it->first, obj));
+    }
+
+    return ret;
+}
+
+UniValue getchangeinfoqueueinfo(const UniValue& params, bool fHelp)
+{
+    if (fHelp || params.size() != 0)
+        throw runtime_error(
+            "getchangeinfoqueueinfo\n"
+            "\nReturns the state of the queue between block connection and the candy change file writer.\n"
+            "\nResult:\n"
+            "{\n"
+            "  \"depth\": xxxxx,            (numeric) Blocks queued or being written\n"
+            "  \"maxdepth\": xxxxx,         (numeric) Highest depth seen since startup\n"
+            "  \"capacity\": xxxxx,         (numeric) Depth at which block connection waits for the writer\n"
+            "  \"producerwaits\": xxxxx,    (numeric) Number of times block connection waited\n"
+            "  \"producerwaittime\": xxxxx, (numeric) Total time spent waiting in microseconds\n"
+            "  \"writtenblocks\": xxxxx,    (numeric) Blocks written to the change files\n"
+            "  \"writebatches\": xxxxx,     (numeric) Batches the blocks were written in\n"
+            "  \"syncs\": xxxxx             (numeric) Number of fsyncs, see -changesyncblocks\n"
+            "}\n"
+            "\nExamples:\n"
+            + HelpExampleCli("getchangeinfoqueueinfo", "")
+            + HelpExampleRpc("getchangeinfoqueueinfo", "")
+        );
+
+    CChangeInfoQueueStats stats = GetChangeInfoQueueStats();
+
+    UniValue ret(UniValue::VOBJ);
+    ret.push_back(Pair("depth", stats.nDepth));
+    ret.push_back(Pair("maxdepth", stats.nMaxDepth));
+    ret.push_back(Pair("capacity", stats.nCapacity));
+    ret.push_back(Pair("producerwaits", stats.nProducerWaits));
+    ret.push_back(Pair("producerwaittime", stats.nProducerWaitTime));
+    ret.push_back(Pair("writtenblocks", stats.nWrittenBlocks));
+    ret.push_back(Pair("writebatches", stats.nWriteBatches));
+    ret.push_back(Pair("syncs", stats.nSyncs));
+    return ret;
+}
+
 UniValue invalidateblock(const UniValue& params, bool fHelp)
 {
     if (fHelp || params.size() != 1)
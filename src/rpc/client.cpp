@@ -157,16 +157,20 @@ static const CRPCConvertParam vRPCConvertParams[] =
     { "putcandy", 1},
     { "putcandy", 2},
     { "getassetidtxids", 1},
+    { "getassetidtxids", 2},
     { "getaddrassettxids", 2},
+    { "getaddrassettxids", 3},
     { "getaddrassetbalance", 2},
     { "getaddressapptxids", 2},
     { "getaddressapptxids", 3},
     { "getapptxids", 1},
     { "getapptxids", 2},
     { "getaddressamountbyheight", 0},
+    { "getavailablecandylist", 0},
     { "sendmanywithlock", 0},
     { "transfermanyasset", 1},
     { "getassetlocaltxlist", 1},
+    { "getassetlocaltxlist", 2},
 };
 
 class CRPCConvertTable
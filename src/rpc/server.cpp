@@ -358,6 +358,8 @@ static const CRPCCommand vRPCCommands[] =
     { "blockchain",         "getchaintips",           &getchaintips,                true  },
     { "blockchain",         "getdifficulty",          &getdifficulty,               true  },
     { "blockchain",         "getmempoolinfo",         &getmempoolinfo,              true  },
+    { "blockchain",         "getassetcacheinfo",      &getassetcacheinfo,           true  },
+    { "blockchain",         "getchangeinfoqueueinfo", &getchangeinfoqueueinfo,      true  },
     { "blockchain",         "getrawmempool",          &getrawmempool,               true  },
     { "blockchain",         "gettxout",               &gettxout,                    true  },
     { "blockchain",         "gettxoutproof",          &gettxoutproof,               true  },
@@ -0,0 +1,116 @@
+// Copyright (c) 2018-2019 The Safe Core developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "app/app.h"
+#include "arith_uint256.h"
+#include "consensus/validation.h"
+#include "key.h"
+#include "validation.h"
+#include "validationinterface.h"
+#include "script/standard.h"
+#include "test/test_safe.h"
+
+#include <map>
+
+#include <boost/test/unit_test.hpp>
+
+BOOST_FIXTURE_TEST_SUITE(appcheck_tests, TestChain100Setup)
+
+/** Keep the reject reason of every checked block */
+struct CBlockCheckedRecorder : public CValidationInterface
+{
+    std::map<uint256, std::string> mapRejectReason;
+
+    void BlockChecked(const CBlock& block, const CValidationState& state)
+    {
+        mapRejectReason[block.GetHash()] = state.IsValid() ? "" : state.GetRejectReason();
+    }
+};
+
+static CMutableTransaction CreateSpend(const CKey& key, const CScript& scriptPubKey, const COutPoint& prevout, const CAmount& nValue)
+{
+    CMutableTransaction tx;
+    tx.vin.resize(1);
+    tx.vin[0].prevout = prevout;
+    tx.vout.push_back(CTxOut(nValue, scriptPubKey));
+
+    std::vector<unsigned char> vchSig;
+    uint256 hash = SignatureHash(scriptPubKey, tx, 0, SIGHASH_ALL);
+    BOOST_CHECK(key.Sign(hash, vchSig));
+    vchSig.push_back((unsigned char)SIGHASH_ALL);
+    tx.vin[0].scriptSig << vchSig;
+    return tx;
+}
+
+/**
+ * Connect the block with the app checks on the check threads or on the
+ * connecting thread and return its reject reason, empty when it is connected.
+ */
+static std::string ConnectWithAppCheck(TestChain100Setup& setup, CBlockCheckedRecorder& recorder, const std::vector<CMutableTransaction>& vtx, const CScript& scriptPubKey, const bool fParallel)
+{
+    const int nScriptCheckThreadsSaved = nScriptCheckThreads;
+    nScriptCheckThreads = fParallel ? nScriptCheckThreadsSaved : 0;
+    CBlock block = setup.CreateAndProcessBlock(vtx, scriptPubKey);
+    nScriptCheckThreads = nScriptCheckThreadsSaved;
+
+    BOOST_CHECK(recorder.mapRejectReason.count(block.GetHash()));
+    if (chainActive.Tip()->GetBlockHash() == block.GetHash())
+        return "";
+    return recorder.mapRejectReason[block.GetHash()].empty() ? "not connected" : recorder.mapRejectReason[block.GetHash()];
+}
+
+BOOST_AUTO_TEST_CASE(appcheck_parallel_matches_serial)
+{
+    BOOST_REQUIRE(nScriptCheckThreads > 1);
+
+    CBlockCheckedRecorder recorder;
+    RegisterValidationInterface(&recorder);
+
+    CScript scriptPubKey = CScript() << ToByteVector(coinbaseKey.GetPubKey()) << OP_CHECKSIG;
+
+    // an asset output in the utxo set, spent as the first input below
+    CMutableTransaction txAsset;
+    txAsset.vin.resize(1);
+    txAsset.vin[0].prevout = COutPoint(ArithToUint256(arith_uint256(1)), 0);
+    CTxOut txoutAsset(1000, scriptPubKey);
+    CAppHeader header(g_nAppHeaderVersion, uint256S(g_strSafeAssetId), TRANSFER_ASSET_CMD);
+    txoutAsset.vReserve = FillCommonData(header, CCommonData(ArithToUint256(arith_uint256(7)), txoutAsset.nValue, "transfer"));
+    txAsset.vout.push_back(txoutAsset);
+    BOOST_REQUIRE(txAsset.vout[0].IsAsset());
+    {
+        LOCK(cs_main);
+        pcoinsTip->ModifyCoins(txAsset.GetHash())->FromTx(txAsset, chainActive.Height());
+    }
+
+    for (int i = 0; i < 2; i++)
+    {
+        // the second transaction spends the asset output and then the coinbase
+        // output the first one spends, the app check threads see no spends
+        const COutPoint prevout(coinbaseTxns[i].GetHash(), 0);
+        std::vector<CMutableTransaction> vtx;
+        vtx.push_back(CreateSpend(coinbaseKey, scriptPubKey, prevout, 11 * CENT));
+
+        CMutableTransaction txDoubleSpend;
+        txDoubleSpend.vin.push_back(CTxIn(COutPoint(txAsset.GetHash(), 0)));
+        txDoubleSpend.vin.push_back(CTxIn(prevout));
+        txDoubleSpend.vout.push_back(txoutAsset);
+        txDoubleSpend.vout.push_back(CTxOut(10 * CENT, scriptPubKey));
+        vtx.push_back(txDoubleSpend);
+
+        BOOST_CHECK_EQUAL(ConnectWithAppCheck(*this, recorder, vtx, scriptPubKey, i == 0), "3-bad-txns-inputs-spent");
+    }
+
+    // a transaction spending an output of the block is connected on both paths
+    for (int i = 2; i < 4; i++)
+    {
+        std::vector<CMutableTransaction> vtx;
+        vtx.push_back(CreateSpend(coinbaseKey, scriptPubKey, COutPoint(coinbaseTxns[i].GetHash(), 0), 11 * CENT));
+        vtx.push_back(CreateSpend(coinbaseKey, scriptPubKey, COutPoint(vtx[0].GetHash(), 0), 10 * CENT));
+        BOOST_CHECK_EQUAL(ConnectWithAppCheck(*this, recorder, vtx, scriptPubKey, i == 2), "");
+    }
+
+    UnregisterValidationInterface(&recorder);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,75 @@
+// Copyright (c) 2018-2019 The Safe Core developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "app/app.h"
+#include "arith_uint256.h"
+#include "primitives/transaction.h"
+#include "streams.h"
+#include "version.h"
+#include "test/test_safe.h"
+
+#include <boost/test/unit_test.hpp>
+
+BOOST_FIXTURE_TEST_SUITE(apppayload_tests, BasicTestingSetup)
+
+static uint256 TxId(const int n)
+{
+    return ArithToUint256(arith_uint256(n));
+}
+
+BOOST_AUTO_TEST_CASE(apppayload_decoded_once)
+{
+    const uint256 assetId = TxId(1000);
+    const CScript scriptPubKey = CScript() << OP_TRUE;
+
+    // a transfer, a plain safe output and a put-candy output
+    CMutableTransaction mtx;
+    mtx.vin.resize(1);
+    mtx.vin[0].prevout = COutPoint(TxId(1), 0);
+    mtx.vout.push_back(CTxOut(0, scriptPubKey));
+    mtx.vout[0].vReserve = FillCommonData(CAppHeader(g_nAppHeaderVersion, uint256S(g_strSafeAssetId), TRANSFER_ASSET_CMD), CCommonData(assetId, 10 * COIN, "transfer"));
+    mtx.vout.push_back(CTxOut(1 * COIN, scriptPubKey));
+    mtx.vout.push_back(CTxOut(0, scriptPubKey));
+    mtx.vout[2].vReserve = FillPutCandyData(CAppHeader(g_nAppHeaderVersion, uint256S(g_strSafeAssetId), PUT_CANDY_CMD), CPutCandyData(assetId, 5 * COIN, 1, "candy"));
+    const CTransaction tx(mtx);
+
+    const CAppPayload* pTransfer = GetAppPayload(tx, 0);
+    BOOST_REQUIRE(pTransfer);
+    BOOST_CHECK_EQUAL(pTransfer->header.nAppCmd, TRANSFER_ASSET_CMD);
+    BOOST_CHECK(pTransfer->fDataValid);
+    BOOST_CHECK(pTransfer->commonData.assetId == assetId);
+    BOOST_CHECK_EQUAL(pTransfer->commonData.nAmount, 10 * COIN);
+    BOOST_CHECK(!GetAppPayload(tx, 1));
+    BOOST_CHECK(!GetAppPayload(tx, 3));
+
+    const CAppPayload* pCandy = GetAppPayload(tx, 2);
+    BOOST_REQUIRE(pCandy);
+    BOOST_CHECK(pCandy->fDataValid);
+    BOOST_CHECK_EQUAL(pCandy->putCandyData.nAmount, 5 * COIN);
+
+    uint256 payloadAssetId;
+    BOOST_CHECK(GetPayloadAssetId(*pCandy, payloadAssetId));
+    BOOST_CHECK(payloadAssetId == assetId);
+
+    // later lookups and copies of the transaction share the decoded outputs
+    BOOST_CHECK(GetAppPayload(tx, 0) == pTransfer);
+    const CTransaction txCopy(tx);
+    BOOST_CHECK(GetAppPayload(txCopy, 0) == pTransfer);
+    CTransaction txAssigned;
+    txAssigned = tx;
+    BOOST_CHECK(GetAppPayload(txAssigned, 2) == pCandy);
+
+    // a deserialized transaction decodes its own
+    CDataStream ss(SER_DISK, CLIENT_VERSION);
+    ss << tx;
+    CTransaction txRead;
+    ss >> txRead;
+    const CAppPayload* pRead = GetAppPayload(txRead, 0);
+    BOOST_REQUIRE(pRead);
+    BOOST_CHECK(pRead != pTransfer);
+    BOOST_CHECK(pRead->commonData.assetId == assetId);
+    BOOST_CHECK_EQUAL(pRead->commonData.nAmount, 10 * COIN);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
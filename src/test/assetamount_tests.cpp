@@ -0,0 +1,89 @@
+// Copyright (c) 2018-2019 The Safe Core developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "assetamount.h"
+#include "test/test_safe.h"
+
+#include <boost/test/unit_test.hpp>
+
+BOOST_FIXTURE_TEST_SUITE(assetamount_tests, BasicTestingSetup)
+
+BOOST_AUTO_TEST_CASE(assetamount_tostring)
+{
+    BOOST_CHECK_EQUAL(CAssetAmount().ToString(0), "0");
+    BOOST_CHECK_EQUAL(CAssetAmount().ToString(4), "0.0000");
+    BOOST_CHECK_EQUAL(CAssetAmount(5).ToString(2), "0.05");
+    BOOST_CHECK_EQUAL(CAssetAmount(123400).ToString(4), "12.3400");
+    BOOST_CHECK_EQUAL(CAssetAmount(-123400).ToString(4), "-12.3400");
+    BOOST_CHECK_EQUAL(CAssetAmount(-5).ToString(3), "-0.005");
+    BOOST_CHECK_EQUAL(CAssetAmount(MAX_ASSETS).ToString(10), "200000000.0000000000");
+
+    CAssetAmount::value_type nMax = ~((unsigned __int128)0) >> 1;
+    BOOST_CHECK_EQUAL(CAssetAmount::FromRaw(nMax).ToString(0), "170141183460469231731687303715884105727");
+    BOOST_CHECK_EQUAL(CAssetAmount::FromRaw(-nMax - 1).ToString(8), "-1701411834604692317316873037158.84105728");
+
+    // decimals beyond what Parse() accepts still format in full
+    BOOST_CHECK_EQUAL(CAssetAmount(-5).ToString(-1), "-5");
+    BOOST_CHECK_EQUAL(CAssetAmount(5).ToString(64), "0." + std::string(63, '0') + "5");
+    BOOST_CHECK_EQUAL(CAssetAmount::FromRaw(-nMax - 1).ToString(255), "-0." + std::string(216, '0') + "170141183460469231731687303715884105728");
+}
+
+BOOST_AUTO_TEST_CASE(assetamount_parse)
+{
+    CAssetAmount amount;
+    BOOST_CHECK(CAssetAmount::Parse("0", 8, amount) && amount.IsZero());
+    BOOST_CHECK(CAssetAmount::Parse("12.34", 4, amount) && amount == CAssetAmount(123400));
+    BOOST_CHECK(CAssetAmount::Parse("-12.34", 4, amount) && amount == CAssetAmount(-123400));
+    BOOST_CHECK(CAssetAmount::Parse(".5", 1, amount) && amount == CAssetAmount(5));
+    BOOST_CHECK(CAssetAmount::Parse("7.", 2, amount) && amount == CAssetAmount(700));
+    BOOST_CHECK(CAssetAmount::Parse("200000000.0000000000", 10, amount) && amount == CAssetAmount(MAX_ASSETS));
+    BOOST_CHECK(CAssetAmount::Parse("170141183460469231731687303715884105727", 0, amount));
+    BOOST_CHECK(CAssetAmount::Parse("-170141183460469231731687303715884105728", 0, amount));
+
+    BOOST_CHECK(!CAssetAmount::Parse("", 4, amount));
+    BOOST_CHECK(!CAssetAmount::Parse("-", 4, amount));
+    BOOST_CHECK(!CAssetAmount::Parse(".", 4, amount));
+    BOOST_CHECK(!CAssetAmount::Parse("1.2.3", 4, amount));
+    BOOST_CHECK(!CAssetAmount::Parse("1.23456", 4, amount));
+    BOOST_CHECK(!CAssetAmount::Parse(" 1", 4, amount));
+    BOOST_CHECK(!CAssetAmount::Parse("1e3", 4, amount));
+    BOOST_CHECK(!CAssetAmount::Parse("--1", 4, amount));
+    BOOST_CHECK(!CAssetAmount::Parse("170141183460469231731687303715884105728", 0, amount));
+    BOOST_CHECK(!CAssetAmount::Parse("17014118346046923173168730371588410572", 2, amount));
+    BOOST_CHECK(!CAssetAmount::Parse("1", MAX_ASSETAMOUNT_DECIMALS + 1, amount));
+}
+
+BOOST_AUTO_TEST_CASE(assetamount_arith)
+{
+    CAssetAmount amount(MAX_ASSETS);
+    BOOST_CHECK(amount.Add(CAssetAmount(MAX_ASSETS)));
+    BOOST_CHECK(amount.Mul(100));
+    BOOST_CHECK_EQUAL(amount.ToString(0), "400000000000000000000");
+    CAmount n = 0;
+    BOOST_CHECK(!amount.GetAmount(n));
+    BOOST_CHECK(amount.Div(1000));
+    BOOST_CHECK(amount.GetAmount(n) && n == 400000000000000000);
+    BOOST_CHECK(!amount.Div(0));
+
+    BOOST_CHECK(amount.Sub(CAssetAmount(500000000000000000)));
+    BOOST_CHECK(amount.IsNegative());
+    BOOST_CHECK(amount.Mul(-3) && amount == CAssetAmount(300000000000000000));
+    BOOST_CHECK(CAssetAmount(-7).Div(2));
+
+    CAssetAmount::value_type nMax = ~((unsigned __int128)0) >> 1;
+    CAssetAmount max = CAssetAmount::FromRaw(nMax);
+    CAssetAmount min = CAssetAmount::FromRaw(-nMax - 1);
+    BOOST_CHECK(!max.Add(CAssetAmount(1)));
+    BOOST_CHECK(max == CAssetAmount::FromRaw(nMax));
+    BOOST_CHECK(!min.Sub(CAssetAmount(1)));
+    BOOST_CHECK(!min.Mul(-1));
+    BOOST_CHECK(!min.Div(-1));
+    BOOST_CHECK(!max.Mul(2));
+    BOOST_CHECK(max.Mul(-1) && max.Sub(CAssetAmount(1)) && max == min);
+    BOOST_CHECK(CAssetAmount::FromRaw(nMax / 2).Mul(2));
+    BOOST_CHECK(!CAssetAmount::FromRaw(nMax / 2 + 1).Mul(2));
+    BOOST_CHECK(CAssetAmount::FromRaw(-(nMax / 2) - 1).Mul(2));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,674 @@
+// Copyright (c) 2018-2019 The Safe Core developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "app/app.h"
+#include "appindex.h"
+#include "arith_uint256.h"
+#include "base58.h"
+#include "consensus/validation.h"
+#include "key.h"
+#include "main.h"
+#include "script/standard.h"
+#include "txdb.h"
+#include "txmempool.h"
+#include "validation.h"
+#include "test/test_safe.h"
+
+#include <list>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+BOOST_FIXTURE_TEST_SUITE(assettxindex_tests, TestingSetup)
+
+static uint256 TxId(const int n)
+{
+    return ArithToUint256(arith_uint256(n));
+}
+
+static std::vector<uint256> ListAssetTxs(CBlockTreeDB& db, const uint256& assetId, const std::string& strAddress, const uint8_t nTxClass, const int nMaxHeight, const CAssetTxCursor& cursor = CAssetTxCursor())
+{
+    std::vector<uint256> vTxId;
+    CAssetTxIterator it(db, assetId, strAddress, nTxClass, nMaxHeight);
+    for (it.Seek(cursor); it.Valid(); it.Next())
+        vTxId.push_back(it.GetTxId());
+    return vTxId;
+}
+
+BOOST_AUTO_TEST_CASE(assettx_height_key_order)
+{
+    // the height is big endian, so 256 sorts after 1 although its low byte is smaller
+    const uint256 assetId = TxId(7);
+    CDataStream ss1(SER_DISK, 0), ss256(SER_DISK, 0);
+    ss1 << CAssetTxHeight_IndexKey(assetId, 1, COutPoint(TxId(9), 0));
+    ss256 << CAssetTxHeight_IndexKey(assetId, 256, COutPoint(TxId(1), 0));
+    BOOST_CHECK(ss1.str() < ss256.str());
+
+    CAssetTx_IndexKey key(assetId, "Xaddress", LOCKED_TXOUT, COutPoint(TxId(3), 2));
+    CDataStream ss(SER_DISK, 0);
+    ss << CAddressAssetTxHeight_IndexKey(key, 300000);
+    BOOST_CHECK_EQUAL(ss.size(), CAddressAssetTxHeight_IndexKey(key, 300000).GetSerializeSize(SER_DISK, 0));
+
+    CAddressAssetTxHeight_IndexKey read;
+    ss >> read;
+    BOOST_CHECK(read.assetId == assetId);
+    BOOST_CHECK_EQUAL(read.strAddress, "Xaddress");
+    BOOST_CHECK_EQUAL(read.nHeight, 300000);
+    BOOST_CHECK(read.out == key.out);
+    BOOST_CHECK_EQUAL(read.nTxClass, LOCKED_TXOUT);
+}
+
+BOOST_AUTO_TEST_CASE(assettx_iterator)
+{
+    CBlockTreeDB db(1 << 20, true);
+    const uint256 assetId = TxId(1000);
+    const uint256 otherAssetId = TxId(2000);
+
+    // written out of height order, tx 5 pays two addresses and tx 3 has a locked output
+    CSideIndexWriteSet writeSet;
+    writeSet.assetTx_index.push_back(std::make_pair(CAssetTx_IndexKey(assetId, "Xb", TRANSFER_TXOUT, COutPoint(TxId(5), 0)), 30));
+    writeSet.assetTx_index.push_back(std::make_pair(CAssetTx_IndexKey(assetId, "Xa", TRANSFER_TXOUT, COutPoint(TxId(5), 1)), 30));
+    writeSet.assetTx_index.push_back(std::make_pair(CAssetTx_IndexKey(assetId, "Xa", TRANSFER_TXOUT, COutPoint(TxId(5), -1)), 30));
+    writeSet.assetTx_index.push_back(std::make_pair(CAssetTx_IndexKey(assetId, "Xa", ISSUE_TXOUT, COutPoint(TxId(9), 0)), 10));
+    writeSet.assetTx_index.push_back(std::make_pair(CAssetTx_IndexKey(assetId, "Xb", LOCKED_TXOUT, COutPoint(TxId(3), 0)), 20));
+    writeSet.assetTx_index.push_back(std::make_pair(CAssetTx_IndexKey(assetId, "Xa", TRANSFER_TXOUT, COutPoint(TxId(4), 0)), 20));
+    writeSet.assetTx_index.push_back(std::make_pair(CAssetTx_IndexKey(assetId, "Xa", TRANSFER_TXOUT, COutPoint(TxId(1), 0)), 40));
+    writeSet.assetTx_index.push_back(std::make_pair(CAssetTx_IndexKey(otherAssetId, "Xa", TRANSFER_TXOUT, COutPoint(TxId(8), 0)), 15));
+    BOOST_CHECK(db.WriteSideIndexes(writeSet, true));
+
+    std::vector<uint256> vAll;
+    vAll.push_back(TxId(9));
+    vAll.push_back(TxId(3));
+    vAll.push_back(TxId(4));
+    vAll.push_back(TxId(5));
+    vAll.push_back(TxId(1));
+    std::vector<uint256> vTxId = ListAssetTxs(db, assetId, "", ALL_TXOUT, 100);
+    BOOST_CHECK(vTxId == vAll);
+
+    // unconfirmed heights are left out
+    vTxId = ListAssetTxs(db, assetId, "", ALL_TXOUT, 30);
+    BOOST_CHECK(vTxId == std::vector<uint256>(vAll.begin(), vAll.begin() + 4));
+
+    vTxId = ListAssetTxs(db, assetId, "", UNLOCKED_TXOUT, 100);
+    BOOST_CHECK_EQUAL(vTxId.size(), 4U);
+    BOOST_CHECK(vTxId[1] == TxId(4));
+
+    vTxId = ListAssetTxs(db, assetId, "", LOCKED_TXOUT, 100);
+    BOOST_CHECK_EQUAL(vTxId.size(), 1U);
+    BOOST_CHECK(vTxId[0] == TxId(3));
+
+    vTxId = ListAssetTxs(db, assetId, "Xb", ALL_TXOUT, 100);
+    BOOST_CHECK_EQUAL(vTxId.size(), 2U);
+    BOOST_CHECK(vTxId[0] == TxId(3));
+    BOOST_CHECK(vTxId[1] == TxId(5));
+
+    // a cursor continues after the transaction it names, whichever output comes first
+    for (size_t i = 0; i < vAll.size(); i++)
+    {
+        CAssetTxIterator it(db, assetId, "", ALL_TXOUT, 100);
+        it.Seek(CAssetTxCursor());
+        for (size_t j = 0; j < i; j++)
+            it.Next();
+        BOOST_CHECK(it.Valid());
+        vTxId = ListAssetTxs(db, assetId, "", ALL_TXOUT, 100, CAssetTxCursor(it.GetHeight(), it.GetTxId()));
+        BOOST_CHECK(vTxId == std::vector<uint256>(vAll.begin() + i + 1, vAll.end()));
+    }
+
+    // disconnecting erases the height keys again
+    BOOST_CHECK(db.WriteSideIndexes(writeSet, false));
+    BOOST_CHECK(ListAssetTxs(db, assetId, "", ALL_TXOUT, 100).empty());
+    BOOST_CHECK(ListAssetTxs(db, otherAssetId, "Xa", ALL_TXOUT, 100).empty());
+}
+
+static CSideIndexWriteSet SupplyWriteSet(const uint256& assetId, const CAssetSupply_IndexValue& supply)
+{
+    CSideIndexWriteSet writeSet;
+    writeSet.assetSupply_index[assetId] = supply;
+    return writeSet;
+}
+
+static bool SameSupply(const CAssetSupply_IndexValue& a, const CAssetSupply_IndexValue& b)
+{
+    return a.nAddAmount == b.nAddAmount && a.nDestoryAmount == b.nDestoryAmount && a.nPutCandyAmount == b.nPutCandyAmount;
+}
+
+BOOST_AUTO_TEST_CASE(addresstx_index)
+{
+    CBlockTreeDB db(1 << 20, true);
+    const int nChainHeight = g_nChainHeight;
+    g_nChainHeight = 20;
+
+    // Xa has outputs of apps 100 and 200, app 300 is above the chain height, Xb has app 100
+    CSideIndexWriteSet writeSet;
+    writeSet.appTx_index.push_back(std::make_pair(CAppTx_IndexKey(TxId(100), "Xa", CREATE_EXTENDDATA_TXOUT, COutPoint(TxId(1), 0)), 10));
+    writeSet.appTx_index.push_back(std::make_pair(CAppTx_IndexKey(TxId(100), "Xa", CREATE_EXTENDDATA_TXOUT, COutPoint(TxId(2), 0)), 11));
+    writeSet.appTx_index.push_back(std::make_pair(CAppTx_IndexKey(TxId(200), "Xa", REGISTER_TXOUT, COutPoint(TxId(3), 0)), 12));
+    writeSet.appTx_index.push_back(std::make_pair(CAppTx_IndexKey(TxId(300), "Xa", REGISTER_TXOUT, COutPoint(TxId(4), 0)), 30));
+    writeSet.appTx_index.push_back(std::make_pair(CAppTx_IndexKey(TxId(100), "Xb", CREATE_EXTENDDATA_TXOUT, COutPoint(TxId(1), 1)), 10));
+    writeSet.assetTx_index.push_back(std::make_pair(CAssetTx_IndexKey(TxId(1000), "Xa", TRANSFER_TXOUT, COutPoint(TxId(5), 0)), 10));
+    writeSet.assetTx_index.push_back(std::make_pair(CAssetTx_IndexKey(TxId(1000), "Xa", LOCKED_TXOUT, COutPoint(TxId(5), 1)), 10));
+    writeSet.assetTx_index.push_back(std::make_pair(CAssetTx_IndexKey(TxId(2000), "Xb", TRANSFER_TXOUT, COutPoint(TxId(6), 0)), 10));
+    BOOST_CHECK(db.WriteSideIndexes(writeSet, true));
+
+    // each id once, the address must match exactly
+    std::vector<uint256> vId;
+    BOOST_CHECK(db.Read_AppList_Index("Xa", vId));
+    BOOST_REQUIRE_EQUAL(vId.size(), 2U);
+    BOOST_CHECK(vId[0] == TxId(100));
+    BOOST_CHECK(vId[1] == TxId(200));
+    vId.clear();
+    BOOST_CHECK(db.Read_AppList_Index("Xb", vId));
+    BOOST_CHECK_EQUAL(vId.size(), 1U);
+    vId.clear();
+    BOOST_CHECK(!db.Read_AppList_Index("X", vId));
+    BOOST_CHECK(db.Read_AssetList_Index("Xa", vId));
+    BOOST_REQUIRE_EQUAL(vId.size(), 1U);
+    BOOST_CHECK(vId[0] == TxId(1000));
+
+    // disconnecting erases the address rows with the primary ones
+    BOOST_CHECK(db.WriteSideIndexes(writeSet, false));
+    vId.clear();
+    BOOST_CHECK(!db.Read_AppList_Index("Xa", vId));
+    BOOST_CHECK(!db.Read_AssetList_Index("Xa", vId));
+
+    // a database with only the primary rows gets the address rows from the upgrade
+    db.Write(std::make_pair(std::string("apptx"), writeSet.appTx_index[0].first), writeSet.appTx_index[0].second);
+    db.Write(std::make_pair(std::string("assettx"), writeSet.assetTx_index[2].first), writeSet.assetTx_index[2].second);
+    BOOST_CHECK(!db.Read_AppList_Index("Xa", vId));
+    BOOST_CHECK(db.Upgrade_AddressTx_Index());
+    bool fUpgraded = false;
+    BOOST_CHECK(db.ReadFlag("addresstxindex", fUpgraded) && fUpgraded);
+    BOOST_CHECK(db.Read_AppList_Index("Xa", vId));
+    BOOST_REQUIRE_EQUAL(vId.size(), 1U);
+    BOOST_CHECK(vId[0] == TxId(100));
+    vId.clear();
+    BOOST_CHECK(db.Read_AssetList_Index("Xb", vId));
+    BOOST_REQUIRE_EQUAL(vId.size(), 1U);
+    BOOST_CHECK(vId[0] == TxId(2000));
+
+    g_nChainHeight = nChainHeight;
+}
+
+BOOST_AUTO_TEST_CASE(assetsupply_connect_disconnect)
+{
+    CBlockTreeDB db(1 << 20, true);
+    const uint256 assetId = TxId(1000);
+    const uint256 otherAssetId = TxId(2000);
+
+    // block 1 adds and puts candy, block 2 adds and destroys, block 3 only touches another asset
+    std::vector<CSideIndexWriteSet> vBlock;
+    vBlock.push_back(SupplyWriteSet(assetId, CAssetSupply_IndexValue(100 * COIN, 0, 10 * COIN)));
+    vBlock.push_back(SupplyWriteSet(assetId, CAssetSupply_IndexValue(50 * COIN, 30 * COIN, 0)));
+    vBlock.push_back(SupplyWriteSet(otherAssetId, CAssetSupply_IndexValue(7 * COIN, 0, 0)));
+
+    std::vector<CAssetSupply_IndexValue> vSupply(1);
+    for (size_t i = 0; i < vBlock.size(); i++)
+    {
+        BOOST_CHECK(db.WriteSideIndexes(vBlock[i], true));
+        CAssetSupply_IndexValue supply;
+        db.Read_AssetSupply_Index(assetId, supply);
+        vSupply.push_back(supply);
+    }
+    BOOST_CHECK(SameSupply(vSupply[3], CAssetSupply_IndexValue(150 * COIN, 30 * COIN, 10 * COIN)));
+
+    // disconnecting in reverse order returns every earlier value, connecting again the later ones
+    for (int i = vBlock.size() - 1; i >= 0; i--)
+    {
+        BOOST_CHECK(db.WriteSideIndexes(vBlock[i], false));
+        CAssetSupply_IndexValue supply;
+        db.Read_AssetSupply_Index(assetId, supply);
+        BOOST_CHECK(SameSupply(supply, vSupply[i]));
+    }
+
+    // nothing is left behind once all blocks are disconnected
+    CAssetSupply_IndexValue supply;
+    BOOST_CHECK(!db.Read_AssetSupply_Index(assetId, supply));
+    BOOST_CHECK(!db.Read_AssetSupply_Index(otherAssetId, supply));
+
+    for (size_t i = 0; i < vBlock.size(); i++)
+    {
+        BOOST_CHECK(db.WriteSideIndexes(vBlock[i], true));
+        db.Read_AssetSupply_Index(assetId, supply);
+        BOOST_CHECK(SameSupply(supply, vSupply[i + 1]));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(assetsupply_mempool_overlay)
+{
+    CTxMemPool pool(CFeeRate(0));
+    TestMemPoolEntryHelper entry;
+    CCoinsView coinsDummy;
+    CCoinsViewCache view(&coinsDummy);
+    const uint256 assetId = TxId(1000);
+
+    CScript scriptPubKey = CScript() << OP_TRUE;
+    CAppHeader addHeader(g_nAppHeaderVersion, uint256S(g_strSafeAssetId), ADD_ASSET_CMD);
+    CAppHeader candyHeader(g_nAppHeaderVersion, uint256S(g_strSafeAssetId), PUT_CANDY_CMD);
+    CAppHeader destoryHeader(g_nAppHeaderVersion, uint256S(g_strSafeAssetId), DESTORY_ASSET_CMD);
+
+    // the first transaction adds and puts candy, the second one spends it and destroys
+    CMutableTransaction txAdd;
+    txAdd.vin.resize(1);
+    txAdd.vin[0].prevout = COutPoint(TxId(1), 0);
+    txAdd.vout.push_back(CTxOut(100 * COIN, scriptPubKey));
+    txAdd.vout[0].vReserve = FillCommonData(addHeader, CCommonData(assetId, 100 * COIN, "add"));
+    txAdd.vout.push_back(CTxOut(10 * COIN, scriptPubKey));
+    txAdd.vout[1].vReserve = FillPutCandyData(candyHeader, CPutCandyData(assetId, 10 * COIN, 1, "candy"));
+
+    CMutableTransaction txDestory;
+    txDestory.vin.resize(1);
+    txDestory.vin[0].prevout = COutPoint(txAdd.GetHash(), 0);
+    txDestory.vout.push_back(CTxOut(30 * COIN, scriptPubKey));
+    txDestory.vout[0].vReserve = FillCommonData(destoryHeader, CCommonData(assetId, 30 * COIN, "destory"));
+
+    CAssetSupply_IndexValue supply;
+    BOOST_CHECK(!pool.get_AssetSupply_Index(assetId, supply));
+
+    pool.addUnchecked(txAdd.GetHash(), entry.FromTx(txAdd), view);
+    pool.add_AssetSupply_Index(entry.FromTx(txAdd), view);
+    BOOST_CHECK(pool.get_AssetSupply_Index(assetId, supply));
+    BOOST_CHECK(SameSupply(supply, CAssetSupply_IndexValue(100 * COIN, 0, 10 * COIN)));
+
+    pool.addUnchecked(txDestory.GetHash(), entry.FromTx(txDestory), view);
+    pool.add_AssetSupply_Index(entry.FromTx(txDestory), view);
+    BOOST_CHECK(pool.get_AssetSupply_Index(assetId, supply));
+    BOOST_CHECK(SameSupply(supply, CAssetSupply_IndexValue(100 * COIN, 30 * COIN, 10 * COIN)));
+
+    // removing the child takes back only its own change
+    std::list<CTransaction> removed;
+    pool.remove(txDestory, removed, false);
+    BOOST_CHECK_EQUAL(removed.size(), 1U);
+    BOOST_CHECK(pool.get_AssetSupply_Index(assetId, supply));
+    BOOST_CHECK(SameSupply(supply, CAssetSupply_IndexValue(100 * COIN, 0, 10 * COIN)));
+
+    // removing both leaves the overlay empty
+    pool.add_AssetSupply_Index(entry.FromTx(txDestory), view);
+    pool.addUnchecked(txDestory.GetHash(), entry.FromTx(txDestory), view);
+    removed.clear();
+    pool.remove(txAdd, removed, true);
+    BOOST_CHECK_EQUAL(removed.size(), 2U);
+    BOOST_CHECK(!pool.get_AssetSupply_Index(assetId, supply));
+}
+
+BOOST_AUTO_TEST_CASE(getcandycount_batch_and_cache)
+{
+    CBlockTreeDB db(1 << 20, true);
+    const uint256 assetId = TxId(1000);
+    const COutPoint candyOut(TxId(1), 0);
+    const COutPoint otherCandyOut(TxId(2), 0);
+
+    // a miss is cached too, the write must drop it
+    CGetCandyCount_IndexValue value;
+    BOOST_CHECK(!db.Read_GetCandyCount_Index(assetId, candyOut, value));
+    BOOST_CHECK(!db.Is_Exists_GetCandyCount_Key(assetId, candyOut));
+
+    CSideIndexWriteSet writeSet;
+    writeSet.getCandyCount_index[CGetCandyCount_IndexKey(assetId, candyOut)] = CGetCandyCount_IndexValue(30 * COIN);
+    writeSet.getCandyCount_index[CGetCandyCount_IndexKey(assetId, otherCandyOut)] = CGetCandyCount_IndexValue(5 * COIN);
+    BOOST_CHECK(db.WriteSideIndexes(writeSet, true));
+    BOOST_CHECK(db.Read_GetCandyCount_Index(assetId, candyOut, value));
+    BOOST_CHECK_EQUAL(value.nGetCandyCount, 30 * COIN);
+    BOOST_CHECK(db.Is_Exists_GetCandyCount_Key(assetId, otherCandyOut));
+
+    // the claims of the next block add to the cached totals
+    CSideIndexWriteSet writeSetNext;
+    writeSetNext.getCandyCount_index[CGetCandyCount_IndexKey(assetId, candyOut)] = CGetCandyCount_IndexValue(20 * COIN);
+    BOOST_CHECK(db.WriteSideIndexes(writeSetNext, true));
+    BOOST_CHECK(db.Read_GetCandyCount_Index(assetId, candyOut, value));
+    BOOST_CHECK_EQUAL(value.nGetCandyCount, 50 * COIN);
+
+    // disconnecting subtracts them again, a total of 0 is erased
+    BOOST_CHECK(db.WriteSideIndexes(writeSetNext, false));
+    BOOST_CHECK(db.Read_GetCandyCount_Index(assetId, candyOut, value));
+    BOOST_CHECK_EQUAL(value.nGetCandyCount, 30 * COIN);
+    BOOST_CHECK(db.WriteSideIndexes(writeSet, false));
+    BOOST_CHECK(!db.Is_Exists_GetCandyCount_Key(assetId, candyOut));
+    BOOST_CHECK(!db.Is_Exists_GetCandyCount_Key(assetId, otherCandyOut));
+}
+
+static bool SameBalance(CBlockTreeDB& db, const CAssetBalance_IndexKey& key, const CAssetBalance_IndexValue& expected)
+{
+    CAssetBalance_IndexValue balance;
+    if (!db.Read_AssetBalance_Index(key, balance))
+        return expected.IsNull();
+    return balance.nReceived == expected.nReceived && balance.nSent == expected.nSent && balance.mapLocked == expected.mapLocked;
+}
+
+static CTxOut AssetTxOut(const uint256& assetId, const CAmount nValue, const CScript& scriptPubKey, const int64_t nUnlockedHeight = 0)
+{
+    CTxOut txout(nValue, scriptPubKey, nUnlockedHeight);
+    CAppHeader header(g_nAppHeaderVersion, uint256S(g_strSafeAssetId), TRANSFER_ASSET_CMD);
+    txout.vReserve = FillCommonData(header, CCommonData(assetId, nValue, "transfer"));
+    return txout;
+}
+
+BOOST_AUTO_TEST_CASE(assetbalance_connect_disconnect)
+{
+    CBlockTreeDB db(1 << 20, true);
+    const uint256 assetId = TxId(1000);
+
+    std::vector<CScript> vScript;
+    std::vector<CAssetBalance_IndexKey> vKey;
+    for (int i = 0; i < 3; i++)
+    {
+        CKey key;
+        key.MakeNewKey(true);
+        vScript.push_back(GetScriptForDestination(key.GetPubKey().GetID()));
+        vKey.push_back(CAssetBalance_IndexKey(CBitcoinAddress(key.GetPubKey().GetID()).ToString(), assetId));
+    }
+
+    // address 0 holds 100 of the asset before the block
+    CMutableTransaction txPrev;
+    txPrev.vin.resize(1);
+    txPrev.vin[0].prevout = COutPoint(TxId(1), 0);
+    txPrev.vout.push_back(AssetTxOut(assetId, 100, vScript[0]));
+
+    CCoinsView coinsDummy;
+    CCoinsViewCache view(&coinsDummy);
+    view.ModifyCoins(txPrev.GetHash())->FromTx(txPrev, 1);
+
+    CSideIndexWriteSet prevWriteSet;
+    AddAssetBalanceDelta(txPrev, view, prevWriteSet.assetBalance_index);
+    BOOST_CHECK(db.WriteSideIndexes(prevWriteSet, true));
+
+    // the block spends and creates the same asset: 60 to address 1 and 40 back to address 0,
+    // then address 1 passes the 60 on to address 2 in a locked output
+    CMutableTransaction tx1;
+    tx1.vin.resize(1);
+    tx1.vin[0].prevout = COutPoint(txPrev.GetHash(), 0);
+    tx1.vin[0].scriptSig = CScript() << OP_TRUE;
+    tx1.vout.push_back(AssetTxOut(assetId, 60, vScript[1]));
+    tx1.vout.push_back(AssetTxOut(assetId, 40, vScript[0]));
+
+    CMutableTransaction tx2;
+    tx2.vin.resize(1);
+    tx2.vin[0].prevout = COutPoint(tx1.GetHash(), 0);
+    tx2.vin[0].scriptSig = CScript() << OP_TRUE;
+    tx2.vout.push_back(AssetTxOut(assetId, 60, vScript[2], 500));
+
+    std::vector<CTransaction> vtx;
+    vtx.push_back(tx1);
+    vtx.push_back(tx2);
+
+    std::vector<CAssetBalance_IndexValue> vBefore(vKey.size());
+    for (size_t i = 0; i < vKey.size(); i++)
+        db.Read_AssetBalance_Index(vKey[i], vBefore[i]);
+
+    // ConnectBlock() adds up the delta before UpdateCoins() spends the inputs
+    CSideIndexWriteSet writeSet;
+    std::vector<std::vector<CTxOut> > vSpent(vtx.size());
+    for (size_t i = 0; i < vtx.size(); i++)
+    {
+        AddAssetBalanceDelta(vtx[i], view, writeSet.assetBalance_index);
+        BOOST_FOREACH(const CTxIn& txin, vtx[i].vin)
+            vSpent[i].push_back(view.GetOutputFor(txin));
+        CValidationState state;
+        UpdateCoins(vtx[i], state, view, 2);
+    }
+    BOOST_CHECK(db.WriteSideIndexes(writeSet, true));
+
+    std::vector<CAssetBalance_IndexValue> vAfter(vKey.size());
+    vAfter[0].nReceived = CAssetAmount(140);
+    vAfter[0].nSent = CAssetAmount(100);
+    vAfter[1].nReceived = CAssetAmount(60);
+    vAfter[1].nSent = CAssetAmount(60);
+    vAfter[2].nReceived = CAssetAmount(60);
+    vAfter[2].mapLocked[500] = CAssetAmount(60);
+    for (size_t i = 0; i < vKey.size(); i++)
+        BOOST_CHECK(SameBalance(db, vKey[i], vAfter[i]));
+
+    // DisconnectBlock() adds up the delta in reverse order after restoring the inputs
+    CSideIndexWriteSet undoWriteSet;
+    for (size_t i = vtx.size(); i-- > 0;)
+    {
+        view.ModifyCoins(vtx[i].GetHash())->Clear();
+        for (size_t j = 0; j < vtx[i].vin.size(); j++)
+        {
+            CCoinsModifier coins = view.ModifyCoins(vtx[i].vin[j].prevout.hash);
+            if (coins->vout.size() <= vtx[i].vin[j].prevout.n)
+                coins->vout.resize(vtx[i].vin[j].prevout.n + 1);
+            coins->vout[vtx[i].vin[j].prevout.n] = vSpent[i][j];
+        }
+        AddAssetBalanceDelta(vtx[i], view, undoWriteSet.assetBalance_index);
+    }
+    BOOST_CHECK(db.WriteSideIndexes(undoWriteSet, false));
+
+    // every balance is back, the addresses the block created are gone
+    for (size_t i = 0; i < vKey.size(); i++)
+        BOOST_CHECK(SameBalance(db, vKey[i], vBefore[i]));
+    CAssetBalance_IndexValue balance;
+    BOOST_CHECK(!db.Read_AssetBalance_Index(vKey[1], balance));
+    BOOST_CHECK(!db.Read_AssetBalance_Index(vKey[2], balance));
+
+    // and reconnecting gives the same balances as the first time
+    BOOST_CHECK(db.WriteSideIndexes(writeSet, true));
+    for (size_t i = 0; i < vKey.size(); i++)
+        BOOST_CHECK(SameBalance(db, vKey[i], vAfter[i]));
+}
+
+BOOST_AUTO_TEST_CASE(assetbalance_out_of_range)
+{
+    CBlockTreeDB db(1 << 20, true);
+    const CAssetBalance_IndexKey key("address", TxId(1000));
+
+    CAssetBalance_IndexValue delta;
+    delta.nReceived = CAssetAmount(100 * COIN);
+    delta.mapLocked[500] = CAssetAmount(40 * COIN);
+    CSideIndexWriteSet writeSet;
+    writeSet.assetBalance_index[key] = delta;
+    BOOST_CHECK(db.WriteSideIndexes(writeSet, true));
+
+    // undoing more than was received fails and leaves the stored balance alone
+    CAssetBalance_IndexValue undo = delta;
+    undo.nReceived = CAssetAmount(101 * COIN);
+    CAssetBalance_IndexValue balance = delta;
+    BOOST_CHECK(!balance.Sub(undo));
+    BOOST_CHECK(SameBalance(db, key, balance));
+    writeSet.assetBalance_index[key] = undo;
+    BOOST_CHECK(!db.WriteSideIndexes(writeSet, false));
+    BOOST_CHECK(SameBalance(db, key, delta));
+
+    // so does a locked amount that was never received at that height
+    undo = delta;
+    undo.mapLocked.clear();
+    undo.mapLocked[600] = CAssetAmount(40 * COIN);
+    writeSet.assetBalance_index[key] = undo;
+    BOOST_CHECK(!db.WriteSideIndexes(writeSet, false));
+    BOOST_CHECK(SameBalance(db, key, delta));
+
+    // the matching undo erases the balance
+    writeSet.assetBalance_index[key] = delta;
+    BOOST_CHECK(db.WriteSideIndexes(writeSet, false));
+    BOOST_CHECK(!db.Read_AssetBalance_Index(key, balance));
+}
+
+BOOST_AUTO_TEST_CASE(sideindexes_one_batch)
+{
+    CBlockTreeDB db(1 << 20, true);
+    const int nChainHeight = g_nChainHeight;
+    g_nChainHeight = 20;
+    const uint256 assetId = TxId(1000);
+
+    // the cached miss must not outlive the block that writes the asset
+    CAssetId_AssetInfo_IndexValue assetInfo;
+    BOOST_CHECK(!db.Read_AssetId_AssetInfo_Index(assetId, assetInfo));
+
+    CSideIndexWriteSet writeSet;
+    writeSet.assetId_assetInfo_index.push_back(std::make_pair(assetId, CAssetId_AssetInfo_IndexValue("Xadmin", CAssetData(), 10)));
+    writeSet.assetName_assetId_index.push_back(std::make_pair(std::string("Gold"), CName_Id_IndexValue(assetId, 10)));
+    writeSet.assetTx_index.push_back(std::make_pair(CAssetTx_IndexKey(assetId, "Xadmin", ISSUE_TXOUT, COutPoint(TxId(1), 0)), 10));
+    writeSet.assetSupply_index[assetId] = CAssetSupply_IndexValue(100 * COIN, 0, 0);
+    writeSet.strPubKeyCollateralAddress = "Xpayee";
+    writeSet.masternodePayment_IndexValue = CMasternodePayee_IndexValue(10, 1000, 1);
+    writeSet.nLocalStartSavePayeeHeight = 5;
+    BOOST_CHECK(db.WriteSideIndexes(writeSet, true));
+
+    CName_Id_IndexValue name;
+    CAssetSupply_IndexValue supply;
+    std::map<std::string, CMasternodePayee_IndexValue> mapPayee;
+    int nStartHeight = 0;
+    BOOST_CHECK(db.Read_AssetId_AssetInfo_Index(assetId, assetInfo));
+    BOOST_CHECK_EQUAL(assetInfo.strAdminAddress, "Xadmin");
+    BOOST_CHECK(db.Read_AssetName_AssetId_Index("gold", name));
+    BOOST_CHECK(name.id == assetId);
+    BOOST_CHECK(db.Read_AssetSupply_Index(assetId, supply));
+    BOOST_CHECK(SameSupply(supply, CAssetSupply_IndexValue(100 * COIN, 0, 0)));
+    BOOST_CHECK(db.Read_MasternodePayee_Index(mapPayee));
+    BOOST_REQUIRE_EQUAL(mapPayee.count("Xpayee"), 1U);
+    BOOST_CHECK_EQUAL(mapPayee["Xpayee"].nPayeeTimes, 1);
+    BOOST_CHECK(db.Read_LocalStartSavePayeeHeight_Index(nStartHeight));
+    BOOST_CHECK_EQUAL(nStartHeight, 5);
+
+    // a disconnect that fails on one index leaves all of them as they were
+    CSideIndexWriteSet writeSetUndo = writeSet;
+    writeSetUndo.masternodePayment_IndexValue.nPayeeTimes = 0;
+    writeSetUndo.nLocalStartSavePayeeHeight = 0;
+    CSideIndexWriteSet writeSetBad = writeSetUndo;
+    writeSetBad.assetBalance_index[CAssetBalance_IndexKey("Xadmin", assetId)].nReceived = CAssetAmount(1 * COIN);
+    BOOST_CHECK(!db.WriteSideIndexes(writeSetBad, false));
+    BOOST_CHECK(db.Read_AssetId_AssetInfo_Index(assetId, assetInfo));
+    BOOST_CHECK(db.Read_AssetName_AssetId_Index("Gold", name));
+    BOOST_CHECK(db.Read_AssetSupply_Index(assetId, supply));
+    BOOST_CHECK(SameSupply(supply, CAssetSupply_IndexValue(100 * COIN, 0, 0)));
+    mapPayee.clear();
+    BOOST_CHECK(db.Read_MasternodePayee_Index(mapPayee));
+    BOOST_CHECK_EQUAL(mapPayee.count("Xpayee"), 1U);
+    std::vector<COutPoint> vOut;
+    BOOST_CHECK(db.Read_AssetTx_Index(assetId, ALL_TXOUT, vOut));
+
+    // the matching disconnect erases them all, the payee once its count is 0
+    BOOST_CHECK(db.WriteSideIndexes(writeSetUndo, false));
+    BOOST_CHECK(!db.Read_AssetId_AssetInfo_Index(assetId, assetInfo));
+    BOOST_CHECK(!db.Read_AssetName_AssetId_Index("Gold", name));
+    BOOST_CHECK(!db.Read_AssetSupply_Index(assetId, supply));
+    mapPayee.clear();
+    db.Read_MasternodePayee_Index(mapPayee);
+    BOOST_CHECK_EQUAL(mapPayee.count("Xpayee"), 0U);
+    vOut.clear();
+    BOOST_CHECK(!db.Read_AssetTx_Index(assetId, ALL_TXOUT, vOut));
+
+    g_nChainHeight = nChainHeight;
+}
+
+static CTxOut AppTxOut(const uint256& appId, const CScript& scriptPubKey)
+{
+    CTxOut txout(0, scriptPubKey);
+    CAppHeader header(g_nAppHeaderVersion, appId, CREATE_EXTEND_TX_CMD);
+    txout.vReserve = FillExtendData(header, CExtendData(1, "extend"));
+    return txout;
+}
+
+BOOST_AUTO_TEST_CASE(mempool_apptx_assettx_views)
+{
+    CTxMemPool pool(CFeeRate(0));
+    TestMemPoolEntryHelper entry;
+    CCoinsView coinsDummy;
+    CCoinsViewCache view(&coinsDummy);
+
+    CKey keyA, keyB;
+    keyA.MakeNewKey(true);
+    keyB.MakeNewKey(true);
+    const CScript scriptA = GetScriptForDestination(keyA.GetPubKey().GetID());
+    const CScript scriptB = GetScriptForDestination(keyB.GetPubKey().GetID());
+    const std::string strA = CBitcoinAddress(keyA.GetPubKey().GetID()).ToString();
+    const std::string strB = CBitcoinAddress(keyB.GetPubKey().GetID()).ToString();
+
+    // app 100 pays A twice and B once over two transactions, app 200 pays A
+    const uint256 appId = TxId(100);
+    const uint256 otherAppId = TxId(200);
+    CMutableTransaction txApp1;
+    txApp1.vin.resize(1);
+    txApp1.vin[0].prevout = COutPoint(TxId(1), 0);
+    txApp1.vout.push_back(AppTxOut(appId, scriptA));
+    txApp1.vout.push_back(AppTxOut(otherAppId, scriptA));
+    txApp1.vout.push_back(AppTxOut(appId, scriptB));
+    CMutableTransaction txApp2;
+    txApp2.vin.resize(1);
+    txApp2.vin[0].prevout = COutPoint(TxId(2), 0);
+    txApp2.vout.push_back(AppTxOut(appId, scriptA));
+    pool.add_AppTx_Index(entry.FromTx(txApp1), view);
+    pool.add_AppTx_Index(entry.FromTx(txApp2), view);
+
+    std::vector<COutPoint> vOut;
+    BOOST_CHECK(pool.get_AppTx_Index(appId, vOut));
+    BOOST_CHECK_EQUAL(vOut.size(), 3U);
+    vOut.clear();
+    BOOST_CHECK(pool.get_AppTx_Index(appId, strA, vOut));
+    BOOST_CHECK_EQUAL(vOut.size(), 2U);
+
+    // the address view lists each app once
+    std::vector<uint256> vId;
+    BOOST_CHECK(pool.getAppList(strA, vId));
+    BOOST_REQUIRE_EQUAL(vId.size(), 2U);
+    BOOST_CHECK(vId[0] == appId);
+    BOOST_CHECK(vId[1] == otherAppId);
+    vId.clear();
+    BOOST_CHECK(pool.getAppList(strB, vId));
+    BOOST_CHECK_EQUAL(vId.size(), 1U);
+
+    // the txid view drops every output of a transaction
+    BOOST_CHECK(pool.remove_AppTx_Index(txApp1.GetHash()));
+    vOut.clear();
+    BOOST_CHECK(pool.get_AppTx_Index(appId, vOut));
+    BOOST_REQUIRE_EQUAL(vOut.size(), 1U);
+    BOOST_CHECK(vOut[0] == COutPoint(txApp2.GetHash(), 0));
+    vId.clear();
+    BOOST_CHECK(!pool.getAppList(strB, vId));
+
+    // asset 1000 goes to A unlocked and locked and to the candy address, asset 2000 to B
+    const uint256 assetId = TxId(1000);
+    const uint256 otherAssetId = TxId(2000);
+    CBitcoinAddress candyAddress(g_strPutCandyAddress);
+    BOOST_REQUIRE(candyAddress.IsValid());
+    CAppHeader candyHeader(g_nAppHeaderVersion, uint256S(g_strSafeAssetId), PUT_CANDY_CMD);
+    CMutableTransaction txAsset;
+    txAsset.vin.resize(1);
+    txAsset.vin[0].prevout = COutPoint(TxId(3), 0);
+    txAsset.vout.push_back(AssetTxOut(assetId, 10 * COIN, scriptA));
+    txAsset.vout.push_back(AssetTxOut(assetId, 20 * COIN, scriptA, 500));
+    txAsset.vout.push_back(AssetTxOut(otherAssetId, 30 * COIN, scriptB));
+    txAsset.vout.push_back(CTxOut(40 * COIN, GetScriptForDestination(candyAddress.Get())));
+    txAsset.vout[3].vReserve = FillPutCandyData(candyHeader, CPutCandyData(assetId, 40 * COIN, 1, "candy"));
+    pool.add_AssetTx_Index(entry.FromTx(txAsset), view);
+
+    vOut.clear();
+    BOOST_CHECK(pool.get_AssetTx_Index(assetId, ALL_TXOUT, vOut));
+    BOOST_CHECK_EQUAL(vOut.size(), 3U);
+    vOut.clear();
+    BOOST_CHECK(pool.get_AssetTx_Index(assetId, UNLOCKED_TXOUT, vOut));
+    BOOST_CHECK_EQUAL(vOut.size(), 2U);
+    vOut.clear();
+    BOOST_CHECK(pool.get_AssetTx_Index(assetId, LOCKED_TXOUT, vOut));
+    BOOST_REQUIRE_EQUAL(vOut.size(), 1U);
+    BOOST_CHECK(vOut[0] == COutPoint(txAsset.GetHash(), 1));
+    vOut.clear();
+    BOOST_CHECK(!pool.get_AssetTx_Index(otherAssetId, LOCKED_TXOUT, vOut));
+
+    vOut.clear();
+    BOOST_CHECK(pool.get_AssetTx_Index(assetId, strA, ALL_TXOUT, vOut));
+    BOOST_CHECK_EQUAL(vOut.size(), 2U);
+    vOut.clear();
+    BOOST_CHECK(pool.get_AssetTx_Index(assetId, strA, UNLOCKED_TXOUT, vOut));
+    BOOST_REQUIRE_EQUAL(vOut.size(), 1U);
+    BOOST_CHECK(vOut[0] == COutPoint(txAsset.GetHash(), 0));
+    vOut.clear();
+    BOOST_CHECK(pool.get_AssetTx_Index(assetId, strA, TRANSFER_TXOUT, vOut));
+    BOOST_CHECK_EQUAL(vOut.size(), 1U);
+
+    vId.clear();
+    BOOST_CHECK(pool.getAssetList(strA, vId));
+    BOOST_REQUIRE_EQUAL(vId.size(), 1U);
+    BOOST_CHECK(vId[0] == assetId);
+    BOOST_CHECK_EQUAL(pool.get_PutCandy_count(assetId), 1);
+    BOOST_CHECK_EQUAL(pool.get_PutCandy_count(otherAssetId), 0);
+
+    BOOST_CHECK(pool.remove_AssetTx_Index(txAsset.GetHash()));
+    vOut.clear();
+    BOOST_CHECK(!pool.get_AssetTx_Index(assetId, ALL_TXOUT, vOut));
+    vId.clear();
+    BOOST_CHECK(!pool.getAssetList(strB, vId));
+    BOOST_CHECK_EQUAL(pool.get_PutCandy_count(assetId), 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
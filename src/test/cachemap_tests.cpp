@@ -125,4 +125,30 @@ BOOST_AUTO_TEST_CASE(cachemap_test)
     BOOST_CHECK(Compare(mapTest1, mapTest4));
 }
 
+BOOST_AUTO_TEST_CASE(cachemap_touch_test)
+{
+    CacheMap<int,int> mapTest(3);
+    for(int i = 0; i < 3; ++i) {
+        mapTest.Insert(i, i);
+    }
+
+    // touching the oldest item keeps it when the next one is inserted
+    BOOST_CHECK(mapTest.Touch(0) == true);
+    BOOST_CHECK(mapTest.Touch(5) == false);
+    mapTest.Insert(3, 3);
+
+    BOOST_CHECK(mapTest.GetSize() == 3);
+    BOOST_CHECK(mapTest.HasKey(0) == true);
+    BOOST_CHECK(mapTest.HasKey(1) == false);
+    BOOST_CHECK(mapTest.HasKey(2) == true);
+    BOOST_CHECK(mapTest.HasKey(3) == true);
+
+    // the touched item is still found through the index
+    int nVal = 0;
+    BOOST_CHECK(mapTest.Get(0, nVal) == true);
+    BOOST_CHECK(nVal == 0);
+    BOOST_CHECK(mapTest.GetItemList().front().key == 3);
+    BOOST_CHECK(mapTest.GetItemList().back().key == 2);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
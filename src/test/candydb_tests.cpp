@@ -0,0 +1,545 @@
+// Copyright (c) 2018-2019 The Safe Core developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "candydb.h"
+#include "key.h"
+#include "main.h"
+#include "script/standard.h"
+#include "validation.h"
+
+#include "test/test_safe.h"
+
+#include <stdio.h>
+
+#include <boost/bind.hpp>
+#include <boost/filesystem.hpp>
+#include <boost/test/unit_test.hpp>
+
+static CCandyAddressKey MakeKey(unsigned char n)
+{
+    return CCandyAddressKey(1, uint160(std::vector<unsigned char>(20, n)));
+}
+
+static CChangeInfo MakeChangeInfo(int nHeight, int nLastCandyHeight, const std::map<CCandyAddressKey, CAmount>& mapAddressAmount)
+{
+    std::vector<CAddressAmount> vAddressAmount;
+    for(std::map<CCandyAddressKey, CAmount>::const_iterator it = mapAddressAmount.begin(); it != mapAddressAmount.end(); it++)
+        vAddressAmount.push_back(CAddressAmount(it->first, it->second));
+    return CChangeInfo(nHeight, nLastCandyHeight, COIN, false, vAddressAmount);
+}
+
+static void CheckAmounts(const CCandyBalanceDB& db, int nCandyHeight, const std::vector<CCandyAddressKey>& vAddress, const std::vector<CAmount>& vExpected)
+{
+    for(size_t i = 0; i < vAddress.size(); i++)
+    {
+        CAmount nAmount = -1;
+        BOOST_CHECK(db.GetAmountByHeight(nCandyHeight, vAddress[i], nAmount));
+        BOOST_CHECK_EQUAL(nAmount, vExpected[i]);
+    }
+}
+
+BOOST_FIXTURE_TEST_SUITE(candydb_tests, BasicTestingSetup)
+
+BOOST_AUTO_TEST_CASE(candydb_append_compact_reopen)
+{
+    boost::filesystem::path pathDir = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path();
+    boost::filesystem::create_directories(pathDir);
+
+    std::vector<CCandyAddressKey> vAddress;
+    for(unsigned char n = 1; n <= 4; n++)
+        vAddress.push_back(MakeKey(n));
+
+    std::vector<int> vChangeHeight;
+    vChangeHeight.push_back(10);
+    vChangeHeight.push_back(20);
+
+    {
+        CCandyBalanceDB db;
+        BOOST_CHECK(db.Open(pathDir, 0));
+        db.SetChangeHeights(vChangeHeight);
+
+        std::map<CCandyAddressKey, CAmount> mapBlock11;
+        mapBlock11[vAddress[0]] = 5 * COIN;
+        mapBlock11[vAddress[1]] = 3 * COIN;
+        BOOST_CHECK(db.AppendBlock(MakeChangeInfo(11, 10, mapBlock11)));
+        db.SetDetailHeight(11);
+
+        std::map<CCandyAddressKey, CAmount> mapBlock21;
+        mapBlock21[vAddress[0]] = 2 * COIN;
+        mapBlock21[vAddress[2]] = 7 * COIN;
+        BOOST_CHECK(db.AppendBlock(MakeChangeInfo(21, 20, mapBlock21)));
+        db.SetDetailHeight(21);
+
+        // blocks must be appended in height order
+        BOOST_CHECK(!db.AppendBlock(MakeChangeInfo(21, 20, mapBlock21)));
+        // only known candy heights can be looked up
+        CAmount nAmount = 0;
+        BOOST_CHECK(!db.GetAmountByHeight(15, vAddress[0], nAmount));
+
+        // nothing was compacted yet, 20.change does not exist on disk
+        CheckAmounts(db, 10, vAddress, std::vector<CAmount>(4, 0));
+        CAmount vAt20[] = {5 * COIN, 3 * COIN, 0, 0};
+        CheckAmounts(db, 20, vAddress, std::vector<CAmount>(vAt20, vAt20 + 4));
+
+        BOOST_CHECK(db.Compact());
+        BOOST_CHECK(boost::filesystem::exists(pathDir / "20.change"));
+        CheckAmounts(db, 10, vAddress, std::vector<CAmount>(4, 0));
+        CheckAmounts(db, 20, vAddress, std::vector<CAmount>(vAt20, vAt20 + 4));
+
+        std::map<CCandyAddressKey, CAmount> mapBlock22;
+        mapBlock22[vAddress[1]] = -3 * COIN;
+        mapBlock22[vAddress[3]] = 4 * COIN;
+        BOOST_CHECK(db.AppendBlock(MakeChangeInfo(22, 20, mapBlock22)));
+        db.SetDetailHeight(22);
+        db.Close();
+    }
+
+    // reopen replays the block appended after the compaction
+    {
+        CCandyBalanceDB db;
+        BOOST_CHECK(db.Open(pathDir, 22));
+        db.SetChangeHeights(vChangeHeight);
+
+        CAmount vAt20[] = {5 * COIN, 3 * COIN, 0, 0};
+        CheckAmounts(db, 20, vAddress, std::vector<CAmount>(vAt20, vAt20 + 4));
+        CheckAmounts(db, 10, vAddress, std::vector<CAmount>(4, 0));
+        db.Close();
+    }
+
+    // a block above detail.dat is dropped and has to be appended again
+    {
+        CCandyBalanceDB db;
+        BOOST_CHECK(db.Open(pathDir, 21));
+        db.SetChangeHeights(vChangeHeight);
+
+        CAmount vAt20[] = {5 * COIN, 3 * COIN, 0, 0};
+        CheckAmounts(db, 20, vAddress, std::vector<CAmount>(vAt20, vAt20 + 4));
+
+        std::map<CCandyAddressKey, CAmount> mapBlock22;
+        mapBlock22[vAddress[3]] = 4 * COIN;
+        BOOST_CHECK(db.AppendBlock(MakeChangeInfo(22, 20, mapBlock22)));
+        db.Close();
+    }
+
+    boost::filesystem::remove_all(pathDir);
+}
+
+static void CheckBatchAmounts(const CCandyBalanceDB& db, int nCandyHeight, const std::vector<CCandyAddressKey>& vAddress, const std::vector<CAmount>& vExpected)
+{
+    std::vector<CAmount> vAmount;
+    BOOST_CHECK(db.GetAmountsByHeight(nCandyHeight, vAddress, vAmount));
+    BOOST_CHECK(vAmount == vExpected);
+
+    CheckAmounts(db, nCandyHeight, vAddress, vExpected);
+}
+
+BOOST_AUTO_TEST_CASE(candydb_amounts_by_height)
+{
+    boost::filesystem::path pathDir = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path();
+    boost::filesystem::create_directories(pathDir);
+
+    // sorted, the second and the last key never had a balance
+    std::vector<CCandyAddressKey> vAddress;
+    for(unsigned char n = 1; n <= 5; n++)
+        vAddress.push_back(MakeKey(n));
+
+    std::vector<int> vChangeHeight;
+    vChangeHeight.push_back(10);
+    vChangeHeight.push_back(20);
+
+    CCandyBalanceDB db;
+    BOOST_CHECK(db.Open(pathDir, 0));
+    db.SetChangeHeights(vChangeHeight);
+
+    std::map<CCandyAddressKey, CAmount> mapBlock11;
+    mapBlock11[vAddress[0]] = 5 * COIN;
+    mapBlock11[vAddress[3]] = 3 * COIN;
+    BOOST_CHECK(db.AppendBlock(MakeChangeInfo(11, 10, mapBlock11)));
+    db.SetDetailHeight(11);
+
+    std::map<CCandyAddressKey, CAmount> mapBlock21;
+    mapBlock21[vAddress[0]] = 2 * COIN;
+    mapBlock21[vAddress[2]] = 7 * COIN;
+    BOOST_CHECK(db.AppendBlock(MakeChangeInfo(21, 20, mapBlock21)));
+    db.SetDetailHeight(21);
+
+    // the same balances from the pending deltas, from the snapshots, and from both
+    CAmount vAt20[] = {5 * COIN, 0, 0, 3 * COIN, 0};
+    CheckBatchAmounts(db, 20, vAddress, std::vector<CAmount>(vAt20, vAt20 + 5));
+    CheckBatchAmounts(db, 10, vAddress, std::vector<CAmount>(5, 0));
+
+    BOOST_CHECK(db.Compact());
+    CheckBatchAmounts(db, 20, vAddress, std::vector<CAmount>(vAt20, vAt20 + 5));
+
+    std::map<CCandyAddressKey, CAmount> mapBlock22;
+    mapBlock22[vAddress[3]] = -COIN;
+    mapBlock22[vAddress[4]] = COIN;
+    BOOST_CHECK(db.AppendBlock(MakeChangeInfo(22, 20, mapBlock22)));
+    db.SetDetailHeight(22);
+    CheckBatchAmounts(db, 20, vAddress, std::vector<CAmount>(vAt20, vAt20 + 5));
+
+    // a subset and an empty list
+    std::vector<CCandyAddressKey> vSubset;
+    vSubset.push_back(vAddress[3]);
+    vSubset.push_back(vAddress[4]);
+    CAmount vSubsetAt20[] = {3 * COIN, 0};
+    CheckBatchAmounts(db, 20, vSubset, std::vector<CAmount>(vSubsetAt20, vSubsetAt20 + 2));
+    std::vector<CAmount> vAmount;
+    BOOST_CHECK(db.GetAmountsByHeight(20, std::vector<CCandyAddressKey>(), vAmount));
+    BOOST_CHECK(vAmount.empty());
+
+    // only known candy heights can be looked up
+    BOOST_CHECK(!db.GetAmountsByHeight(15, vAddress, vAmount));
+
+    db.Close();
+    boost::filesystem::remove_all(pathDir);
+}
+
+BOOST_AUTO_TEST_CASE(candydb_merge_address_amounts)
+{
+    std::vector<CAddressAmount> vAddressAmount;
+    vAddressAmount.push_back(CAddressAmount(MakeKey(3), 4 * COIN));
+    vAddressAmount.push_back(CAddressAmount(MakeKey(1), 5 * COIN));
+    vAddressAmount.push_back(CAddressAmount(CCandyAddressKey(2, MakeKey(1).hash), COIN));
+    vAddressAmount.push_back(CAddressAmount(MakeKey(3), -4 * COIN));
+    vAddressAmount.push_back(CAddressAmount(MakeKey(1), -2 * COIN));
+    MergeAddressAmounts(vAddressAmount);
+
+    // the spent and received amount of key 3 cancel out, a script hash sorts after every pubkey hash
+    BOOST_CHECK_EQUAL(vAddressAmount.size(), 2U);
+    BOOST_CHECK(vAddressAmount[0].key == MakeKey(1));
+    BOOST_CHECK_EQUAL(vAddressAmount[0].nAmount, 3 * COIN);
+    BOOST_CHECK(vAddressAmount[1].key == CCandyAddressKey(2, MakeKey(1).hash));
+    BOOST_CHECK_EQUAL(vAddressAmount[1].nAmount, COIN);
+
+    CCandyAddressKey key;
+    BOOST_CHECK(key.SetString(MakeKey(7).ToString()) && key == MakeKey(7));
+    BOOST_CHECK(key.SetString(CCandyAddressKey(2, MakeKey(7).hash).ToString()) && key.nType == 2);
+    BOOST_CHECK(!key.SetString("XaAddress"));
+}
+
+/** Entry of the files written before the binary address keys */
+struct CTestLegacyAddressAmount
+{
+    char szAddress[36];
+    CAmount nAmount;
+};
+
+static void WriteLegacySnapshot(const boost::filesystem::path& path, const std::map<std::string, CAmount>& mapAmount)
+{
+    FILE* pFile = fopen(path.string().c_str(), "wb");
+    BOOST_REQUIRE(pFile);
+    for(std::map<std::string, CAmount>::const_iterator it = mapAmount.begin(); it != mapAmount.end(); it++)
+    {
+        CTestLegacyAddressAmount data;
+        memset(&data, 0, sizeof(data));
+        strncpy(data.szAddress, it->first.c_str(), sizeof(data.szAddress) - 1);
+        data.nAmount = it->second;
+        BOOST_CHECK_EQUAL(fwrite(&data, sizeof(data), 1, pFile), 1U);
+    }
+    fclose(pFile);
+}
+
+BOOST_AUTO_TEST_CASE(candydb_upgrade_legacy_files)
+{
+    boost::filesystem::path pathDir = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path();
+    boost::filesystem::create_directories(pathDir);
+
+    std::vector<CCandyAddressKey> vAddress;
+    for(unsigned char n = 1; n <= 3; n++)
+        vAddress.push_back(MakeKey(n));
+
+    std::map<std::string, CAmount> mapAll;
+    mapAll[vAddress[0].ToString()] = 5 * COIN;
+    mapAll[vAddress[1].ToString()] = 3 * COIN;
+    WriteLegacySnapshot(pathDir / "all.dat", mapAll);
+
+    std::map<std::string, CAmount> mapChange;
+    mapChange[vAddress[0].ToString()] = 2 * COIN;
+    WriteLegacySnapshot(pathDir / "20.change", mapChange);
+
+    // version 1 delta.log with block 22 of candy period 20
+    {
+        FILE* pFile = fopen((pathDir / "delta.log").string().c_str(), "wb");
+        BOOST_REQUIRE(pFile);
+        uint32_t vHeader[3] = {0x53414645, 1, 21};
+        uint32_t vRecord[4] = {0x53414645, 22, 20, 2};
+        CTestLegacyAddressAmount vData[2];
+        memset(vData, 0, sizeof(vData));
+        strncpy(vData[0].szAddress, vAddress[1].ToString().c_str(), sizeof(vData[0].szAddress) - 1);
+        vData[0].nAmount = -3 * COIN;
+        strncpy(vData[1].szAddress, vAddress[2].ToString().c_str(), sizeof(vData[1].szAddress) - 1);
+        vData[1].nAmount = 4 * COIN;
+        BOOST_CHECK_EQUAL(fwrite(vHeader, sizeof(vHeader), 1, pFile), 1U);
+        BOOST_CHECK_EQUAL(fwrite(vRecord, sizeof(vRecord), 1, pFile), 1U);
+        BOOST_CHECK_EQUAL(fwrite(vData, sizeof(vData), 1, pFile), 1U);
+        fclose(pFile);
+    }
+
+    std::vector<int> vChangeHeight;
+    vChangeHeight.push_back(10);
+    vChangeHeight.push_back(20);
+
+    CAmount vAt20[] = {3 * COIN, 3 * COIN, 0};
+    for(int i = 0; i < 2; i++)
+    {
+        CCandyBalanceDB db;
+        BOOST_CHECK(db.Open(pathDir, 22));
+        db.SetChangeHeights(vChangeHeight);
+        CheckBatchAmounts(db, 20, vAddress, std::vector<CAmount>(vAt20, vAt20 + 3));
+        CheckBatchAmounts(db, 10, vAddress, std::vector<CAmount>(vAt20, vAt20 + 3));
+        db.Close();
+
+        // an 8 byte header and 32 byte entries
+        BOOST_CHECK_EQUAL(boost::filesystem::file_size(pathDir / "all.dat"), 8U + 2 * 32U);
+        BOOST_CHECK_EQUAL(boost::filesystem::file_size(pathDir / "20.change"), 8U + 32U);
+        BOOST_CHECK_EQUAL(boost::filesystem::file_size(pathDir / "delta.log"), 12U + 16U + 2 * 32U);
+    }
+
+    boost::filesystem::remove_all(pathDir);
+}
+
+BOOST_AUTO_TEST_CASE(candydb_stale_commit_marker)
+{
+    boost::filesystem::path pathDir = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path();
+    boost::filesystem::create_directories(pathDir);
+
+    std::vector<CCandyAddressKey> vAddress;
+    vAddress.push_back(MakeKey(1));
+    vAddress.push_back(MakeKey(2));
+
+    std::vector<int> vChangeHeight(1, 20);
+
+    {
+        CCandyBalanceDB db;
+        BOOST_CHECK(db.Open(pathDir, 0));
+        db.SetChangeHeights(vChangeHeight);
+
+        std::map<CCandyAddressKey, CAmount> mapBlock21;
+        mapBlock21[vAddress[0]] = 5 * COIN;
+        BOOST_CHECK(db.AppendBlock(MakeChangeInfo(21, 20, mapBlock21)));
+        db.SetDetailHeight(21);
+        BOOST_CHECK(db.Compact());
+        BOOST_CHECK(!db.IsFailed());
+        db.Close();
+    }
+
+    // a marker the compaction failed to remove must not finish a later compaction
+    FILE* pFile = fopen((pathDir / "delta.log.commit").string().c_str(), "wb");
+    BOOST_REQUIRE(pFile);
+    fclose(pFile);
+
+    {
+        CCandyBalanceDB db;
+        BOOST_CHECK(db.Open(pathDir, 21));
+        BOOST_CHECK(!boost::filesystem::exists(pathDir / "delta.log.commit"));
+        db.SetChangeHeights(vChangeHeight);
+
+        std::map<CCandyAddressKey, CAmount> mapBlock22;
+        mapBlock22[vAddress[1]] = 2 * COIN;
+        BOOST_CHECK(db.AppendBlock(MakeChangeInfo(22, 20, mapBlock22)));
+        db.SetDetailHeight(22);
+        BOOST_CHECK(db.Compact());
+
+        CAmount vAt20[] = {0, 0};
+        CheckAmounts(db, 20, vAddress, std::vector<CAmount>(vAt20, vAt20 + 2));
+        BOOST_CHECK(!boost::filesystem::exists(pathDir / "delta.log.commit"));
+        BOOST_CHECK(!boost::filesystem::exists(pathDir / "delta.log.old"));
+        db.Close();
+    }
+
+    boost::filesystem::remove_all(pathDir);
+}
+
+BOOST_AUTO_TEST_CASE(candydb_log_behind_detail)
+{
+    boost::filesystem::path pathDir = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path();
+    boost::filesystem::create_directories(pathDir);
+
+    std::vector<CCandyAddressKey> vAddress;
+    vAddress.push_back(MakeKey(1));
+    vAddress.push_back(MakeKey(2));
+
+    std::vector<int> vChangeHeight(1, 20);
+
+    std::map<CCandyAddressKey, CAmount> mapBlock21;
+    mapBlock21[vAddress[0]] = 5 * COIN;
+    std::map<CCandyAddressKey, CAmount> mapBlock22;
+    mapBlock22[vAddress[1]] = 2 * COIN;
+
+    {
+        CCandyBalanceDB db;
+        BOOST_CHECK(db.Open(pathDir, 20));
+        BOOST_CHECK(db.AppendBlock(MakeChangeInfo(21, 20, mapBlock21)));
+        db.SetDetailHeight(21);
+        db.Close();
+    }
+
+    // detail.dat already has block 22, the log lost it
+    {
+        CCandyBalanceDB db;
+        BOOST_CHECK(db.Open(pathDir, 22));
+        BOOST_CHECK_EQUAL(db.GetLogHeight(), 21);
+        db.SetChangeHeights(vChangeHeight);
+
+        // the caller truncates detail.dat and appends block 22 again
+        db.SetDetailHeight(db.GetLogHeight());
+        BOOST_CHECK(db.AppendBlock(MakeChangeInfo(22, 20, mapBlock22)));
+        db.SetDetailHeight(22);
+        BOOST_CHECK_EQUAL(db.GetLogHeight(), 22);
+        BOOST_CHECK(db.Compact());
+        db.Close();
+    }
+
+    // the snapshots now cover block 22
+    {
+        CCandyBalanceDB db;
+        BOOST_CHECK(db.Open(pathDir, 22));
+        BOOST_CHECK_EQUAL(db.GetLogHeight(), 22);
+        db.Close();
+    }
+
+    boost::filesystem::remove_all(pathDir);
+}
+
+BOOST_AUTO_TEST_CASE(candydb_snapshot_ahead_of_detail)
+{
+    boost::filesystem::path pathDir = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path();
+    boost::filesystem::create_directories(pathDir);
+
+    std::vector<CCandyAddressKey> vAddress;
+    vAddress.push_back(MakeKey(1));
+    vAddress.push_back(MakeKey(2));
+
+    std::vector<int> vChangeHeight(1, 20);
+
+    std::map<CCandyAddressKey, CAmount> mapBlock21;
+    mapBlock21[vAddress[0]] = 5 * COIN;
+    std::map<CCandyAddressKey, CAmount> mapBlock22;
+    mapBlock22[vAddress[1]] = 2 * COIN;
+    std::map<CCandyAddressKey, CAmount> mapBlock23;
+    mapBlock23[vAddress[0]] = -1 * COIN;
+
+    {
+        CCandyBalanceDB db;
+        BOOST_CHECK(db.Open(pathDir, 20));
+        BOOST_CHECK(db.AppendBlock(MakeChangeInfo(21, 20, mapBlock21)));
+        db.SetDetailHeight(21);
+        BOOST_CHECK(db.AppendBlock(MakeChangeInfo(22, 20, mapBlock22)));
+        db.SetDetailHeight(22);
+        // the compaction flushes detail.dat before the snapshots cover block 22
+        BOOST_CHECK(db.Compact());
+        BOOST_CHECK(boost::filesystem::exists(pathDir / "detail.dat"));
+        db.Close();
+    }
+
+    // detail.dat lost blocks 21 and 22 anyway, the store opens at the snapshots
+    {
+        CCandyBalanceDB db;
+        BOOST_CHECK(db.Open(pathDir, 20));
+        BOOST_CHECK(!db.IsFailed());
+        BOOST_CHECK_EQUAL(db.GetLogHeight(), 22);
+        BOOST_CHECK_EQUAL(db.GetDetailHeight(), 20);
+        db.SetChangeHeights(vChangeHeight);
+
+        CAmount vAt20[] = {0, 0};
+        CheckAmounts(db, 20, vAddress, std::vector<CAmount>(vAt20, vAt20 + 2));
+
+        // the replayed blocks only go to detail.dat, they are not counted twice
+        BOOST_CHECK(db.AppendBlock(MakeChangeInfo(21, 20, mapBlock21)));
+        db.SetDetailHeight(21);
+        BOOST_CHECK(!db.NeedCompact());
+        BOOST_CHECK(db.AppendBlock(MakeChangeInfo(22, 20, mapBlock22)));
+        db.SetDetailHeight(22);
+        BOOST_CHECK_EQUAL(db.GetLogHeight(), 22);
+        CheckAmounts(db, 20, vAddress, std::vector<CAmount>(vAt20, vAt20 + 2));
+
+        BOOST_CHECK(db.AppendBlock(MakeChangeInfo(23, 20, mapBlock23)));
+        db.SetDetailHeight(23);
+        BOOST_CHECK_EQUAL(db.GetLogHeight(), 23);
+        db.AddChangeHeight(23);
+        CAmount vAt23[] = {4 * COIN, 2 * COIN};
+        CheckAmounts(db, 23, vAddress, std::vector<CAmount>(vAt23, vAt23 + 2));
+        BOOST_CHECK(db.Compact());
+        db.Close();
+    }
+
+    {
+        CCandyBalanceDB db;
+        BOOST_CHECK(db.Open(pathDir, 23));
+        BOOST_CHECK_EQUAL(db.GetLogHeight(), 23);
+        db.SetChangeHeights(std::vector<int>(1, 23));
+        CAmount vAt23[] = {4 * COIN, 2 * COIN};
+        CheckAmounts(db, 23, vAddress, std::vector<CAmount>(vAt23, vAt23 + 2));
+        db.Close();
+    }
+
+    boost::filesystem::remove_all(pathDir);
+}
+
+/** Add up the balances of the replayed blocks and keep what else they carry */
+static bool AddReplayedChangeInfo(CChangeInfo& changeInfo, std::map<CCandyAddressKey, CAmount>& mapBalance, std::vector<std::string>& vBlock)
+{
+    for(size_t i = 0; i < changeInfo.vAddressAmount.size(); i++)
+        mapBalance[changeInfo.vAddressAmount[i].key] += changeInfo.vAddressAmount[i].nAmount;
+    vBlock.push_back(strprintf("%d %d %d %d %u", changeInfo.nHeight, changeInfo.nLastCandyHeight, changeInfo.nReward, changeInfo.fCandy, changeInfo.vAddressAmount.size()));
+    return true;
+}
+
+BOOST_FIXTURE_TEST_CASE(candydb_replay_parallel_matches_serial, TestChain100Setup)
+{
+    CKey key;
+    key.MakeNewKey(true);
+    CScript scriptPubKey = CScript() << ToByteVector(coinbaseKey.GetPubKey()) << OP_CHECKSIG;
+    CScript scriptPayTo = GetScriptForDestination(key.GetPubKey().GetID());
+
+    // blocks paying from the coinbase outputs to another address, the last one spends an output of its own block
+    for(int i = 0; i < 4; i++)
+    {
+        std::vector<CMutableTransaction> vtx(1);
+        vtx[0].vin.resize(1);
+        vtx[0].vin[0].prevout = COutPoint(coinbaseTxns[i].GetHash(), 0);
+        vtx[0].vout.push_back(CTxOut(11 * CENT, i < 3 ? scriptPayTo : scriptPubKey));
+        std::vector<unsigned char> vchSig;
+        BOOST_CHECK(coinbaseKey.Sign(SignatureHash(scriptPubKey, vtx[0], 0, SIGHASH_ALL), vchSig));
+        vchSig.push_back((unsigned char)SIGHASH_ALL);
+        vtx[0].vin[0].scriptSig << vchSig;
+
+        if(i == 3)
+        {
+            vtx.resize(2);
+            vtx[1].vin.resize(1);
+            vtx[1].vin[0].prevout = COutPoint(vtx[0].GetHash(), 0);
+            vtx[1].vout.push_back(CTxOut(10 * CENT, scriptPayTo));
+            vchSig.clear();
+            BOOST_CHECK(coinbaseKey.Sign(SignatureHash(scriptPubKey, vtx[1], 0, SIGHASH_ALL), vchSig));
+            vchSig.push_back((unsigned char)SIGHASH_ALL);
+            vtx[1].vin[0].scriptSig << vchSig;
+        }
+
+        CBlock block = CreateAndProcessBlock(vtx, scriptPubKey);
+        BOOST_CHECK(chainActive.Tip()->GetBlockHash() == block.GetHash());
+    }
+
+    // the spent outputs only count from g_nCriticalHeight on
+    const int nCriticalHeightSaved = g_nCriticalHeight;
+    g_nCriticalHeight = 0;
+
+    std::map<CCandyAddressKey, CAmount> mapSerial, mapParallel;
+    std::vector<std::string> vSerial, vParallel;
+    BOOST_CHECK(ReplayChangeInfo(1, chainActive.Height(), 1, 0, boost::bind(&AddReplayedChangeInfo, _1, boost::ref(mapSerial), boost::ref(vSerial))));
+    BOOST_CHECK(ReplayChangeInfo(1, chainActive.Height(), 4, 0, boost::bind(&AddReplayedChangeInfo, _1, boost::ref(mapParallel), boost::ref(vParallel))));
+
+    g_nCriticalHeight = nCriticalHeightSaved;
+
+    BOOST_CHECK_EQUAL(vSerial.size(), (size_t)chainActive.Height());
+    BOOST_CHECK(vSerial == vParallel);
+    BOOST_CHECK(mapSerial == mapParallel);
+
+    CCandyAddressKey keyPayTo;
+    BOOST_CHECK(keyPayTo.SetDestination(key.GetPubKey().GetID()));
+    BOOST_CHECK_EQUAL(mapSerial[keyPayTo], 43 * CENT);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
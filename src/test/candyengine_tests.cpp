@@ -0,0 +1,203 @@
+// Copyright (c) 2018-2019 The Safe Core developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "app/app.h"
+#include "arith_uint256.h"
+#include "candyengine.h"
+#include "chainparams.h"
+#include "txdb.h"
+#include "utiltime.h"
+#include "validation.h"
+#include "test/test_safe.h"
+
+#include <limits>
+#include <set>
+#include <vector>
+
+#include <boost/bind.hpp>
+#include <boost/thread.hpp>
+#include <boost/test/unit_test.hpp>
+
+BOOST_AUTO_TEST_SUITE(candyengine_tests)
+
+static uint256 TxId(const int n)
+{
+    return ArithToUint256(arith_uint256(n));
+}
+
+static CTransaction PutCandyTx(const int n)
+{
+    CMutableTransaction tx;
+    tx.vin.resize(1);
+    tx.vin[0].prevout = COutPoint(TxId(n), 0);
+    CAppHeader header(g_nAppHeaderVersion, uint256S(g_strSafeAssetId), PUT_CANDY_CMD);
+    tx.vout.push_back(CTxOut(10 * COIN, CScript() << OP_TRUE));
+    tx.vout[0].vReserve = FillPutCandyData(header, CPutCandyData(TxId(1000), 10 * COIN, 1, "candy"));
+    return tx;
+}
+
+static CCandy_BlockTime_Info CandyInfo(const int n, const int64_t nBlockTime)
+{
+    return CCandy_BlockTime_Info(TxId(1000), CAssetData(), CCandyInfo(10 * COIN, 1), COutPoint(TxId(n), 0), nBlockTime, n);
+}
+
+/** Exposes the validation callbacks, which the engine otherwise only gets through GetMainSignals() */
+class CTestCandyEngine : public CCandyEngine
+{
+public:
+    using CCandyEngine::SyncTransaction;
+    using CCandyEngine::UpdatedBlockTip;
+};
+
+static bool HasJobCounts(CTestCandyEngine& engine, const size_t nQueued, const size_t nWaiting)
+{
+    size_t nQueuedNow = 0;
+    size_t nWaitingNow = 0;
+    engine.GetJobCounts(nQueuedNow, nWaitingNow);
+    return nQueuedNow == nQueued && nWaitingNow == nWaiting;
+}
+
+/** The worker threads run on their own, give them a few seconds to get there */
+static bool WaitForJobCounts(CTestCandyEngine& engine, const size_t nQueued, const size_t nWaiting)
+{
+    for (int i = 0; i < 500; i++)
+    {
+        if (HasJobCounts(engine, nQueued, nWaiting) && (nQueued > 0 || engine.IsIdle()))
+            return true;
+        MilliSleep(10);
+    }
+    return false;
+}
+
+BOOST_FIXTURE_TEST_CASE(candyinfostore_paging, BasicTestingSetup)
+{
+    CCandyInfoStore store;
+    const unsigned int nPageCount = 3;
+    bool fFirstPage = false;
+
+    // candies 1..10 with blocktime 100..1000, inserted oldest first, so every
+    // insert lands on the first page
+    for (int n = 1; n <= 10; n++)
+    {
+        BOOST_CHECK(store.Insert(CandyInfo(n, n * 100), nPageCount, fFirstPage));
+        BOOST_CHECK(fFirstPage);
+    }
+    BOOST_CHECK(!store.Insert(CandyInfo(5, 500), nPageCount, fFirstPage));
+    BOOST_CHECK(!fFirstPage);
+    BOOST_CHECK(store.Insert(CandyInfo(11, 50), nPageCount, fFirstPage));
+    BOOST_CHECK(!fFirstPage);
+    BOOST_CHECK_EQUAL(store.Size(), 11U);
+
+    // newest first
+    std::vector<CCandy_BlockTime_Info> vInfo;
+    store.GetPage(0, nPageCount, vInfo);
+    BOOST_REQUIRE_EQUAL(vInfo.size(), nPageCount);
+    BOOST_CHECK_EQUAL(vInfo[0].nHeight, 10);
+    BOOST_CHECK_EQUAL(vInfo[2].nHeight, 8);
+    store.GetPage(9, nPageCount, vInfo);
+    BOOST_REQUIRE_EQUAL(vInfo.size(), 2U);
+    BOOST_CHECK_EQUAL(vInfo[0].nHeight, 1);
+    BOOST_CHECK_EQUAL(vInfo[1].nHeight, 11);
+    store.GetPage(11, nPageCount, vInfo);
+    BOOST_CHECK(vInfo.empty());
+
+    // the cursor walks every candy once
+    std::vector<int> vSeen;
+    store.GetPageAfter(NULL, nPageCount, vInfo);
+    while (!vInfo.empty())
+    {
+        for (size_t i = 0; i < vInfo.size(); i++)
+            vSeen.push_back(vInfo[i].nHeight);
+        const CCandy_BlockTime_Info cursor = vInfo.back();
+        store.GetPageAfter(&cursor, nPageCount, vInfo);
+    }
+    BOOST_REQUIRE_EQUAL(vSeen.size(), 11U);
+    BOOST_CHECK_EQUAL(vSeen.front(), 10);
+    BOOST_CHECK_EQUAL(vSeen.back(), 11);
+
+    // the cursor stays valid after its own entry has been erased
+    store.GetPage(0, nPageCount, vInfo);
+    const CCandy_BlockTime_Info cursor = vInfo.back();
+    BOOST_CHECK(store.Erase(cursor.outpoint));
+    BOOST_CHECK(!store.Erase(cursor.outpoint));
+    store.GetPageAfter(&cursor, nPageCount, vInfo);
+    BOOST_REQUIRE_EQUAL(vInfo.size(), nPageCount);
+    BOOST_CHECK_EQUAL(vInfo[0].nHeight, 7);
+
+    // erasing only older candies leaves the first page alone
+    std::set<COutPoint> setOut;
+    setOut.insert(CandyInfo(1, 100).outpoint);
+    setOut.insert(CandyInfo(2, 200).outpoint);
+    store.Erase(setOut, nPageCount, fFirstPage);
+    BOOST_CHECK(!fFirstPage);
+    BOOST_CHECK_EQUAL(store.Size(), 8U);
+
+    setOut.clear();
+    setOut.insert(CandyInfo(3, 300).outpoint);
+    setOut.insert(CandyInfo(9, 900).outpoint);
+    setOut.insert(CandyInfo(12, 1200).outpoint);
+    store.Erase(setOut, nPageCount, fFirstPage);
+    BOOST_CHECK(fFirstPage);
+    BOOST_CHECK_EQUAL(store.Size(), 6U);
+}
+
+BOOST_FIXTURE_TEST_CASE(candyengine_waits_for_balances, TestChain100Setup)
+{
+    CTestCandyEngine engine;
+    BOOST_CHECK(!engine.IsIdle());
+    BOOST_CHECK(engine.LoadAll());
+    BOOST_CHECK(engine.IsIdle());
+
+    CBlock block;
+    int nHeight = 0;
+    {
+        LOCK(cs_main);
+        BOOST_REQUIRE(ReadBlockFromDisk(block, chainActive.Tip(), Params().GetConsensus()));
+        nHeight = chainActive.Height();
+    }
+
+    // a new candy waits for the balances of its height, a repeated event is dropped
+    const CTransaction tx = PutCandyTx(1);
+    {
+        LOCK(cs_main);
+        engine.SyncTransaction(tx, &block);
+        engine.SyncTransaction(tx, &block);
+    }
+    BOOST_CHECK(HasJobCounts(engine, 0, 1));
+    BOOST_CHECK(engine.IsIdle());
+
+    engine.NotifyCandyHeight(nHeight - 1);
+    BOOST_CHECK(HasJobCounts(engine, 0, 1));
+    engine.NotifyCandyHeight(nHeight);
+    BOOST_CHECK(HasJobCounts(engine, 1, 0));
+    BOOST_CHECK(!engine.IsIdle());
+
+    // a worker puts it back as long as the balances are not written
+    boost::thread worker(boost::bind(&CTestCandyEngine::ThreadWorker, &engine));
+    BOOST_CHECK(WaitForJobCounts(engine, 0, 1));
+
+    // once they are, it is evaluated and released: the asset is unknown, so
+    // it doesn't go to the available list
+    BOOST_REQUIRE(pblocktree->Write_CandyHeight_TotalAmount_Index(nHeight, 100 * COIN));
+    engine.NotifyCandyHeight(nHeight);
+    BOOST_CHECK(WaitForJobCounts(engine, 0, 0));
+    BOOST_CHECK(engine.IsIdle());
+    BOOST_CHECK(candyinfostore.Empty());
+
+    worker.interrupt();
+    worker.join();
+
+    // a waiting candy is dropped when it expires
+    {
+        LOCK(cs_main);
+        engine.SyncTransaction(PutCandyTx(2), &block);
+    }
+    BOOST_CHECK(HasJobCounts(engine, 0, 1));
+    CBlockIndex indexExpired;
+    indexExpired.nHeight = std::numeric_limits<int>::max() / 2;
+    engine.UpdatedBlockTip(&indexExpired, chainActive.Tip(), false);
+    BOOST_CHECK(HasJobCounts(engine, 0, 0));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,159 @@
+// Copyright (c) 2018-2019 The Safe Core developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "changequeue.h"
+#include "utiltime.h"
+#include "test/test_safe.h"
+
+#include <atomic>
+#include <vector>
+
+#include <boost/bind.hpp>
+#include <boost/thread.hpp>
+#include <boost/test/unit_test.hpp>
+
+BOOST_FIXTURE_TEST_SUITE(changequeue_tests, BasicTestingSetup)
+
+struct CTestChange
+{
+    int nHeight;
+
+    CTestChange(const int nHeightIn = 0) : nHeight(nHeightIn) {}
+};
+
+typedef CBlockChangeQueue<CTestChange> CTestChangeQueue;
+
+static const int TEST_KEEP_BLOCKS = 2;
+static const int TEST_CAPACITY = 5;
+
+static std::atomic<bool> fTestShutdown(false);
+
+static bool TestShutdownRequested()
+{
+    return fTestShutdown;
+}
+
+static void PushBlocks(CTestChangeQueue& queue, const int nFirst, const int nLast)
+{
+    for (int nHeight = nFirst; nHeight <= nLast; nHeight++)
+        queue.Push(CTestChange(nHeight));
+}
+
+static void Produce(CTestChangeQueue& queue, std::atomic<bool>& fDone)
+{
+    queue.WaitForSpace(1);
+    fDone = true;
+}
+
+/** Give a blocked producer the time to get past WaitForSpace() if it wrongly could */
+static bool StillWaiting(const std::atomic<bool>& fDone)
+{
+    MilliSleep(200);
+    return !fDone;
+}
+
+BOOST_AUTO_TEST_CASE(changequeue_keep_and_truncate)
+{
+    CTestChangeQueue queue(TEST_KEEP_BLOCKS, TEST_CAPACITY, TestShutdownRequested);
+    PushBlocks(queue, 10, 13);
+    BOOST_CHECK_EQUAL(queue.GetStats().nDepth, 4);
+
+    // a reorg to height 12 drops 12 and 13, a height below the queue is stale
+    BOOST_CHECK(queue.Truncate(12));
+    BOOST_CHECK_EQUAL(queue.GetStats().nDepth, 2);
+    BOOST_CHECK(!queue.Truncate(9));
+    BOOST_CHECK_EQUAL(queue.GetStats().nDepth, 2);
+    PushBlocks(queue, 12, 14);
+
+    // the writer gets the oldest blocks beyond the kept ones, at most nMaxBlocks
+    std::vector<CTestChange> vItems;
+    queue.PopForWriting(vItems, 2);
+    BOOST_REQUIRE_EQUAL(vItems.size(), 2U);
+    BOOST_CHECK_EQUAL(vItems[0].nHeight, 10);
+    BOOST_CHECK_EQUAL(vItems[1].nHeight, 11);
+    BOOST_CHECK_EQUAL(queue.GetStats().nDepth, 5);
+    queue.FinishWriting(vItems.size(), false);
+
+    vItems.clear();
+    queue.PopForWriting(vItems, 0);
+    BOOST_REQUIRE_EQUAL(vItems.size(), 1U);
+    BOOST_CHECK_EQUAL(vItems[0].nHeight, 12);
+    queue.FinishWriting(vItems.size(), true);
+
+    CChangeInfoQueueStats stats = queue.GetStats();
+    BOOST_CHECK_EQUAL(stats.nDepth, TEST_KEEP_BLOCKS);
+    BOOST_CHECK_EQUAL(stats.nMaxDepth, 5);
+    BOOST_CHECK_EQUAL(stats.nCapacity, TEST_CAPACITY);
+    BOOST_CHECK_EQUAL(stats.nWrittenBlocks, 3);
+    BOOST_CHECK_EQUAL(stats.nWriteBatches, 2);
+    BOOST_CHECK_EQUAL(stats.nSyncs, 1);
+    BOOST_CHECK_EQUAL(stats.nProducerWaits, 0);
+}
+
+BOOST_AUTO_TEST_CASE(changequeue_producer_waits_for_writer)
+{
+    CTestChangeQueue queue(TEST_KEEP_BLOCKS, TEST_CAPACITY, TestShutdownRequested);
+    PushBlocks(queue, 1, TEST_CAPACITY);
+
+    std::atomic<bool> fDone(false);
+    boost::thread producer(boost::bind(&Produce, boost::ref(queue), boost::ref(fDone)));
+    BOOST_CHECK(StillWaiting(fDone));
+
+    // the popped blocks count until they are written
+    std::vector<CTestChange> vItems;
+    queue.PopForWriting(vItems, 0);
+    BOOST_CHECK_EQUAL(vItems.size(), 3U);
+    BOOST_CHECK(StillWaiting(fDone));
+
+    queue.FinishWriting(vItems.size(), false);
+    producer.join();
+    BOOST_CHECK(fDone);
+
+    CChangeInfoQueueStats stats = queue.GetStats();
+    BOOST_CHECK_EQUAL(stats.nProducerWaits, 1);
+    BOOST_CHECK(stats.nProducerWaitTime > 0);
+
+    // asking for more room than the capacity waits for an empty queue only
+    PushBlocks(queue, TEST_CAPACITY + 1, TEST_CAPACITY + 3);
+    vItems.clear();
+    queue.PopForWriting(vItems, 0);
+    queue.FinishWriting(vItems.size(), false);
+    queue.Clear();
+    queue.WaitForSpace(TEST_CAPACITY + 10);
+    BOOST_CHECK_EQUAL(queue.GetStats().nProducerWaits, 1);
+}
+
+BOOST_AUTO_TEST_CASE(changequeue_shutdown_releases_producer)
+{
+    CTestChangeQueue queue(TEST_KEEP_BLOCKS, TEST_CAPACITY, TestShutdownRequested);
+    PushBlocks(queue, 1, TEST_CAPACITY);
+
+    std::atomic<bool> fDone(false);
+    boost::thread producer(boost::bind(&Produce, boost::ref(queue), boost::ref(fDone)));
+    BOOST_CHECK(StillWaiting(fDone));
+
+    // no writer ever runs, the shutdown is noticed on the next poll
+    fTestShutdown = true;
+    producer.join();
+    fTestShutdown = false;
+    BOOST_CHECK(fDone);
+    BOOST_CHECK_EQUAL(queue.GetStats().nDepth, TEST_CAPACITY);
+}
+
+BOOST_AUTO_TEST_CASE(changequeue_writer_interrupted)
+{
+    CTestChangeQueue queue(TEST_KEEP_BLOCKS, TEST_CAPACITY, TestShutdownRequested);
+    PushBlocks(queue, 1, TEST_KEEP_BLOCKS);
+
+    // the writer waits for more than the kept blocks until its thread is interrupted
+    std::vector<CTestChange> vItems;
+    boost::thread writer(boost::bind(&CTestChangeQueue::PopForWriting, &queue, boost::ref(vItems), 0));
+    MilliSleep(100);
+    writer.interrupt();
+    writer.join();
+    BOOST_CHECK(vItems.empty());
+    BOOST_CHECK_EQUAL(queue.GetStats().nDepth, TEST_KEEP_BLOCKS);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
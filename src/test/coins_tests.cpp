@@ -4,6 +4,7 @@
 
 #include "coins.h"
 #include "random.h"
+#include "txdb.h"
 #include "uint256.h"
 #include "test/test_safe.h"
 #include "validation.h"
@@ -347,4 +348,50 @@ BOOST_AUTO_TEST_CASE(updatecoins_simulation_test)
     BOOST_CHECK(spent_a_duplicate_coinbase);
 }
 
+namespace
+{
+//! Exposes the chainstate rows an older version wrote
+class CCoinsViewDBTest : public CCoinsViewDB
+{
+public:
+    CCoinsViewDBTest() : CCoinsViewDB(1 << 20, true, true) {}
+    CDBWrapper& GetDB() { return db; }
+};
+}
+
+BOOST_FIXTURE_TEST_CASE(coins_db_upgrade, TestingSetup)
+{
+    CCoinsViewDBTest view;
+
+    CCoins coins;
+    coins.nVersion = 1;
+    coins.nHeight = 100;
+    coins.vout.resize(2);
+    coins.vout[0].nValue = 5 * COIN;
+    coins.vout[0].scriptPubKey = CScript() << OP_TRUE;
+    coins.vout[1].nValue = 3 * COIN;
+    coins.vout[1].scriptPubKey = CScript() << OP_TRUE << OP_DROP << OP_TRUE;
+    coins.vout[1].nUnlockedHeight = 200;
+
+    // 'c' and 'B' are the coins and the best block of the versions before the compact txout encoding
+    uint256 txid = GetRandHash();
+    uint256 hashBest = GetRandHash();
+    BOOST_CHECK(view.GetDB().Write(std::make_pair('c', txid), CLegacyCoinsFormat(coins)));
+    BOOST_CHECK(view.GetDB().Write('B', hashBest));
+
+    BOOST_CHECK(view.Upgrade());
+    BOOST_CHECK(view.GetBestBlock() == hashBest);
+    BOOST_CHECK(!view.GetDB().Exists('B'));
+    BOOST_CHECK(!view.GetDB().Exists(std::make_pair('c', txid)));
+
+    CCoins coinsUpgraded;
+    BOOST_CHECK(view.GetCoins(txid, coinsUpgraded));
+    BOOST_CHECK(coinsUpgraded == coins);
+    BOOST_CHECK(view.Upgrade());
+
+    // an older version found no best block and rebuilt its coins on top of the converted ones
+    BOOST_CHECK(view.GetDB().Write('B', GetRandHash()));
+    BOOST_CHECK(!view.Upgrade());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -2,7 +2,9 @@
 // Distributed under the MIT software license, see the accompanying
 // file COPYING or http://www.opensource.org/licenses/mit-license.php.
 
+#include "clientversion.h"
 #include "compressor.h"
+#include "streams.h"
 #include "util.h"
 #include "test/test_safe.h"
 
@@ -62,4 +64,44 @@ BOOST_AUTO_TEST_CASE(compress_amounts)
         BOOST_CHECK(TestDecode(i));
 }
 
+static CTxOut CompactRoundTrip(const CTxOut& txout, unsigned int nExpectedSize)
+{
+    CTxOut txoutIn = txout;
+    CTxOut txoutOut;
+    CDataStream ss(SER_DISK, CLIENT_VERSION);
+    CTxOutCompactCompressor compressorIn(txoutIn);
+    CTxOutCompactCompressor compressorOut(txoutOut);
+    ss << compressorIn;
+    BOOST_CHECK_EQUAL(ss.size(), nExpectedSize);
+    ss >> compressorOut;
+    BOOST_CHECK(ss.empty());
+    return txoutOut;
+}
+
+BOOST_AUTO_TEST_CASE(compress_txout_compact)
+{
+    CScript scriptPubKey = CScript() << OP_DUP << OP_HASH160 << std::vector<unsigned char>(20, 0x5a) << OP_EQUALVERIFY << OP_CHECKSIG;
+
+    // flags, amount, 21 byte script, no unlock height and reserve
+    CTxOut txout(50 * COIN, scriptPubKey);
+    BOOST_CHECK(CompactRoundTrip(txout, 23) == txout);
+
+    txout.nUnlockedHeight = 300000;
+    BOOST_CHECK(CompactRoundTrip(txout, 26) == txout);
+
+    txout.nUnlockedHeight = -1;
+    BOOST_CHECK(CompactRoundTrip(txout, 31) == txout);
+
+    txout.nUnlockedHeight = 0;
+    txout.vReserve.push_back(0x01);
+    BOOST_CHECK(CompactRoundTrip(txout, 29) == txout);
+
+    // flags of a later format are refused
+    CDataStream ss(SER_DISK, CLIENT_VERSION);
+    ss << (unsigned char)0x80;
+    CTxOut txoutOut;
+    CTxOutCompactCompressor compressorOut(txoutOut);
+    BOOST_CHECK_THROW(ss >> compressorOut, std::ios_base::failure);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,93 @@
+// Copyright (c) 2018-2019 The Safe Core developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "arith_uint256.h"
+#include "masternode-sync.h"
+#include "masternodeman.h"
+#include "net.h"
+#include "test/test_safe.h"
+
+#include <boost/test/unit_test.hpp>
+
+BOOST_FIXTURE_TEST_SUITE(masternodeman_tests, TestingSetup)
+
+static CMasternode TestMasternode(const int n)
+{
+    COutPoint outpoint(ArithToUint256(arith_uint256(n)), 0);
+    return CMasternode(CService(), outpoint, CPubKey(), CPubKey(), PROTOCOL_VERSION);
+}
+
+static void AddMasternodes(CMasternodeMan& mnman, const int nFirst, const int nLast)
+{
+    for (int n = nFirst; n <= nLast; n++)
+    {
+        CMasternode mn = TestMasternode(n);
+        BOOST_CHECK(mnman.Add(mn));
+    }
+}
+
+/** The ranks of mnman must match those of a list without any cached table */
+static void CheckRanksAsFresh(CMasternodeMan& mnman, const int nFirst, const int nLast)
+{
+    CMasternodeMan mnmanFresh;
+    AddMasternodes(mnmanFresh, nFirst, nLast);
+
+    CMasternodeMan::rank_pair_vec_t vecRanks, vecRanksFresh;
+    BOOST_REQUIRE(mnman.GetMasternodeRanks(vecRanks, 0));
+    BOOST_REQUIRE(mnmanFresh.GetMasternodeRanks(vecRanksFresh, 0));
+    BOOST_REQUIRE_EQUAL(vecRanks.size(), vecRanksFresh.size());
+    for (size_t i = 0; i < vecRanks.size(); i++)
+    {
+        const COutPoint& outpoint = vecRanks[i].second.vin.prevout;
+        BOOST_CHECK_EQUAL(vecRanks[i].first, int(i + 1));
+        BOOST_CHECK(outpoint == vecRanksFresh[i].second.vin.prevout);
+
+        int nRank = -1;
+        BOOST_CHECK(mnman.GetMasternodeRank(outpoint, nRank, 0));
+        BOOST_CHECK_EQUAL(nRank, vecRanks[i].first);
+
+        masternode_info_t mnInfo;
+        BOOST_CHECK(mnman.GetMasternodeByRank(vecRanks[i].first, mnInfo, 0));
+        BOOST_CHECK(mnInfo.vin.prevout == outpoint);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(masternodeman_rank_cache_invalidation)
+{
+    // ranks are only served once the masternode list is synced
+    CMasternodeMan mnman;
+    AddMasternodes(mnman, 1, 5);
+    CMasternodeMan::rank_pair_vec_t vecRanks;
+    BOOST_CHECK(!mnman.GetMasternodeRanks(vecRanks, 0));
+
+    masternodeSync.Reset();
+    while (!masternodeSync.IsMasternodeListSynced())
+        masternodeSync.SwitchToNextAsset(*connman);
+
+    CheckRanksAsFresh(mnman, 1, 5);
+
+    // an added masternode drops the cached table and gets its rank
+    AddMasternodes(mnman, 6, 8);
+    CheckRanksAsFresh(mnman, 1, 8);
+
+    int nRank = -1;
+    BOOST_CHECK(!mnman.GetMasternodeRank(TestMasternode(9).vin.prevout, nRank, 0));
+    BOOST_CHECK_EQUAL(nRank, -1);
+    masternode_info_t mnInfo;
+    BOOST_CHECK(!mnman.GetMasternodeByRank(9, mnInfo, 0));
+
+    // a cleared list has no ranks left, not the cached ones
+    mnman.Clear();
+    BOOST_CHECK(!mnman.GetMasternodeRanks(vecRanks, 0));
+    BOOST_CHECK(vecRanks.empty());
+    BOOST_CHECK(!mnman.GetMasternodeByRank(1, mnInfo, 0));
+    BOOST_CHECK_EQUAL(mnman.size(), 0);
+
+    AddMasternodes(mnman, 3, 4);
+    CheckRanksAsFresh(mnman, 3, 4);
+
+    masternodeSync.Reset();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -102,6 +102,81 @@ BOOST_AUTO_TEST_CASE(MempoolRemoveTest)
     removed.clear();
 }
 
+BOOST_AUTO_TEST_CASE(MempoolAncestorStateReorgTest)
+{
+    // A transaction put back from a disconnected block, with more in-mempool
+    // descendants than a reorg used to walk, must be in the ancestor state of
+    // every one of them, or mining it again breaks their state.
+    CTxMemPool pool(CFeeRate(0));
+    CCoinsView coinsDummy;
+    CCoinsViewCache view(&coinsDummy);
+    TestMemPoolEntryHelper entry;
+    const int nChain = 150;
+
+    CMutableTransaction txParent;
+    txParent.vin.resize(1);
+    txParent.vin[0].scriptSig = CScript() << OP_11;
+    txParent.vout.resize(1);
+    txParent.vout[0].scriptPubKey = CScript() << OP_11 << OP_EQUAL;
+    txParent.vout[0].nValue = 10 * COIN;
+
+    std::vector<CMutableTransaction> vChain(nChain);
+    uint256 hashPrev = txParent.GetHash();
+    for (int i = 0; i < nChain; i++)
+    {
+        vChain[i].vin.resize(1);
+        vChain[i].vin[0].scriptSig = CScript() << OP_11;
+        vChain[i].vin[0].prevout = COutPoint(hashPrev, 0);
+        vChain[i].vout.resize(1);
+        vChain[i].vout[0].scriptPubKey = CScript() << OP_11 << OP_EQUAL;
+        vChain[i].vout[0].nValue = 10 * COIN - (i + 1) * 1000LL;
+        hashPrev = vChain[i].GetHash();
+    }
+
+    // The chain stays in the mempool while the parent goes back from the block
+    for (int i = 0; i < nChain; i++)
+        pool.addUnchecked(vChain[i].GetHash(), entry.Fee(1000LL).FromTx(vChain[i]), view);
+    pool.addUnchecked(txParent.GetHash(), entry.Fee(5000LL).FromTx(txParent), view);
+    pool.UpdateTransactionsFromBlock(std::vector<uint256>(1, txParent.GetHash()));
+
+    CTxMemPool::txiter parentIt = pool.mapTx.find(txParent.GetHash());
+    const int64_t nTxSize = parentIt->GetTxSize();
+    BOOST_CHECK_EQUAL(parentIt->GetCountWithDescendants(), nChain + 1);
+    BOOST_CHECK_EQUAL(parentIt->GetSizeWithDescendants(), (nChain + 1) * nTxSize);
+    BOOST_CHECK_EQUAL(parentIt->GetModFeesWithDescendants(), 5000LL + nChain * 1000LL);
+    for (int i = 0; i < nChain; i++)
+    {
+        CTxMemPool::txiter it = pool.mapTx.find(vChain[i].GetHash());
+        BOOST_CHECK_EQUAL(it->GetCountWithAncestors(), i + 2);
+        BOOST_CHECK_EQUAL(it->GetSizeWithAncestors(), (i + 2) * nTxSize);
+        BOOST_CHECK_EQUAL(it->GetModFeesWithAncestors(), 5000LL + (i + 1) * 1000LL);
+        BOOST_CHECK_EQUAL(it->GetSigOpCountWithAncestors(), i + 2);
+    }
+
+    // Removing the tail of the chain takes it out of the parent's state
+    std::list<CTransaction> removed;
+    pool.remove(vChain[100], removed, true);
+    BOOST_CHECK_EQUAL(removed.size(), nChain - 100);
+    removed.clear();
+    parentIt = pool.mapTx.find(txParent.GetHash());
+    BOOST_CHECK_EQUAL(parentIt->GetCountWithDescendants(), 101);
+    BOOST_CHECK_EQUAL(parentIt->GetModFeesWithDescendants(), 5000LL + 100 * 1000LL);
+
+    // Mining the parent again takes it out of the ancestor state of the rest
+    std::list<CTransaction> conflicts;
+    pool.removeForBlock(std::vector<CTransaction>(1, CTransaction(txParent)), 1, conflicts);
+    BOOST_CHECK_EQUAL(pool.size(), 100);
+    for (int i = 0; i < 100; i++)
+    {
+        CTxMemPool::txiter it = pool.mapTx.find(vChain[i].GetHash());
+        BOOST_CHECK_EQUAL(it->GetCountWithAncestors(), i + 1);
+        BOOST_CHECK_EQUAL(it->GetSizeWithAncestors(), (i + 1) * nTxSize);
+        BOOST_CHECK_EQUAL(it->GetModFeesWithAncestors(), (i + 1) * 1000LL);
+        BOOST_CHECK_EQUAL(it->GetSigOpCountWithAncestors(), i + 1);
+        BOOST_CHECK_EQUAL(it->GetCountWithDescendants(), 100 - i);
+    }
+}
+
 template<int index>
 void CheckSort(CTxMemPool &pool, std::vector<std::string> &sortedOrder)
 {
@@ -72,6 +72,83 @@ bool TestSequenceLocks(const CTransaction &tx, int flags)
     return CheckSequenceLocks(tx, flags);
 }
 
+// Test the ancestor feerate transaction selection. Called from
+// CreateNewBlock_validity to reuse its chain, with an empty priority area.
+void TestPackageSelection(const CChainParams& chainparams, CScript scriptPubKey, std::vector<CTransaction*>& txFirst)
+{
+    TestMemPoolEntryHelper entry;
+    CBlockTemplate *pblocktemplate;
+    mapArgs["-blockprioritysize"] = "0";
+
+    // A medium fee transaction goes after a package with a higher feerate
+    // made of a low fee parent and a high fee child
+    CMutableTransaction tx;
+    tx.vin.resize(1);
+    tx.vin[0].scriptSig = CScript() << OP_1;
+    tx.vin[0].prevout.hash = txFirst[0]->GetHash();
+    tx.vin[0].prevout.n = 0;
+    tx.vout.resize(1);
+    tx.vout[0].nValue = txFirst[0]->vout[0].nValue - 1000;
+    CTransaction txParent(tx);
+    mempool.addUnchecked(txParent.GetHash(), entry.Fee(1000).Time(GetTime()).SpendsCoinbase(true).FromTx(tx), *pcoinsTip);
+
+    tx.vin[0].prevout.hash = txFirst[1]->GetHash();
+    tx.vout[0].nValue = txFirst[1]->vout[0].nValue - 10000;
+    uint256 hashMediumFeeTx = tx.GetHash();
+    mempool.addUnchecked(hashMediumFeeTx, entry.Fee(10000).Time(GetTime()).SpendsCoinbase(true).FromTx(tx), *pcoinsTip);
+
+    tx.vin[0].prevout.hash = txParent.GetHash();
+    tx.vout[0].nValue = txParent.vout[0].nValue - 50000;
+    CTransaction txHighFee(tx);
+    uint256 hashHighFeeTx = txHighFee.GetHash();
+    mempool.addUnchecked(hashHighFeeTx, entry.Fee(50000).Time(GetTime()).SpendsCoinbase(false).FromTx(tx), *pcoinsTip);
+
+    BOOST_CHECK(pblocktemplate = CreateNewBlock(chainparams, scriptPubKey));
+    BOOST_CHECK_EQUAL(pblocktemplate->block.vtx.size(), 4);
+    BOOST_CHECK(pblocktemplate->block.vtx[1].GetHash() == txParent.GetHash());
+    BOOST_CHECK(pblocktemplate->block.vtx[2].GetHash() == hashHighFeeTx);
+    BOOST_CHECK(pblocktemplate->block.vtx[3].GetHash() == hashMediumFeeTx);
+    delete pblocktemplate;
+
+    // The parent is mined and put back by a reorg: the package is the same
+    std::list<CTransaction> conflicts;
+    mempool.removeForBlock(std::vector<CTransaction>(1, txParent), chainActive.Height() + 1, conflicts);
+    {
+        CTxMemPool::txiter it = mempool.mapTx.find(hashHighFeeTx);
+        BOOST_CHECK_EQUAL(it->GetCountWithAncestors(), 1);
+        BOOST_CHECK_EQUAL(it->GetModFeesWithAncestors(), 50000);
+    }
+    tx = txParent;
+    mempool.addUnchecked(txParent.GetHash(), entry.Fee(1000).Time(GetTime()).SpendsCoinbase(true).FromTx(tx), *pcoinsTip);
+    mempool.UpdateTransactionsFromBlock(std::vector<uint256>(1, txParent.GetHash()));
+    {
+        CTxMemPool::txiter it = mempool.mapTx.find(hashHighFeeTx);
+        BOOST_CHECK_EQUAL(it->GetCountWithAncestors(), 2);
+        BOOST_CHECK_EQUAL(it->GetModFeesWithAncestors(), 51000);
+        BOOST_CHECK_EQUAL(mempool.mapTx.find(txParent.GetHash())->GetCountWithDescendants(), 2);
+    }
+
+    BOOST_CHECK(pblocktemplate = CreateNewBlock(chainparams, scriptPubKey));
+    BOOST_CHECK_EQUAL(pblocktemplate->block.vtx.size(), 4);
+    BOOST_CHECK(pblocktemplate->block.vtx[1].GetHash() == txParent.GetHash());
+    BOOST_CHECK(pblocktemplate->block.vtx[2].GetHash() == hashHighFeeTx);
+    BOOST_CHECK(pblocktemplate->block.vtx[3].GetHash() == hashMediumFeeTx);
+    delete pblocktemplate;
+
+    // Removing the child leaves the parent alone below the medium fee tx
+    std::list<CTransaction> removed;
+    mempool.remove(txHighFee, removed, true);
+    BOOST_CHECK_EQUAL(mempool.mapTx.find(txParent.GetHash())->GetCountWithDescendants(), 1);
+    BOOST_CHECK(pblocktemplate = CreateNewBlock(chainparams, scriptPubKey));
+    BOOST_CHECK_EQUAL(pblocktemplate->block.vtx.size(), 3);
+    BOOST_CHECK(pblocktemplate->block.vtx[1].GetHash() == hashMediumFeeTx);
+    BOOST_CHECK(pblocktemplate->block.vtx[2].GetHash() == txParent.GetHash());
+    delete pblocktemplate;
+
+    mempool.clear();
+    mapArgs.erase("-blockprioritysize");
+}
+
 // NOTE: These tests rely on CreateNewBlock doing its own self-validation!
 BOOST_AUTO_TEST_CASE(CreateNewBlock_validity)
 {
@@ -382,6 +459,8 @@ BOOST_AUTO_TEST_CASE(CreateNewBlock_validity)
     SetMockTime(0);
     mempool.clear();
 
+    TestPackageSelection(chainparams, scriptPubKey, txFirst);
+
     BOOST_FOREACH(CTransaction *tx, txFirst)
         delete tx;
 
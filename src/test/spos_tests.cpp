@@ -0,0 +1,93 @@
+// Copyright (c) 2018-2019 The Safe Core developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "arith_uint256.h"
+#include "masternode.h"
+#include "txdb.h"
+#include "validation.h"
+#include "test/test_safe.h"
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+extern int g_nSelectGlobalDefaultValue;
+extern int g_nLocalStartSavePayeeHeight;
+extern const std::map<std::string, CMasternodePayee_IndexValue>& GetAllPayeeInfoMap();
+
+BOOST_FIXTURE_TEST_SUITE(spos_tests, BasicTestingSetup)
+
+static std::vector<CMasternode> TestMasternodes(const int nCount)
+{
+    std::vector<CMasternode> vecMasternodes;
+    for (int n = 1; n <= nCount; n++)
+    {
+        COutPoint outpoint(ArithToUint256(arith_uint256(n)), 0);
+        vecMasternodes.push_back(CMasternode(CService(), outpoint, CPubKey(), CPubKey(), PROTOCOL_VERSION));
+    }
+    return vecMasternodes;
+}
+
+static void PublishMasternodes(const std::vector<CMasternode>& vecMasternodes, const bool fClearVec)
+{
+    UpdateMasternodeGlobalData(vecMasternodes, fClearVec, g_nSelectGlobalDefaultValue, g_nSelectGlobalDefaultValue, g_nSelectGlobalDefaultValue);
+}
+
+BOOST_AUTO_TEST_CASE(spos_result_masternodes_snapshot)
+{
+    PublishMasternodes(TestMasternodes(2), false);
+    std::shared_ptr<const std::vector<CMasternode> > pOld = GetResultMasternodes();
+    BOOST_REQUIRE(pOld);
+    BOOST_CHECK_EQUAL(pOld->size(), 2U);
+
+    // a new selection replaces the shared list, the snapshot taken before stays as it was
+    PublishMasternodes(TestMasternodes(3), false);
+    std::shared_ptr<const std::vector<CMasternode> > pNew = GetResultMasternodes();
+    BOOST_REQUIRE(pNew);
+    BOOST_CHECK_EQUAL(pNew->size(), 3U);
+    BOOST_CHECK(pNew != pOld);
+    BOOST_CHECK_EQUAL(pOld->size(), 2U);
+    BOOST_CHECK(pOld->back().vin.prevout == TestMasternodes(2).back().vin.prevout);
+
+    // an empty result only replaces it when the list is to be cleared
+    PublishMasternodes(std::vector<CMasternode>(), false);
+    BOOST_CHECK(GetResultMasternodes() == pNew);
+    PublishMasternodes(std::vector<CMasternode>(), true);
+    BOOST_REQUIRE(GetResultMasternodes());
+    BOOST_CHECK(GetResultMasternodes()->empty());
+    BOOST_CHECK_EQUAL(pNew->size(), 3U);
+}
+
+BOOST_FIXTURE_TEST_CASE(spos_payee_table_loaded_with_block_index, TestingSetup)
+{
+    CSideIndexWriteSet writeSet;
+    writeSet.strPubKeyCollateralAddress = "Xpayee";
+    writeSet.masternodePayment_IndexValue = CMasternodePayee_IndexValue(10, 1000, 2);
+    writeSet.nLocalStartSavePayeeHeight = 5;
+    BOOST_REQUIRE(pblocktree->WriteSideIndexes(writeSet, true));
+
+    // the table is ready as soon as the block index is, before any block is connected
+    UnloadBlockIndex();
+    {
+        LOCK(cs_main);
+        BOOST_CHECK(GetAllPayeeInfoMap().empty());
+    }
+    g_nLocalStartSavePayeeHeight = 0;
+    BOOST_REQUIRE(LoadBlockIndex());
+    {
+        LOCK(cs_main);
+        const std::map<std::string, CMasternodePayee_IndexValue>& mapPayee = GetAllPayeeInfoMap();
+        BOOST_REQUIRE_EQUAL(mapPayee.size(), 1U);
+        BOOST_CHECK_EQUAL(mapPayee.begin()->first, "Xpayee");
+        BOOST_CHECK_EQUAL(mapPayee.begin()->second.nPayeeTimes, 2);
+        BOOST_CHECK_EQUAL(mapPayee.begin()->second.nHeight, 10);
+    }
+    BOOST_CHECK_EQUAL(g_nLocalStartSavePayeeHeight, 5);
+    g_nLocalStartSavePayeeHeight = 0;
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -6,6 +6,7 @@
 #include "data/tx_valid.json.h"
 #include "test/test_safe.h"
 
+#include "app/app.h"
 #include "clientversion.h"
 #include "consensus/validation.h"
 #include "core_io.h"
@@ -404,4 +405,40 @@ BOOST_AUTO_TEST_CASE(test_IsStandard)
     BOOST_CHECK(!IsStandardTx(t, reason));
 }
 
+BOOST_AUTO_TEST_CASE(test_TxOutReserve)
+{
+    // The plain "safe" marker stays in the inline buffer
+    CTxOut txout;
+    BOOST_CHECK_EQUAL(txout.vReserve.size(), TXOUT_RESERVE_MIN_SIZE);
+    BOOST_CHECK_EQUAL(txout.vReserve.allocated_memory(), 0U);
+    BOOST_CHECK(txout.IsSafeOnly());
+    BOOST_CHECK(!txout.IsAsset());
+    BOOST_CHECK(!txout.IsApp());
+
+    const uint256 assetId = uint256S("5a3e1b8c2d9f47e6a1b0c3d2e5f4a7b6c9d8e1f0a3b2c5d4e7f6a9b8c1d0e3f2");
+    CAppHeader header(g_nAppHeaderVersion, uint256S(g_strSafeAssetId), TRANSFER_ASSET_CMD);
+    txout.nValue = 1000;
+    txout.vReserve = FillCommonData(header, CCommonData(assetId, txout.nValue, "transfer"));
+
+    uint32_t nAppCmd = 0;
+    BOOST_CHECK(txout.IsAsset(&nAppCmd));
+    BOOST_CHECK_EQUAL(nAppCmd, TRANSFER_ASSET_CMD);
+    BOOST_CHECK(!txout.IsSafeOnly());
+    BOOST_CHECK(!txout.IsSPOSSafeOnly());
+
+    CDataStream ss(SER_DISK, SAFE_TX_VERSION_1);
+    ss << txout;
+    CTxOut txoutRead;
+    ss >> txoutRead;
+    BOOST_CHECK(txoutRead == txout);
+
+    CAppHeader headerRead;
+    std::vector<unsigned char> vData;
+    CCommonData commonData;
+    BOOST_CHECK(ParseReserve(txoutRead.vReserve, headerRead, vData));
+    BOOST_CHECK(headerRead.appId == header.appId);
+    BOOST_CHECK(ParseCommonData(vData, commonData));
+    BOOST_CHECK(commonData.assetId == assetId);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -7,20 +7,27 @@
 
 #include "chain.h"
 #include "chainparams.h"
+#include "clientversion.h"
 #include "hash.h"
 #include "validation.h"
 #include "pow.h"
 #include "uint256.h"
 #include "main.h"
 #include "app/app.h"
+#include "ui_interface.h"
+#include "util.h"
+#include "utiltime.h"
 
+#include <limits>
 #include <stdint.h>
 
 #include <boost/thread.hpp>
 
 using namespace std;
 
-static const char DB_COINS = 'c';
+static const char DB_COINS = 'C';
+//! coins in CLegacyCoinsFormat, converted by CCoinsViewDB::Upgrade()
+static const char DB_LEGACY_COINS = 'c';
 static const char DB_BLOCK_FILES = 'f';
 static const char DB_TXINDEX = 't';
 static const char DB_ADDRESSINDEX = 'a';
@@ -29,7 +36,9 @@ static const char DB_TIMESTAMPINDEX = 's';
 static const char DB_SPENTINDEX = 'p';
 static const char DB_BLOCK_INDEX = 'b';
 
-static const char DB_BEST_BLOCK = 'B';
+//! best block of the compact coins, older versions only know DB_LEGACY_BEST_BLOCK
+static const char DB_BEST_BLOCK = 'K';
+static const char DB_LEGACY_BEST_BLOCK = 'B';
 static const char DB_FLAG = 'F';
 static const char DB_REINDEX_FLAG = 'R';
 static const char DB_LAST_BLOCK = 'l';
@@ -42,11 +51,21 @@ static const string DB_ASSETID_ASSETINFO_INDEX = "assetid_assetinfo";
 static const string DB_SHORTNAME_ASSETID_INDEX = "shortname_assetid";
 static const string DB_ASSETNAME_ASSETID_INDEX = "assetname_assetid";
 static const string DB_ASSETTX_INDEX = "assettx";
+static const string DB_ASSETTX_HEIGHT_INDEX = "assettx_height";
+static const string DB_ADDRESS_ASSETTX_HEIGHT_INDEX = "address_assettx_height";
 static const string DB_PUTCANDY_INDEX = "putcandy";
 static const string DB_GETCANDY_INDEX = "getcandy";
 static const string DB_CANDYHEIGHT_TOTALAMOUNT_INDEX = "candyheight_totalamount";
 static const string DB_CANDYHEIGHT_INDEX = "candyheight";
 static const string DB_GETCANDYCOUNT_INDEX = "getcandycount";
+static const string DB_ADDRESS_APPTX_INDEX = "address_apptx";
+static const string DB_ADDRESS_ASSETTX_INDEX = "address_assettx";
+static const string DB_ASSETSUPPLY_INDEX = "assetsupply";
+static const string DB_ASSETBALANCE_INDEX = "assetbalance";
+
+//! rows written per batch while building the address indexes
+static const unsigned int ADDRESSTX_UPGRADE_BATCH_SIZE = 10000;
+static const unsigned int COINS_UPGRADE_BATCH_SIZE = 10000;
 static const string DB_MASTERNODE_PAYEE_INDEX ="masternode_payee";
 static const string DB_LOCAL_START_SAVE_PAYEE_HEIGHT_INDEX ="localstartsavepayee_height";
 
@@ -92,7 +111,85 @@ bool CCoinsViewDB::BatchWrite(CCoinsMap &mapCoins, const uint256 &hashBlock) {
     return db.WriteBatch(batch);
 }
 
-CBlockTreeDB::CBlockTreeDB(size_t nCacheSize, bool fMemory, bool fWipe) : CDBWrapper(GetDataDir() / "blocks" / "index", nCacheSize, fMemory, fWipe) {
+bool CCoinsViewDB::Upgrade() {
+    // an older version that runs on the converted coins finds no best block and writes its own
+    uint256 hashLegacyBest;
+    bool fLegacyBest = db.Read(DB_LEGACY_BEST_BLOCK, hashLegacyBest);
+    if (fLegacyBest && db.Exists(DB_BEST_BLOCK))
+        return error("%s: the chainstate was written by an older version after the upgrade, restart with -reindex-chainstate", __func__);
+
+    CDBBatch batch(&db.GetObfuscateKey());
+    // the best block moves with the first batch of converted coins
+    if (fLegacyBest) {
+        batch.Erase(DB_LEGACY_BEST_BLOCK);
+        batch.Write(DB_BEST_BLOCK, hashLegacyBest);
+    }
+
+    boost::scoped_ptr<CDBIterator> pcursor(db.NewIterator());
+    pcursor->Seek(make_pair(DB_LEGACY_COINS, uint256()));
+    std::pair<char, uint256> key;
+    if (!pcursor->Valid() || !pcursor->GetKey(key) || key.first != DB_LEGACY_COINS)
+        return !fLegacyBest || db.WriteBatch(batch, true);
+
+    LogPrintf("%s: converting the coins database to the compact txout encoding...\n", __func__);
+    uiInterface.ShowProgress(_("Upgrading UTXO database"), 0);
+
+    int64_t nStart = GetTimeMillis();
+    unsigned int nCount = 0;
+    uint64_t nSizeBefore = 0;
+    uint64_t nSizeAfter = 0;
+    int nReportDone = 0;
+    while (pcursor->Valid())
+    {
+        boost::this_thread::interruption_point();
+        if (!pcursor->GetKey(key) || key.first != DB_LEGACY_COINS)
+            break;
+
+        CCoins coins;
+        CLegacyCoinsFormat legacyCoins(coins);
+        if (!pcursor->GetValue(legacyCoins))
+            return error("%s: unable to read coins of %s", __func__, key.second.ToString());
+
+        nSizeBefore += pcursor->GetValueSize();
+        nSizeAfter += ::GetSerializeSize(coins, SER_DISK, CLIENT_VERSION);
+        // the old record goes in the same batch, a restart picks up the rest
+        batch.Erase(key);
+        batch.Write(make_pair(DB_COINS, key.second), coins);
+        if (++nCount % COINS_UPGRADE_BATCH_SIZE == 0)
+        {
+            if (!db.WriteBatch(batch))
+                return error("%s: write coins failed", __func__);
+            batch.Clear();
+
+            // txids are in key order, their leading bytes tell the progress
+            uint32_t nHigh = 0x100 * *key.second.begin() + *(key.second.begin() + 1);
+            int nDone = (int)(nHigh * 100.0 / 65536.0 + 0.5);
+            uiInterface.ShowProgress(_("Upgrading UTXO database"), nDone);
+            if (nDone >= nReportDone + 10)
+            {
+                nReportDone = nDone / 10 * 10;
+                LogPrintf("[%d%%]...", nReportDone);
+            }
+        }
+        pcursor->Next();
+    }
+
+    if (!db.WriteBatch(batch, true))
+        return error("%s: write coins failed", __func__);
+    uiInterface.ShowProgress("", 100);
+
+    LogPrintf("[DONE].\n");
+    LogPrintf("%s: converted %u transactions in %dms, %u bytes before, %u bytes after\n", __func__, nCount, GetTimeMillis() - nStart, nSizeBefore, nSizeAfter);
+    return true;
+}
+
+CBlockTreeDB::CBlockTreeDB(size_t nCacheSize, bool fMemory, bool fWipe) : CDBWrapper(GetDataDir() / "blocks" / "index", nCacheSize, fMemory, fWipe),
+    appInfoCache(DEFAULT_APPASSET_CACHE_SIZE),
+    appNameCache(DEFAULT_APPASSET_CACHE_SIZE),
+    assetInfoCache(DEFAULT_APPASSET_CACHE_SIZE),
+    shortNameCache(DEFAULT_APPASSET_CACHE_SIZE),
+    assetNameCache(DEFAULT_APPASSET_CACHE_SIZE),
+    getCandyCountCache(DEFAULT_APPASSET_CACHE_SIZE) {
 }
 
 bool CBlockTreeDB::ReadBlockFileInfo(int nFile, CBlockFileInfo &info) {
@@ -324,6 +421,150 @@ bool CBlockTreeDB::ReadFlag(const std::string &name, bool &fValue) {
     return true;
 }
 
+bool CBlockTreeDB::Read_AddressTx_Index(const std::string& strIndex, const std::string& strAddress, std::vector<uint256>& vId)
+{
+    boost::scoped_ptr<CDBIterator> pcursor(NewIterator());
+
+    pcursor->Seek(make_pair(strIndex, CIterator_AddressKey(strAddress)));
+
+    // the rows of one id are adjacent, jump past them once the id is known
+    const COutPoint outLast(uint256S("ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff"), std::numeric_limits<uint32_t>::max());
+
+    int nCurHeight = g_nChainHeight;
+    while (pcursor->Valid())
+    {
+        boost::this_thread::interruption_point();
+        std::pair<std::string, CAddressTx_IndexKey> key;
+        if (pcursor->GetKey(key) && key.first == strIndex && key.second.strAddress == strAddress)
+        {
+            int nHeight;
+            if(!pcursor->GetValue(nHeight))
+                return error("failed to get %s index value", strIndex);
+
+            if(nCurHeight >= nHeight)
+            {
+                vId.push_back(key.second.id);
+                pcursor->Seek(make_pair(strIndex, CAddressTx_IndexKey(strAddress, key.second.id, outLast)));
+            }
+            else
+            {
+                pcursor->Next();
+            }
+        }
+        else
+        {
+            break;
+        }
+    }
+
+    return vId.size();
+}
+
+bool CBlockTreeDB::Upgrade_AddressTx_Index()
+{
+    bool fUpgraded = false;
+    if(ReadFlag("addresstxindex", fUpgraded) && fUpgraded)
+        return true;
+
+    LogPrintf("%s: building the address indexes of asset and app transactions...\n", __func__);
+
+    unsigned int nCount = 0;
+    CDBBatch batch(&GetObfuscateKey());
+    boost::scoped_ptr<CDBIterator> pcursor(NewIterator());
+
+    pcursor->Seek(make_pair(DB_APPTX_INDEX, CIterator_IdKey()));
+    while (pcursor->Valid())
+    {
+        boost::this_thread::interruption_point();
+        std::pair<std::string, CAppTx_IndexKey> key;
+        if (!pcursor->GetKey(key) || key.first != DB_APPTX_INDEX)
+            break;
+
+        int nHeight;
+        if(!pcursor->GetValue(nHeight))
+            return error("failed to get apptx index value");
+
+        batch.Write(make_pair(DB_ADDRESS_APPTX_INDEX, CAddressTx_IndexKey(key.second.strAddress, key.second.appId, key.second.out)), nHeight);
+        if(++nCount % ADDRESSTX_UPGRADE_BATCH_SIZE == 0)
+        {
+            if(!WriteBatch(batch))
+                return error("%s: write address_apptx index failed", __func__);
+            batch.Clear();
+        }
+        pcursor->Next();
+    }
+
+    pcursor->Seek(make_pair(DB_ASSETTX_INDEX, CIterator_IdKey()));
+    while (pcursor->Valid())
+    {
+        boost::this_thread::interruption_point();
+        std::pair<std::string, CAssetTx_IndexKey> key;
+        if (!pcursor->GetKey(key) || key.first != DB_ASSETTX_INDEX)
+            break;
+
+        int nHeight;
+        if(!pcursor->GetValue(nHeight))
+            return error("failed to get assettx index value");
+
+        batch.Write(make_pair(DB_ADDRESS_ASSETTX_INDEX, CAddressTx_IndexKey(key.second.strAddress, key.second.assetId, key.second.out)), nHeight);
+        if(++nCount % ADDRESSTX_UPGRADE_BATCH_SIZE == 0)
+        {
+            if(!WriteBatch(batch))
+                return error("%s: write address_assettx index failed", __func__);
+            batch.Clear();
+        }
+        pcursor->Next();
+    }
+
+    if(!WriteBatch(batch, true))
+        return error("%s: write address indexes failed", __func__);
+
+    LogPrintf("%s: indexed %u asset and app transaction outputs\n", __func__, nCount);
+    return WriteFlag("addresstxindex", true);
+}
+
+bool CBlockTreeDB::Upgrade_AssetTxHeight_Index()
+{
+    bool fUpgraded = false;
+    if(ReadFlag("assettxheightindex", fUpgraded) && fUpgraded)
+        return true;
+
+    LogPrintf("%s: building the height ordered asset tx indexes...\n", __func__);
+
+    unsigned int nCount = 0;
+    CDBBatch batch(&GetObfuscateKey());
+    boost::scoped_ptr<CDBIterator> pcursor(NewIterator());
+
+    pcursor->Seek(make_pair(DB_ASSETTX_INDEX, CIterator_IdKey()));
+    while (pcursor->Valid())
+    {
+        boost::this_thread::interruption_point();
+        std::pair<std::string, CAssetTx_IndexKey> key;
+        if (!pcursor->GetKey(key) || key.first != DB_ASSETTX_INDEX)
+            break;
+
+        int nHeight;
+        if(!pcursor->GetValue(nHeight))
+            return error("failed to get assettx index value");
+
+        batch.Write(make_pair(DB_ASSETTX_HEIGHT_INDEX, CAssetTxHeight_IndexKey(key.second, nHeight)), nHeight);
+        batch.Write(make_pair(DB_ADDRESS_ASSETTX_HEIGHT_INDEX, CAddressAssetTxHeight_IndexKey(key.second, nHeight)), nHeight);
+        if(++nCount % ADDRESSTX_UPGRADE_BATCH_SIZE == 0)
+        {
+            if(!WriteBatch(batch))
+                return error("%s: write assettx height indexes failed", __func__);
+            batch.Clear();
+        }
+        pcursor->Next();
+    }
+
+    if(!WriteBatch(batch, true))
+        return error("%s: write assettx height indexes failed", __func__);
+
+    LogPrintf("%s: indexed %u asset transaction outputs\n", __func__, nCount);
+    return WriteFlag("assettxheightindex", true);
+}
+
 bool CBlockTreeDB::LoadBlockIndexGuts()
 {
     boost::scoped_ptr<CDBIterator> pcursor(NewIterator());
@@ -378,25 +619,119 @@ bool CBlockTreeDB::LoadBlockIndexGuts()
     return true;
 }
 
-bool CBlockTreeDB::Write_AppId_AppInfo_Index(const std::vector<std::pair<uint256, CAppId_AppInfo_IndexValue> > &vect)
+template<typename K, typename V>
+static void BatchWriteOrErase(CDBBatch& batch, const bool fWrite, const std::string& strIndex, const std::vector<std::pair<K, V> >& vect)
 {
-    CDBBatch batch(&GetObfuscateKey());
-    for (std::vector<std::pair<uint256, CAppId_AppInfo_IndexValue> >::const_iterator it=vect.begin(); it!=vect.end(); it++)
-        batch.Write(make_pair(DB_APPID_APPINFO_INDEX, it->first), it->second);
-    return WriteBatch(batch);
+    for (typename std::vector<std::pair<K, V> >::const_iterator it = vect.begin(); it != vect.end(); it++)
+    {
+        if (fWrite)
+            batch.Write(make_pair(strIndex, it->first), it->second);
+        else
+            batch.Erase(make_pair(strIndex, it->first));
+    }
 }
 
-bool CBlockTreeDB::Erase_AppId_AppInfo_Index(const std::vector<std::pair<uint256, CAppId_AppInfo_IndexValue> > &vect)
+static void BatchWriteOrEraseName(CDBBatch& batch, const bool fWrite, const std::string& strIndex, const std::vector<std::pair<std::string, CName_Id_IndexValue> >& vect)
+{
+    for (std::vector<std::pair<std::string, CName_Id_IndexValue> >::const_iterator it = vect.begin(); it != vect.end(); it++)
+    {
+        if (fWrite)
+            batch.Write(make_pair(strIndex, ToLower(it->first)), it->second);
+        else
+            batch.Erase(make_pair(strIndex, ToLower(it->first)));
+    }
+}
+
+bool CBlockTreeDB::WriteSideIndexes(const CSideIndexWriteSet& writeSet, const bool fConnect)
 {
     CDBBatch batch(&GetObfuscateKey());
-    for (std::vector<std::pair<uint256, CAppId_AppInfo_IndexValue> >::const_iterator it=vect.begin(); it!=vect.end(); it++)
-        batch.Erase(make_pair(DB_APPID_APPINFO_INDEX, it->first));
-    return WriteBatch(batch);
+
+    BatchWriteOrErase(batch, fConnect, DB_APPID_APPINFO_INDEX, writeSet.appId_appInfo_index);
+    BatchWriteOrEraseName(batch, fConnect, DB_APPNAME_APPID_INDEX, writeSet.appName_appId_index);
+    for (std::vector<std::pair<CAuth_IndexKey, int> >::const_iterator it = writeSet.auth_index.begin(); it != writeSet.auth_index.end(); it++)
+    {
+        if (it->second <= 0)
+            batch.Erase(make_pair(DB_AUTH_INDEX, it->first));
+        else
+            batch.Write(make_pair(DB_AUTH_INDEX, it->first), it->second);
+    }
+    for (std::vector<std::pair<CAppTx_IndexKey, int> >::const_iterator it = writeSet.appTx_index.begin(); it != writeSet.appTx_index.end(); it++)
+    {
+        std::pair<std::string, CAddressTx_IndexKey> addressKey = make_pair(DB_ADDRESS_APPTX_INDEX, CAddressTx_IndexKey(it->first.strAddress, it->first.appId, it->first.out));
+        if (fConnect)
+        {
+            batch.Write(make_pair(DB_APPTX_INDEX, it->first), it->second);
+            batch.Write(addressKey, it->second);
+        }
+        else
+        {
+            batch.Erase(make_pair(DB_APPTX_INDEX, it->first));
+            batch.Erase(addressKey);
+        }
+    }
+
+    BatchWriteOrErase(batch, fConnect, DB_ASSETID_ASSETINFO_INDEX, writeSet.assetId_assetInfo_index);
+    BatchWriteOrEraseName(batch, fConnect, DB_SHORTNAME_ASSETID_INDEX, writeSet.shortName_assetId_index);
+    BatchWriteOrEraseName(batch, fConnect, DB_ASSETNAME_ASSETID_INDEX, writeSet.assetName_assetId_index);
+    BatchWriteOrErase(batch, fConnect, DB_PUTCANDY_INDEX, writeSet.putCandy_index);
+    BatchWriteOrErase(batch, fConnect, DB_GETCANDY_INDEX, writeSet.getCandy_index);
+    for (std::vector<std::pair<CAssetTx_IndexKey, int> >::const_iterator it = writeSet.assetTx_index.begin(); it != writeSet.assetTx_index.end(); it++)
+    {
+        std::pair<std::string, CAddressTx_IndexKey> addressKey = make_pair(DB_ADDRESS_ASSETTX_INDEX, CAddressTx_IndexKey(it->first.strAddress, it->first.assetId, it->first.out));
+        std::pair<std::string, CAssetTxHeight_IndexKey> heightKey = make_pair(DB_ASSETTX_HEIGHT_INDEX, CAssetTxHeight_IndexKey(it->first, it->second));
+        std::pair<std::string, CAddressAssetTxHeight_IndexKey> addressHeightKey = make_pair(DB_ADDRESS_ASSETTX_HEIGHT_INDEX, CAddressAssetTxHeight_IndexKey(it->first, it->second));
+        if (fConnect)
+        {
+            batch.Write(make_pair(DB_ASSETTX_INDEX, it->first), it->second);
+            batch.Write(addressKey, it->second);
+            batch.Write(heightKey, it->second);
+            batch.Write(addressHeightKey, it->second);
+        }
+        else
+        {
+            batch.Erase(make_pair(DB_ASSETTX_INDEX, it->first));
+            batch.Erase(addressKey);
+            batch.Erase(heightKey);
+            batch.Erase(addressHeightKey);
+        }
+    }
+    BatchUpdate_AssetSupply(batch, writeSet.assetSupply_index, fConnect);
+    // a balance that doesn't add up means the index is corrupted, nothing is written
+    if (!BatchUpdate_AssetBalance(batch, writeSet.assetBalance_index, fConnect))
+        return false;
+    BatchUpdate_GetCandyCount(batch, writeSet.getCandyCount_index, fConnect);
+
+    if (writeSet.nLocalStartSavePayeeHeight != 0)
+        batch.Write(DB_LOCAL_START_SAVE_PAYEE_HEIGHT_INDEX, writeSet.nLocalStartSavePayeeHeight);
+    if (!writeSet.strPubKeyCollateralAddress.empty())
+    {
+        if (fConnect || writeSet.masternodePayment_IndexValue.nPayeeTimes > 0)
+            batch.Write(make_pair(DB_MASTERNODE_PAYEE_INDEX, writeSet.strPubKeyCollateralAddress), writeSet.masternodePayment_IndexValue);
+        else
+            batch.Erase(make_pair(DB_MASTERNODE_PAYEE_INDEX, writeSet.strPubKeyCollateralAddress));
+    }
+
+    if (!WriteBatch(batch))
+        return false;
+
+    for (std::vector<std::pair<uint256, CAppId_AppInfo_IndexValue> >::const_iterator it = writeSet.appId_appInfo_index.begin(); it != writeSet.appId_appInfo_index.end(); it++)
+        appInfoCache.Erase(it->first);
+    for (std::vector<std::pair<std::string, CName_Id_IndexValue> >::const_iterator it = writeSet.appName_appId_index.begin(); it != writeSet.appName_appId_index.end(); it++)
+        appNameCache.Erase(ToLower(it->first));
+    for (std::vector<std::pair<uint256, CAssetId_AssetInfo_IndexValue> >::const_iterator it = writeSet.assetId_assetInfo_index.begin(); it != writeSet.assetId_assetInfo_index.end(); it++)
+        assetInfoCache.Erase(it->first);
+    for (std::vector<std::pair<std::string, CName_Id_IndexValue> >::const_iterator it = writeSet.shortName_assetId_index.begin(); it != writeSet.shortName_assetId_index.end(); it++)
+        shortNameCache.Erase(ToLower(it->first));
+    for (std::vector<std::pair<std::string, CName_Id_IndexValue> >::const_iterator it = writeSet.assetName_assetId_index.begin(); it != writeSet.assetName_assetId_index.end(); it++)
+        assetNameCache.Erase(ToLower(it->first));
+    for (std::map<CGetCandyCount_IndexKey, CGetCandyCount_IndexValue>::const_iterator it = writeSet.getCandyCount_index.begin(); it != writeSet.getCandyCount_index.end(); it++)
+        getCandyCountCache.Erase(it->first);
+    return true;
 }
 
 bool CBlockTreeDB::Read_AppId_AppInfo_Index(const uint256& appId, CAppId_AppInfo_IndexValue& appInfo)
 {
-    return Read(make_pair(DB_APPID_APPINFO_INDEX, appId), appInfo) && g_nChainHeight >= appInfo.nHeight;
+    return ReadCached(appInfoCache, DB_APPID_APPINFO_INDEX, appId, appInfo) && g_nChainHeight >= appInfo.nHeight;
 }
 
 bool CBlockTreeDB::Read_AppList_Index(std::vector<uint256>& vAppId)
@@ -432,41 +767,9 @@ bool CBlockTreeDB::Read_AppList_Index(std::vector<uint256>& vAppId)
     return vAppId.size();
 }
 
-bool CBlockTreeDB::Write_AppName_AppId_Index(const std::vector<std::pair<std::string, CName_Id_IndexValue> > &vect)
-{
-    CDBBatch batch(&GetObfuscateKey());
-    for (std::vector<std::pair<std::string, CName_Id_IndexValue> >::const_iterator it=vect.begin(); it!=vect.end(); it++)
-        batch.Write(make_pair(DB_APPNAME_APPID_INDEX, ToLower(it->first)), it->second);
-    return WriteBatch(batch);
-}
-
-bool CBlockTreeDB::Erase_AppName_AppId_Index(const std::vector<std::pair<std::string, CName_Id_IndexValue> > &vect)
-{
-    CDBBatch batch(&GetObfuscateKey());
-    for (std::vector<std::pair<std::string, CName_Id_IndexValue> >::const_iterator it=vect.begin(); it!=vect.end(); it++)
-        batch.Erase(make_pair(DB_APPNAME_APPID_INDEX, ToLower(it->first)));
-    return WriteBatch(batch);
-}
-
 bool CBlockTreeDB::Read_AppName_AppId_Index(const std::string& strAppName, CName_Id_IndexValue& value)
 {
-    return Read(make_pair(DB_APPNAME_APPID_INDEX, ToLower(strAppName)), value) && g_nChainHeight >= value.nHeight;
-}
-
-bool CBlockTreeDB::Write_AppTx_Index(const std::vector<std::pair<CAppTx_IndexKey, int> > &vect)
-{
-    CDBBatch batch(&GetObfuscateKey());
-    for(std::vector<std::pair<CAppTx_IndexKey, int> >::const_iterator it = vect.begin(); it != vect.end(); it++)
-        batch.Write(make_pair(DB_APPTX_INDEX, it->first), it->second);
-    return WriteBatch(batch);
-}
-
-bool CBlockTreeDB::Erase_AppTx_Index(const std::vector<std::pair<CAppTx_IndexKey, int> > &vect)
-{
-    CDBBatch batch(&GetObfuscateKey());
-    for(std::vector<std::pair<CAppTx_IndexKey, int> >::const_iterator it = vect.begin(); it != vect.end(); it++)
-        batch.Erase(make_pair(DB_APPTX_INDEX, it->first));
-    return WriteBatch(batch);
+    return ReadCached(appNameCache, DB_APPNAME_APPID_INDEX, ToLower(strAppName), value) && g_nChainHeight >= value.nHeight;
 }
 
 bool CBlockTreeDB::Read_AppTx_Index(const uint256& appId, std::vector<COutPoint>& vOut)
@@ -539,54 +842,9 @@ bool CBlockTreeDB::Read_AppTx_Index(const uint256& appId, const std::string& str
 
 bool CBlockTreeDB::Read_AppList_Index(const std::string& strAddress, std::vector<uint256>& vAppId)
 {
-    boost::scoped_ptr<CDBIterator> pcursor(NewIterator());
-
-    pcursor->Seek(make_pair(DB_APPTX_INDEX, CIterator_IdAddressKey()));
-
-    int nCurHeight = g_nChainHeight;
-    std::map<uint256, char> mapAppId;
-    while (pcursor->Valid())
-    {
-        boost::this_thread::interruption_point();
-        std::pair<std::string, CAppTx_IndexKey> key;
-        if (pcursor->GetKey(key) && key.first == DB_APPTX_INDEX)
-        {
-            int nHeight;
-            if(pcursor->GetValue(nHeight))
-            {
-                if(nCurHeight >= nHeight && key.second.strAddress == strAddress)
-                    mapAppId[key.second.appId] = 1;
-                pcursor->Next();
-            }
-            else
-            {
-                return error("failed to get apptx index value");
-            }
-        }
-        else
-        {
-            break;
-        }
-    }
-
-    for(std::map<uint256, char>::const_iterator it = mapAppId.begin(); it != mapAppId.end(); it++)
-        vAppId.push_back(it->first);
-
-    return vAppId.size();
+    return Read_AddressTx_Index(DB_ADDRESS_APPTX_INDEX, strAddress, vAppId);
 }
 
-bool CBlockTreeDB::Update_Auth_Index(const std::vector<std::pair<CAuth_IndexKey, int> > &vect)
-{
-    CDBBatch batch(&GetObfuscateKey());
-    for(std::vector<std::pair<CAuth_IndexKey, int> >::const_iterator it = vect.begin(); it != vect.end(); it++)
-    {
-        if(it->second <= 0)
-            batch.Erase(make_pair(DB_AUTH_INDEX, it->first));
-        else
-            batch.Write(make_pair(DB_AUTH_INDEX, it->first), it->second);
-    }
-    return WriteBatch(batch);
-}
 bool CBlockTreeDB::Read_Auth_Index(const uint256& appId, const std::string& strAddress, std::map<uint32_t, int>& mapAuth)
 {
     boost::scoped_ptr<CDBIterator> pcursor(NewIterator());
@@ -619,25 +877,9 @@ bool CBlockTreeDB::Read_Auth_Index(const uint256& appId, const std::string& strA
     return mapAuth.size();
 }
 
-bool CBlockTreeDB::Write_AssetId_AssetInfo_Index(const std::vector<std::pair<uint256, CAssetId_AssetInfo_IndexValue> > &vect)
-{
-    CDBBatch batch(&GetObfuscateKey());
-    for (std::vector<std::pair<uint256, CAssetId_AssetInfo_IndexValue> >::const_iterator it=vect.begin(); it!=vect.end(); it++)
-        batch.Write(make_pair(DB_ASSETID_ASSETINFO_INDEX, it->first), it->second);
-    return WriteBatch(batch);
-}
-
-bool CBlockTreeDB::Erase_AssetId_AssetInfo_Index(const std::vector<std::pair<uint256, CAssetId_AssetInfo_IndexValue> > &vect)
-{
-    CDBBatch batch(&GetObfuscateKey());
-    for (std::vector<std::pair<uint256, CAssetId_AssetInfo_IndexValue> >::const_iterator it=vect.begin(); it!=vect.end(); it++)
-        batch.Erase(make_pair(DB_ASSETID_ASSETINFO_INDEX, it->first));
-    return WriteBatch(batch);
-}
-
 bool CBlockTreeDB::Read_AssetId_AssetInfo_Index(const uint256& assetId, CAssetId_AssetInfo_IndexValue& assetInfo)
 {
-    return Read(make_pair(DB_ASSETID_ASSETINFO_INDEX, assetId), assetInfo) && g_nChainHeight >= assetInfo.nHeight;
+    return ReadCached(assetInfoCache, DB_ASSETID_ASSETINFO_INDEX, assetId, assetInfo) && g_nChainHeight >= assetInfo.nHeight;
 }
 
 bool CBlockTreeDB::Read_AssetList_Index(std::vector<uint256>& vAssetId)
@@ -674,62 +916,24 @@ bool CBlockTreeDB::Read_AssetList_Index(std::vector<uint256>& vAssetId)
     return vAssetId.size();
 }
 
-bool CBlockTreeDB::Write_ShortName_AssetId_Index(const std::vector<std::pair<std::string, CName_Id_IndexValue> > &vect)
-{
-    CDBBatch batch(&GetObfuscateKey());
-    for (std::vector<std::pair<std::string, CName_Id_IndexValue> >::const_iterator it=vect.begin(); it!=vect.end(); it++)
-        batch.Write(make_pair(DB_SHORTNAME_ASSETID_INDEX, ToLower(it->first)), it->second);
-    return WriteBatch(batch);
-}
-
-bool CBlockTreeDB::Erase_ShortName_AssetId_Index(const std::vector<std::pair<std::string, CName_Id_IndexValue> > &vect)
-{
-    CDBBatch batch(&GetObfuscateKey());
-    for (std::vector<std::pair<std::string, CName_Id_IndexValue> >::const_iterator it=vect.begin(); it!=vect.end(); it++)
-        batch.Erase(make_pair(DB_SHORTNAME_ASSETID_INDEX, ToLower(it->first)));
-    return WriteBatch(batch);
-}
-
 bool CBlockTreeDB::Read_ShortName_AssetId_Index(const std::string& strShortName, CName_Id_IndexValue& value)
 {
-    return Read(make_pair(DB_SHORTNAME_ASSETID_INDEX, ToLower(strShortName)), value) && g_nChainHeight >= value.nHeight;
-}
-
-bool CBlockTreeDB::Write_AssetName_AssetId_Index(const std::vector<std::pair<std::string, CName_Id_IndexValue> > &vect)
-{
-    CDBBatch batch(&GetObfuscateKey());
-    for (std::vector<std::pair<std::string, CName_Id_IndexValue> >::const_iterator it=vect.begin(); it!=vect.end(); it++)
-        batch.Write(make_pair(DB_ASSETNAME_ASSETID_INDEX, ToLower(it->first)), it->second);
-    return WriteBatch(batch);
-}
-
-bool CBlockTreeDB::Erase_AssetName_AssetId_Index(const std::vector<std::pair<std::string, CName_Id_IndexValue> > &vect)
-{
-    CDBBatch batch(&GetObfuscateKey());
-    for (std::vector<std::pair<std::string, CName_Id_IndexValue> >::const_iterator it=vect.begin(); it!=vect.end(); it++)
-        batch.Erase(make_pair(DB_ASSETNAME_ASSETID_INDEX, ToLower(it->first)));
-    return WriteBatch(batch);
+    return ReadCached(shortNameCache, DB_SHORTNAME_ASSETID_INDEX, ToLower(strShortName), value) && g_nChainHeight >= value.nHeight;
 }
 
 bool CBlockTreeDB::Read_AssetName_AssetId_Index(const std::string& strAssetName, CName_Id_IndexValue& value)
 {
-    return Read(make_pair(DB_ASSETNAME_ASSETID_INDEX, ToLower(strAssetName)), value) && g_nChainHeight >= value.nHeight;
-}
-
-bool CBlockTreeDB::Write_AssetTx_Index(const std::vector<std::pair<CAssetTx_IndexKey, int> > &vect)
-{
-    CDBBatch batch(&GetObfuscateKey());
-    for(std::vector<std::pair<CAssetTx_IndexKey, int> >::const_iterator it = vect.begin(); it != vect.end(); it++)
-        batch.Write(make_pair(DB_ASSETTX_INDEX, it->first), it->second);
-    return WriteBatch(batch);
+    return ReadCached(assetNameCache, DB_ASSETNAME_ASSETID_INDEX, ToLower(strAssetName), value) && g_nChainHeight >= value.nHeight;
 }
 
-bool CBlockTreeDB::Erase_AssetTx_Index(const std::vector<std::pair<CAssetTx_IndexKey, int> > &vect)
+void CBlockTreeDB::GetAppAssetCacheStats(std::map<std::string, CIndexCacheStats>& mapStats) const
 {
-    CDBBatch batch(&GetObfuscateKey());
-    for(std::vector<std::pair<CAssetTx_IndexKey, int> >::const_iterator it = vect.begin(); it != vect.end(); it++)
-        batch.Erase(make_pair(DB_ASSETTX_INDEX, it->first));
-    return WriteBatch(batch);
+    mapStats["appinfo"] = appInfoCache.GetStats();
+    mapStats["appname"] = appNameCache.GetStats();
+    mapStats["assetinfo"] = assetInfoCache.GetStats();
+    mapStats["shortname"] = shortNameCache.GetStats();
+    mapStats["assetname"] = assetNameCache.GetStats();
+    mapStats["getcandycount"] = getCandyCountCache.GetStats();
 }
 
 bool CBlockTreeDB::Read_AssetTx_Index(const uint256& assetId, const uint8_t& nTxClass, std::vector<COutPoint>& vOut)
@@ -841,30 +1045,30 @@ bool CBlockTreeDB::Read_AssetTx_Index(const uint256& assetId, const std::string&
 }
 
 bool CBlockTreeDB::Read_AssetList_Index(const std::string& strAddress, std::vector<uint256>& vAssetId)
+{
+    return Read_AddressTx_Index(DB_ADDRESS_ASSETTX_INDEX, strAddress, vAssetId);
+}
+
+bool CBlockTreeDB::Read_AssetTx_Index(const std::set<uint8_t>& setTxClass, std::vector<std::pair<CAssetTx_IndexKey, int> >& vKey)
 {
     boost::scoped_ptr<CDBIterator> pcursor(NewIterator());
 
-    pcursor->Seek(make_pair(DB_ASSETTX_INDEX, CIterator_IdAddressKey()));
+    pcursor->Seek(make_pair(DB_ASSETTX_INDEX, CIterator_IdKey()));
 
-    int nCurHeight = g_nChainHeight;
-    std::map<uint256, char> mapAssetId;
     while (pcursor->Valid())
     {
         boost::this_thread::interruption_point();
         std::pair<std::string, CAssetTx_IndexKey> key;
         if (pcursor->GetKey(key) && key.first == DB_ASSETTX_INDEX)
         {
-            int nHeight;
-            if(pcursor->GetValue(nHeight))
-            {
-                if(nCurHeight >= nHeight && key.second.strAddress == strAddress)
-                    mapAssetId[key.second.assetId] = 1;
-                pcursor->Next();
-            }
-            else
+            int nHeight = 0;
+            if(setTxClass.count(key.second.nTxClass))
             {
-                return error("failed to get assettx index value");
+                if(!pcursor->GetValue(nHeight))
+                    return error("failed to get assettx index value");
+                vKey.push_back(make_pair(key.second, nHeight));
             }
+            pcursor->Next();
         }
         else
         {
@@ -872,28 +1076,69 @@ bool CBlockTreeDB::Read_AssetList_Index(const std::string& strAddress, std::vect
         }
     }
 
-    for(std::map<uint256, char>::iterator it = mapAssetId.begin(); it != mapAssetId.end(); it++)
-        vAssetId.push_back(it->first);
+    return vKey.size();
+}
 
-    return vAssetId.size();
+void CBlockTreeDB::BatchUpdate_AssetSupply(CDBBatch& batch, const std::map<uint256, CAssetSupply_IndexValue>& mapDelta, const bool fAdd)
+{
+    for(std::map<uint256, CAssetSupply_IndexValue>::const_iterator it = mapDelta.begin(); it != mapDelta.end(); it++)
+    {
+        CAssetSupply_IndexValue supply;
+        Read(make_pair(DB_ASSETSUPPLY_INDEX, it->first), supply);
+        if(fAdd)
+            supply += it->second;
+        else
+            supply -= it->second;
+
+        if(supply.IsNull())
+            batch.Erase(make_pair(DB_ASSETSUPPLY_INDEX, it->first));
+        else
+            batch.Write(make_pair(DB_ASSETSUPPLY_INDEX, it->first), supply);
+    }
 }
 
-bool CBlockTreeDB::Write_PutCandy_Index(const std::vector<std::pair<CPutCandy_IndexKey, CPutCandy_IndexValue> > &vect)
+bool CBlockTreeDB::Update_AssetSupply_Index(const std::map<uint256, CAssetSupply_IndexValue>& mapDelta, const bool fAdd)
 {
     CDBBatch batch(&GetObfuscateKey());
-    for(std::vector<std::pair<CPutCandy_IndexKey, CPutCandy_IndexValue> >::const_iterator it = vect.begin(); it != vect.end(); it++)
-        batch.Write(make_pair(DB_PUTCANDY_INDEX, it->first), it->second);
+    BatchUpdate_AssetSupply(batch, mapDelta, fAdd);
     return WriteBatch(batch);
 }
 
-bool CBlockTreeDB::Erase_PutCandy_Index(const std::vector<std::pair<CPutCandy_IndexKey, CPutCandy_IndexValue> > &vect)
+bool CBlockTreeDB::Read_AssetSupply_Index(const uint256& assetId, CAssetSupply_IndexValue& supply)
+{
+    return Read(make_pair(DB_ASSETSUPPLY_INDEX, assetId), supply);
+}
+
+bool CBlockTreeDB::BatchUpdate_AssetBalance(CDBBatch& batch, const std::map<CAssetBalance_IndexKey, CAssetBalance_IndexValue>& mapDelta, const bool fAdd)
+{
+    for(std::map<CAssetBalance_IndexKey, CAssetBalance_IndexValue>::const_iterator it = mapDelta.begin(); it != mapDelta.end(); it++)
+    {
+        CAssetBalance_IndexValue balance;
+        Read(make_pair(DB_ASSETBALANCE_INDEX, it->first), balance);
+        if(!(fAdd ? balance.Add(it->second) : balance.Sub(it->second)))
+            return error("%s: asset %s balance of %s out of range", __func__, it->first.assetId.ToString(), it->first.strAddress);
+
+        if(balance.IsNull())
+            batch.Erase(make_pair(DB_ASSETBALANCE_INDEX, it->first));
+        else
+            batch.Write(make_pair(DB_ASSETBALANCE_INDEX, it->first), balance);
+    }
+    return true;
+}
+
+bool CBlockTreeDB::Update_AssetBalance_Index(const std::map<CAssetBalance_IndexKey, CAssetBalance_IndexValue>& mapDelta, const bool fAdd)
 {
     CDBBatch batch(&GetObfuscateKey());
-    for(std::vector<std::pair<CPutCandy_IndexKey, CPutCandy_IndexValue> >::const_iterator it = vect.begin(); it != vect.end(); it++)
-        batch.Erase(make_pair(DB_PUTCANDY_INDEX, it->first));
+    if(!BatchUpdate_AssetBalance(batch, mapDelta, fAdd))
+        return false;
     return WriteBatch(batch);
 }
 
+bool CBlockTreeDB::Read_AssetBalance_Index(const CAssetBalance_IndexKey& key, CAssetBalance_IndexValue& balance)
+{
+    return Read(make_pair(DB_ASSETBALANCE_INDEX, key), balance);
+}
+
 bool CBlockTreeDB::Read_PutCandy_Index(const uint256& assetId, std::map<COutPoint, CCandyInfo>& mapCandyInfo)
 {
     boost::scoped_ptr<CDBIterator> pcursor(NewIterator());
@@ -999,22 +1244,6 @@ bool CBlockTreeDB::Read_PutCandy_Index(std::map<CPutCandy_IndexKey, CPutCandy_In
     return mapCandy.size();
 }
 
-bool CBlockTreeDB::Write_GetCandy_Index(const std::vector<std::pair<CGetCandy_IndexKey, CGetCandy_IndexValue> >& vect)
-{
-    CDBBatch batch(&GetObfuscateKey());
-    for(std::vector<std::pair<CGetCandy_IndexKey, CGetCandy_IndexValue> >::const_iterator it = vect.begin(); it != vect.end(); it++)
-        batch.Write(make_pair(DB_GETCANDY_INDEX, it->first), it->second);
-    return WriteBatch(batch);
-}
-
-bool CBlockTreeDB::Erase_GetCandy_Index(const std::vector<std::pair<CGetCandy_IndexKey, CGetCandy_IndexValue> >& vect)
-{
-    CDBBatch batch(&GetObfuscateKey());
-    for(std::vector<std::pair<CGetCandy_IndexKey, CGetCandy_IndexValue> >::const_iterator it = vect.begin(); it != vect.end(); it++)
-        batch.Erase(make_pair(DB_GETCANDY_INDEX, it->first));
-    return WriteBatch(batch);
-}
-
 bool CBlockTreeDB::Read_GetCandy_Index(const uint256& assetId, const COutPoint& out, const std::string& strAddress, CAmount& nAmount)
 {
     boost::scoped_ptr<CDBIterator> pcursor(NewIterator());
@@ -1199,88 +1428,63 @@ bool CBlockTreeDB::Write_GetCandyCount_Index(const CGetCandyCount_IndexKey& key,
 {
     CDBBatch batch(&GetObfuscateKey());
     batch.Write(make_pair(DB_GETCANDYCOUNT_INDEX, key), value);
-    return WriteBatch(batch);
+    if (!WriteBatch(batch))
+        return false;
+    getCandyCountCache.Erase(key);
+    return true;
 }
 
 bool CBlockTreeDB::Erase_GetCandyCount_Index(const CGetCandyCount_IndexKey &key)
 {
     CDBBatch batch(&GetObfuscateKey());
     batch.Erase(make_pair(DB_GETCANDYCOUNT_INDEX, key));
-    return WriteBatch(batch);
+    if (!WriteBatch(batch))
+        return false;
+    getCandyCountCache.Erase(key);
+    return true;
 }
 
 bool CBlockTreeDB::Is_Exists_GetCandyCount_Key(const uint256& assetId, const COutPoint& out)
 {
-    boost::scoped_ptr<CDBIterator> pcursor(NewIterator());
-    pcursor->Seek(make_pair(DB_GETCANDYCOUNT_INDEX, CGetCandyCount_IndexKey(assetId, out)));
-
-    bool ret = false;
-    while (pcursor->Valid())
-    {
-        boost::this_thread::interruption_point();
-        std::pair<std::string, CGetCandyCount_IndexKey> key;
-        if (pcursor->GetKey(key) && key.first == DB_GETCANDYCOUNT_INDEX && key.second.assetId == assetId && key.second.out == out)
-        {
-            ret = true;
-            break;
-        }
-        else
-        {
-            break;
-        }
-    }
-
-    return ret;
+    CGetCandyCount_IndexValue value;
+    return ReadCached(getCandyCountCache, DB_GETCANDYCOUNT_INDEX, CGetCandyCount_IndexKey(assetId, out), value);
 }
 
 bool CBlockTreeDB::Read_GetCandyCount_Index(const uint256& assetId, const COutPoint& out,CGetCandyCount_IndexValue& getCandyCountvalue)
 {
-    boost::scoped_ptr<CDBIterator> pcursor(NewIterator());
-    pcursor->Seek(make_pair(DB_GETCANDYCOUNT_INDEX, CGetCandyCount_IndexKey(assetId, out)));
+    return ReadCached(getCandyCountCache, DB_GETCANDYCOUNT_INDEX, CGetCandyCount_IndexKey(assetId, out), getCandyCountvalue);
+}
 
-    bool ret = false;
-    while (pcursor->Valid())
+void CBlockTreeDB::BatchUpdate_GetCandyCount(CDBBatch& batch, const std::map<CGetCandyCount_IndexKey, CGetCandyCount_IndexValue>& mapDelta, const bool fAdd)
+{
+    for (std::map<CGetCandyCount_IndexKey, CGetCandyCount_IndexValue>::const_iterator it = mapDelta.begin(); it != mapDelta.end(); it++)
     {
-        boost::this_thread::interruption_point();
-        std::pair<std::string, CGetCandyCount_IndexKey> key;
-        if (pcursor->GetKey(key) && key.first == DB_GETCANDYCOUNT_INDEX && key.second.assetId == assetId && key.second.out == out)
+        const CGetCandyCount_IndexKey& key = it->first;
+        CGetCandyCount_IndexValue value;
+        if (!ReadCached(getCandyCountCache, DB_GETCANDYCOUNT_INDEX, key, value))
+            value = CGetCandyCount_IndexValue();
+
+        if (fAdd)
         {
-            if(pcursor->GetValue(getCandyCountvalue))
-            {
-                ret = true;
-                break;
-            }
-            else
-            {
-                return error("failed to get getcandy index value");
-            }
+            value.nGetCandyCount += it->second.nGetCandyCount;
         }
         else
         {
-            break;
+            value.nGetCandyCount -= it->second.nGetCandyCount;
+            if (value.nGetCandyCount < 0)
+            {
+                LogPrintf("disconnect getCandyAmountError:currCount:%d,deltaCount:%d\n", value.nGetCandyCount, it->second.nGetCandyCount);
+                value.nGetCandyCount = 0;
+            }
         }
-    }
-
-    return ret;
-}
-
-bool CBlockTreeDB::Write_MasternodePayee_Index(const std::string& strPubKeyCollateralAddress, const CMasternodePayee_IndexValue& value)
-{
-    CDBBatch batch(&GetObfuscateKey());
-    batch.Write(make_pair(DB_MASTERNODE_PAYEE_INDEX, strPubKeyCollateralAddress), value);
-    return WriteBatch(batch);
-}
-
-bool CBlockTreeDB::Erase_MasternodePayee_Index(const string &strPubKeyCollateralAddress)
-{
-    CDBBatch batch(&GetObfuscateKey());
-    batch.Erase(make_pair(DB_MASTERNODE_PAYEE_INDEX, strPubKeyCollateralAddress));
-    return WriteBatch(batch);
-}
+        LogPrint("asset", "check-getcandy:leveldb_%s_candy:%s,%s,currAmount:%d,totalAmount:%d\n", fAdd ? "add" : "sub", key.assetId.ToString(), key.out.ToString(),
+                 it->second.nGetCandyCount, value.nGetCandyCount);
 
-bool CBlockTreeDB::Read_MasternodePayee_Index(const string &strPubKeyCollateralAddress, CMasternodePayee_IndexValue &value)
-{
-    return Read(make_pair(DB_MASTERNODE_PAYEE_INDEX, strPubKeyCollateralAddress), value);
+        if (value.nGetCandyCount == 0)
+            batch.Erase(make_pair(DB_GETCANDYCOUNT_INDEX, key));
+        else
+            batch.Write(make_pair(DB_GETCANDYCOUNT_INDEX, key), value);
+    }
 }
 
 bool CBlockTreeDB::Read_MasternodePayee_Index(std::map<string, CMasternodePayee_IndexValue> &mapPayeeInfo)
@@ -1314,59 +1518,104 @@ bool CBlockTreeDB::Read_MasternodePayee_Index(std::map<string, CMasternodePayee_
     return mapPayeeInfo.size();
 }
 
-bool CBlockTreeDB::Is_Exists_MasternodePayee_Key(const string &strPubKeyCollateralAddress)
+bool CBlockTreeDB::Read_LocalStartSavePayeeHeight_Index(int &nHeight)
 {
     boost::scoped_ptr<CDBIterator> pcursor(NewIterator());
-    pcursor->Seek(make_pair(DB_MASTERNODE_PAYEE_INDEX, strPubKeyCollateralAddress));
+    pcursor->Seek(DB_LOCAL_START_SAVE_PAYEE_HEIGHT_INDEX);
 
     bool ret = false;
     while (pcursor->Valid())
     {
         boost::this_thread::interruption_point();
-        std::pair<std::string, std::string> key;
-        if (pcursor->GetKey(key) && key.first == DB_MASTERNODE_PAYEE_INDEX && key.second == strPubKeyCollateralAddress)
+        std::pair<std::string, CGetCandyCount_IndexKey> key;
+        int height = 0;
+        if(pcursor->GetValue(height))
         {
+            nHeight = height;
             ret = true;
             break;
         }
         else
         {
-            break;
+            return error("failed to get local start save payee height index value");
         }
     }
 
     return ret;
 }
 
-bool CBlockTreeDB::Write_LocalStartSavePayeeHeight_Index(const int &nHeight)
+static bool IsAssetTxClass(const uint8_t& nKeyTxClass, const uint8_t& nTxClass)
 {
-    CDBBatch batch(&GetObfuscateKey());
-    batch.Write(DB_LOCAL_START_SAVE_PAYEE_HEIGHT_INDEX, nHeight);
-    return WriteBatch(batch);
+    if(nTxClass == ALL_TXOUT)
+        return true;
+    if(nTxClass == UNLOCKED_TXOUT)
+        return nKeyTxClass != LOCKED_TXOUT;
+    return nKeyTxClass == nTxClass;
 }
 
-bool CBlockTreeDB::Read_LocalStartSavePayeeHeight_Index(int &nHeight)
+CAssetTxIterator::CAssetTxIterator(CBlockTreeDB& db, const uint256& assetId, const std::string& strAddress, const uint8_t& nTxClass, const int& nMaxHeight)
+    : pcursor(db.NewIterator()), assetId(assetId), strAddress(strAddress), nTxClass(nTxClass), nMaxHeight(nMaxHeight), fValid(false), nHeight(0)
 {
-    boost::scoped_ptr<CDBIterator> pcursor(NewIterator());
-    pcursor->Seek(DB_LOCAL_START_SAVE_PAYEE_HEIGHT_INDEX);
+}
 
-    bool ret = false;
-    while (pcursor->Valid())
+bool CAssetTxIterator::GetKey(int& nKeyHeight, COutPoint& out, uint8_t& nKeyTxClass)
+{
+    if(strAddress.empty())
+    {
+        std::pair<std::string, CAssetTxHeight_IndexKey> key;
+        if(!pcursor->GetKey(key) || key.first != DB_ASSETTX_HEIGHT_INDEX || key.second.assetId != assetId)
+            return false;
+        nKeyHeight = key.second.nHeight;
+        out = key.second.out;
+        nKeyTxClass = key.second.nTxClass;
+        return true;
+    }
+
+    std::pair<std::string, CAddressAssetTxHeight_IndexKey> key;
+    if(!pcursor->GetKey(key) || key.first != DB_ADDRESS_ASSETTX_HEIGHT_INDEX || key.second.assetId != assetId || key.second.strAddress != strAddress)
+        return false;
+    nKeyHeight = key.second.nHeight;
+    out = key.second.out;
+    nKeyTxClass = key.second.nTxClass;
+    return true;
+}
+
+void CAssetTxIterator::SkipTo(const uint256& skipTxId)
+{
+    // the outputs of a transaction are next to each other, they share height and txid
+    fValid = false;
+    int nKeyHeight = 0;
+    COutPoint out;
+    uint8_t nKeyTxClass = 0;
+    while(pcursor->Valid() && GetKey(nKeyHeight, out, nKeyTxClass))
     {
         boost::this_thread::interruption_point();
-        std::pair<std::string, CGetCandyCount_IndexKey> key;
-        int height = 0;
-        if(pcursor->GetValue(height))
-        {
-            nHeight = height;
-            ret = true;
-            break;
-        }
-        else
+        if(nKeyHeight > nMaxHeight)
+            return;
+
+        if(out.hash != skipTxId && IsAssetTxClass(nKeyTxClass, nTxClass))
         {
-            return error("failed to get local start save payee height index value");
+            fValid = true;
+            nHeight = nKeyHeight;
+            txId = out.hash;
+            return;
         }
+        pcursor->Next();
     }
+}
 
-    return ret;
+void CAssetTxIterator::Seek(const CAssetTxCursor& cursor)
+{
+    COutPoint out(cursor.txId, 0);
+    if(strAddress.empty())
+        pcursor->Seek(make_pair(DB_ASSETTX_HEIGHT_INDEX, CAssetTxHeight_IndexKey(assetId, cursor.nHeight, out)));
+    else
+        pcursor->Seek(make_pair(DB_ADDRESS_ASSETTX_HEIGHT_INDEX, CAddressAssetTxHeight_IndexKey(assetId, strAddress, cursor.nHeight, out)));
+    SkipTo(cursor.txId);
+}
+
+void CAssetTxIterator::Next()
+{
+    if(fValid)
+        SkipTo(txId);
 }
@@ -6,15 +6,20 @@
 #ifndef BITCOIN_TXDB_H
 #define BITCOIN_TXDB_H
 
+#include "cachemap.h"
 #include "coins.h"
 #include "dbwrapper.h"
+#include "sync.h"
 #include "validation.h"
 
 #include <map>
+#include <set>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include <boost/scoped_ptr.hpp>
+
 class CBlockFileInfo;
 class CBlockIndex;
 struct CDiskTxPos;
@@ -35,6 +40,10 @@ struct CAuth_IndexKey;
 struct CAppTx_IndexKey;
 struct CAssetId_AssetInfo_IndexValue;
 struct CAssetTx_IndexKey;
+struct CAssetTxCursor;
+struct CAssetSupply_IndexValue;
+struct CAssetBalance_IndexKey;
+struct CAssetBalance_IndexValue;
 struct CPutCandy_IndexKey;
 struct CPutCandy_IndexValue;
 struct CGetCandy_IndexKey;
@@ -47,6 +56,84 @@ static const int64_t nMaxDbCache = sizeof(void*) > 4 ? 16384 : 1024;
 //! min. -dbcache in (MiB)
 static const int64_t nMinDbCache = 4;
 
+//! entries kept by each asset/app metadata cache
+static const uint32_t DEFAULT_APPASSET_CACHE_SIZE = 10000;
+
+struct CIndexCacheStats
+{
+    uint32_t nSize;
+    uint32_t nMaxSize;
+    uint64_t nHits;
+    uint64_t nMisses;
+};
+
+/**
+ * LRU cache in front of one asset/app metadata index of the block tree db.
+ * Keys that are not in the db are cached too, so name availability checks
+ * don't hit leveldb either. Every write or erase of a key drops it.
+ */
+template<typename K, typename V>
+class CIndexCache
+{
+private:
+    typedef std::pair<bool, V> entry_t;
+
+    mutable CCriticalSection cs;
+    CacheMap<K, entry_t> cache;
+    //! bumped by every invalidation, a reader that raced with a write must not cache what it read
+    uint64_t nGeneration;
+    uint64_t nHits;
+    uint64_t nMisses;
+
+public:
+    CIndexCache(uint32_t nMaxSize) : cache(nMaxSize), nGeneration(0), nHits(0), nMisses(0) {}
+
+    /** Returns false on a miss, nGenerationRet must then be passed to Insert() */
+    bool Get(const K& key, bool& fFound, V& value, uint64_t& nGenerationRet)
+    {
+        LOCK(cs);
+        entry_t entry;
+        if(!cache.Get(key, entry))
+        {
+            ++nMisses;
+            nGenerationRet = nGeneration;
+            return false;
+        }
+
+        cache.Touch(key);
+        ++nHits;
+        fFound = entry.first;
+        if(fFound)
+            value = entry.second;
+        return true;
+    }
+
+    void Insert(const K& key, const bool fFound, const V& value, const uint64_t nGenerationIn)
+    {
+        LOCK(cs);
+        if(nGenerationIn == nGeneration)
+            cache.Insert(key, entry_t(fFound, value));
+    }
+
+    void Erase(const K& key)
+    {
+        LOCK(cs);
+        cache.Erase(key);
+        ++nGeneration;
+    }
+
+    CIndexCacheStats GetStats() const
+    {
+        LOCK(cs);
+        CIndexCacheStats stats;
+        stats.nSize = cache.GetSize();
+        stats.nMaxSize = cache.GetMaxSize();
+        stats.nHits = nHits;
+        stats.nMisses = nMisses;
+        return stats;
+    }
+};
+
 /** CCoinsView backed by the coin database (chainstate/) */
 class CCoinsViewDB : public CCoinsView
 {
@@ -60,6 +147,44 @@ public:
     uint256 GetBestBlock() const;
     bool BatchWrite(CCoinsMap &mapCoins, const uint256 &hashBlock);
     bool GetStats(CCoinsStats &stats) const;
+    /**
+     * Convert coins written in CLegacyCoinsFormat, a no-op once none are left.
+     * The best block moves to a key older versions don't read, so they rebuild
+     * the chainstate instead of using the converted one. Fails on a chainstate an
+     * older version wrote to after the upgrade, it needs -reindex-chainstate.
+     */
+    bool Upgrade();
+};
+
+/**
+ * App, asset, candy and masternode payee index changes of one block.
+ *
+ * ConnectBlock() and DisconnectBlock() collect them while walking the block and
+ * CBlockTreeDB::WriteSideIndexes() commits them in a single batch, so a crash
+ * can't leave some of the indexes of a block updated and others not.
+ */
+struct CSideIndexWriteSet
+{
+    std::vector<std::pair<uint256, CAppId_AppInfo_IndexValue> > appId_appInfo_index;
+    std::vector<std::pair<std::string, CName_Id_IndexValue> > appName_appId_index;
+    std::vector<std::pair<CAuth_IndexKey, int> > auth_index;
+    std::vector<std::pair<CAppTx_IndexKey, int> > appTx_index;
+    std::vector<std::pair<uint256, CAssetId_AssetInfo_IndexValue> > assetId_assetInfo_index;
+    std::vector<std::pair<std::string, CName_Id_IndexValue> > shortName_assetId_index;
+    std::vector<std::pair<std::string, CName_Id_IndexValue> > assetName_assetId_index;
+    std::vector<std::pair<CPutCandy_IndexKey, CPutCandy_IndexValue> > putCandy_index;
+    std::vector<std::pair<CGetCandy_IndexKey, CGetCandy_IndexValue> > getCandy_index;
+    std::vector<std::pair<CAssetTx_IndexKey, int> > assetTx_index;
+    std::map<CGetCandyCount_IndexKey, CGetCandyCount_IndexValue> getCandyCount_index;
+    std::map<uint256, CAssetSupply_IndexValue> assetSupply_index;
+    std::map<CAssetBalance_IndexKey, CAssetBalance_IndexValue> assetBalance_index;
+    //! payee of the block, empty if the payee index is left untouched
+    std::string strPubKeyCollateralAddress;
+    CMasternodePayee_IndexValue masternodePayment_IndexValue;
+    //! height the local payee index starts at, only written when it is not 0
+    int nLocalStartSavePayeeHeight;
+
+    CSideIndexWriteSet() : nLocalStartSavePayeeHeight(0) {}
 };
 
 /** Access to the block database (blocks/index/) */
@@ -70,6 +195,31 @@ public:
 private:
     CBlockTreeDB(const CBlockTreeDB&);
     void operator=(const CBlockTreeDB&);
+    bool Read_AddressTx_Index(const std::string& strIndex, const std::string& strAddress, std::vector<uint256>& vId);
+
+    CIndexCache<uint256, CAppId_AppInfo_IndexValue> appInfoCache;
+    CIndexCache<std::string, CName_Id_IndexValue> appNameCache;
+    CIndexCache<uint256, CAssetId_AssetInfo_IndexValue> assetInfoCache;
+    CIndexCache<std::string, CName_Id_IndexValue> shortNameCache;
+    CIndexCache<std::string, CName_Id_IndexValue> assetNameCache;
+    CIndexCache<CGetCandyCount_IndexKey, CGetCandyCount_IndexValue> getCandyCountCache;
+
+    template<typename K, typename V>
+    bool ReadCached(CIndexCache<K, V>& cache, const std::string& strIndex, const K& key, V& value)
+    {
+        bool fFound = false;
+        uint64_t nGeneration = 0;
+        if(cache.Get(key, fFound, value, nGeneration))
+            return fFound;
+
+        fFound = Read(std::make_pair(strIndex, key), value);
+        cache.Insert(key, fFound, value, nGeneration);
+        return fFound;
+    }
+
+    void BatchUpdate_AssetSupply(CDBBatch& batch, const std::map<uint256, CAssetSupply_IndexValue>& mapDelta, const bool fAdd);
+    bool BatchUpdate_AssetBalance(CDBBatch& batch, const std::map<CAssetBalance_IndexKey, CAssetBalance_IndexValue>& mapDelta, const bool fAdd);
+    void BatchUpdate_GetCandyCount(CDBBatch& batch, const std::map<CGetCandyCount_IndexKey, CGetCandyCount_IndexValue>& mapDelta, const bool fAdd);
 public:
     bool WriteBatchSync(const std::vector<std::pair<int, const CBlockFileInfo*> >& fileInfo, int nLastFile, const std::vector<const CBlockIndex*>& blockinfo);
     bool ReadBlockFileInfo(int nFile, CBlockFileInfo &fileinfo);
@@ -94,51 +244,41 @@ public:
     bool ReadFlag(const std::string &name, bool &fValue);
     bool LoadBlockIndexGuts();
 
-    bool Write_AppId_AppInfo_Index(const std::vector<std::pair<uint256, CAppId_AppInfo_IndexValue> > &vect);
-    bool Erase_AppId_AppInfo_Index(const std::vector<std::pair<uint256, CAppId_AppInfo_IndexValue> > &vect);
+    /**
+     * Write (fConnect) or erase the side indexes of one block in a single batch. The claimed candy
+     * totals and asset supplies are added or subtracted, on disconnect the payee is erased once
+     * its count drops to 0.
+     */
+    bool WriteSideIndexes(const CSideIndexWriteSet& writeSet, const bool fConnect);
+
     bool Read_AppId_AppInfo_Index(const uint256& appId, CAppId_AppInfo_IndexValue& appInfo);
     bool Read_AppList_Index(std::vector<uint256>& vAppId);
 
-    bool Write_AppName_AppId_Index(const std::vector<std::pair<std::string, CName_Id_IndexValue> > &vect);
-    bool Erase_AppName_AppId_Index(const std::vector<std::pair<std::string, CName_Id_IndexValue> > &vect);
     bool Read_AppName_AppId_Index(const std::string& strAppName, CName_Id_IndexValue& value);
 
-    bool Write_AppTx_Index(const std::vector<std::pair<CAppTx_IndexKey, int> > &vect);
-    bool Erase_AppTx_Index(const std::vector<std::pair<CAppTx_IndexKey, int> > &vect);
     bool Read_AppTx_Index(const uint256& appId, std::vector<COutPoint>& vOut);
     bool Read_AppTx_Index(const uint256& appId, const std::string& strAddress, std::vector<COutPoint>& vOut);
     bool Read_AppList_Index(const std::string& strAddress, std::vector<uint256>& vAppId);
 
-    bool Update_Auth_Index(const std::vector<std::pair<CAuth_IndexKey, int> > &vect);
     bool Read_Auth_Index(const uint256& appId, const std::string& strAddress, std::map<uint32_t, int>& mapAuth);
 
-    bool Write_AssetId_AssetInfo_Index(const std::vector<std::pair<uint256, CAssetId_AssetInfo_IndexValue> > &vect);
-    bool Erase_AssetId_AssetInfo_Index(const std::vector<std::pair<uint256, CAssetId_AssetInfo_IndexValue> > &vect);
     bool Read_AssetId_AssetInfo_Index(const uint256& assetId, CAssetId_AssetInfo_IndexValue& assetInfo);
     bool Read_AssetList_Index(std::vector<uint256>& vAssetId);
 
-    bool Write_ShortName_AssetId_Index(const std::vector<std::pair<std::string, CName_Id_IndexValue> > &vect);
-    bool Erase_ShortName_AssetId_Index(const std::vector<std::pair<std::string, CName_Id_IndexValue> > &vect);
     bool Read_ShortName_AssetId_Index(const std::string& strShortName, CName_Id_IndexValue& value);
 
-    bool Write_AssetName_AssetId_Index(const std::vector<std::pair<std::string, CName_Id_IndexValue> > &vect);
-    bool Erase_AssetName_AssetId_Index(const std::vector<std::pair<std::string, CName_Id_IndexValue> > &vect);
     bool Read_AssetName_AssetId_Index(const std::string& strAssetName, CName_Id_IndexValue& value);
 
-    bool Write_AssetTx_Index(const std::vector<std::pair<CAssetTx_IndexKey, int> > &vect);
-    bool Erase_AssetTx_Index(const std::vector<std::pair<CAssetTx_IndexKey, int> > &vect);
+    void GetAppAssetCacheStats(std::map<std::string, CIndexCacheStats>& mapStats) const;
+
     bool Read_AssetTx_Index(const uint256& assetId, const uint8_t& nTxClass, std::vector<COutPoint>& vOut);
     bool Read_AssetTx_Index(const uint256& assetId, const std::string& strAddress, const uint8_t& nTxClass, std::vector<COutPoint>& vOut);
     bool Read_AssetList_Index(const std::string& strAddress, std::vector<uint256>& vAssetId);
 
-    bool Write_PutCandy_Index(const std::vector<std::pair<CPutCandy_IndexKey, CPutCandy_IndexValue> > &vect);
-    bool Erase_PutCandy_Index(const std::vector<std::pair<CPutCandy_IndexKey, CPutCandy_IndexValue> > &vect);
     bool Read_PutCandy_Index(const uint256& assetId, std::map<COutPoint, CCandyInfo>& mapCandyInfo);
     bool Read_PutCandy_Index(const uint256& assetId, const COutPoint& out, CCandyInfo& candyInfo);
     bool Read_PutCandy_Index(std::map<CPutCandy_IndexKey, CPutCandy_IndexValue>& mapCandy);
 
-    bool Write_GetCandy_Index(const std::vector<std::pair<CGetCandy_IndexKey, CGetCandy_IndexValue> >& vect);
-    bool Erase_GetCandy_Index(const std::vector<std::pair<CGetCandy_IndexKey, CGetCandy_IndexValue> >& vect);
     bool Read_GetCandy_Index(const uint256& assetId, const COutPoint& out, const std::string& strAddress, CAmount& amount);
     bool Read_GetCandy_Index(const uint256& assetId, std::map<COutPoint, std::vector<std::string> > &mapOutAddress);
     bool Read_GetCandy_Index(const uint256& assetId, const std::string& straddress, std::vector<COutPoint>& vOut);
@@ -155,14 +295,48 @@ public:
     bool Read_GetCandyCount_Index(const uint256& assetId, const COutPoint& out,CGetCandyCount_IndexValue& getCandyCountvalue);
     bool Is_Exists_GetCandyCount_Key(const uint256& assetId, const COutPoint& out);
 
-    bool Write_MasternodePayee_Index(const std::string& strPubKeyCollateralAddress, const CMasternodePayee_IndexValue& value);
-    bool Erase_MasternodePayee_Index(const std::string& strPubKeyCollateralAddress);
-    bool Read_MasternodePayee_Index(const std::string& strPubKeyCollateralAddress, CMasternodePayee_IndexValue& value);
+    bool Update_AssetSupply_Index(const std::map<uint256, CAssetSupply_IndexValue>& mapDelta, const bool fAdd);
+    bool Read_AssetSupply_Index(const uint256& assetId, CAssetSupply_IndexValue& supply);
+    bool Update_AssetBalance_Index(const std::map<CAssetBalance_IndexKey, CAssetBalance_IndexValue>& mapDelta, const bool fAdd);
+    bool Read_AssetBalance_Index(const CAssetBalance_IndexKey& key, CAssetBalance_IndexValue& balance);
+    bool Read_AssetTx_Index(const std::set<uint8_t>& setTxClass, std::vector<std::pair<CAssetTx_IndexKey, int> >& vKey);
+
+    bool Upgrade_AddressTx_Index();
+    bool Upgrade_AssetTxHeight_Index();
     bool Read_MasternodePayee_Index(std::map<std::string,CMasternodePayee_IndexValue>& mapPayeeInfo);
-    bool Is_Exists_MasternodePayee_Key(const std::string& strPubKeyCollateralAddress);
 
-    bool Write_LocalStartSavePayeeHeight_Index(const int& nHeight);
     bool Read_LocalStartSavePayeeHeight_Index(int& nHeight);
 };
 
+/**
+ * Visits the transactions of an asset, or of an asset and address, in the height ordered
+ * asset tx index up to a height, each once. Reads the db directly, so no cs_main is needed.
+ */
+class CAssetTxIterator
+{
+private:
+    boost::scoped_ptr<CDBIterator> pcursor;
+    uint256 assetId;
+    std::string strAddress;
+    uint8_t nTxClass;
+    int nMaxHeight;
+    bool fValid;
+    int nHeight;
+    uint256 txId;
+
+    bool GetKey(int& nKeyHeight, COutPoint& out, uint8_t& nKeyTxClass);
+    void SkipTo(const uint256& skipTxId);
+
+public:
+    //! An empty strAddress visits every address of the asset
+    CAssetTxIterator(CBlockTreeDB& db, const uint256& assetId, const std::string& strAddress, const uint8_t& nTxClass, const int& nMaxHeight);
+
+    //! Position at the first transaction after cursor
+    void Seek(const CAssetTxCursor& cursor);
+    void Next();
+    bool Valid() const { return fValid; }
+    int GetHeight() const { return nHeight; }
+    const uint256& GetTxId() const { return txId; }
+};
+
 #endif // BITCOIN_TXDB_H
@@ -44,6 +44,11 @@ CTxMemPoolEntry::CTxMemPoolEntry(const CTransaction& _tx, const CAmount& _nFee,
     assert(inChainInputValue <= nValueIn);
 
     feeDelta = 0;
+
+    nCountWithAncestors = 1;
+    nSizeWithAncestors = nTxSize;
+    nModFeesWithAncestors = nFee;
+    nSigOpCountWithAncestors = sigOpCount;
 }
 
 CTxMemPoolEntry::CTxMemPoolEntry(const CTxMemPoolEntry& other)
@@ -64,6 +69,7 @@ CTxMemPoolEntry::GetPriority(unsigned int currentHeight) const
 void CTxMemPoolEntry::UpdateFeeDelta(int64_t newFeeDelta)
 {
     nModFeesWithDescendants += newFeeDelta - feeDelta;
+    nModFeesWithAncestors += newFeeDelta - feeDelta;
     feeDelta = newFeeDelta;
 }
 
@@ -75,21 +81,13 @@ void CTxMemPoolEntry::UpdateLockPoints(const LockPoints& lp)
 // Update the given tx for any in-mempool descendants.
 // Assumes that setMemPoolChildren is correct for the given tx and all
 // descendants.
-bool CTxMemPool::UpdateForDescendants(txiter updateIt, int maxDescendantsToVisit, cacheMap &cachedDescendants, const std::set<uint256> &setExclude)
+void CTxMemPool::UpdateForDescendants(txiter updateIt, cacheMap &cachedDescendants, const std::set<uint256> &setExclude)
 {
-    // Track the number of entries (outside setExclude) that we'd need to visit
-    // (will bail out if it exceeds maxDescendantsToVisit)
-    int nChildrenToVisit = 0;
-
     setEntries stageEntries, setAllDescendants;
     stageEntries = GetMemPoolChildren(updateIt);
 
     while (!stageEntries.empty()) {
         const txiter cit = *stageEntries.begin();
-        if (cit->IsDirty()) {
-            // Don't consider any more children if any descendant is dirty
-            return false;
-        }
         setAllDescendants.insert(cit);
         stageEntries.erase(cit);
         const setEntries &setChildren = GetMemPoolChildren(cit);
@@ -99,22 +97,11 @@ bool CTxMemPool::UpdateForDescendants(txiter updateIt, int maxDescendantsToVisit
                 // We've already calculated this one, just add the entries for this set
                 // but don't traverse again.
                 BOOST_FOREACH(const txiter cacheEntry, cacheIt->second) {
-                    // update visit count only for new child transactions
-                    // (outside of setExclude and stageEntries)
-                    if (setAllDescendants.insert(cacheEntry).second &&
-                            !setExclude.count(cacheEntry->GetTx().GetHash()) &&
-                            !stageEntries.count(cacheEntry)) {
-                        nChildrenToVisit++;
-                    }
+                    setAllDescendants.insert(cacheEntry);
                 }
             } else if (!setAllDescendants.count(childEntry)) {
-                // Schedule for later processing and update our visit count
-                if (stageEntries.insert(childEntry).second && !setExclude.count(childEntry->GetTx().GetHash())) {
-                        nChildrenToVisit++;
-                }
-            }
-            if (nChildrenToVisit > maxDescendantsToVisit) {
-                return false;
+                // Schedule for later processing
+                stageEntries.insert(childEntry);
             }
         }
     }
@@ -129,10 +116,11 @@ bool CTxMemPool::UpdateForDescendants(txiter updateIt, int maxDescendantsToVisit
             modifyFee += cit->GetModifiedFee();
             modifyCount++;
             cachedDescendants[updateIt].insert(cit);
+            // Update ancestor state for each descendant
+            mapTx.modify(cit, update_ancestor_state(updateIt->GetTxSize(), updateIt->GetModifiedFee(), 1, updateIt->GetSigOpCount()));
         }
     }
     mapTx.modify(updateIt, update_descendant_state(modifySize, modifyFee, modifyCount));
-    return true;
 }
 
 // vHashesToUpdate is the set of transaction hashes from a disconnected block
@@ -178,14 +166,11 @@ void CTxMemPool::UpdateTransactionsFromBlock(const std::vector<uint256> &vHashes
                 UpdateParent(childIter, it, true);
             }
         }
-        if (!UpdateForDescendants(it, 100, mapMemPoolDescendantsToUpdate, setAlreadyIncluded)) {
-            // Mark as dirty if we can't do the calculation.
-            mapTx.modify(it, set_dirty());
-        }
+        UpdateForDescendants(it, mapMemPoolDescendantsToUpdate, setAlreadyIncluded);
     }
 }
 
-bool CTxMemPool::CalculateMemPoolAncestors(const CTxMemPoolEntry &entry, setEntries &setAncestors, uint64_t limitAncestorCount, uint64_t limitAncestorSize, uint64_t limitDescendantCount, uint64_t limitDescendantSize, std::string &errString, bool fSearchForParents /* = true */)
+bool CTxMemPool::CalculateMemPoolAncestors(const CTxMemPoolEntry &entry, setEntries &setAncestors, uint64_t limitAncestorCount, uint64_t limitAncestorSize, uint64_t limitDescendantCount, uint64_t limitDescendantSize, std::string &errString, bool fSearchForParents /* = true */) const
 {
     setEntries parentHashes;
     const CTransaction &tx = entry.GetTx();
@@ -265,6 +250,20 @@ void CTxMemPool::UpdateAncestorsOf(bool add, txiter it, setEntries &setAncestors
     }
 }
 
+void CTxMemPool::UpdateEntryForAncestors(txiter it, const setEntries &setAncestors)
+{
+    int64_t updateCount = setAncestors.size();
+    int64_t updateSize = 0;
+    CAmount updateFee = 0;
+    int updateSigOps = 0;
+    BOOST_FOREACH(txiter ancestorIt, setAncestors) {
+        updateSize += ancestorIt->GetTxSize();
+        updateFee += ancestorIt->GetModifiedFee();
+        updateSigOps += ancestorIt->GetSigOpCount();
+    }
+    mapTx.modify(it, update_ancestor_state(updateSize, updateFee, updateCount, updateSigOps));
+}
+
 void CTxMemPool::UpdateChildrenForRemoval(txiter it)
 {
     const setEntries &setMemPoolChildren = GetMemPoolChildren(it);
@@ -273,11 +272,30 @@ void CTxMemPool::UpdateChildrenForRemoval(txiter it)
     }
 }
 
-void CTxMemPool::UpdateForRemoveFromMempool(const setEntries &entriesToRemove)
+void CTxMemPool::UpdateForRemoveFromMempool(const setEntries &entriesToRemove, bool updateDescendants)
 {
     // For each entry, walk back all ancestors and decrement size associated with this
     // transaction
     const uint64_t nNoLimit = std::numeric_limits<uint64_t>::max();
+    if (updateDescendants) {
+        // updateDescendants should be true whenever we're not recursively
+        // removing a tx and all its descendants, eg when a transaction is
+        // confirmed in a block.
+        // Here we only update statistics and not data in mapLinks (which
+        // we need to preserve until we're finished with all operations that
+        // need to traverse the mempool).
+        BOOST_FOREACH(txiter removeIt, entriesToRemove) {
+            setEntries setDescendants;
+            CalculateDescendants(removeIt, setDescendants);
+            setDescendants.erase(removeIt); // don't update state for self
+            int64_t modifySize = -((int64_t)removeIt->GetTxSize());
+            CAmount modifyFee = -removeIt->GetModifiedFee();
+            int modifySigOps = -(int)removeIt->GetSigOpCount();
+            BOOST_FOREACH(txiter dit, setDescendants) {
+                mapTx.modify(dit, update_ancestor_state(modifySize, modifyFee, -1, modifySigOps));
+            }
+        }
+    }
     BOOST_FOREACH(txiter removeIt, entriesToRemove) {
         setEntries setAncestors;
         const CTxMemPoolEntry &entry = *removeIt;
@@ -315,22 +333,24 @@ void CTxMemPool::UpdateForRemoveFromMempool(const setEntries &entriesToRemove)
     }
 }
 
-void CTxMemPoolEntry::SetDirty()
+void CTxMemPoolEntry::UpdateState(int64_t modifySize, CAmount modifyFee, int64_t modifyCount)
 {
-    nCountWithDescendants = 0;
-    nSizeWithDescendants = nTxSize;
-    nModFeesWithDescendants = GetModifiedFee();
+    nSizeWithDescendants += modifySize;
+    assert(int64_t(nSizeWithDescendants) > 0);
+    nModFeesWithDescendants += modifyFee;
+    nCountWithDescendants += modifyCount;
+    assert(int64_t(nCountWithDescendants) > 0);
 }
 
-void CTxMemPoolEntry::UpdateState(int64_t modifySize, CAmount modifyFee, int64_t modifyCount)
+void CTxMemPoolEntry::UpdateAncestorState(int64_t modifySize, CAmount modifyFee, int64_t modifyCount, int modifySigOps)
 {
-    if (!IsDirty()) {
-        nSizeWithDescendants += modifySize;
-        assert(int64_t(nSizeWithDescendants) > 0);
-        nModFeesWithDescendants += modifyFee;
-        nCountWithDescendants += modifyCount;
-        assert(int64_t(nCountWithDescendants) > 0);
-    }
+    nSizeWithAncestors += modifySize;
+    assert(int64_t(nSizeWithAncestors) > 0);
+    nModFeesWithAncestors += modifyFee;
+    nCountWithAncestors += modifyCount;
+    assert(int64_t(nCountWithAncestors) > 0);
+    nSigOpCountWithAncestors += modifySigOps;
+    assert(int(nSigOpCountWithAncestors) >= 0);
 }
 
 CTxMemPool::CTxMemPool(const CFeeRate& _minReasonableRelayFee) :
@@ -440,6 +460,7 @@ bool CTxMemPool::addUnchecked(const uint256& hash, const CTxMemPoolEntry &entry,
         }
     }
     UpdateAncestorsOf(true, newit, setAncestors);
+    UpdateEntryForAncestors(newit, setAncestors);
 
     nTransactionsUpdated++;
     totalTxSize += entry.GetTxSize();
@@ -617,18 +638,18 @@ void CTxMemPool::addAppInfoIndex(const CTxMemPoolEntry& entry, const CCoinsViewC
     {
         const CTxOut& txout = tx.vout[i];
 
-        CAppHeader header;
-        std::vector<unsigned char> vData;
-        if(ParseReserve(txout.vReserve, header, vData))
+        const CAppPayload* pPayload = GetAppPayload(tx, i);
+        if(pPayload)
         {
+            const CAppHeader& header = pPayload->header;
             CTxDestination dest;
             if(!ExtractDestination(txout.scriptPubKey, dest))
                 continue;
 
             if(header.nAppCmd == REGISTER_APP_CMD)
             {
-                CAppData appData;
-                if(ParseRegisterData(vData, appData))
+                const CAppData& appData = pPayload->appData;
+                if(pPayload->fDataValid)
                 {
                     mapAppId_AppInfo.insert(make_pair(header.appId, CAppId_AppInfo_IndexValue(CBitcoinAddress(dest).ToString(), appData)));
                     appId_inserted.push_back(header.appId);
@@ -706,36 +727,20 @@ bool CTxMemPool::removeAppInfoIndex(const uint256& txhash)
     return true;
 }
 
-bool CAppTx_IndexKeyCompare::operator()(const CAppTx_IndexKey& a, const CAppTx_IndexKey& b) const
-{
-    if(a.appId == b.appId)
-    {
-        if(a.strAddress == b.strAddress)
-        {
-            if(a.nTxClass == b.nTxClass)
-                return a.out < b.out;
-            return a.nTxClass < b.nTxClass;
-        }
-        return a.strAddress < b.strAddress;
-    }
-    return a.appId < b.appId;
-}
-
 void CTxMemPool::add_AppTx_Index(const CTxMemPoolEntry& entry, const CCoinsViewCache& view)
 {
     LOCK(cs);
     const CTransaction& tx = entry.GetTx();
-    std::vector<CAppTx_IndexKey> inserted;
 
     uint256 txhash = tx.GetHash();
     for(unsigned int i = 0; i < tx.vout.size(); i++)
     {
         const CTxOut& txout = tx.vout[i];
 
-        CAppHeader header;
-        std::vector<unsigned char> vData;
-        if(ParseReserve(txout.vReserve, header, vData))
+        const CAppPayload* pPayload = GetAppPayload(tx, i);
+        if(pPayload)
         {
+            const CAppHeader& header = pPayload->header;
             CTxDestination dest;
             if(!ExtractDestination(txout.scriptPubKey, dest))
                 continue;
@@ -752,45 +757,39 @@ void CTxMemPool::add_AppTx_Index(const CTxMemPoolEntry& entry, const CCoinsViewC
             else
                 continue;
 
-            CAppTx_IndexKey key(header.appId, CBitcoinAddress(dest).ToString(), nTxClass, COutPoint(txhash, i));
-            mapAppTx.insert(make_pair(key, -1));
-            inserted.push_back(key);
+            mapAppTx.insert(CAppTx_IndexKey(header.appId, CBitcoinAddress(dest).ToString(), nTxClass, COutPoint(txhash, i)));
         }
     }
-
-    if (inserted.size())
-        mapAppTx_Inserted.insert(make_pair(txhash, inserted));
 }
 
 bool CTxMemPool::get_AppTx_Index(const uint256& appId, std::vector<COutPoint>& vOut)
 {
     LOCK(cs);
-    for(mapAppTx_Index::const_iterator it = mapAppTx.begin(); it != mapAppTx.end(); it++)
-    {
-        if(it->first.appId == appId)
-            vOut.push_back(it->first.out);
-    }
+    std::pair<indexed_apptx_set::iterator, indexed_apptx_set::iterator> range = mapAppTx.equal_range(boost::make_tuple(appId));
+    for(indexed_apptx_set::iterator it = range.first; it != range.second; it++)
+        vOut.push_back(it->out);
     return vOut.size();
 }
 
 bool CTxMemPool::get_AppTx_Index(const uint256& appId, const std::string& strAddress, std::vector<COutPoint>& vOut)
 {
     LOCK(cs);
-    for(mapAppTx_Index::const_iterator it = mapAppTx.begin(); it != mapAppTx.end(); it++)
-    {
-        if(it->first.appId == appId && it->first.strAddress == strAddress)
-            vOut.push_back(it->first.out);
-    }
+    std::pair<indexed_apptx_set::iterator, indexed_apptx_set::iterator> range = mapAppTx.equal_range(boost::make_tuple(appId, strAddress));
+    for(indexed_apptx_set::iterator it = range.first; it != range.second; it++)
+        vOut.push_back(it->out);
     return vOut.size();
 }
 
 bool CTxMemPool::getAppList(const std::string& strAddress, std::vector<uint256>& vAppId)
 {
     LOCK(cs);
-    for(mapAppTx_Index::const_iterator it = mapAppTx.begin(); it != mapAppTx.end(); it++)
+    typedef indexed_apptx_set::index<apptx_address>::type address_index;
+    const address_index& index = mapAppTx.get<apptx_address>();
+    std::pair<address_index::iterator, address_index::iterator> range = index.equal_range(boost::make_tuple(strAddress));
+    for(address_index::iterator it = range.first; it != range.second; it++)
     {
-        if(it->first.strAddress == strAddress)
-            vAppId.push_back(it->first.appId);
+        if(vAppId.empty() || vAppId.back() != it->appId)
+            vAppId.push_back(it->appId);
     }
     return vAppId.size();
 }
@@ -798,17 +797,7 @@ bool CTxMemPool::getAppList(const std::string& strAddress, std::vector<uint256>&
 bool CTxMemPool::remove_AppTx_Index(const uint256& txhash)
 {
     LOCK(cs);
-    mapAppTx_IndexInserted::iterator it = mapAppTx_Inserted.find(txhash);
-    if(it != mapAppTx_Inserted.end())
-    {
-        std::vector<CAppTx_IndexKey> keys = (*it).second;
-        for(std::vector<CAppTx_IndexKey>::iterator mit = keys.begin(); mit != keys.end(); mit++)
-        {
-            if(mapAppTx.find(*mit) != mapAppTx.end())
-                mapAppTx.erase(*mit);
-        }
-        mapAppTx_Inserted.erase(it);
-    }
+    mapAppTx.get<indexkey_txid_tag>().erase(txhash);
     return true;
 }
 
@@ -832,16 +821,14 @@ void CTxMemPool::add_Auth_Index(const CTxMemPoolEntry& entry, const CCoinsViewCa
     uint256 txhash = tx.GetHash();
     for(unsigned int i = 0; i < tx.vout.size(); i++)
     {
-        const CTxOut& txout = tx.vout[i];
-
-        CAppHeader header;
-        std::vector<unsigned char> vData;
-        if(ParseReserve(txout.vReserve, header, vData))
+        const CAppPayload* pPayload = GetAppPayload(tx, i);
+        if(pPayload)
         {
+            const CAppHeader& header = pPayload->header;
             if(header.nAppCmd == ADD_AUTH_CMD || header.nAppCmd == DELETE_AUTH_CMD)
             {
-                CAuthData authData;
-                if(ParseAuthData(vData, authData))
+                const CAuthData& authData = pPayload->authData;
+                if(pPayload->fDataValid)
                 {
                     CAuth_IndexKey key(header.appId, authData.strUserAddress, authData.nAuth);
                     mapAuth.insert(make_pair(key, -1));
@@ -897,18 +884,18 @@ void CTxMemPool::addAssetInfoIndex(const CTxMemPoolEntry& entry, const CCoinsVie
     {
         const CTxOut& txout = tx.vout[i];
 
-        CAppHeader header;
-        std::vector<unsigned char> vData;
-        if(ParseReserve(txout.vReserve, header, vData))
+        const CAppPayload* pPayload = GetAppPayload(tx, i);
+        if(pPayload)
         {
+            const CAppHeader& header = pPayload->header;
             CTxDestination dest;
             if(!ExtractDestination(txout.scriptPubKey, dest))
                 continue;
 
             if(header.nAppCmd == ISSUE_ASSET_CMD)
             {
-                CAssetData assetData;
-                if(ParseIssueData(vData, assetData))
+                const CAssetData& assetData = pPayload->assetData;
+                if(pPayload->fDataValid)
                 {
                     uint256 assetId = assetData.GetHash();
 
@@ -1016,184 +1003,129 @@ bool CTxMemPool::removeAssetInfoIndex(const uint256& txhash)
     return true;
 }
 
-bool CAssetTx_IndexKeyCompare::operator()(const CAssetTx_IndexKey& a, const CAssetTx_IndexKey& b) const
-{
-    if(a.assetId == b.assetId)
-    {
-        if(a.strAddress == b.strAddress)
-        {
-            if(a.nTxClass == b.nTxClass)
-                return a.out < b.out;
-            return a.nTxClass < b.nTxClass;
-        }
-        return a.strAddress < b.strAddress;
-    }
-    return a.assetId < b.assetId;
-}
-
 void CTxMemPool::add_AssetTx_Index(const CTxMemPoolEntry& entry, const CCoinsViewCache& view)
 {
     LOCK(cs);
     const CTransaction& tx = entry.GetTx();
-    std::vector<CAssetTx_IndexKey> inserted;
 
     uint256 txhash = tx.GetHash();
     for(unsigned int i = 0; i < tx.vout.size(); i++)
     {
         const CTxOut& txout = tx.vout[i];
 
-        CAppHeader header;
-        std::vector<unsigned char> vData;
-        if(ParseReserve(txout.vReserve, header, vData))
+        const CAppPayload* pPayload = GetAppPayload(tx, i);
+        if(pPayload)
         {
+            const CAppHeader& header = pPayload->header;
             CTxDestination dest;
             if(!ExtractDestination(txout.scriptPubKey, dest))
                 continue;
 
             if(header.nAppCmd == ISSUE_ASSET_CMD)
             {
-                CAssetData assetData;
-                if(ParseIssueData(vData, assetData))
+                const CAssetData& assetData = pPayload->assetData;
+                if(pPayload->fDataValid)
                 {
-                    CAssetTx_IndexKey key(assetData.GetHash(), CBitcoinAddress(dest).ToString(), ISSUE_TXOUT, COutPoint(txhash, i));
-                    mapAssetTx.insert(make_pair(key, -1));
-                    inserted.push_back(key);
+                    mapAssetTx.insert(CAssetTx_IndexKey(assetData.GetHash(), CBitcoinAddress(dest).ToString(), ISSUE_TXOUT, COutPoint(txhash, i)));
                 }
             }
             else if(header.nAppCmd == ADD_ASSET_CMD || header.nAppCmd == TRANSFER_ASSET_CMD || header.nAppCmd == DESTORY_ASSET_CMD)
             {
-                CCommonData commonData;
-                if(ParseCommonData(vData, commonData))
+                const CCommonData& commonData = pPayload->commonData;
+                if(pPayload->fDataValid)
                 {
                     if (header.nAppCmd == ADD_ASSET_CMD)
                     {
-                        CAssetTx_IndexKey key(commonData.assetId, CBitcoinAddress(dest).ToString(), ADD_ISSUE_TXOUT, COutPoint(txhash, i));
-                        mapAssetTx.insert(make_pair(key, -1));
-                        inserted.push_back(key);
+                        mapAssetTx.insert(CAssetTx_IndexKey(commonData.assetId, CBitcoinAddress(dest).ToString(), ADD_ISSUE_TXOUT, COutPoint(txhash, i)));
                     }
                     else if (header.nAppCmd == DESTORY_ASSET_CMD)
                     {
-                        CAssetTx_IndexKey key(commonData.assetId, CBitcoinAddress(dest).ToString(), DESTORY_TXOUT, COutPoint(txhash, i));
-                        mapAssetTx.insert(make_pair(key, -1));
-                        inserted.push_back(key);
+                        mapAssetTx.insert(CAssetTx_IndexKey(commonData.assetId, CBitcoinAddress(dest).ToString(), DESTORY_TXOUT, COutPoint(txhash, i)));
                     }
                     else if(header.nAppCmd == TRANSFER_ASSET_CMD)
                     {
                         if(txout.nUnlockedHeight > 0)
                         {
-                            CAssetTx_IndexKey key(commonData.assetId, CBitcoinAddress(dest).ToString(), LOCKED_TXOUT, COutPoint(txhash, i));
-                            mapAssetTx.insert(make_pair(key, -1));
-                            inserted.push_back(key);
+                            mapAssetTx.insert(CAssetTx_IndexKey(commonData.assetId, CBitcoinAddress(dest).ToString(), LOCKED_TXOUT, COutPoint(txhash, i)));
                         }
                         else
                         {
-                            CAssetTx_IndexKey key(commonData.assetId, CBitcoinAddress(dest).ToString(), TRANSFER_TXOUT, COutPoint(txhash, i));
-                            mapAssetTx.insert(make_pair(key, -1));
-                            inserted.push_back(key);
+                            mapAssetTx.insert(CAssetTx_IndexKey(commonData.assetId, CBitcoinAddress(dest).ToString(), TRANSFER_TXOUT, COutPoint(txhash, i)));
                         }
                     }
                 }
             }
             else if(header.nAppCmd == PUT_CANDY_CMD)
             {
-                CPutCandyData candyData;
-                if(ParsePutCandyData(vData, candyData))
+                const CPutCandyData& candyData = pPayload->putCandyData;
+                if(pPayload->fDataValid)
                 {
-                    CAssetTx_IndexKey key(candyData.assetId, CBitcoinAddress(dest).ToString(), PUT_CANDY_TXOUT, COutPoint(txhash, i));
-                    mapAssetTx.insert(make_pair(key, -1));
-                    inserted.push_back(key);
+                    mapAssetTx.insert(CAssetTx_IndexKey(candyData.assetId, CBitcoinAddress(dest).ToString(), PUT_CANDY_TXOUT, COutPoint(txhash, i)));
                 }
             }
             else if(header.nAppCmd == GET_CANDY_CMD)
             {
-                CGetCandyData candyData;
-                if(ParseGetCandyData(vData, candyData))
+                const CGetCandyData& candyData = pPayload->getCandyData;
+                if(pPayload->fDataValid)
                 {
-                    CAssetTx_IndexKey key(candyData.assetId, CBitcoinAddress(dest).ToString(), GET_CANDY_TXOUT, COutPoint(txhash, i));
-                    mapAssetTx.insert(make_pair(key, -1));
-                    inserted.push_back(key);
+                    mapAssetTx.insert(CAssetTx_IndexKey(candyData.assetId, CBitcoinAddress(dest).ToString(), GET_CANDY_TXOUT, COutPoint(txhash, i)));
                 }
             }
         }
     }
-
-    if (inserted.size())
-        mapAssetTx_Inserted.insert(make_pair(txhash, inserted));
 }
 
 bool CTxMemPool::get_AssetTx_Index(const uint256& assetId, const uint8_t& nTxClass, std::vector<COutPoint>& vOut)
 {
     LOCK(cs);
-    multimap<int, COutPoint> tmpMap;
-    for(mapAssetTx_Index::const_iterator it = mapAssetTx.begin(); it != mapAssetTx.end(); it++)
+    if(nTxClass == ALL_TXOUT || nTxClass == UNLOCKED_TXOUT)
     {
-        if(it->first.assetId != assetId)
-            continue;
-        if(nTxClass == ALL_TXOUT)
+        std::pair<indexed_assettx_set::iterator, indexed_assettx_set::iterator> range = mapAssetTx.equal_range(boost::make_tuple(assetId));
+        for(indexed_assettx_set::iterator it = range.first; it != range.second; it++)
         {
-            tmpMap.insert(make_pair(it->second, it->first.out));
-        }
-        else if(nTxClass == UNLOCKED_TXOUT)
-        {
-            if(it->first.nTxClass == LOCKED_TXOUT)
+            if(nTxClass == UNLOCKED_TXOUT && it->nTxClass == LOCKED_TXOUT)
                 continue;
-            tmpMap.insert(make_pair(it->second, it->first.out));
-        }
-        else if(it->first.nTxClass == nTxClass)
-        {
-            tmpMap.insert(make_pair(it->second, it->first.out));
+            vOut.push_back(it->out);
         }
+        return vOut.size();
     }
 
-    for(multimap<int, COutPoint>::iterator iter = tmpMap.begin(); iter != tmpMap.end(); ++iter)
-        vOut.push_back(iter->second);
-
-    multimap<int,COutPoint>().swap(tmpMap);
-
+    typedef indexed_assettx_set::index<assettx_class>::type class_index;
+    const class_index& index = mapAssetTx.get<assettx_class>();
+    std::pair<class_index::iterator, class_index::iterator> range = index.equal_range(boost::make_tuple(assetId, nTxClass));
+    for(class_index::iterator it = range.first; it != range.second; it++)
+        vOut.push_back(it->out);
     return vOut.size();
 }
 
 bool CTxMemPool::get_AssetTx_Index(const uint256& assetId, const std::string& strAddress, const uint8_t& nTxClass, std::vector<COutPoint>& vOut)
 {
     LOCK(cs);
-    multimap<int, COutPoint> tmpMap;
-    for(mapAssetTx_Index::const_iterator it = mapAssetTx.begin(); it != mapAssetTx.end(); it++)
+    std::pair<indexed_assettx_set::iterator, indexed_assettx_set::iterator> range;
+    if(nTxClass == ALL_TXOUT || nTxClass == UNLOCKED_TXOUT)
+        range = mapAssetTx.equal_range(boost::make_tuple(assetId, strAddress));
+    else
+        range = mapAssetTx.equal_range(boost::make_tuple(assetId, strAddress, nTxClass));
+
+    for(indexed_assettx_set::iterator it = range.first; it != range.second; it++)
     {
-        if(it->first.assetId != assetId || it->first.strAddress != strAddress)
+        if(nTxClass == UNLOCKED_TXOUT && it->nTxClass == LOCKED_TXOUT)
             continue;
-
-        if(nTxClass == ALL_TXOUT)
-        {
-            tmpMap.insert(make_pair(it->second, it->first.out));
-        }
-        else if(nTxClass == UNLOCKED_TXOUT)
-        {
-            if(it->first.nTxClass == LOCKED_TXOUT)
-                continue;
-            tmpMap.insert(make_pair(it->second, it->first.out));
-        }
-        else if(it->first.nTxClass == nTxClass)
-        {
-            tmpMap.insert(make_pair(it->second, it->first.out));
-        }
-    }
-
-    for(multimap<int, COutPoint>::iterator iter = tmpMap.begin(); iter != tmpMap.end(); ++iter){
-        vOut.push_back(iter->second);
+        vOut.push_back(it->out);
     }
-
-    multimap<int, COutPoint>().swap(tmpMap);
-
     return vOut.size();
 }
 
 bool CTxMemPool::getAssetList(const std::string& strAddress, std::vector<uint256>& vAssetId)
 {
     LOCK(cs);
-    for(mapAssetTx_Index::const_iterator it = mapAssetTx.begin(); it != mapAssetTx.end(); it++)
+    typedef indexed_assettx_set::index<assettx_address>::type address_index;
+    const address_index& index = mapAssetTx.get<assettx_address>();
+    std::pair<address_index::iterator, address_index::iterator> range = index.equal_range(boost::make_tuple(strAddress));
+    for(address_index::iterator it = range.first; it != range.second; it++)
     {
-        if (it->first.strAddress == strAddress)
-            vAssetId.push_back(it->first.assetId);
+        if(vAssetId.empty() || vAssetId.back() != it->assetId)
+            vAssetId.push_back(it->assetId);
     }
     return vAssetId.size();
 }
@@ -1201,31 +1133,14 @@ bool CTxMemPool::getAssetList(const std::string& strAddress, std::vector<uint256
 bool CTxMemPool::remove_AssetTx_Index(const uint256& txhash)
 {
     LOCK(cs);
-    mapAssetTx_IndexInserted::iterator it = mapAssetTx_Inserted.find(txhash);
-    if(it != mapAssetTx_Inserted.end())
-    {
-        std::vector<CAssetTx_IndexKey> keys = (*it).second;
-        for(std::vector<CAssetTx_IndexKey>::iterator mit = keys.begin(); mit != keys.end(); mit++)
-        {
-            if(mapAssetTx.find(*mit) != mapAssetTx.end())
-                mapAssetTx.erase(*mit);
-        }
-        mapAssetTx_Inserted.erase(it);
-    }
+    mapAssetTx.get<indexkey_txid_tag>().erase(txhash);
     return true;
 }
 
 int CTxMemPool::get_PutCandy_count(const uint256 &assetId)
 {
     LOCK(cs);
-    int nCount = 0;
-    for(mapAssetTx_Index::const_iterator it = mapAssetTx.begin(); it != mapAssetTx.end(); it++)
-    {
-        if(it->first.assetId != assetId || it->first.strAddress != g_strPutCandyAddress || it->first.nTxClass != PUT_CANDY_TXOUT)
-            continue;
-        nCount++;
-    }
-    return nCount;
+    return mapAssetTx.count(boost::make_tuple(assetId, g_strPutCandyAddress, (uint8_t)PUT_CANDY_TXOUT));
 }
 
 bool CGetCandy_IndexKeyCompare::operator()(const CGetCandy_IndexKey& a, const CGetCandy_IndexKey& b) const
@@ -1259,17 +1174,17 @@ void CTxMemPool::add_GetCandy_Index(const CTxMemPoolEntry& entry, const CCoinsVi
     {
         const CTxOut& txout = tx.vout[i];
 
-        CAppHeader header;
-        std::vector<unsigned char> vData;
-        if(ParseReserve(txout.vReserve, header, vData))
+        const CAppPayload* pPayload = GetAppPayload(tx, i);
+        if(pPayload)
         {
+            const CAppHeader& header = pPayload->header;
             CTxDestination dest;
             if(!ExtractDestination(txout.scriptPubKey, dest))
                 continue;
             if(header.nAppCmd == GET_CANDY_CMD)
             {
-                CGetCandyData candyData;
-                if(ParseGetCandyData(vData, candyData))
+                const CGetCandyData& candyData = pPayload->getCandyData;
+                if(pPayload->fDataValid)
                 {
                     for(unsigned int m = 0; m < tx.vin.size(); m++)
                     {
@@ -1340,17 +1255,17 @@ void CTxMemPool::add_GetCandyCount_Index(const CTxMemPoolEntry& entry, const CCo
     {
         const CTxOut& txout = tx.vout[i];
 
-        CAppHeader header;
-        std::vector<unsigned char> vData;
-        if(ParseReserve(txout.vReserve, header, vData))
+        const CAppPayload* pPayload = GetAppPayload(tx, i);
+        if(pPayload)
         {
+            const CAppHeader& header = pPayload->header;
             CTxDestination dest;
             if(!ExtractDestination(txout.scriptPubKey, dest))
                 continue;
             if(header.nAppCmd == GET_CANDY_CMD)
             {
-                CGetCandyData candyData;
-                if(ParseGetCandyData(vData, candyData))
+                const CGetCandyData& candyData = pPayload->getCandyData;
+                if(pPayload->fDataValid)
                 {
                     for(unsigned int m = 0; m < tx.vin.size(); m++)
                     {
@@ -1381,18 +1296,12 @@ void CTxMemPool::add_GetCandyCount_Index(const CTxMemPoolEntry& entry, const CCo
 bool CTxMemPool::get_GetCandyCount_Index(const uint256 &assetId, const COutPoint &out, CGetCandyCount_IndexValue &value)
 {
     LOCK(cs);
-    for(mapGetCandyCount_Index::const_iterator it = mapGetCandyCount.begin(); it != mapGetCandyCount.end(); it++)
-    {
-        const CGetCandyCount_IndexKey& key = it->first;
-        if(key.assetId == assetId && key.out == out)
-        {
-            const CGetCandyCount_IndexValue& poolValue = it->second;
-            value.nGetCandyCount = poolValue.nGetCandyCount;
-            return true;
-        }
-    }
+    mapGetCandyCount_Index::const_iterator it = mapGetCandyCount.find(CGetCandyCount_IndexKey(assetId, out));
+    if(it == mapGetCandyCount.end())
+        return false;
 
-    return false;
+    value.nGetCandyCount = it->second.nGetCandyCount;
+    return true;
 }
 
 bool CTxMemPool::remove_GetCandyCount_Index(const uint256& txhash)
@@ -1422,6 +1331,128 @@ bool CTxMemPool::remove_GetCandyCount_Index(const uint256& txhash)
     return true;
 }
 
+void CTxMemPool::add_AssetSupply_Index(const CTxMemPoolEntry& entry, const CCoinsViewCache& view)
+{
+    LOCK(cs);
+    const CTransaction& tx = entry.GetTx();
+    std::vector<std::pair<uint256, CAssetSupply_IndexValue> > inserted;
+
+    for(unsigned int i = 0; i < tx.vout.size(); i++)
+    {
+        const CAppPayload* pPayload = GetAppPayload(tx, i);
+        if(!pPayload)
+            continue;
+
+        const CAppHeader& header = pPayload->header;
+
+        if(header.nAppCmd == ADD_ASSET_CMD || header.nAppCmd == DESTORY_ASSET_CMD)
+        {
+            if(!pPayload->fDataValid)
+                continue;
+            const CCommonData& commonData = pPayload->commonData;
+            if(header.nAppCmd == ADD_ASSET_CMD)
+                inserted.push_back(std::make_pair(commonData.assetId, CAssetSupply_IndexValue(commonData.nAmount, 0, 0)));
+            else
+                inserted.push_back(std::make_pair(commonData.assetId, CAssetSupply_IndexValue(0, commonData.nAmount, 0)));
+        }
+        else if(header.nAppCmd == PUT_CANDY_CMD)
+        {
+            const CPutCandyData& candyData = pPayload->putCandyData;
+            if(pPayload->fDataValid)
+                inserted.push_back(std::make_pair(candyData.assetId, CAssetSupply_IndexValue(0, 0, candyData.nAmount)));
+        }
+    }
+
+    if(inserted.empty())
+        return;
+
+    for(std::vector<std::pair<uint256, CAssetSupply_IndexValue> >::const_iterator it = inserted.begin(); it != inserted.end(); it++)
+        mapAssetSupply[it->first] += it->second;
+    mapAssetSupply_Inserted.insert(make_pair(tx.GetHash(), inserted));
+}
+
+bool CTxMemPool::get_AssetSupply_Index(const uint256& assetId, CAssetSupply_IndexValue& supply)
+{
+    LOCK(cs);
+    mapAssetSupply_Index::const_iterator it = mapAssetSupply.find(assetId);
+    if(it == mapAssetSupply.end())
+        return false;
+
+    supply = it->second;
+    return true;
+}
+
+bool CTxMemPool::remove_AssetSupply_Index(const uint256& txhash)
+{
+    LOCK(cs);
+    mapAssetSupply_IndexInserted::iterator it = mapAssetSupply_Inserted.find(txhash);
+    if(it == mapAssetSupply_Inserted.end())
+        return true;
+
+    for(std::vector<std::pair<uint256, CAssetSupply_IndexValue> >::const_iterator mit = it->second.begin(); mit != it->second.end(); mit++)
+    {
+        mapAssetSupply_Index::iterator supplyit = mapAssetSupply.find(mit->first);
+        if(supplyit == mapAssetSupply.end())
+            continue;
+        supplyit->second -= mit->second;
+        if(supplyit->second.IsNull())
+            mapAssetSupply.erase(supplyit);
+    }
+    mapAssetSupply_Inserted.erase(it);
+
+    return true;
+}
+
+void CTxMemPool::add_AssetBalance_Index(const CTxMemPoolEntry& entry, const CCoinsViewCache& view)
+{
+    LOCK(cs);
+    const CTransaction& tx = entry.GetTx();
+    mapAssetBalance_Index inserted;
+    AddAssetBalanceDelta(tx, view, inserted);
+    if(inserted.empty())
+        return;
+
+    for(mapAssetBalance_Index::const_iterator it = inserted.begin(); it != inserted.end(); it++)
+    {
+        if(!mapAssetBalance[it->first].Add(it->second))
+            LogPrintf("%s: asset %s balance of %s out of range\n", __func__, it->first.assetId.ToString(), it->first.strAddress);
+    }
+    mapAssetBalance_Inserted.insert(make_pair(tx.GetHash(), inserted));
+}
+
+bool CTxMemPool::get_AssetBalance_Index(const CAssetBalance_IndexKey& key, CAssetBalance_IndexValue& balance)
+{
+    LOCK(cs);
+    mapAssetBalance_Index::const_iterator it = mapAssetBalance.find(key);
+    if(it == mapAssetBalance.end())
+        return false;
+
+    balance = it->second;
+    return true;
+}
+
+bool CTxMemPool::remove_AssetBalance_Index(const uint256& txhash)
+{
+    LOCK(cs);
+    mapAssetBalance_IndexInserted::iterator it = mapAssetBalance_Inserted.find(txhash);
+    if(it == mapAssetBalance_Inserted.end())
+        return true;
+
+    for(mapAssetBalance_Index::const_iterator mit = it->second.begin(); mit != it->second.end(); mit++)
+    {
+        mapAssetBalance_Index::iterator balanceit = mapAssetBalance.find(mit->first);
+        if(balanceit == mapAssetBalance.end())
+            continue;
+        if(!balanceit->second.Sub(mit->second))
+            LogPrintf("%s: asset %s balance of %s out of range\n", __func__, mit->first.assetId.ToString(), mit->first.strAddress);
+        if(balanceit->second.IsNull())
+            mapAssetBalance.erase(balanceit);
+    }
+    mapAssetBalance_Inserted.erase(it);
+
+    return true;
+}
+
 void CTxMemPool::removeUnchecked(txiter it)
 {
     const uint256 hash = it->GetTx().GetHash();
@@ -1444,6 +1475,8 @@ void CTxMemPool::removeUnchecked(txiter it)
     remove_AssetTx_Index(hash);
     remove_GetCandy_Index(hash);
     remove_GetCandyCount_Index(hash);
+    remove_AssetSupply_Index(hash);
+    remove_AssetBalance_Index(hash);
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////
@@ -1510,7 +1543,7 @@ void CTxMemPool::remove(const CTransaction &origTx, std::list<CTransaction>& rem
         BOOST_FOREACH(txiter it, setAllRemoves) {
             removed.push_back(it->GetTx());
         }
-        RemoveStaged(setAllRemoves);
+        RemoveStaged(setAllRemoves, !fRecursive);
     }
 }
 
@@ -1664,6 +1697,24 @@ void CTxMemPool::check(const CCoinsViewCache *pcoins) const
             i++;
         }
         assert(setParentCheck == GetMemPoolParents(it));
+        // Verify ancestor state is correct.
+        setEntries setAncestors;
+        uint64_t nNoLimit = std::numeric_limits<uint64_t>::max();
+        std::string dummy;
+        CalculateMemPoolAncestors(*it, setAncestors, nNoLimit, nNoLimit, nNoLimit, nNoLimit, dummy, false);
+        uint64_t nCountCheck = setAncestors.size() + 1;
+        uint64_t nSizeCheck = it->GetTxSize();
+        CAmount nFeesCheck = it->GetModifiedFee();
+        unsigned int nSigOpCheck = it->GetSigOpCount();
+        BOOST_FOREACH(txiter ancestorIt, setAncestors) {
+            nSizeCheck += ancestorIt->GetTxSize();
+            nFeesCheck += ancestorIt->GetModifiedFee();
+            nSigOpCheck += ancestorIt->GetSigOpCount();
+        }
+        assert(it->GetCountWithAncestors() == nCountCheck);
+        assert(it->GetSizeWithAncestors() == nSizeCheck);
+        assert(it->GetModFeesWithAncestors() == nFeesCheck);
+        assert(it->GetSigOpCountWithAncestors() == nSigOpCheck);
         // Check children against mapNextTx
         CTxMemPool::setEntries setChildrenCheck;
         std::map<COutPoint, CInPoint>::const_iterator iter = mapNextTx.lower_bound(COutPoint(it->GetTx().GetHash(), 0));
@@ -1680,12 +1731,7 @@ void CTxMemPool::check(const CCoinsViewCache *pcoins) const
         assert(setChildrenCheck == GetMemPoolChildren(it));
         // Also check to make sure size is greater than sum with immediate children.
         // just a sanity check, not definitive that this calc is correct...
-        if (!it->IsDirty()) {
-            assert(it->GetSizeWithDescendants() >= childSizes + it->GetTxSize());
-        } else {
-            assert(it->GetSizeWithDescendants() == it->GetTxSize());
-            assert(it->GetModFeesWithDescendants() == it->GetModifiedFee());
-        }
+        assert(it->GetSizeWithDescendants() >= childSizes + it->GetTxSize());
 
         if (fDependsWait)
             waitingOnDependants.push_back(&(*it));
@@ -1817,7 +1863,16 @@ void CTxMemPool::PrioritiseTransaction(const uint256 hash, const string strHash,
             BOOST_FOREACH(txiter ancestorIt, setAncestors) {
                 mapTx.modify(ancestorIt, update_descendant_state(0, nFeeDelta, 0));
             }
+            // Now update all descendants' modified fees with ancestors
+            setEntries setDescendants;
+            CalculateDescendants(it, setDescendants);
+            setDescendants.erase(it);
+            BOOST_FOREACH(txiter descendantIt, setDescendants) {
+                mapTx.modify(descendantIt, update_ancestor_state(0, nFeeDelta, 0, 0));
+            }
         }
+        // The block templates built so far are stale now
+        nTransactionsUpdated++;
     }
     LogPrintf("PrioritiseTransaction: %s priority += %f, fee += %d\n", strHash, dPriorityDelta, FormatMoney(nFeeDelta));
 }
@@ -1867,13 +1922,13 @@ bool CCoinsViewMemPool::HaveCoins(const uint256 &txid) const {
 
 size_t CTxMemPool::DynamicMemoryUsage() const {
     LOCK(cs);
-    // Estimate the overhead of mapTx to be 12 pointers + an allocation, as no exact formula for boost::multi_index_contained is implemented.
-    return memusage::MallocUsage(sizeof(CTxMemPoolEntry) + 12 * sizeof(void*)) * mapTx.size() + memusage::DynamicUsage(mapNextTx) + memusage::DynamicUsage(mapDeltas) + memusage::DynamicUsage(mapLinks) + cachedInnerUsage;
+    // Estimate the overhead of mapTx to be 15 pointers + an allocation, as no exact formula for boost::multi_index_contained is implemented.
+    return memusage::MallocUsage(sizeof(CTxMemPoolEntry) + 15 * sizeof(void*)) * mapTx.size() + memusage::DynamicUsage(mapNextTx) + memusage::DynamicUsage(mapDeltas) + memusage::DynamicUsage(mapLinks) + cachedInnerUsage;
 }
 
-void CTxMemPool::RemoveStaged(setEntries &stage) {
+void CTxMemPool::RemoveStaged(setEntries &stage, bool updateDescendants) {
     AssertLockHeld(cs);
-    UpdateForRemoveFromMempool(stage);
+    UpdateForRemoveFromMempool(stage, updateDescendants);
     BOOST_FOREACH(const txiter& it, stage) {
         removeUnchecked(it);
     }
@@ -11,6 +11,7 @@
 
 #include "addressindex.h"
 #include "spentindex.h"
+#include "appindex.h"
 #include "amount.h"
 #include "coins.h"
 #include "primitives/transaction.h"
@@ -18,6 +19,9 @@
 
 #undef foreach
 #include "boost/multi_index_container.hpp"
+#include "boost/multi_index/composite_key.hpp"
+#include "boost/multi_index/hashed_index.hpp"
+#include "boost/multi_index/member.hpp"
 #include "boost/multi_index/ordered_index.hpp"
 
 class CAutoFile;
@@ -25,15 +29,16 @@ class CBlockIndex;
 struct CName_Id_IndexValue;
 struct CAppId_AppInfo_IndexValue;
 struct CAuth_IndexKey;
-struct CAppTx_IndexKey;
 struct CAssetId_AssetInfo_IndexValue;
-struct CAssetTx_IndexKey;
 struct CPutCandy_IndexKey;
 struct CPutCandy_IndexValue;
 struct CGetCandy_IndexKey;
 struct CGetCandy_IndexValue;
 struct CGetCandyCount_IndexKey;
 struct CGetCandyCount_IndexValue;
+struct CAssetSupply_IndexValue;
+struct CAssetBalance_IndexKey;
+struct CAssetBalance_IndexValue;
 
 inline double AllowFreeThreshold()
 {
@@ -72,16 +77,13 @@ class CTxMemPool;
  *
  * CTxMemPoolEntry stores data about the correponding transaction, as well
  * as data about all in-mempool transactions that depend on the transaction
- * ("descendant" transactions).
+ * ("descendant" transactions) and all in-mempool transactions it depends on
+ * ("ancestor" transactions).
  *
  * When a new entry is added to the mempool, we update the descendant state
  * (nCountWithDescendants, nSizeWithDescendants, and nModFeesWithDescendants) for
- * all ancestors of the newly added transaction.
- *
- * If updating the descendant state is skipped, we can mark the entry as
- * "dirty", and set nSizeWithDescendants/nModFeesWithDescendants to equal nTxSize/
- * nFee+feeDelta. (This can potentially happen during a reorg, where we limit the
- * amount of work we're willing to do to avoid consuming too much CPU.)
+ * all ancestors of the newly added transaction, and set its ancestor state from
+ * those ancestors.
  *
  */
 
@@ -105,13 +107,17 @@ private:
 
     // Information about descendants of this transaction that are in the
     // mempool; if we remove this transaction we must remove all of these
-    // descendants as well.  if nCountWithDescendants is 0, treat this entry as
-    // dirty, and nSizeWithDescendants and nModFeesWithDescendants will not be
-    // correct.
+    // descendants as well.
     uint64_t nCountWithDescendants; //! number of descendant transactions
     uint64_t nSizeWithDescendants;  //! ... and size
     CAmount nModFeesWithDescendants;  //! ... and total fees (all including us)
 
+    // Analogous statistics for ancestor transactions, used to mine packages
+    uint64_t nCountWithAncestors;
+    uint64_t nSizeWithAncestors;
+    CAmount nModFeesWithAncestors;
+    unsigned int nSigOpCountWithAncestors;
+
 public:
     CTxMemPoolEntry(const CTransaction& _tx, const CAmount& _nFee,
                     int64_t _nTime, double _entryPriority, unsigned int _entryHeight,
@@ -135,25 +141,25 @@ public:
     size_t DynamicMemoryUsage() const { return nUsageSize; }
     const LockPoints& GetLockPoints() const { return lockPoints; }
 
-    // Adjusts the descendant state, if this entry is not dirty.
+    // Adjusts the descendant state.
     void UpdateState(int64_t modifySize, CAmount modifyFee, int64_t modifyCount);
+    // Adjusts the ancestor state
+    void UpdateAncestorState(int64_t modifySize, CAmount modifyFee, int64_t modifyCount, int modifySigOps);
     // Updates the fee delta used for mining priority score, and the
-    // modified fees with descendants.
+    // modified fees with descendants and ancestors.
     void UpdateFeeDelta(int64_t feeDelta);
     // Update the LockPoints after a reorg
     void UpdateLockPoints(const LockPoints& lp);
 
-    /** We can set the entry to be dirty if doing the full calculation of in-
-     *  mempool descendants will be too expensive, which can potentially happen
-     *  when re-adding transactions from a block back to the mempool.
-     */
-    void SetDirty();
-    bool IsDirty() const { return nCountWithDescendants == 0; }
-
     uint64_t GetCountWithDescendants() const { return nCountWithDescendants; }
     uint64_t GetSizeWithDescendants() const { return nSizeWithDescendants; }
     CAmount GetModFeesWithDescendants() const { return nModFeesWithDescendants; }
 
+    uint64_t GetCountWithAncestors() const { return nCountWithAncestors; }
+    uint64_t GetSizeWithAncestors() const { return nSizeWithAncestors; }
+    CAmount GetModFeesWithAncestors() const { return nModFeesWithAncestors; }
+    unsigned int GetSigOpCountWithAncestors() const { return nSigOpCountWithAncestors; }
+
     bool GetSpendsCoinbase() const { return spendsCoinbase; }
 };
 
@@ -173,10 +179,20 @@ struct update_descendant_state
         int64_t modifyCount;
 };
 
-struct set_dirty
+struct update_ancestor_state
 {
+    update_ancestor_state(int64_t _modifySize, CAmount _modifyFee, int64_t _modifyCount, int _modifySigOps) :
+        modifySize(_modifySize), modifyFee(_modifyFee), modifyCount(_modifyCount), modifySigOps(_modifySigOps)
+    {}
+
     void operator() (CTxMemPoolEntry &e)
-        { e.SetDirty(); }
+        { e.UpdateAncestorState(modifySize, modifyFee, modifyCount, modifySigOps); }
+
+    private:
+        int64_t modifySize;
+        CAmount modifyFee;
+        int64_t modifyCount;
+        int modifySigOps;
 };
 
 struct update_fee_delta
@@ -264,18 +280,40 @@ public:
     }
 };
 
-class CompareTxMemPoolEntryByEntryTime
+/** \class CompareTxMemPoolEntryByAncestorFee
+ *
+ *  Sort by feerate of entry with all its in-mempool ancestors, in descending
+ *  order. This is the order packages are mined in.
+ */
+class CompareTxMemPoolEntryByAncestorFee
 {
 public:
     bool operator()(const CTxMemPoolEntry& a, const CTxMemPoolEntry& b) const
     {
-        return a.GetTime() < b.GetTime();
+        double aFees = a.GetModFeesWithAncestors();
+        double aSize = a.GetSizeWithAncestors();
+
+        double bFees = b.GetModFeesWithAncestors();
+        double bSize = b.GetSizeWithAncestors();
+
+        // Avoid division by rewriting (a/b > c/d) as (a*d > c*b).
+        double f1 = aFees * bSize;
+        double f2 = aSize * bFees;
+
+        if (f1 == f2) {
+            return a.GetTx().GetHash() < b.GetTx().GetHash();
+        }
+        return f1 > f2;
     }
 };
 
-struct CAppTx_IndexKeyCompare
+class CompareTxMemPoolEntryByEntryTime
 {
-    bool operator()(const CAppTx_IndexKey& a, const CAppTx_IndexKey& b) const;
+public:
+    bool operator()(const CTxMemPoolEntry& a, const CTxMemPoolEntry& b) const
+    {
+        return a.GetTime() < b.GetTime();
+    }
 };
 
 struct CAuth_IndexKeyCompare
@@ -283,11 +321,104 @@ struct CAuth_IndexKeyCompare
     bool operator()(const CAuth_IndexKey& a, const CAuth_IndexKey& b) const;
 };
 
-struct CAssetTx_IndexKeyCompare
+// extracts the txid of an indexed app or asset output, all outputs of a tx are removed together
+template<typename Key>
+struct indexkey_txid
 {
-    bool operator()(const CAssetTx_IndexKey& a, const CAssetTx_IndexKey& b) const;
+    typedef uint256 result_type;
+    const result_type& operator() (const Key& key) const
+    {
+        return key.out.hash;
+    }
 };
 
+struct IndexKeyTxidHasher
+{
+    size_t operator()(const uint256& txid) const { return txid.GetCheapHash(); }
+};
+
+// tag of the mapTx view used to mine packages
+struct ancestor_score {};
+
+// tags of the mapAppTx and mapAssetTx views
+struct apptx_address {};
+struct assettx_address {};
+struct assettx_class {};
+struct indexkey_txid_tag {};
+
+typedef boost::multi_index_container<
+    CAppTx_IndexKey,
+    boost::multi_index::indexed_by<
+        // sorted by app id, address, class and outpoint
+        boost::multi_index::ordered_unique<
+            boost::multi_index::composite_key<
+                CAppTx_IndexKey,
+                boost::multi_index::member<CAppTx_IndexKey, uint256, &CAppTx_IndexKey::appId>,
+                boost::multi_index::member<CAppTx_IndexKey, std::string, &CAppTx_IndexKey::strAddress>,
+                boost::multi_index::member<CAppTx_IndexKey, uint8_t, &CAppTx_IndexKey::nTxClass>,
+                boost::multi_index::member<CAppTx_IndexKey, COutPoint, &CAppTx_IndexKey::out>
+            >
+        >,
+        // sorted by address and app id
+        boost::multi_index::ordered_non_unique<
+            boost::multi_index::tag<apptx_address>,
+            boost::multi_index::composite_key<
+                CAppTx_IndexKey,
+                boost::multi_index::member<CAppTx_IndexKey, std::string, &CAppTx_IndexKey::strAddress>,
+                boost::multi_index::member<CAppTx_IndexKey, uint256, &CAppTx_IndexKey::appId>
+            >
+        >,
+        // grouped by txid
+        boost::multi_index::hashed_non_unique<
+            boost::multi_index::tag<indexkey_txid_tag>,
+            indexkey_txid<CAppTx_IndexKey>,
+            IndexKeyTxidHasher
+        >
+    >
+> indexed_apptx_set;
+
+typedef boost::multi_index_container<
+    CAssetTx_IndexKey,
+    boost::multi_index::indexed_by<
+        // sorted by asset id, address, class and outpoint
+        boost::multi_index::ordered_unique<
+            boost::multi_index::composite_key<
+                CAssetTx_IndexKey,
+                boost::multi_index::member<CAssetTx_IndexKey, uint256, &CAssetTx_IndexKey::assetId>,
+                boost::multi_index::member<CAssetTx_IndexKey, std::string, &CAssetTx_IndexKey::strAddress>,
+                boost::multi_index::member<CAssetTx_IndexKey, uint8_t, &CAssetTx_IndexKey::nTxClass>,
+                boost::multi_index::member<CAssetTx_IndexKey, COutPoint, &CAssetTx_IndexKey::out>
+            >
+        >,
+        // sorted by address and asset id
+        boost::multi_index::ordered_non_unique<
+            boost::multi_index::tag<assettx_address>,
+            boost::multi_index::composite_key<
+                CAssetTx_IndexKey,
+                boost::multi_index::member<CAssetTx_IndexKey, std::string, &CAssetTx_IndexKey::strAddress>,
+                boost::multi_index::member<CAssetTx_IndexKey, uint256, &CAssetTx_IndexKey::assetId>
+            >
+        >,
+        // sorted by asset id and class, then like the first view
+        boost::multi_index::ordered_non_unique<
+            boost::multi_index::tag<assettx_class>,
+            boost::multi_index::composite_key<
+                CAssetTx_IndexKey,
+                boost::multi_index::member<CAssetTx_IndexKey, uint256, &CAssetTx_IndexKey::assetId>,
+                boost::multi_index::member<CAssetTx_IndexKey, uint8_t, &CAssetTx_IndexKey::nTxClass>,
+                boost::multi_index::member<CAssetTx_IndexKey, std::string, &CAssetTx_IndexKey::strAddress>,
+                boost::multi_index::member<CAssetTx_IndexKey, COutPoint, &CAssetTx_IndexKey::out>
+            >
+        >,
+        // grouped by txid
+        boost::multi_index::hashed_non_unique<
+            boost::multi_index::tag<indexkey_txid_tag>,
+            indexkey_txid<CAssetTx_IndexKey>,
+            IndexKeyTxidHasher
+        >
+    >
+> indexed_assettx_set;
+
 struct CGetCandy_IndexKeyCompare
 {
     bool operator()(const CGetCandy_IndexKey& a, const CGetCandy_IndexKey& b) const;
@@ -326,11 +457,12 @@ public:
  *
  * CTxMemPool::mapTx, and CTxMemPoolEntry bookkeeping:
  *
- * mapTx is a boost::multi_index that sorts the mempool on 4 criteria:
+ * mapTx is a boost::multi_index that sorts the mempool on 5 criteria:
  * - transaction hash
  * - feerate [we use max(feerate of tx, feerate of tx with all descendants)]
  * - time in mempool
  * - mining score (feerate modified by any fee deltas from PrioritiseTransaction)
+ * - ancestor feerate (modified feerate of tx with all its ancestors)
  *
  * Note: the term "descendant" refers to in-mempool transactions that depend on
  * this one, while "ancestor" refers to in-mempool transactions that a given
@@ -339,7 +471,8 @@ public:
  * In order for the feerate sort to remain correct, we must update transactions
  * in the mempool when new descendants arrive.  To facilitate this, we track
  * the set of in-mempool direct parents and direct children in mapLinks.  Within
- * each CTxMemPoolEntry, we track the size and fees of all descendants.
+ * each CTxMemPoolEntry, we track the size and fees of all descendants, and the
+ * size, fees and sigops of all ancestors.
  *
  * Usually when a new transaction is added to the mempool, it has no in-mempool
  * children (because any such children would be an orphan).  So in
@@ -347,11 +480,14 @@ public:
  * - update a new entry's setMemPoolParents to include all in-mempool parents
  * - update the new entry's direct parents to include the new tx as a child
  * - update all ancestors of the transaction to include the new tx's size/fee
+ * - update the new entry's ancestor state to include all its ancestors
  *
  * When a transaction is removed from the mempool, we must:
  * - update all in-mempool parents to not track the tx in setMemPoolChildren
  * - update all ancestors to not include the tx's size/fees in descendant state
  * - update all in-mempool children to not include it as a parent
+ * - if its descendants stay in the mempool (the tx was mined), update them to
+ *   not include the tx in their ancestor state
  *
  * These happen in UpdateForRemoveFromMempool().  (Note that when removing a
  * transaction along with its descendants, we must calculate that set of
@@ -382,14 +518,6 @@ public:
  * CalculateMemPoolAncestors() takes configurable limits that are designed to
  * prevent these calculations from being too CPU intensive.
  *
- * Adding transactions from a disconnected block can be very time consuming,
- * because we don't have a way to limit the number of in-mempool descendants.
- * To bound CPU processing, we limit the amount of work we're willing to do
- * to properly update the descendant information for a tx being added from
- * a disconnected block.  If we would exceed the limit, then we instead mark
- * the entry as "dirty", and set the feerate for sorting purposes to be equal
- * the feerate of the transaction without any descendants.
- *
  */
 class CTxMemPool
 {
@@ -432,6 +560,12 @@ public:
             boost::multi_index::ordered_unique<
                 boost::multi_index::identity<CTxMemPoolEntry>,
                 CompareTxMemPoolEntryByScore
+            >,
+            // sorted by fee rate with ancestors (for package mining)
+            boost::multi_index::ordered_non_unique<
+                boost::multi_index::tag<ancestor_score>,
+                boost::multi_index::identity<CTxMemPoolEntry>,
+                CompareTxMemPoolEntryByAncestorFee
             >
         >
     > indexed_transaction_set;
@@ -481,10 +615,7 @@ private:
     typedef std::map<uint256, std::vector<std::string> > mapAppName_AppId_IndexInserted;
     mapAppName_AppId_IndexInserted mapAppName_AppId_Inserted;
 
-    typedef std::map<CAppTx_IndexKey, int, CAppTx_IndexKeyCompare> mapAppTx_Index;
-    mapAppTx_Index mapAppTx;
-    typedef std::map<uint256, std::vector<CAppTx_IndexKey> > mapAppTx_IndexInserted;
-    mapAppTx_IndexInserted mapAppTx_Inserted;
+    indexed_apptx_set mapAppTx;
 
     typedef std::map<CAuth_IndexKey, int, CAuth_IndexKeyCompare> mapAuth_Index;
     mapAuth_Index mapAuth;
@@ -506,10 +637,7 @@ private:
     typedef std::map<uint256, std::vector<std::string> > mapAssetName_AssetId_IndexInserted;
     mapAssetName_AssetId_IndexInserted mapAssetName_AssetId_Inserted;
 
-    typedef std::map<CAssetTx_IndexKey, int, CAssetTx_IndexKeyCompare> mapAssetTx_Index;
-    mapAssetTx_Index mapAssetTx;
-    typedef std::map<uint256, std::vector<CAssetTx_IndexKey> > mapAssetTx_IndexInserted;
-    mapAssetTx_IndexInserted mapAssetTx_Inserted;
+    indexed_assettx_set mapAssetTx;
 
     typedef std::map<CGetCandy_IndexKey, CGetCandy_IndexValue, CGetCandy_IndexKeyCompare> mapGetCandy_Index;
     mapGetCandy_Index mapGetCandy;
@@ -521,6 +649,16 @@ private:
     typedef std::map<uint256, std::vector<std::pair<CGetCandyCount_IndexKey,CGetCandyCount_IndexValue> > > mapGetCandyCount_IndexInserted;
     mapGetCandyCount_IndexInserted mapGetCandyCount_Inserted;
 
+    typedef std::map<uint256, CAssetSupply_IndexValue> mapAssetSupply_Index;
+    mapAssetSupply_Index mapAssetSupply;
+    typedef std::map<uint256, std::vector<std::pair<uint256, CAssetSupply_IndexValue> > > mapAssetSupply_IndexInserted;
+    mapAssetSupply_IndexInserted mapAssetSupply_Inserted;
+
+    typedef std::map<CAssetBalance_IndexKey, CAssetBalance_IndexValue> mapAssetBalance_Index;
+    mapAssetBalance_Index mapAssetBalance;
+    typedef std::map<uint256, mapAssetBalance_Index> mapAssetBalance_IndexInserted;
+    mapAssetBalance_IndexInserted mapAssetBalance_Inserted;
+
     void UpdateParent(txiter entry, txiter parent, bool add);
     void UpdateChild(txiter entry, txiter child, bool add);
 
@@ -598,6 +736,14 @@ public:
     bool get_GetCandyCount_Index(const uint256& assetId, const COutPoint& out,CGetCandyCount_IndexValue& value);
     bool remove_GetCandyCount_Index(const uint256& txhash);
 
+    void add_AssetSupply_Index(const CTxMemPoolEntry& entry, const CCoinsViewCache& view);
+    bool get_AssetSupply_Index(const uint256& assetId, CAssetSupply_IndexValue& supply);
+    bool remove_AssetSupply_Index(const uint256& txhash);
+
+    void add_AssetBalance_Index(const CTxMemPoolEntry& entry, const CCoinsViewCache& view);
+    bool get_AssetBalance_Index(const CAssetBalance_IndexKey& key, CAssetBalance_IndexValue& balance);
+    bool remove_AssetBalance_Index(const uint256& txhash);
+
     int get_PutCandy_count(const uint256& assetId);
 
     void remove(const CTransaction &tx, std::list<CTransaction>& removed, bool fRecursive = false);
@@ -625,8 +771,11 @@ public:
 public:
     /** Remove a set of transactions from the mempool.
      *  If a transaction is in this set, then all in-mempool descendants must
-     *  also be in the set.*/
-    void RemoveStaged(setEntries &stage);
+     *  also be in the set, unless this transaction is being removed for being
+     *  in a block. Set updateDescendants to true when removing a tx that was
+     *  in a block, so that any in-mempool descendants have their ancestor state
+     *  updated.*/
+    void RemoveStaged(setEntries &stage, bool updateDescendants = false);
 
     /** When adding transactions from a disconnected block back to the mempool,
      *  new mempool entries may have children in the mempool (which is generally
@@ -649,7 +798,7 @@ public:
      *  fSearchForParents = whether to search a tx's vin for in-mempool parents, or
      *    look up parents from mapLinks. Must be true for entries not in the mempool
      */
-    bool CalculateMemPoolAncestors(const CTxMemPoolEntry &entry, setEntries &setAncestors, uint64_t limitAncestorCount, uint64_t limitAncestorSize, uint64_t limitDescendantCount, uint64_t limitDescendantSize, std::string &errString, bool fSearchForParents = true);
+    bool CalculateMemPoolAncestors(const CTxMemPoolEntry &entry, setEntries &setAncestors, uint64_t limitAncestorCount, uint64_t limitAncestorSize, uint64_t limitDescendantCount, uint64_t limitDescendantSize, std::string &errString, bool fSearchForParents = true) const;
 
     /** Populate setDescendants with all in-mempool descendants of hash.
      *  Assumes that setDescendants includes all in-mempool descendants of anything
@@ -728,21 +877,21 @@ private:
      *  updated and hence their state is already reflected in the parent
      *  state).
      *
-     *  If updating an entry requires looking at more than maxDescendantsToVisit
-     *  transactions, outside of the ones in setExclude, then give up.
-     *
      *  cachedDescendants will be updated with the descendants of the transaction
      *  being updated, so that future invocations don't need to walk the
      *  same transaction again, if encountered in another transaction chain.
      */
-    bool UpdateForDescendants(txiter updateIt,
-            int maxDescendantsToVisit,
+    void UpdateForDescendants(txiter updateIt,
             cacheMap &cachedDescendants,
             const std::set<uint256> &setExclude);
     /** Update ancestors of hash to add/remove it as a descendant transaction. */
     void UpdateAncestorsOf(bool add, txiter hash, setEntries &setAncestors);
-    /** For each transaction being removed, update ancestors and any direct children. */
-    void UpdateForRemoveFromMempool(const setEntries &entriesToRemove);
+    /** Set ancestor state for an entry */
+    void UpdateEntryForAncestors(txiter it, const setEntries &setAncestors);
+    /** For each transaction being removed, update ancestors and any direct children.
+     *  If updateDescendants is true, then also update in-mempool descendants'
+     *  ancestor state. */
+    void UpdateForRemoveFromMempool(const setEntries &entriesToRemove, bool updateDescendants);
     /** Sever link between specified transaction and direct children. */
     void UpdateChildrenForRemoval(txiter entry);
 
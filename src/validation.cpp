@@ -45,6 +45,8 @@
 #include "masternode-sync.h"
 #include "messagesigner.h"
 #include "validation.h"
+#include "candydb.h"
+#include "candyengine.h"
 
 
 #ifdef ENABLE_WALLET
@@ -56,11 +58,15 @@
 #include "masternode-payments.h"
 #include "activemasternode.h"
 
+#include <deque>
 #include <sstream>
 
 #include <boost/algorithm/string/replace.hpp>
+#include <boost/bind.hpp>
 #include <boost/filesystem.hpp>
 #include <boost/filesystem/fstream.hpp>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
 #include <boost/lexical_cast.hpp>
 #include <boost/math/distributions/poisson.hpp>
 #include <boost/thread.hpp>
@@ -106,11 +112,6 @@ uint64_t nPruneTarget = 0;
 bool fAlerts = DEFAULT_ALERTS;
 bool fEnableReplacement = DEFAULT_ENABLE_REPLACEMENT;
 bool fGetCandyInfoStart = false;
-std::mutex g_mutexAllCandyInfo;
-std::vector<CCandy_BlockTime_Info> gAllCandyInfoVec;
-std::mutex g_mutexTmpAllCandyInfo;
-std::vector<CCandy_BlockTime_Info> gTmpAllCandyInfoVec;
-bool fUpdateAllCandyInfoFinished = false;
 unsigned int nCandyPageCount = 20;//display 20 candy info per page
 int64_t g_nAllowableErrorTime = 60;
 #if SCN_CURRENT == SCN__main
@@ -166,24 +167,12 @@ extern int g_nSelectMasterNodeReset;
 extern int g_nSelectMasterNodeFail;
 extern bool g_fReceiveBlock;
 
-std::mutex g_mutexAllPayeeInfo;
+// every masternode payee index record, loaded with the block index and kept in step by ConnectBlock/DisconnectBlock (guarded by cs_main)
 std::map<std::string,CMasternodePayee_IndexValue> gAllPayeeInfoMap;
 
-const static int M = 2000; //Maximum number of digits
-int numA[M];
-int numB[M];
-
 std::atomic<bool> fDIP0001WasLockedIn{false};
 std::atomic<bool> fDIP0001ActiveAtTip{false};
 
-struct CompareCandyInfo
-{
-    bool operator()(const std::pair<CPutCandy_IndexKey, CPutCandy_IndexValue>& l, const std::pair<CPutCandy_IndexKey, CPutCandy_IndexValue>& r)
-    {
-        return l.second.nHeight > r.second.nHeight;
-    }
-};
-
 uint256 hashAssumeValid;
 
 /** Fees smaller than this (in duffs) are considered zero fee (for relaying, mining and transaction creation) */
@@ -206,14 +195,32 @@ const string strMessageMagic = "DarkCoin Signed Message:\n";
 
 std::mutex g_mutexChangeFile;
 
-std::mutex g_mutexChangeInfo;
-static std::list<CChangeInfo> g_listChangeInfo;
-static int g_nListChangeInfoLimited = 20;
-int GetChangeInfoListSize()
+/**
+ * Change info of the connected blocks, handed from ConnectBlock() to ThreadWriteChangeInfo().
+ * The newest CHANGE_INFO_KEEP_BLOCKS blocks stay queued so that a reorg can still replace them
+ * before they reach the change files. Block connection waits for the writer once
+ * CHANGE_INFO_QUEUE_CAPACITY blocks are queued or being written. Its producers, ConnectBlock()
+ * under cs_main and the replay at startup, never run at the same time.
+ */
+static const int CHANGE_INFO_KEEP_BLOCKS = 20;
+//! blocks ActivateBestChainStep() may connect while holding cs_main
+static const int CHANGE_INFO_STEP_BLOCKS = 32;
+static const int CHANGE_INFO_QUEUE_CAPACITY = CHANGE_INFO_KEEP_BLOCKS + 2 * CHANGE_INFO_STEP_BLOCKS;
+//! blocks LoadChangeInfoToList() reads ahead of the one it queues
+static const int CHANGE_INFO_REPLAY_AHEAD = 256;
+
+static CBlockChangeQueue<CChangeInfo> g_queueChangeInfo(CHANGE_INFO_KEEP_BLOCKS, CHANGE_INFO_QUEUE_CAPACITY, ShutdownRequested);
+
+void WaitForChangeInfoQueue(const int nBlocks)
+{
+    g_queueChangeInfo.WaitForSpace(nBlocks);
+}
+
+CChangeInfoQueueStats GetChangeInfoQueueStats()
 {
-    std::lock_guard<std::mutex> lock(g_mutexChangeInfo);
-    return int(g_listChangeInfo.size());
+    return g_queueChangeInfo.GetStats();
 }
+
 bool CompareChangeInfo(const CChangeInfo& a1, const CChangeInfo& a2)
 {
     return a1.nHeight < a2.nHeight;
@@ -610,6 +617,16 @@ bool GetTxOutAddress(const CTxOut& txout, string* pAddress)
     return true;
 }
 
+/** Binary key of a txout address for the candy balances, like GetTxOutAddress() without base58 */
+static bool GetTxOutAddressKey(const CTxOut& txout, CCandyAddressKey& key)
+{
+    CTxDestination dest;
+    if(!ExtractDestination(txout.scriptPubKey, dest))
+        return false;
+
+    return key.SetDestination(dest);
+}
+
 bool CheckUnlockedHeight(const int32_t& nTxVersion, const int64_t& nOffset)
 {
     if (nTxVersion >= SAFE_TX_VERSION_3)
@@ -736,7 +753,7 @@ bool CheckTransaction(const CTransaction& tx, CValidationState &state, const enu
             }
         }
 
-        const std::vector<unsigned char>& vReserve = txout.vReserve;
+        const CTxOutReserve& vReserve = txout.vReserve;
         if(tx.IsCoinBase())
         {
             if(IsProtocolV0(nTxHeight))
@@ -762,7 +779,7 @@ bool CheckTransaction(const CTransaction& tx, CValidationState &state, const enu
             }
             else if(tx.nVersion >= SAFE_TX_VERSION_2)
             {
-                const std::vector<unsigned char>& vReserve = txout.vReserve;
+                const CTxOutReserve& vReserve = txout.vReserve;
                 if(txout.nUnlockedHeight < 0 ||
                    vReserve.size() < TXOUT_RESERVE_MIN_SIZE || vReserve.size() > TXOUT_RESERVE_MAX_SIZE ||
                    vReserve[0] != 's' || vReserve[1] != 'a' || vReserve[2] != 'f' || vReserve[3] != 'e')
@@ -819,12 +836,9 @@ bool CheckAssetTxInputAndOutput(const CTransaction& tx, CValidationState &state,
         if (!coins || !coins->IsAvailable(txin.prevout.n))
             return state.Invalid(false, REJECT_DUPLICATE, "3-bad-txns-inputs-spent");
 
-        const CTxOut& txout = coins->vout[txin.prevout.n];
-        if (txout.IsAsset())
-        {
+        // every input is checked, the app checks of a block run on a view without its spends
+        if (coins->vout[txin.prevout.n].IsAsset())
             fvinHasAsset = true;
-            break;
-        }
     }
 
     if (fvinHasAsset && !fvoutHasAssset)
@@ -833,7 +847,64 @@ bool CheckAssetTxInputAndOutput(const CTransaction& tx, CValidationState &state,
     return true;
 }
 
-bool CheckAppTransaction(const CTransaction& tx, CValidationState &state, const CCoinsViewCache& view, map<CPutCandy_IndexKey, CAmount>& mapAssetGetCandy, const bool &fWithMempool)
+/** Get candy amount claimed by a get candy txout, added up with the others of the block in block order */
+struct CGetCandyClaim
+{
+    CPutCandy_IndexKey key;
+    CAmount nDBAmount;
+    CAmount nCandyAmount;
+
+    CGetCandyClaim(const CPutCandy_IndexKey& key, const CAmount& nDBAmount, const CAmount& nCandyAmount) : key(key), nDBAmount(nDBAmount), nCandyAmount(nCandyAmount) {}
+};
+
+/** Outcome of the app and asset rules of a block transaction checked on the app check threads */
+struct CAppCheckResult
+{
+    bool fQueued;
+    bool fValid;
+    bool fInterrupted;
+    //! looked up under cs_main before the check is queued
+    int nTxHeight;
+    int nCandyTxHeight;
+    CValidationState state;
+    std::vector<CGetCandyClaim> vClaim;
+
+    CAppCheckResult() : fQueued(false), fValid(false), fInterrupted(false), nTxHeight(0), nCandyTxHeight(0) {}
+};
+
+static bool AddGetCandyAmount(map<CPutCandy_IndexKey, CAmount>& mapAssetGetCandy, CValidationState &state, const CPutCandy_IndexKey& key, const CAmount& dbamount, const CAmount& memamount, const CAmount& nCandyAmount, const bool &fWithMempool)
+{
+    const CCandyInfo& candyInfo = key.candyInfo;
+    CAmount nTxGetCandyTotal = 0;
+
+    if (!CompareDBGetCandyPutCandyTotal(mapAssetGetCandy, key, dbamount, candyInfo.nAmount, nCandyAmount, nTxGetCandyTotal))
+    {
+        LogPrint("asset", "check-getcandy: get_candy_this_time_total_amount: %lld, already_get_candy_dbtotal_amount: %lld, total_candy_amount: %lld\n", nTxGetCandyTotal, dbamount, candyInfo.nAmount);
+        return state.DoS(10, false, REJECT_INVALID, "get_candy: more than the total number of candy issued");
+    }
+
+    CAmount nmapgetcandyamount = 0;
+    CAmount nGetCandyTotalAmount = 0;
+    if (fWithMempool)
+        nGetCandyTotalAmount = dbamount + memamount;
+    else
+        nGetCandyTotalAmount = dbamount;
+
+    if (!CompareGetCandyPutCandyTotal(mapAssetGetCandy, key, nGetCandyTotalAmount, candyInfo.nAmount, nCandyAmount, nmapgetcandyamount))
+    {
+        LogPrint("asset", "check-getcandy: get_candy_this_time_total_amount: %lld, already_get_candy_total_amount: %lld, total_candy_amount: %lld\n", nmapgetcandyamount, nGetCandyTotalAmount, candyInfo.nAmount);
+        return state.DoS(10, false, SEND_GETCADNY_TX_SUCCESS, "get_candy: Send candy transaction successfully");
+    }
+
+    return true;
+}
+
+/**
+ * pCheck is set when the transaction is checked on an app check thread: the
+ * heights come from it and the get candy amounts are claimed in it instead of
+ * being added to mapAssetGetCandy, see AddAppCheckResult().
+ */
+static bool CheckAppTransaction(const CTransaction& tx, CValidationState &state, const CCoinsViewCache& view, map<CPutCandy_IndexKey, CAmount>& mapAssetGetCandy, const bool &fWithMempool, CAppCheckResult* pCheck)
 {
     if(tx.IsCoinBase())
         return true;
@@ -847,11 +918,12 @@ bool CheckAppTransaction(const CTransaction& tx, CValidationState &state, const
     for(unsigned int i = 0; i < tx.vout.size(); i++)
     {
         const CTxOut& txout = tx.vout[i];
-        CAppHeader header;
-        vector<unsigned char> vData;
-        if(!ParseReserve(txout.vReserve, header, vData))
+        const CAppPayload* pPayload = GetAppPayload(tx, i);
+        if(!pPayload)
             continue;
 
+        const CAppHeader& header = pPayload->header;
+
         if(header.appId.IsNull())
             return state.DoS(50, false, REJECT_INVALID, "app_tx/asset_tx: app id is null");
         appId = header.appId;
@@ -859,9 +931,9 @@ bool CheckAppTransaction(const CTransaction& tx, CValidationState &state, const
 
         if(header.nAppCmd == ISSUE_ASSET_CMD)
         {
-            CAssetData assetData;
-            if(!ParseIssueData(vData, assetData))
+            if(!pPayload->fDataValid)
                 return state.DoS(50, false, REJECT_INVALID, "asset_tx: parse issue txout reserve failed");
+            const CAssetData& assetData = pPayload->assetData;
             uint256 assetId = assetData.GetHash();
             if(assetId.IsNull())
                 return state.DoS(50, false, REJECT_INVALID, "issue_asset: asset id is null, " + strprintf("%s-%d", tx.GetHash().GetHex(), i));
@@ -869,45 +941,45 @@ bool CheckAppTransaction(const CTransaction& tx, CValidationState &state, const
         }
         else if(header.nAppCmd == ADD_ASSET_CMD)
         {
-            CCommonData addData;
-            if(!ParseCommonData(vData, addData))
+            if(!pPayload->fDataValid)
                 return state.DoS(50, false, REJECT_INVALID, "asset_tx: parse add txout reserve failed");
+            const CCommonData& addData = pPayload->commonData;
             if(addData.assetId.IsNull())
                 return state.DoS(50, false, REJECT_INVALID, "add_asset: asset id is null, " + strprintf("%s-%d", tx.GetHash().GetHex(), i));
             mapAssetId[addData.assetId]++;
         }
         else if(header.nAppCmd == TRANSFER_ASSET_CMD)
         {
-            CCommonData transferData;
-            if(!ParseCommonData(vData, transferData))
+            if(!pPayload->fDataValid)
                 return state.DoS(50, false, REJECT_INVALID, "asset_tx: parse transfer txout reserve failed");
+            const CCommonData& transferData = pPayload->commonData;
             if(transferData.assetId.IsNull())
                 return state.DoS(50, false, REJECT_INVALID, "transfer_asset: asset id is null, " + strprintf("%s-%d", tx.GetHash().GetHex(), i));
             mapAssetId[transferData.assetId]++;
         }
         else if(header.nAppCmd == DESTORY_ASSET_CMD)
         {
-            CCommonData destoryData;
-            if(!ParseCommonData(vData, destoryData))
+            if(!pPayload->fDataValid)
                 return state.DoS(50, false, REJECT_INVALID, "asset_tx: parse destory txout reserve failed");
+            const CCommonData& destoryData = pPayload->commonData;
             if(destoryData.assetId.IsNull())
                 return state.DoS(50, false, REJECT_INVALID, "destory_asset: asset id is null, " + strprintf("%s-%d", tx.GetHash().GetHex(), i));
             mapAssetId[destoryData.assetId]++;
         }
         else if(header.nAppCmd == CHANGE_ASSET_CMD)
         {
-            CCommonData changeData;
-            if(!ParseCommonData(vData, changeData))
+            if(!pPayload->fDataValid)
                 return state.DoS(50, false, REJECT_INVALID, "asset_tx: parse change txout reserve failed");
+            const CCommonData& changeData = pPayload->commonData;
             if(changeData.assetId.IsNull())
                 return state.DoS(50, false, REJECT_INVALID, "change_asset: asset id is null, " + strprintf("%s-%d", tx.GetHash().GetHex(), i));
             mapAssetId[changeData.assetId]++;
         }
         else if(header.nAppCmd == PUT_CANDY_CMD)
         {
-            CPutCandyData putData;
-            if(!ParsePutCandyData(vData, putData))
+            if(!pPayload->fDataValid)
                 return state.DoS(50, false, REJECT_INVALID, "asset_tx: parse putcandy txout reserve failed");
+            const CPutCandyData& putData = pPayload->putCandyData;
             if(putData.assetId.IsNull())
                 return state.DoS(50, false, REJECT_INVALID, "put_candy: asset id is null, " + strprintf("%s-%d", tx.GetHash().GetHex(), i));
             mapAssetId[putData.assetId]++;
@@ -923,9 +995,9 @@ bool CheckAppTransaction(const CTransaction& tx, CValidationState &state, const
             else
                return state.DoS(50, false, REJECT_INVALID, "get_candy: the output address already exists.");
 
-            CGetCandyData getData;
-            if(!ParseGetCandyData(vData, getData))
+            if(!pPayload->fDataValid)
                 return state.DoS(50, false, REJECT_INVALID, "asset_tx: parse getcandy txout reserve failed");
+            const CGetCandyData& getData = pPayload->getCandyData;
             if(getData.assetId.IsNull())
                 return state.DoS(50, false, REJECT_INVALID, "get_candy: asset id is null, " + strprintf("%s-%d", tx.GetHash().GetHex(), i));
             mapAssetId[getData.assetId]++;
@@ -1063,17 +1135,17 @@ bool CheckAppTransaction(const CTransaction& tx, CValidationState &state, const
     if(mapInAssetId.size() > 1 || mapInAssetId2.size() > 1)
         return state.DoS(50, false, REJECT_INVALID, "asset_tx: vin can contain 1 asset only, " + tx.GetHash().GetHex());
 
-    int nTxHeight = GetTxHeight(tx.GetHash());
+    int nTxHeight = pCheck ? pCheck->nTxHeight : GetTxHeight(tx.GetHash());
 
     for(unsigned int i = 0; i < tx.vout.size(); i++)
     {
         const CTxOut txout = tx.vout[i];
-        CAppHeader header;
-        vector<unsigned char> vData;
-
-        if(!ParseReserve(txout.vReserve, header, vData)) // safe txout
+        const CAppPayload* pPayload = GetAppPayload(tx, i);
+        if(!pPayload) // safe txout
             continue;
 
+        const CAppHeader& header = pPayload->header;
+
         string strAddress = "";
         if(!GetTxOutAddress(txout, &strAddress))
             return state.DoS(10, false, REJECT_INVALID, "invalid txout address, " + txout.ToString());
@@ -1086,10 +1158,10 @@ bool CheckAppTransaction(const CTransaction& tx, CValidationState &state, const
             if(txout.nValue != APP_OUT_VALUE)
                 return state.DoS(50, false, REJECT_INVALID, "register_app: invalid txout value");
 
-            CAppData appData;
-            string strAdminAddress = "";
-            if(!ParseRegisterData(vData, appData, &strAdminAddress))
+            if(!pPayload->fDataValid)
                 return state.DoS(50, false, REJECT_INVALID, "register_app: parse reserve failed");
+            const CAppData& appData = pPayload->appData;
+            const string& strAdminAddress = pPayload->strAdminAddress;
             if(strAddress != strAdminAddress)
                 return state.DoS(50, false, REJECT_INVALID, "register_app: txout address is different from admin address, " + strAddress + " != " + strAdminAddress);
 
@@ -1209,9 +1281,9 @@ bool CheckAppTransaction(const CTransaction& tx, CValidationState &state, const
             if(strAddress != strAdminAddress)
                 return state.DoS(50, false, REJECT_INVALID, "set_auth: txout address is different from admin address" + strAddress + " != " + strAdminAddress);
 
-            CAuthData authData;
-            if(!ParseAuthData(vData, authData))
+            if(!pPayload->fDataValid)
                 return state.DoS(50, false, REJECT_INVALID, "set_auth: parse reserve failed");
+            const CAuthData& authData = pPayload->authData;
 
             if(authData.nSetType < MIN_SETTYPE_VALUE || authData.nSetType > sporkManager.GetSporkValue(SPORK_102_SET_TYPE_MAX_VALUE))
                 return state.DoS(10, false, REJECT_INVALID, "set_auth: invalid set type");
@@ -1306,9 +1378,9 @@ bool CheckAppTransaction(const CTransaction& tx, CValidationState &state, const
             if(!GetAppInfoByAppId(header.appId, appInfo, false))
                 return state.DoS(10, false, REJECT_INVALID, "extenddata: non-existent app");
 
-            CExtendData extendData;
-            if(!ParseExtendData(vData, extendData))
+            if(!pPayload->fDataValid)
                 return state.DoS(50, false, REJECT_INVALID, "extenddata: parse reserve failed");
+            const CExtendData& extendData = pPayload->extendData;
 
             if(extendData.nAuth < MIN_AUTH_VALUE)
                 return state.DoS(10, false, REJECT_INVALID, "extenddata: invalid auth");
@@ -1445,9 +1517,9 @@ bool CheckAppTransaction(const CTransaction& tx, CValidationState &state, const
             if(strInAddress != strAddress)
                 return state.DoS(50, false, REJECT_INVALID, "issue_asset: txin address is different from txout address, " + strInAddress + " != " + strAddress);
 
-            CAssetData assetData;
-            if(!ParseIssueData(vData, assetData))
+            if(!pPayload->fDataValid)
                 return state.DoS(50, false, REJECT_INVALID, "issue_asset: parse reserve failed");
+            const CAssetData& assetData = pPayload->assetData;
 
             uint256 assetId = assetData.GetHash();
             if(ExistAssetId(assetId, fWithMempool))
@@ -1483,12 +1555,7 @@ bool CheckAppTransaction(const CTransaction& tx, CValidationState &state, const
 
             if(assetData.bPayCandy)
             {
-                char totalAmountStr[64] = "",candyAmountStr[64]="";
-                snprintf(totalAmountStr,sizeof(totalAmountStr),"%" PRId64,assetData.nTotalAmount);
-                snprintf(candyAmountStr,sizeof(candyAmountStr),"%" PRId64,assetData.nCandyAmount);
-                string candyMinStr = numtofloatstring(totalAmountStr,3); // 1‰
-                string candyMaxStr = numtofloatstring(totalAmountStr,1); // 10%
-                if(compareFloatString(candyAmountStr,candyMinStr)<0 || compareFloatString(candyAmountStr,candyMaxStr)>0)
+                if(!IsCandyAmountInRange(assetData.nCandyAmount, assetData.nTotalAmount))
                     return state.DoS(10, false, REJECT_INVALID, "issue_asset: candy amount out of range (min: 0.001 * total, max: 0.1 * total)");
                 if(assetData.nCandyAmount >= assetData.nFirstIssueAmount)
                     return state.DoS(10, false, REJECT_INVALID, "issue_asset: candy amount exceed first issue amount");
@@ -1592,9 +1659,9 @@ bool CheckAppTransaction(const CTransaction& tx, CValidationState &state, const
             if(header.appId.GetHex() != g_strSafeAssetId)
                 return state.DoS(50, false, REJECT_INVALID, "add_asset: invalid safe-asset app id in header, " + header.appId.GetHex());
 
-            CCommonData addData;
-            if(!ParseCommonData(vData, addData))
+            if(!pPayload->fDataValid)
                 return state.DoS(50, false, REJECT_INVALID, "add_asset: parse reserve failed");
+            const CCommonData& addData = pPayload->commonData;
 
             CAssetId_AssetInfo_IndexValue assetInfo;
             if(!GetAssetInfoByAssetId(addData.assetId, assetInfo, false))
@@ -1649,9 +1716,9 @@ bool CheckAppTransaction(const CTransaction& tx, CValidationState &state, const
             if(header.appId.GetHex() != g_strSafeAssetId)
                 return state.DoS(50, false, REJECT_INVALID, "transfer_asset: invalid safe-asset app id in header, " + header.appId.GetHex());
 
-            CCommonData transferData;
-            if(!ParseCommonData(vData, transferData))
+            if(!pPayload->fDataValid)
                 return state.DoS(50, false, REJECT_INVALID, "transfer_asset: parse reserve failed");
+            const CCommonData& transferData = pPayload->commonData;
 
             CAssetId_AssetInfo_IndexValue assetInfo;
             if(!GetAssetInfoByAssetId(transferData.assetId, assetInfo, false))
@@ -1709,9 +1776,9 @@ bool CheckAppTransaction(const CTransaction& tx, CValidationState &state, const
             if(strAddress != g_strCancelledAssetAddress)
                 return state.DoS(50, false, REJECT_INVALID, "destory_asset: invalid asset cancelled address");
 
-            CCommonData destoryData;
-            if(!ParseCommonData(vData, destoryData))
+            if(!pPayload->fDataValid)
                 return state.DoS(50, false, REJECT_INVALID, "destory_asset: parse reserve failed");
+            const CCommonData& destoryData = pPayload->commonData;
 
             CAssetId_AssetInfo_IndexValue assetInfo;
             if(!GetAssetInfoByAssetId(destoryData.assetId, assetInfo, false))
@@ -1769,9 +1836,9 @@ bool CheckAppTransaction(const CTransaction& tx, CValidationState &state, const
             if(header.appId.GetHex() != g_strSafeAssetId)
                 return state.DoS(50, false, REJECT_INVALID, "change_asset: invalid safe-asset app id in header, " + header.appId.GetHex());
 
-            CCommonData changeData;
-            if(!ParseCommonData(vData, changeData))
+            if(!pPayload->fDataValid)
                 return state.DoS(50, false, REJECT_INVALID, "change_asset: parse reserve failed");
+            const CCommonData& changeData = pPayload->commonData;
 
             CAssetId_AssetInfo_IndexValue assetInfo;
             if(!GetAssetInfoByAssetId(changeData.assetId, assetInfo, false))
@@ -1838,9 +1905,9 @@ bool CheckAppTransaction(const CTransaction& tx, CValidationState &state, const
             if(strAddress != g_strPutCandyAddress)
                 return state.DoS(10, false, REJECT_INVALID, "put_candy: invalid candy put address, " + strAddress);
 
-            CPutCandyData candyData;
-            if(!ParsePutCandyData(vData, candyData))
+            if(!pPayload->fDataValid)
                 return state.DoS(50, false, REJECT_INVALID, "put_candy: parse reserve failed");
+            const CPutCandyData& candyData = pPayload->putCandyData;
 
             if(candyData.nExpired < MIN_CANDYEXPIRED_VALUE || candyData.nExpired > MAX_CANDYEXPIRED_VALUE)
                 return state.DoS(10, false, REJECT_INVALID, "put_candy: invalid candy expired");
@@ -1911,12 +1978,7 @@ bool CheckAppTransaction(const CTransaction& tx, CValidationState &state, const
                 if(candyData.nAmount != assetData.nCandyAmount)
                     return state.DoS(10, false, REJECT_INVALID, "put_candy: candy amount is different from candy amount of asset data");
 
-                char totalAmountStr[64] = "",candyAmountStr[64]="";
-                snprintf(totalAmountStr,sizeof(totalAmountStr),"%" PRId64,assetData.nTotalAmount);
-                snprintf(candyAmountStr,sizeof(candyAmountStr),"%" PRId64,assetData.nCandyAmount);
-                string candyMinStr = numtofloatstring(totalAmountStr,3); // 1‰
-                string candyMaxStr = numtofloatstring(totalAmountStr,1); // 10%
-                if(compareFloatString(candyAmountStr,candyMinStr)<0 || compareFloatString(candyAmountStr,candyMaxStr)>0)
+                if(!IsCandyAmountInRange(assetData.nCandyAmount, assetData.nTotalAmount))
                     return state.DoS(10, false, REJECT_INVALID, "put_candy: candy amount out of range (min: 0.001 * total, max: 0.1 * total)");
 
                 if(candyData.nAmount != assetData.nFirstIssueAmount - assetData.nFirstActualAmount)
@@ -1931,12 +1993,7 @@ bool CheckAppTransaction(const CTransaction& tx, CValidationState &state, const
                 if(!GetAssetInfoByAssetId(candyData.assetId, assetInfo, false))
                     return state.DoS(10, false, REJECT_INVALID, "put_candy: non-existent asset");
 
-                char totalAmountStr[64] = "",candyAmountStr[64]="";
-                snprintf(totalAmountStr,sizeof(totalAmountStr),"%" PRId64,assetInfo.assetData.nTotalAmount);
-                snprintf(candyAmountStr,sizeof(candyAmountStr),"%" PRId64,candyData.nAmount);
-                string candyMinStr = numtofloatstring(totalAmountStr,3); // 1‰
-                string candyMaxStr = numtofloatstring(totalAmountStr,1); // 10%
-                if(compareFloatString(candyAmountStr,candyMinStr)<0||compareFloatString(candyAmountStr,candyMaxStr)>0)
+                if(!IsCandyAmountInRange(candyData.nAmount, assetInfo.assetData.nTotalAmount))
                     return state.DoS(10, false, REJECT_INVALID, "put_candy: candy amount out of range (min: 0.001 * total, max: 0.1 * total)");
 
                 strAdminAddress = assetInfo.strAdminAddress;
@@ -1989,9 +2046,9 @@ bool CheckAppTransaction(const CTransaction& tx, CValidationState &state, const
             if(strInAddress != g_strPutCandyAddress)
                 return state.DoS(10, false, REJECT_INVALID, "get_candy: invalid candy put address, " + strInAddress);
 
-            CGetCandyData candyData;
-            if(!ParseGetCandyData(vData, candyData))
+            if(!pPayload->fDataValid)
                 return state.DoS(50, false, REJECT_INVALID, "get_candy: parse reserve failed");
+            const CGetCandyData& candyData = pPayload->getCandyData;
 
             CAssetId_AssetInfo_IndexValue assetInfo;
             if(!GetAssetInfoByAssetId(candyData.assetId, assetInfo, false))
@@ -2011,7 +2068,7 @@ bool CheckAppTransaction(const CTransaction& tx, CValidationState &state, const
             if(GetGetCandyAmount(candyData.assetId, out, strAddress, nAmount, fWithMempool))
                 return state.DoS(10, false, REJECT_INVALID, "get_candy: current user got candy already, " + out.ToString());
 
-            int nPrevTxHeight = GetTxHeight(out.hash);
+            int nPrevTxHeight = pCheck ? pCheck->nCandyTxHeight : GetTxHeight(out.hash);
             //if(fWithMempool)
             {
                 if (nPrevTxHeight >= nTxHeight)
@@ -2111,26 +2168,10 @@ bool CheckAppTransaction(const CTransaction& tx, CValidationState &state, const
                 return state.DoS(10, false, REJECT_INVALID, "get_candy: failed to get the number of candy already received");
 
             CPutCandy_IndexKey tempkey(candyData.assetId, out, candyInfo);
-            CAmount nTxGetCandyTotal = 0;
-
-            if (!CompareDBGetCandyPutCandyTotal(mapAssetGetCandy, tempkey, dbamount, candyInfo.nAmount, nCandyAmount, nTxGetCandyTotal))
-            {
-                LogPrint("asset", "check-getcandy: get_candy_this_time_total_amount: %lld, already_get_candy_dbtotal_amount: %lld, total_candy_amount: %lld\n", nTxGetCandyTotal, dbamount, candyInfo.nAmount);
-                return state.DoS(10, false, REJECT_INVALID, "get_candy: more than the total number of candy issued");
-            }
-
-            CAmount nmapgetcandyamount = 0;
-            CAmount nGetCandyTotalAmount = 0;
-            if (fWithMempool)
-                nGetCandyTotalAmount = dbamount + memamount;
-            else
-                nGetCandyTotalAmount = dbamount;
-
-            if (!CompareGetCandyPutCandyTotal(mapAssetGetCandy, tempkey, nGetCandyTotalAmount, candyInfo.nAmount, nCandyAmount, nmapgetcandyamount))
-            {
-                LogPrint("asset", "check-getcandy: get_candy_this_time_total_amount: %lld, already_get_candy_total_amount: %lld, total_candy_amount: %lld\n", nmapgetcandyamount, nGetCandyTotalAmount, candyInfo.nAmount);
-                return state.DoS(10, false, SEND_GETCADNY_TX_SUCCESS, "get_candy: Send candy transaction successfully");
-            }
+            if (pCheck)
+                pCheck->vClaim.push_back(CGetCandyClaim(tempkey, dbamount, nCandyAmount));
+            else if (!AddGetCandyAmount(mapAssetGetCandy, state, tempkey, dbamount, memamount, nCandyAmount, fWithMempool))
+                return false;
 
             if(txout.nValue != nCandyAmount)
             {
@@ -2208,6 +2249,11 @@ bool CheckAppTransaction(const CTransaction& tx, CValidationState &state, const
     return true;
 }
 
+bool CheckAppTransaction(const CTransaction& tx, CValidationState &state, const CCoinsViewCache& view, map<CPutCandy_IndexKey, CAmount>& mapAssetGetCandy, const bool &fWithMempool)
+{
+    return CheckAppTransaction(tx, state, view, mapAssetGetCandy, fWithMempool, NULL);
+}
+
 bool ContextualCheckTransaction(const CTransaction& tx, CValidationState &state, CBlockIndex * const pindexPrev)
 {
     bool fDIP0001Active_context = (VersionBitsState(pindexPrev, Params().GetConsensus(), Consensus::DEPLOYMENT_DIP0001, versionbitscache) == THRESHOLD_ACTIVE);
@@ -2579,20 +2625,6 @@ bool AcceptToMemoryPoolWorker(CTxMemPool& pool, CValidationState &state, const C
                 // Save these to avoid repeated lookups
                 setIterConflicting.insert(mi);
 
-                // If this entry is "dirty", then we don't have descendant
-                // state for this transaction, which means we probably have
-                // lots of in-mempool descendants.
-                // Don't allow replacements of dirty transactions, to ensure
-                // that we don't spend too much time walking descendants.
-                // This should be rare.
-                if (mi->IsDirty()) {
-                    return state.DoS(0,
-                            error("AcceptToMemoryPool: rejecting replacement %s; cannot replace tx %s with untracked descendants",
-                                hash.ToString(),
-                                mi->GetTx().GetHash().ToString()),
-                            REJECT_NONSTANDARD, "too many potential replacements");
-                }
-
                 // Don't allow the replacement to reduce the feerate of the
                 // mempool.
                 //
@@ -2745,6 +2777,8 @@ bool AcceptToMemoryPoolWorker(CTxMemPool& pool, CValidationState &state, const C
         pool.add_AssetTx_Index(entry, view);
         pool.add_GetCandy_Index(entry, view);
         pool.add_GetCandyCount_Index(entry,view);
+        pool.add_AssetSupply_Index(entry, view);
+        pool.add_AssetBalance_Index(entry, view);
 
         // trim mempool and check if tx was trimmed
         if (!fOverrideMempoolLimit) {
@@ -2826,6 +2860,26 @@ bool GetAddressUnspent(uint160 addressHash, int type,
 }
 
 /** Return transaction in tx, and if it was found inside a block, its hash is placed in hashBlock */
+/** Read the transaction at a tx index position, needs no lock */
+static bool ReadTransactionAt(const CDiskTxPos& postx, const uint256 &hash, CTransaction &txOut, uint256 &hashBlock)
+{
+    CAutoFile file(OpenBlockFile(postx, true), SER_DISK, CLIENT_VERSION);
+    if (file.IsNull())
+        return error("%s: OpenBlockFile failed", __func__);
+    CBlockHeader header;
+    try {
+        file >> header;
+        fseek(file.Get(), postx.nTxOffset, SEEK_CUR);
+        file >> txOut;
+    } catch (const std::exception& e) {
+        return error("%s: Deserialize or I/O error - %s", __func__, e.what());
+    }
+    hashBlock = header.GetHash();
+    if (txOut.GetHash() != hash)
+        return error("%s: txid mismatch", __func__);
+    return true;
+}
+
 bool GetTransaction(const uint256 &hash, CTransaction &txOut, const Consensus::Params& consensusParams, uint256 &hashBlock, bool fAllowSlow)
 {
     CBlockIndex *pindexSlow = NULL;
@@ -2839,23 +2893,8 @@ bool GetTransaction(const uint256 &hash, CTransaction &txOut, const Consensus::P
 
     if (fTxIndex) {
         CDiskTxPos postx;
-        if (pblocktree->ReadTxIndex(hash, postx)) {
-            CAutoFile file(OpenBlockFile(postx, true), SER_DISK, CLIENT_VERSION);
-            if (file.IsNull())
-                return error("%s: OpenBlockFile failed", __func__);
-            CBlockHeader header;
-            try {
-                file >> header;
-                fseek(file.Get(), postx.nTxOffset, SEEK_CUR);
-                file >> txOut;
-            } catch (const std::exception& e) {
-                return error("%s: Deserialize or I/O error - %s", __func__, e.what());
-            }
-            hashBlock = header.GetHash();
-            if (txOut.GetHash() != hash)
-                return error("%s: txid mismatch", __func__);
-            return true;
-        }
+        if (pblocktree->ReadTxIndex(hash, postx))
+            return ReadTransactionAt(postx, hash, txOut, hashBlock);
     }
 
     if (fAllowSlow) { // use coin database to locate block that contains transaction, and scan it
@@ -3459,26 +3498,27 @@ bool CheckInputs(const CTransaction& tx, CValidationState &state, const CCoinsVi
                                 }
                                 else
                                 {
-                                    CAppHeader header;
-                                    vector<unsigned char> vData;
-                                    if(!ParseReserve(txout.vReserve, header, vData))
+                                    const CAppPayload* pPayload = GetAppPayload(tx, m);
+                                    if(!pPayload)
                                     {
                                         fPass = false;
                                         break;
                                     }
 
+                                    const CAppHeader& header = pPayload->header;
+
                                     if(header.nAppCmd != GET_CANDY_CMD)
                                     {
                                         fPass = false;
                                         break;
                                     }
 
-                                    CGetCandyData candyData;
-                                    if(!ParseGetCandyData(vData, candyData))
+                                    if(!pPayload->fDataValid)
                                     {
                                         fPass = false;
                                         break;
                                     }
+                                    const CGetCandyData& candyData = pPayload->getCandyData;
 
                                     if(candyData.assetId != in_assetId)
                                     {
@@ -3660,18 +3700,21 @@ bool DisconnectBlock(const CBlock& block, CValidationState& state, const CBlockI
     std::vector<std::pair<CAddressIndexKey, CAmount> > addressIndex;
     std::vector<std::pair<CSpentIndexKey, CSpentIndexValue> > spentIndex;
     std::vector<std::pair<CAddressUnspentKey, CAddressUnspentValue> > addressUnspentIndex;
-    std::vector<std::pair<uint256, CAppId_AppInfo_IndexValue> > appId_appInfo_index;
-    std::vector<std::pair<std::string, CName_Id_IndexValue> > appName_appId_index;
-    std::vector<std::pair<CAppTx_IndexKey, int> > appTx_index;
-    std::vector<std::pair<uint256, CAssetId_AssetInfo_IndexValue> > assetId_assetInfo_index;
-    std::vector<std::pair<std::string, CName_Id_IndexValue> > shortName_assetId_index;
-    std::vector<std::pair<std::string, CName_Id_IndexValue> > assetName_assetId_index;
-    std::vector<std::pair<CPutCandy_IndexKey, CPutCandy_IndexValue> > putCandy_index;
-    std::vector<std::pair<CGetCandy_IndexKey, CGetCandy_IndexValue> > getCandy_index;
-    std::vector<std::pair<CAssetTx_IndexKey, int> > assetTx_index;
-    std::map<CGetCandyCount_IndexKey,CGetCandyCount_IndexValue> getCandyCount_index;
-    std::string strPubKeyCollateralAddress = "";
-    CMasternodePayee_IndexValue masternodePayment_IndexValue;
+    CSideIndexWriteSet sideIndex;
+    std::vector<std::pair<uint256, CAppId_AppInfo_IndexValue> >& appId_appInfo_index = sideIndex.appId_appInfo_index;
+    std::vector<std::pair<std::string, CName_Id_IndexValue> >& appName_appId_index = sideIndex.appName_appId_index;
+    std::vector<std::pair<CAppTx_IndexKey, int> >& appTx_index = sideIndex.appTx_index;
+    std::vector<std::pair<uint256, CAssetId_AssetInfo_IndexValue> >& assetId_assetInfo_index = sideIndex.assetId_assetInfo_index;
+    std::vector<std::pair<std::string, CName_Id_IndexValue> >& shortName_assetId_index = sideIndex.shortName_assetId_index;
+    std::vector<std::pair<std::string, CName_Id_IndexValue> >& assetName_assetId_index = sideIndex.assetName_assetId_index;
+    std::vector<std::pair<CPutCandy_IndexKey, CPutCandy_IndexValue> >& putCandy_index = sideIndex.putCandy_index;
+    std::vector<std::pair<CGetCandy_IndexKey, CGetCandy_IndexValue> >& getCandy_index = sideIndex.getCandy_index;
+    std::vector<std::pair<CAssetTx_IndexKey, int> >& assetTx_index = sideIndex.assetTx_index;
+    std::map<CGetCandyCount_IndexKey,CGetCandyCount_IndexValue>& getCandyCount_index = sideIndex.getCandyCount_index;
+    std::map<uint256, CAssetSupply_IndexValue>& assetSupply_index = sideIndex.assetSupply_index;
+    std::map<CAssetBalance_IndexKey, CAssetBalance_IndexValue>& assetBalance_index = sideIndex.assetBalance_index;
+    std::string& strPubKeyCollateralAddress = sideIndex.strPubKeyCollateralAddress;
+    CMasternodePayee_IndexValue& masternodePayment_IndexValue = sideIndex.masternodePayment_IndexValue;
 
     // undo transactions in reverse order
     for (int i = block.vtx.size() - 1; i >= 0; i--) {
@@ -3839,14 +3882,16 @@ bool DisconnectBlock(const CBlock& block, CValidationState& state, const CBlockI
             }
         }
 
+        AddAssetBalanceDelta(tx, view, assetBalance_index);
+
         for(unsigned int m = tx.vout.size(); m-- > 0;)
         {
             const CTxOut& txout = tx.vout[m];
 
-            CAppHeader header;
-            std::vector<unsigned char> vData;
-            if(ParseReserve(txout.vReserve, header, vData))
+            const CAppPayload* pPayload = GetAppPayload(tx, m);
+            if(pPayload)
             {
+                const CAppHeader& header = pPayload->header;
                 CTxDestination dest;
                 if(!ExtractDestination(txout.scriptPubKey, dest))
                     continue;
@@ -3855,8 +3900,8 @@ bool DisconnectBlock(const CBlock& block, CValidationState& state, const CBlockI
 
                 if(header.nAppCmd == REGISTER_APP_CMD)
                 {
-                    CAppData appData;
-                    if(ParseRegisterData(vData, appData))
+                    const CAppData& appData = pPayload->appData;
+                    if(pPayload->fDataValid)
                     {
                         appId_appInfo_index.push_back(make_pair(header.appId, CAppId_AppInfo_IndexValue()));
                         appName_appId_index.push_back(make_pair(appData.strAppName, CName_Id_IndexValue()));
@@ -3865,8 +3910,7 @@ bool DisconnectBlock(const CBlock& block, CValidationState& state, const CBlockI
                 }
                 else if(header.nAppCmd == ADD_AUTH_CMD || header.nAppCmd == DELETE_AUTH_CMD)
                 {
-                    CAuthData authData;
-                    if(ParseAuthData(vData, authData))
+                    if(pPayload->fDataValid)
                         appTx_index.push_back(make_pair(CAppTx_IndexKey(header.appId, strAddress, header.nAppCmd == ADD_AUTH_CMD ? ADD_AUTH_TXOUT : DELETE_AUTH_TXOUT, COutPoint(hash, m)), -1));
                 }
                 else if(header.nAppCmd == CREATE_EXTEND_TX_CMD)
@@ -3875,31 +3919,34 @@ bool DisconnectBlock(const CBlock& block, CValidationState& state, const CBlockI
                 }
                 else if(header.nAppCmd == ISSUE_ASSET_CMD)
                 {
-                    CAssetData assetData;
-                    if(ParseIssueData(vData, assetData))
+                    const CAssetData& assetData = pPayload->assetData;
+                    if(pPayload->fDataValid)
                     {
                         uint256 assetId = assetData.GetHash();
                         assetId_assetInfo_index.push_back(make_pair(assetId, CAssetId_AssetInfo_IndexValue()));
                         shortName_assetId_index.push_back(make_pair(assetData.strShortName, CName_Id_IndexValue()));
                         assetName_assetId_index.push_back(make_pair(assetData.strAssetName, CName_Id_IndexValue()));
-                        assetTx_index.push_back(make_pair(CAssetTx_IndexKey(assetId, strAddress, ISSUE_TXOUT, COutPoint(hash, m)), -1));
+                        assetTx_index.push_back(make_pair(CAssetTx_IndexKey(assetId, strAddress, ISSUE_TXOUT, COutPoint(hash, m)), pindex->nHeight));
                     }
                 }
                 else if(header.nAppCmd == ADD_ASSET_CMD)
                 {
-                    CCommonData addData;
-                    if(ParseCommonData(vData, addData))
-                        assetTx_index.push_back(make_pair(CAssetTx_IndexKey(addData.assetId, strAddress, ADD_ISSUE_TXOUT, COutPoint(hash, m)), -1));
+                    const CCommonData& addData = pPayload->commonData;
+                    if(pPayload->fDataValid)
+                    {
+                        assetTx_index.push_back(make_pair(CAssetTx_IndexKey(addData.assetId, strAddress, ADD_ISSUE_TXOUT, COutPoint(hash, m)), pindex->nHeight));
+                        assetSupply_index[addData.assetId].nAddAmount += addData.nAmount;
+                    }
                 }
                 else if(header.nAppCmd == TRANSFER_ASSET_CMD)
                 {
-                    CCommonData transferData;
-                    if(ParseCommonData(vData, transferData))
+                    const CCommonData& transferData = pPayload->commonData;
+                    if(pPayload->fDataValid)
                     {
                         if(txout.nUnlockedHeight > 0)
-                            assetTx_index.push_back(make_pair(CAssetTx_IndexKey(transferData.assetId, strAddress, LOCKED_TXOUT, COutPoint(hash, m)), -1));
+                            assetTx_index.push_back(make_pair(CAssetTx_IndexKey(transferData.assetId, strAddress, LOCKED_TXOUT, COutPoint(hash, m)), pindex->nHeight));
                         else
-                            assetTx_index.push_back(make_pair(CAssetTx_IndexKey(transferData.assetId, strAddress, TRANSFER_TXOUT, COutPoint(hash, m)), -1));
+                            assetTx_index.push_back(make_pair(CAssetTx_IndexKey(transferData.assetId, strAddress, TRANSFER_TXOUT, COutPoint(hash, m)), pindex->nHeight));
 
                         for(unsigned int x = 0; x < tx.vin.size(); x++)
                         {
@@ -3910,16 +3957,17 @@ bool DisconnectBlock(const CBlock& block, CValidationState& state, const CBlockI
                             std::string strInAddress = "";
                             if(!GetTxOutAddress(in_txout, &strInAddress))
                                 continue;
-                            assetTx_index.push_back(make_pair(CAssetTx_IndexKey(transferData.assetId, strInAddress, TRANSFER_TXOUT, COutPoint(hash, -1)), -1));
+                            assetTx_index.push_back(make_pair(CAssetTx_IndexKey(transferData.assetId, strInAddress, TRANSFER_TXOUT, COutPoint(hash, -1)), pindex->nHeight));
                         }
                     }
                 }
                 else if(header.nAppCmd == DESTORY_ASSET_CMD)
                 {
-                    CCommonData destoryData;
-                    if(ParseCommonData(vData, destoryData))
+                    const CCommonData& destoryData = pPayload->commonData;
+                    if(pPayload->fDataValid)
                     {
-                        assetTx_index.push_back(make_pair(CAssetTx_IndexKey(destoryData.assetId, strAddress, DESTORY_TXOUT, COutPoint(hash, m)), -1));
+                        assetTx_index.push_back(make_pair(CAssetTx_IndexKey(destoryData.assetId, strAddress, DESTORY_TXOUT, COutPoint(hash, m)), pindex->nHeight));
+                        assetSupply_index[destoryData.assetId].nDestoryAmount += destoryData.nAmount;
                         for(unsigned int x = 0; x < tx.vin.size(); x++)
                         {
                             const CTxIn& txin = tx.vin[x];
@@ -3929,33 +3977,34 @@ bool DisconnectBlock(const CBlock& block, CValidationState& state, const CBlockI
                             std::string strInAddress = "";
                             if(!GetTxOutAddress(in_txout, &strInAddress))
                                 continue;
-                            assetTx_index.push_back(make_pair(CAssetTx_IndexKey(destoryData.assetId, strInAddress, DESTORY_TXOUT, COutPoint(hash, -1)), -1));
+                            assetTx_index.push_back(make_pair(CAssetTx_IndexKey(destoryData.assetId, strInAddress, DESTORY_TXOUT, COutPoint(hash, -1)), pindex->nHeight));
                         }
                     }
                 }
                 else if(header.nAppCmd == PUT_CANDY_CMD)
                 {
-                    CPutCandyData candyData;
-                    if(ParsePutCandyData(vData, candyData))
+                    const CPutCandyData& candyData = pPayload->putCandyData;
+                    if(pPayload->fDataValid)
                     {
                         putCandy_index.push_back(make_pair(CPutCandy_IndexKey(candyData.assetId, COutPoint(hash, m), CCandyInfo(candyData.nAmount, candyData.nExpired)), CPutCandy_IndexValue()));
-                        assetTx_index.push_back(make_pair(CAssetTx_IndexKey(candyData.assetId, strAddress, PUT_CANDY_TXOUT, COutPoint(hash, m)), -1));
+                        assetTx_index.push_back(make_pair(CAssetTx_IndexKey(candyData.assetId, strAddress, PUT_CANDY_TXOUT, COutPoint(hash, m)), pindex->nHeight));
+                        assetSupply_index[candyData.assetId].nPutCandyAmount += candyData.nAmount;
 
                         CAssetId_AssetInfo_IndexValue assetInfo;
                         if(GetAssetInfoByAssetId(candyData.assetId, assetInfo))
-                            assetTx_index.push_back(make_pair(CAssetTx_IndexKey(candyData.assetId, assetInfo.strAdminAddress, PUT_CANDY_TXOUT, COutPoint(hash, -1)), -1));
+                            assetTx_index.push_back(make_pair(CAssetTx_IndexKey(candyData.assetId, assetInfo.strAdminAddress, PUT_CANDY_TXOUT, COutPoint(hash, -1)), pindex->nHeight));
                     }
                 }
                 else if(header.nAppCmd == GET_CANDY_CMD)
                 {
-                    CGetCandyData candyData;
-                    if(ParseGetCandyData(vData, candyData))
+                    const CGetCandyData& candyData = pPayload->getCandyData;
+                    if(pPayload->fDataValid)
                     {
                         CGetCandyCount_IndexKey key(candyData.assetId,tx.vin.back().prevout);
                         CGetCandyCount_IndexValue& value = getCandyCount_index[key];
                         value.nGetCandyCount += candyData.nAmount;
                         getCandy_index.push_back(make_pair(CGetCandy_IndexKey(candyData.assetId, tx.vin.back().prevout, strAddress), CGetCandy_IndexValue()));
-                        assetTx_index.push_back(make_pair(CAssetTx_IndexKey(candyData.assetId, strAddress, GET_CANDY_TXOUT, COutPoint(hash, m)), -1));
+                        assetTx_index.push_back(make_pair(CAssetTx_IndexKey(candyData.assetId, strAddress, GET_CANDY_TXOUT, COutPoint(hash, m)), pindex->nHeight));
                     }
                 }
             }
@@ -4001,84 +4050,24 @@ bool DisconnectBlock(const CBlock& block, CValidationState& state, const CBlockI
         if (!pblocktree->UpdateSpentIndex(spentIndex))
             return AbortNode(state, "Failed to delete spent index");
 
-    if(appId_appInfo_index.size() && !pblocktree->Erase_AppId_AppInfo_Index(appId_appInfo_index))
-        return AbortNode(state, "Failed to delete appId_appInfo index");
-
-    if(appName_appId_index.size() && !pblocktree->Erase_AppName_AppId_Index(appName_appId_index))
-        return AbortNode(state, "Failed to delete appName_appId index");
-
-    if(appTx_index.size() && !pblocktree->Erase_AppTx_Index(appTx_index))
-        return AbortNode(state, "Failed to delete appTx index");
-
-    if(assetId_assetInfo_index.size() && !pblocktree->Erase_AssetId_AssetInfo_Index(assetId_assetInfo_index))
-        return AbortNode(state, "Failed to delete assetId_assetInfo index");
-
-    if(shortName_assetId_index.size() && !pblocktree->Erase_ShortName_AssetId_Index(shortName_assetId_index))
-        return AbortNode(state, "Failed to delete shortName_assetId index");
-
-    if(assetName_assetId_index.size() && !pblocktree->Erase_AssetName_AssetId_Index(assetName_assetId_index))
-        return AbortNode(state, "Failed to delete assetName_assetId index");
-
-    if(putCandy_index.size() && !pblocktree->Erase_PutCandy_Index(putCandy_index))
-        return AbortNode(state, "Failed to delete putcandy index");
-
-    if(getCandy_index.size() && !pblocktree->Erase_GetCandy_Index(getCandy_index))
-        return AbortNode(state, "Failed to delete getCandy index");
-
-    if(assetTx_index.size() && !pblocktree->Erase_AssetTx_Index(assetTx_index))
-        return AbortNode(state, "Failed to delete assetTx index");
-
-    if(getCandyCount_index.size())
+    //remove masternode payee
+    if(strPubKeyCollateralAddress.size())
     {
-        std::map<CGetCandyCount_IndexKey,CGetCandyCount_IndexValue>::const_iterator iter = getCandyCount_index.begin();
-        while(iter != getCandyCount_index.end())
-        {
-            const CGetCandyCount_IndexKey& key = iter->first;
-            const CGetCandyCount_IndexValue& deltaValue = iter->second;
-            CGetCandyCount_IndexValue value;
-            if(pblocktree->Is_Exists_GetCandyCount_Key(key.assetId,key.out))
-            {
-                if(!pblocktree->Read_GetCandyCount_Index(key.assetId,key.out,value)){
-                    return AbortNode(state, "Failed to read getCandyCount index");
-                }
-                value.nGetCandyCount -= deltaValue.nGetCandyCount;
-                if(value.nGetCandyCount < 0)
-                {
-                    LogPrintf("disconnect getCandyAmountError:currCount:%d,deltaCount:%d",value.nGetCandyCount,deltaValue.nGetCandyCount);
-                    value.nGetCandyCount = 0;
-                }
-                if(!pblocktree->Erase_GetCandyCount_Index(key))
-                    return AbortNode(state, "Failed to erase getCandyCount index");
-                if(!pblocktree->Write_GetCandyCount_Index(key,value))
-                    return AbortNode(state, "Failed to write getCandyCount index");
-            }
-            ++iter;
-        }
+        std::map<std::string,CMasternodePayee_IndexValue>::const_iterator payeeit = gAllPayeeInfoMap.find(strPubKeyCollateralAddress);
+        if(payeeit != gAllPayeeInfoMap.end())
+            masternodePayment_IndexValue.nPayeeTimes = payeeit->second.nPayeeTimes - 1;
+        else
+            strPubKeyCollateralAddress.clear();
     }
 
-    //remove masternode payee
+    if(!pblocktree->WriteSideIndexes(sideIndex, false))
+        return AbortNode(state, "Failed to delete app and asset indexes");
+
     if(strPubKeyCollateralAddress.size())
     {
-        if(pblocktree->Is_Exists_MasternodePayee_Key(strPubKeyCollateralAddress))
-        {
-            CMasternodePayee_IndexValue value;
-            if(!pblocktree->Read_MasternodePayee_Index(strPubKeyCollateralAddress,value))
-                return AbortNode(state, "SPOS_Error:Failed to read masternode payee index when disconnect block");
-            if(!pblocktree->Erase_MasternodePayee_Index(strPubKeyCollateralAddress))
-                return AbortNode(state, "SPOS_Error:Failed to erase masternode payee index when disconnect block");
-            masternodePayment_IndexValue.nPayeeTimes = value.nPayeeTimes - 1;
-            if(masternodePayment_IndexValue.nPayeeTimes>0)
-            {
-                if(!pblocktree->Write_MasternodePayee_Index(strPubKeyCollateralAddress,masternodePayment_IndexValue))
-                    return AbortNode(state, "SPOS_Error:Failed to write masternode payee index when disconnect block");
-            }
-            {
-                std::lock_guard<std::mutex> lock(g_mutexAllPayeeInfo);
-                gAllPayeeInfoMap[strPubKeyCollateralAddress] = masternodePayment_IndexValue;
-            }
-            LogPrint("masternode","remove masternode payee:strPubKeyCollateralAddress:%s,nHeight:%d,nPayeeTimes:%d,blockTime:%lld\n",strPubKeyCollateralAddress,
-                     masternodePayment_IndexValue.nHeight,masternodePayment_IndexValue.nPayeeTimes,masternodePayment_IndexValue.blockTime);
-        }
+        gAllPayeeInfoMap[strPubKeyCollateralAddress] = masternodePayment_IndexValue;
+        LogPrint("masternode","remove masternode payee:strPubKeyCollateralAddress:%s,nHeight:%d,nPayeeTimes:%d,blockTime:%lld\n",strPubKeyCollateralAddress,
+                 masternodePayment_IndexValue.nHeight,masternodePayment_IndexValue.nPayeeTimes,masternodePayment_IndexValue.blockTime);
     }
     return fClean;
 }
@@ -4115,6 +4104,122 @@ void ThreadScriptCheck() {
     scriptcheckqueue.Thread();
 }
 
+/**
+ * Closure representing the app and asset rules of one block transaction.
+ * The coins and heights it needs are captured before it is queued, the get
+ * candy amounts it claims are added up in block order by AddAppCheckResult().
+ */
+class CAppCheck
+{
+private:
+    const CTransaction *ptx;
+    const CCoinsViewCache *pview;
+    CAppCheckResult *pResult;
+
+public:
+    CAppCheck(): ptx(0), pview(0), pResult(0) {}
+    CAppCheck(const CTransaction& txIn, const CCoinsViewCache& viewIn, CAppCheckResult& resultIn) :
+        ptx(&txIn), pview(&viewIn), pResult(&resultIn) { }
+
+    bool operator()() {
+        map<CPutCandy_IndexKey, CAmount> mapAssetGetCandy;
+        try {
+            pResult->fValid = CheckAppTransaction(*ptx, pResult->state, *pview, mapAssetGetCandy, false, pResult);
+        } catch (const boost::thread_interrupted&) {
+            // rethrown by the master when it gets to this transaction
+            pResult->fInterrupted = true;
+        } catch (const std::exception& e) {
+            // a db or deserialization error must not escape the check thread,
+            // the master fails the block without marking it invalid
+            pResult->fValid = false;
+            pResult->vClaim.clear();
+            pResult->state = CValidationState();
+            pResult->state.Error(strprintf("app-check-failed: %s", e.what()));
+        }
+        // every transaction keeps its own result, the others must be checked anyway
+        return true;
+    }
+
+    void swap(CAppCheck &check) {
+        std::swap(ptx, check.ptx);
+        std::swap(pview, check.pview);
+        std::swap(pResult, check.pResult);
+    }
+};
+
+static CCheckQueue<CAppCheck> appcheckqueue(16);
+
+void ThreadAppCheck() {
+    RenameThread("safe-appcheck");
+    appcheckqueue.Thread();
+}
+
+/**
+ * Queue the app checks of the block transactions. viewApp gets the coins they
+ * spend and the outputs of the block but no spends: ConnectBlock() checks every
+ * input of a transaction against the spends of the block before it uses its
+ * result, see CheckAssetTxInputAndOutput().
+ * viewApp has no backing view, so the check threads never write to its cache.
+ */
+static void QueueAppChecks(const CBlock& block, CCoinsViewCache& view, CCoinsViewCache& viewApp, const int nHeight, std::vector<CAppCheckResult>& vResult, CCheckQueueControl<CAppCheck>& control)
+{
+    vResult.resize(block.vtx.size());
+    std::vector<CAppCheck> vChecks;
+    vChecks.reserve(block.vtx.size());
+    for (unsigned int i = 0; i < block.vtx.size(); i++)
+    {
+        const CTransaction& tx = block.vtx[i];
+        if (!tx.IsCoinBase())
+        {
+            BOOST_FOREACH(const CTxIn& txin, tx.vin)
+            {
+                if (viewApp.HaveCoinsInCache(txin.prevout.hash))
+                    continue;
+                const CCoins* coins = view.AccessCoins(txin.prevout.hash);
+                if (coins)
+                    *viewApp.ModifyCoins(txin.prevout.hash) = *coins;
+            }
+
+            // the block fails at this transaction before its app check
+            if (!viewApp.HaveInputs(tx))
+                break;
+
+            CAppCheckResult& result = vResult[i];
+            result.fQueued = true;
+            result.nTxHeight = GetTxHeight(tx.GetHash());
+            for (unsigned int n = 0; n < tx.vout.size(); n++)
+            {
+                const CAppPayload* pPayload = GetAppPayload(tx, n);
+                if (pPayload && pPayload->header.nAppCmd == GET_CANDY_CMD)
+                {
+                    result.nCandyTxHeight = GetTxHeight(tx.vin[tx.vin.size() - 1].prevout.hash);
+                    break;
+                }
+            }
+            vChecks.push_back(CAppCheck(tx, viewApp, result));
+        }
+        *viewApp.ModifyCoins(tx.GetHash()) = CCoins(tx, nHeight);
+    }
+    control.Add(vChecks);
+}
+
+/** Add the get candy amounts of a checked transaction in block order and hand over its result */
+static bool AddAppCheckResult(const CAppCheckResult& result, CValidationState &state, map<CPutCandy_IndexKey, CAmount>& mapAssetGetCandy)
+{
+    if (result.fInterrupted)
+        throw boost::thread_interrupted();
+
+    BOOST_FOREACH(const CGetCandyClaim& claim, result.vClaim)
+    {
+        if (!AddGetCandyAmount(mapAssetGetCandy, state, claim.key, claim.nDBAmount, 0, claim.nCandyAmount, false))
+            return false;
+    }
+
+    if (!result.fValid)
+        state = result.state;
+    return result.fValid;
+}
+
 // Protected by cs_main
 VersionBitsCache versionbitscache;
 
@@ -4190,12 +4295,13 @@ static ThresholdConditionCache warningcache[VERSIONBITS_NUM_BITS];
 
 static int64_t nTimeCheck = 0;
 static int64_t nTimeForks = 0;
+static int64_t nTimeAppCheck = 0;
 static int64_t nTimeVerify = 0;
 static int64_t nTimeConnect = 0;
 static int64_t nTimeIndex = 0;
 static int64_t nTimeCallbacks = 0;
 static int64_t nTimeTotal = 0;
-static bool PutChangeInfoToList(const int& nHeight, const CAmount& nReward, const bool fCandy, const map<string, CAmount>& mapAddressAmount);
+static bool PutChangeInfoToList(const int& nHeight, const CAmount& nReward, const bool fCandy, std::vector<CAddressAmount>&& vAddressAmount);
 bool ConnectBlock(const CBlock& block, CValidationState& state, CBlockIndex* pindex, CCoinsViewCache& view, bool fJustCheck)
 {
     const CChainParams& chainparams = Params();
@@ -4339,25 +4445,41 @@ bool ConnectBlock(const CBlock& block, CValidationState& state, CBlockIndex* pin
     std::vector<std::pair<CAddressIndexKey, CAmount> > addressIndex;
     std::vector<std::pair<CAddressUnspentKey, CAddressUnspentValue> > addressUnspentIndex;
     std::vector<std::pair<CSpentIndexKey, CSpentIndexValue> > spentIndex;
-    std::vector<std::pair<uint256, CAppId_AppInfo_IndexValue> > appId_appInfo_index;
-    std::vector<std::pair<std::string, CName_Id_IndexValue> > appName_appId_index;
-    std::vector<std::pair<CAuth_IndexKey, int> > auth_index;
-    std::vector<std::pair<CAppTx_IndexKey, int> > appTx_index;
-    std::vector<std::pair<uint256, CAssetId_AssetInfo_IndexValue> > assetId_assetInfo_index;
-    std::vector<std::pair<std::string, CName_Id_IndexValue> > shortName_assetId_index;
-    std::vector<std::pair<std::string, CName_Id_IndexValue> > assetName_assetId_index;
-    std::vector<std::pair<CPutCandy_IndexKey, CPutCandy_IndexValue> > putCandy_index;
-    std::vector<std::pair<CGetCandy_IndexKey, CGetCandy_IndexValue> > getCandy_index;
-    std::vector<std::pair<CAssetTx_IndexKey, int> > assetTx_index;
-    std::map<CGetCandyCount_IndexKey,CGetCandyCount_IndexValue> getCandyCount_index;
-    std::string strPubKeyCollateralAddress = "";
-    CMasternodePayee_IndexValue masternodePayment_IndexValue;
-
-    map<string, CAmount> mapAddressAmount;
+    CSideIndexWriteSet sideIndex;
+    std::vector<std::pair<uint256, CAppId_AppInfo_IndexValue> >& appId_appInfo_index = sideIndex.appId_appInfo_index;
+    std::vector<std::pair<std::string, CName_Id_IndexValue> >& appName_appId_index = sideIndex.appName_appId_index;
+    std::vector<std::pair<CAuth_IndexKey, int> >& auth_index = sideIndex.auth_index;
+    std::vector<std::pair<CAppTx_IndexKey, int> >& appTx_index = sideIndex.appTx_index;
+    std::vector<std::pair<uint256, CAssetId_AssetInfo_IndexValue> >& assetId_assetInfo_index = sideIndex.assetId_assetInfo_index;
+    std::vector<std::pair<std::string, CName_Id_IndexValue> >& shortName_assetId_index = sideIndex.shortName_assetId_index;
+    std::vector<std::pair<std::string, CName_Id_IndexValue> >& assetName_assetId_index = sideIndex.assetName_assetId_index;
+    std::vector<std::pair<CPutCandy_IndexKey, CPutCandy_IndexValue> >& putCandy_index = sideIndex.putCandy_index;
+    std::vector<std::pair<CGetCandy_IndexKey, CGetCandy_IndexValue> >& getCandy_index = sideIndex.getCandy_index;
+    std::vector<std::pair<CAssetTx_IndexKey, int> >& assetTx_index = sideIndex.assetTx_index;
+    std::map<CGetCandyCount_IndexKey,CGetCandyCount_IndexValue>& getCandyCount_index = sideIndex.getCandyCount_index;
+    std::map<uint256, CAssetSupply_IndexValue>& assetSupply_index = sideIndex.assetSupply_index;
+    std::map<CAssetBalance_IndexKey, CAssetBalance_IndexValue>& assetBalance_index = sideIndex.assetBalance_index;
+    std::string& strPubKeyCollateralAddress = sideIndex.strPubKeyCollateralAddress;
+    CMasternodePayee_IndexValue& masternodePayment_IndexValue = sideIndex.masternodePayment_IndexValue;
+
+    std::vector<CAddressAmount> vAddressAmount;
 
     bool fDIP0001Active_context = (VersionBitsState(pindex->pprev, chainparams.GetConsensus(), Consensus::DEPLOYMENT_DIP0001, versionbitscache) == THRESHOLD_ACTIVE);
 
     map<CPutCandy_IndexKey, CAmount> mapAssetGetCandy;
+    std::vector<CAppCheckResult> vAppCheck;
+    if (!fJustCheck && nScriptCheckThreads)
+    {
+        CCoinsView viewDummy;
+        CCoinsViewCache viewApp(&viewDummy);
+        CCheckQueueControl<CAppCheck> appControl(&appcheckqueue);
+        QueueAppChecks(block, view, viewApp, pindex->nHeight, vAppCheck, appControl);
+        appControl.Wait();
+
+        int64_t nTimeApp = GetTimeMicros(); nTimeAppCheck += nTimeApp - nTime2;
+        LogPrint("bench", "    - App checks: %.2fms [%.2fs]\n", 0.001 * (nTimeApp - nTime2), nTimeAppCheck * 0.000001);
+    }
+
     for (unsigned int i = 0; i < block.vtx.size(); i++)
     {
         const CTransaction& tx = block.vtx[i];
@@ -4366,8 +4488,16 @@ bool ConnectBlock(const CBlock& block, CValidationState& state, CBlockIndex* pin
         if (!CheckAssetTxInputAndOutput(tx, state, view))
             return error("ConnectBlock(): CheckAssetTxInputAndOutput on %s failed with %s", txhash.ToString(), FormatStateMessage(state));
 
-        if(!fJustCheck && !CheckAppTransaction(tx, state, view, mapAssetGetCandy, false))
-            return error("ConnectBlock(): CheckAppTransaction on %s failed with %s", txhash.ToString(), FormatStateMessage(state));
+        if (!fJustCheck)
+        {
+            bool fAppValid = false;
+            if (i < vAppCheck.size() && vAppCheck[i].fQueued)
+                fAppValid = AddAppCheckResult(vAppCheck[i], state, mapAssetGetCandy);
+            else
+                fAppValid = CheckAppTransaction(tx, state, view, mapAssetGetCandy, false);
+            if (!fAppValid)
+                return error("ConnectBlock(): CheckAppTransaction on %s failed with %s", txhash.ToString(), FormatStateMessage(state));
+        }
 
         nInputs += tx.vin.size();
         nSigOps += GetLegacySigOpCount(tx);
@@ -4403,23 +4533,11 @@ bool ConnectBlock(const CBlock& block, CValidationState& state, CBlockIndex* pin
                 const CTxIn input = tx.vin[j];
                 const CTxOut& prevout = view.GetOutputFor(input);
 
-                if (pindex->nHeight >= g_nCriticalHeight)
+                if (pindex->nHeight >= g_nCriticalHeight && !prevout.IsAsset() && calprevheights[j] >= g_nCriticalHeight)
                 {
-                    string strAddress = "";
-                    if (GetTxOutAddress(prevout, &strAddress))
-                    {
-                        if (!prevout.IsAsset() && calprevheights[j] >= g_nCriticalHeight)
-                        {
-                            if (mapAddressAmount.count(strAddress))
-                            {
-                                mapAddressAmount[strAddress] += -prevout.nValue;
-                                if (mapAddressAmount[strAddress] == 0)
-                                    mapAddressAmount.erase(strAddress);
-                            }
-                            else
-                                mapAddressAmount[strAddress] = -prevout.nValue;
-                        }
-                    }
+                    CCandyAddressKey addressKey;
+                    if (GetTxOutAddressKey(prevout, addressKey))
+                        vAddressAmount.push_back(CAddressAmount(addressKey, -prevout.nValue));
                 }
 
                 if (fAddressIndex || fSpentIndex)
@@ -4483,18 +4601,9 @@ bool ConnectBlock(const CBlock& block, CValidationState& state, CBlockIndex* pin
             if (out.IsAsset())
                 continue;
 
-            string strAddress = "";
-            if (pindex->nHeight >= g_nCriticalHeight && GetTxOutAddress(out, &strAddress))
-            {
-                if(mapAddressAmount.count(strAddress))
-                {
-                    mapAddressAmount[strAddress] += out.nValue;
-                    if(mapAddressAmount[strAddress] == 0)
-                        mapAddressAmount.erase(strAddress);
-                }
-                else
-                    mapAddressAmount[strAddress] = out.nValue;
-            }
+            CCandyAddressKey addressKey;
+            if (pindex->nHeight >= g_nCriticalHeight && GetTxOutAddressKey(out, addressKey))
+                vAddressAmount.push_back(CAddressAmount(addressKey, out.nValue));
 
             if (fAddressIndex) {
                 if (out.scriptPubKey.IsPayToScriptHash()) {
@@ -4529,15 +4638,16 @@ bool ConnectBlock(const CBlock& block, CValidationState& state, CBlockIndex* pin
             }
         }
 
+        AddAssetBalanceDelta(tx, view, assetBalance_index);
 
         for(unsigned int m = 0; m < tx.vout.size(); m++)
         {
             const CTxOut& txout = tx.vout[m];
 
-            CAppHeader header;
-            std::vector<unsigned char> vData;
-            if(ParseReserve(txout.vReserve, header, vData))
+            const CAppPayload* pPayload = GetAppPayload(tx, m);
+            if(pPayload)
             {
+                const CAppHeader& header = pPayload->header;
                 CTxDestination dest;
                 if(!ExtractDestination(txout.scriptPubKey, dest))
                     continue;
@@ -4546,8 +4656,8 @@ bool ConnectBlock(const CBlock& block, CValidationState& state, CBlockIndex* pin
 
                 if(header.nAppCmd == REGISTER_APP_CMD)
                 {
-                    CAppData appData;
-                    if(ParseRegisterData(vData, appData))
+                    const CAppData& appData = pPayload->appData;
+                    if(pPayload->fDataValid)
                     {
                         appId_appInfo_index.push_back(make_pair(header.appId, CAppId_AppInfo_IndexValue(strAddress, appData, pindex->nHeight)));
                         appName_appId_index.push_back(make_pair(appData.strAppName, CName_Id_IndexValue(header.appId, pindex->nHeight)));
@@ -4556,8 +4666,8 @@ bool ConnectBlock(const CBlock& block, CValidationState& state, CBlockIndex* pin
                 }
                 else if(header.nAppCmd == ADD_AUTH_CMD)
                 {
-                    CAuthData authData;
-                    if(ParseAuthData(vData, authData))
+                    const CAuthData& authData = pPayload->authData;
+                    if(pPayload->fDataValid)
                     {
                         appTx_index.push_back(make_pair(CAppTx_IndexKey(header.appId, strAddress, ADD_AUTH_TXOUT, COutPoint(txhash, m)), pindex->nHeight));
 
@@ -4583,8 +4693,8 @@ bool ConnectBlock(const CBlock& block, CValidationState& state, CBlockIndex* pin
                 }
                 else if(header.nAppCmd == DELETE_AUTH_CMD)
                 {
-                    CAuthData authData;
-                    if(ParseAuthData(vData, authData))
+                    const CAuthData& authData = pPayload->authData;
+                    if(pPayload->fDataValid)
                     {
                         appTx_index.push_back(make_pair(CAppTx_IndexKey(header.appId, strAddress, DELETE_AUTH_TXOUT, COutPoint(txhash, m)), pindex->nHeight));
 
@@ -4600,8 +4710,8 @@ bool ConnectBlock(const CBlock& block, CValidationState& state, CBlockIndex* pin
                 }
                 else if(header.nAppCmd == ISSUE_ASSET_CMD)
                 {
-                    CAssetData assetData;
-                    if(ParseIssueData(vData, assetData))
+                    const CAssetData& assetData = pPayload->assetData;
+                    if(pPayload->fDataValid)
                     {
                         uint256 assetId = assetData.GetHash();
                         assetId_assetInfo_index.push_back(make_pair(assetId, CAssetId_AssetInfo_IndexValue(strAddress, assetData, pindex->nHeight)));
@@ -4612,20 +4722,23 @@ bool ConnectBlock(const CBlock& block, CValidationState& state, CBlockIndex* pin
                 }
                 else if(header.nAppCmd == ADD_ASSET_CMD)
                 {
-                    CCommonData addData;
-                    if(ParseCommonData(vData, addData))
+                    const CCommonData& addData = pPayload->commonData;
+                    if(pPayload->fDataValid)
+                    {
                         assetTx_index.push_back(make_pair(CAssetTx_IndexKey(addData.assetId, strAddress, ADD_ISSUE_TXOUT, COutPoint(txhash, m)), pindex->nHeight));
+                        assetSupply_index[addData.assetId].nAddAmount += addData.nAmount;
+                    }
                 }
                 else if (header.nAppCmd == CHANGE_ASSET_CMD)
                 {
-                    CCommonData changeData;
-                    if(ParseCommonData(vData, changeData))
+                    const CCommonData& changeData = pPayload->commonData;
+                    if(pPayload->fDataValid)
                         assetTx_index.push_back(make_pair(CAssetTx_IndexKey(changeData.assetId, strAddress, CHANGE_ASSET_TXOUT, COutPoint(txhash, m)), pindex->nHeight));
                 }
                 else if(header.nAppCmd == TRANSFER_ASSET_CMD)
                 {
-                    CCommonData transferData;
-                    if(ParseCommonData(vData, transferData))
+                    const CCommonData& transferData = pPayload->commonData;
+                    if(pPayload->fDataValid)
                     {
                         if(txout.nUnlockedHeight > 0)
                             assetTx_index.push_back(make_pair(CAssetTx_IndexKey(transferData.assetId, strAddress, LOCKED_TXOUT, COutPoint(txhash, m)), pindex->nHeight));
@@ -4647,10 +4760,11 @@ bool ConnectBlock(const CBlock& block, CValidationState& state, CBlockIndex* pin
                 }
                 else if(header.nAppCmd == DESTORY_ASSET_CMD)
                 {
-                    CCommonData destoryData;
-                    if(ParseCommonData(vData, destoryData))
+                    const CCommonData& destoryData = pPayload->commonData;
+                    if(pPayload->fDataValid)
                     {
                         assetTx_index.push_back(make_pair(CAssetTx_IndexKey(destoryData.assetId, strAddress, DESTORY_TXOUT, COutPoint(txhash, m)), pindex->nHeight));
+                        assetSupply_index[destoryData.assetId].nDestoryAmount += destoryData.nAmount;
                         for(unsigned int x = 0; x < tx.vin.size(); x++)
                         {
                             const CTxIn& txin = tx.vin[x];
@@ -4666,11 +4780,12 @@ bool ConnectBlock(const CBlock& block, CValidationState& state, CBlockIndex* pin
                 }
                 else if(header.nAppCmd == PUT_CANDY_CMD)
                 {
-                    CPutCandyData candyData;
-                    if(ParsePutCandyData(vData, candyData))
+                    const CPutCandyData& candyData = pPayload->putCandyData;
+                    if(pPayload->fDataValid)
                     {
                         putCandy_index.push_back(make_pair(CPutCandy_IndexKey(candyData.assetId, COutPoint(txhash, m), CCandyInfo(candyData.nAmount, candyData.nExpired)), CPutCandy_IndexValue(pindex->nHeight, blockHash, i)));
                         assetTx_index.push_back(make_pair(CAssetTx_IndexKey(candyData.assetId, strAddress, PUT_CANDY_TXOUT, COutPoint(txhash, m)), pindex->nHeight));
+                        assetSupply_index[candyData.assetId].nPutCandyAmount += candyData.nAmount;
 
                         CAssetId_AssetInfo_IndexValue assetInfo;
                         if(GetAssetInfoByAssetId(candyData.assetId, assetInfo))
@@ -4679,8 +4794,8 @@ bool ConnectBlock(const CBlock& block, CValidationState& state, CBlockIndex* pin
                 }
                 else if(header.nAppCmd == GET_CANDY_CMD)
                 {
-                    CGetCandyData candyData;
-                    if(ParseGetCandyData(vData, candyData))
+                    const CGetCandyData& candyData = pPayload->getCandyData;
+                    if(pPayload->fDataValid)
                     {
                         CGetCandyCount_IndexKey key(candyData.assetId,tx.vin.back().prevout);
                         CGetCandyCount_IndexValue& value = getCandyCount_index[key];
@@ -4811,101 +4926,35 @@ bool ConnectBlock(const CBlock& block, CValidationState& state, CBlockIndex* pin
         if (!pblocktree->WriteTimestampIndex(CTimestampIndexKey(pindex->nTime, pindex->GetBlockHash())))
             return AbortNode(state, "Failed to write timestamp index");
 
-    if(appId_appInfo_index.size() && !pblocktree->Write_AppId_AppInfo_Index(appId_appInfo_index))
-        return AbortNode(state, "Failed to write appId_appInfo index");
-
-    if(appName_appId_index.size() && !pblocktree->Write_AppName_AppId_Index(appName_appId_index))
-        return AbortNode(state, "Failed to write appName_appId index");
-
-    if(auth_index.size() && !pblocktree->Update_Auth_Index(auth_index))
-        return AbortNode(state, "Failed to update auth index");
-
-    if(appTx_index.size() && !pblocktree->Write_AppTx_Index(appTx_index))
-        return AbortNode(state, "Failed to write appTx index");
-
-    if(assetId_assetInfo_index.size() && !pblocktree->Write_AssetId_AssetInfo_Index(assetId_assetInfo_index))
-        return AbortNode(state, "Failed to write assetId_assetInfo index");
-
-    if(shortName_assetId_index.size() && !pblocktree->Write_ShortName_AssetId_Index(shortName_assetId_index))
-        return AbortNode(state, "Failed to write shortName_assetId index");
-
-    if(assetName_assetId_index.size() && !pblocktree->Write_AssetName_AssetId_Index(assetName_assetId_index))
-        return AbortNode(state, "Failed to write assetName_assetId index");
-
-    if(putCandy_index.size() && !pblocktree->Write_PutCandy_Index(putCandy_index))
-        return AbortNode(state, "Failed to write putcandy index");
-
-    if(getCandy_index.size() && !pblocktree->Write_GetCandy_Index(getCandy_index))
-        return AbortNode(state, "Failed to write getCandy index");
-
-    if(assetTx_index.size() && !pblocktree->Write_AssetTx_Index(assetTx_index))
-        return AbortNode(state, "Failed to write assetTx index");
+    if(g_nLocalStartSavePayeeHeight==0&&pindex->nHeight>=g_nSaveMasternodePayeeHeight)
+        sideIndex.nLocalStartSavePayeeHeight = masternodePayment_IndexValue.nHeight;
 
-    if(getCandyCount_index.size())
+    //add masternode payee
+    if(strPubKeyCollateralAddress.size())
     {
-        std::map<CGetCandyCount_IndexKey,CGetCandyCount_IndexValue>::const_iterator iter = getCandyCount_index.begin();
-        while(iter != getCandyCount_index.end())
-        {
-            const CGetCandyCount_IndexKey& key = iter->first;
-            const CGetCandyCount_IndexValue& deltaValue = iter->second;
-            CGetCandyCount_IndexValue value;
-            if(pblocktree->Is_Exists_GetCandyCount_Key(key.assetId,key.out))
-            {
-                if(!pblocktree->Read_GetCandyCount_Index(key.assetId,key.out,value))
-                    return AbortNode(state, "Failed to get getCandyCount index");
-                if(!pblocktree->Erase_GetCandyCount_Index(key))
-                    return AbortNode(state, "Failed to erase getCandyCount index");
-            }
-            value.nGetCandyCount += deltaValue.nGetCandyCount;
-            if(!pblocktree->Write_GetCandyCount_Index(key,value))
-                return AbortNode(state, "Failed to write getCandyCount index");
-            ++iter;
-            LogPrint("asset","check-getcandy:leveldb_add_candy:%s,%s,currAmount:%d,totalAmount:%d\n",key.assetId.ToString(),key.out.ToString()
-                      ,deltaValue.nGetCandyCount,value.nGetCandyCount);
-        }
+        std::map<std::string,CMasternodePayee_IndexValue>::const_iterator payeeit = gAllPayeeInfoMap.find(strPubKeyCollateralAddress);
+        if(payeeit != gAllPayeeInfoMap.end())
+            masternodePayment_IndexValue.nPayeeTimes = payeeit->second.nPayeeTimes + 1;
     }
 
-    if(g_nLocalStartSavePayeeHeight==0&&pindex->nHeight>=g_nSaveMasternodePayeeHeight)
+    if(!pblocktree->WriteSideIndexes(sideIndex, true))
+        return AbortNode(state, "Failed to write app and asset indexes");
+
+    if(sideIndex.nLocalStartSavePayeeHeight != 0)
     {
-        if(!pblocktree->Write_LocalStartSavePayeeHeight_Index(masternodePayment_IndexValue.nHeight))
-            return AbortNode(state, "SPOS_Error:Failed to write local start save payee height");
-        else
-        {
-            g_nLocalStartSavePayeeHeight = masternodePayment_IndexValue.nHeight;
-            LogPrintf("SPOS_Message:write local start save payee height:%d\n",masternodePayment_IndexValue.nHeight);
-        }
+        g_nLocalStartSavePayeeHeight = sideIndex.nLocalStartSavePayeeHeight;
+        LogPrintf("SPOS_Message:write local start save payee height:%d\n",sideIndex.nLocalStartSavePayeeHeight);
     }
 
-    //add masternode payee
     if(strPubKeyCollateralAddress.size())
     {
-        if(pblocktree->Is_Exists_MasternodePayee_Key(strPubKeyCollateralAddress))
-        {
-            CMasternodePayee_IndexValue value;
-            if(!pblocktree->Read_MasternodePayee_Index(strPubKeyCollateralAddress,value))
-                return AbortNode(state, "SPOS_Error:Failed to read masternode payee index when connect block");
-            if(!pblocktree->Erase_MasternodePayee_Index(strPubKeyCollateralAddress))
-                return AbortNode(state, "SPOS_Error:Failed to erase masternode payee index when connect block");
-            masternodePayment_IndexValue.nPayeeTimes = value.nPayeeTimes + 1;
-        }
-        if(!pblocktree->Write_MasternodePayee_Index(strPubKeyCollateralAddress,masternodePayment_IndexValue))
-            return AbortNode(state, "SPOS_Error:Failed to write masternode payee index when connect block");
-
-        {
-            std::lock_guard<std::mutex> lock(g_mutexAllPayeeInfo);
-            gAllPayeeInfoMap[strPubKeyCollateralAddress] = masternodePayment_IndexValue;
-        }
+        gAllPayeeInfoMap[strPubKeyCollateralAddress] = masternodePayment_IndexValue;
         LogPrintf("SPOS_Info:add masternode payee,strPubKeyCollateralAddress:%s,nHeight:%d,nPayeeTimes:%d,blockTime:%lld\n",strPubKeyCollateralAddress,
                  masternodePayment_IndexValue.nHeight,masternodePayment_IndexValue.nPayeeTimes,masternodePayment_IndexValue.blockTime);
     }
 
-    while(GetChangeInfoListSize() >= g_nListChangeInfoLimited)
-    {
-        boost::this_thread::interruption_point();
-        if(ShutdownRequested())
-            break;
-    }
-    if(!PutChangeInfoToList(pindex->nHeight, blockReward - nFees, !putCandy_index.empty(), mapAddressAmount))
+    MergeAddressAmounts(vAddressAmount);
+    if(!PutChangeInfoToList(pindex->nHeight, blockReward - nFees, !putCandy_index.empty(), std::move(vAddressAmount)))
         return AbortNode(state, "Failed to write change info");
 
 	// add this block to the view's block chain
@@ -5555,6 +5604,10 @@ bool ActivateBestChain(CValidationState &state, const CChainParams& chainparams,
 
         const CBlockIndex *pindexFork;
         bool fInitialDownload;
+
+        // Let the change writer catch up before taking cs_main, one step connects at most CHANGE_INFO_STEP_BLOCKS blocks
+        WaitForChangeInfoQueue(CHANGE_INFO_STEP_BLOCKS);
+
         {
             LOCK(cs_main);
             CBlockIndex *pindexOldTip = chainActive.Tip();
@@ -5877,7 +5930,7 @@ bool CheckBlockHeader(const CBlockHeader& block, CValidationState& state, bool f
 }
 
 
-bool ParseCoinBaseReserve(const std::vector<unsigned char> &vReserve, std::vector<unsigned char> &vchKeyId, std::vector<unsigned char> &vchSig, std::vector<unsigned char> &vchConAlg, uint16_t &nSPOSVersion, string &strSigMessage)
+bool ParseCoinBaseReserve(const CTxOutReserve &vReserve, std::vector<unsigned char> &vchKeyId, std::vector<unsigned char> &vchSig, std::vector<unsigned char> &vchConAlg, uint16_t &nSPOSVersion, string &strSigMessage)
 {
     unsigned int nFixedLen = TXOUT_RESERVE_MIN_SIZE + nConsensusAlgorithmLen + sizeof(nSPOSVersion) + nKeyIdSize;
 
@@ -5955,24 +6008,25 @@ bool CheckSPOSBlock(const CBlock &block, CValidationState &state, const int &nHe
     int32_t mnSize = 0;
     int64_t nStartNewLoopTime = 0;
     int32_t nIndex = 0;
-    CMasternode mnTemp;
+    std::shared_ptr<const std::vector<CMasternode> > pResultMasternodes;
     {
         LOCK(cs_spos);
-        mnSize = g_vecResultMasternodes.size();
+        pResultMasternodes = g_pResultMasternodes;
+        mnSize = pResultMasternodes->size();
         nStartNewLoopTime = g_nStartNewLoopTimeMS;
         if (!masternodeSync.IsSynced()|| (mnSize == 0 && g_nSelectMasterNodeRet == g_nSelectMasterNodeReset))
             return true;
 
         if(mnSize == 0)
-            return state.DoS(100, error("SPOS_Error CheckSPOSBlock():g_vecResultMasternodes is empty,height:%d, signature error, keyID:%s, strSigMessage:%s, vchSig size:%d,g_nSelectMasterNodeRet:%d"
+            return state.DoS(100, error("SPOS_Error CheckSPOSBlock():g_pResultMasternodes is empty,height:%d, signature error, keyID:%s, strSigMessage:%s, vchSig size:%d,g_nSelectMasterNodeRet:%d"
                                         ,nHeight, keyID.ToString(), strSigMessage, vchSig.size(),g_nSelectMasterNodeRet), REJECT_INVALID, "bad-mnSize", true);
         int32_t interval = (block.GetBlockTime() - nStartNewLoopTime / 1000 - g_nPushForwardTime) / Params().GetConsensus().nSPOSTargetSpacing - 1;
         nIndex = interval % mnSize;
         if(nIndex<0)
             return state.DoS(100,error("SPOS_Error CheckSPOSBlock():incorrect index value,height:%d, invalid index:%d,blockTime:%lld,startLoopTime:%lld"
                                        ,nHeight,nIndex,block.GetBlockTime(),nStartNewLoopTime),REJECT_INVALID,"bad-index",true);
-        mnTemp = g_vecResultMasternodes[nIndex];
     }
+    const CMasternode& mnTemp = (*pResultMasternodes)[nIndex];
 
     CKeyID mnkeyID = mnTemp.pubKeyMasternode.GetID();
 
@@ -6759,10 +6813,23 @@ bool static LoadBlockIndexDB()
     pblocktree->ReadFlag("spentindex", fSpentIndex);
     LogPrintf("%s: spent index %s\n", __func__, fSpentIndex ? "enabled" : "disabled");
 
-    // Load pointer to end of best chain
-    BlockMap::iterator it = mapBlockIndex.find(pcoinsTip->GetBestBlock());
-    if (it == mapBlockIndex.end())
-        return true;
+    // Load the masternode payee table, ConnectBlock counts payments against it
+    if(!pblocktree->Read_MasternodePayee_Index(gAllPayeeInfoMap))
+    {
+        LogPrintf("SPOS_Warning:init read masternode payee fail\n");
+    }
+    if(!pblocktree->Read_LocalStartSavePayeeHeight_Index(g_nLocalStartSavePayeeHeight))
+    {
+        LogPrintf("SPOS_Warning:init read local start save payee height fail\n");
+    }else
+    {
+        LogPrintf("SPOS_Message:read local start save payee height(%d) succ\n",g_nLocalStartSavePayeeHeight);
+    }
+
+    // Load pointer to end of best chain
+    BlockMap::iterator it = mapBlockIndex.find(pcoinsTip->GetBestBlock());
+    if (it == mapBlockIndex.end())
+        return true;
     chainActive.SetTip(it->second);
 
     PruneBlockIndexCandidates();
@@ -6891,6 +6958,7 @@ void UnloadBlockIndex()
     }
     mapBlockIndex.clear();
     fHavePruned = false;
+    gAllPayeeInfoMap.clear();
 }
 
 bool LoadBlockIndex()
@@ -7547,6 +7615,42 @@ bool GetTxInfoByAssetIdAddressTxClass(const uint256& assetId, const string& strA
     return vOut.size();
 }
 
+bool ForEachAssetTx(const uint256& assetId, const string& strAddress, const uint8_t& nTxClass, CAssetTxCursor& cursor, const boost::function<bool(const uint256&)>& fn, const bool fWithMempool)
+{
+    if(cursor.nHeight != ASSETTX_CURSOR_MEMPOOL_HEIGHT)
+    {
+        CAssetTxIterator it(*pblocktree, assetId, strAddress, nTxClass, g_nChainHeight);
+        for(it.Seek(cursor); it.Valid(); it.Next())
+        {
+            if(!fn(it.GetTxId()))
+                return true;
+            cursor = CAssetTxCursor(it.GetHeight(), it.GetTxId());
+        }
+        cursor = CAssetTxCursor(ASSETTX_CURSOR_MEMPOOL_HEIGHT);
+    }
+
+    if(!fWithMempool)
+        return false;
+
+    vector<COutPoint> vMempoolOut;
+    if(strAddress.empty())
+        mempool.get_AssetTx_Index(assetId, nTxClass, vMempoolOut);
+    else
+        mempool.get_AssetTx_Index(assetId, strAddress, nTxClass, vMempoolOut);
+
+    std::set<uint256> setTxId;
+    BOOST_FOREACH(const COutPoint& out, vMempoolOut)
+        setTxId.insert(out.hash);
+    for(std::set<uint256>::const_iterator it = setTxId.upper_bound(cursor.txId); it != setTxId.end(); it++)
+    {
+        if(!fn(*it))
+            return true;
+        cursor.txId = *it;
+    }
+
+    return false;
+}
+
 bool GetAssetIdCandyInfo(const uint256& assetId, map<COutPoint, CCandyInfo>& mapCandyInfo)
 {
     return pblocktree->Read_PutCandy_Index(assetId, mapCandyInfo);
@@ -7595,11 +7699,8 @@ bool GetGetCandyTotalAmount(const uint256& assetId, const COutPoint& out, CAmoun
 {
     LogPrint("asset", "get_candy:: assetid: %s, out: %s\n", assetId.GetHex(), out.ToString());
     CGetCandyCount_IndexValue dbcandyCountValue;
-    if (pblocktree->Is_Exists_GetCandyCount_Key(assetId, out))
-    {
-        if (!pblocktree->Read_GetCandyCount_Index(assetId, out, dbcandyCountValue))
-            return false;
-    }
+    if (!pblocktree->Read_GetCandyCount_Index(assetId, out, dbcandyCountValue))
+        dbcandyCountValue = CGetCandyCount_IndexValue();
 
     dbamount = dbcandyCountValue.nGetCandyCount;
     LogPrint("asset", "GetGetCandyTotalAmount: get_candy_db_amount: %lld\n", dbcandyCountValue.nGetCandyCount);
@@ -7686,95 +7787,265 @@ bool GetAssetListInfo(std::vector<uint256> &vAssetId, const bool fWithMempool)
 //}
 
 
+bool GetAssetSupplyByAssetId(const uint256& assetId, CAssetSupply_IndexValue& supply, const bool fWithMempool)
+{
+    supply = CAssetSupply_IndexValue();
+    if (assetId.IsNull())
+        return false;
+
+    bool fRet = pblocktree->Read_AssetSupply_Index(assetId, supply);
+    if (fWithMempool)
+    {
+        CAssetSupply_IndexValue poolSupply;
+        if (mempool.get_AssetSupply_Index(assetId, poolSupply))
+        {
+            supply += poolSupply;
+            fRet = true;
+        }
+    }
+
+    return fRet;
+}
+
 CAmount GetAddedAmountByAssetId(const uint256& assetId, const bool fWithMempool)
 {
-	if (assetId.IsNull() || NULL == pwalletMain)
-		return 0;
+    CAssetSupply_IndexValue supply;
+    GetAssetSupplyByAssetId(assetId, supply, fWithMempool);
+    return supply.nAddAmount;
+}
 
-	CAmount value = 0;
-	vector<COutPoint> tempvOut;
-	GetTxInfoByAssetIdTxClass(assetId, ADD_ISSUE_TXOUT, tempvOut, fWithMempool);
-	if (tempvOut.empty())
-		return 0;
+/**
+ * Read an indexed asset transaction. Without -txindex it is looked up in the block at
+ * nHeight, which is kept in block so that the transactions of one block read it once.
+ */
+static bool ReadIndexedAssetTransaction(const uint256& txId, const int nHeight, CTransaction& txOut, CBlock& block)
+{
+    uint256 hashBlock;
+    if (fTxIndex)
+        return GetTransaction(txId, txOut, Params().GetConsensus(), hashBlock, true);
 
-	std::vector<uint256> vTx;
-	BOOST_FOREACH(const COutPoint& out, tempvOut)
-	{
-		if (find(vTx.begin(), vTx.end(), out.hash) == vTx.end())
-			vTx.push_back(out.hash);
-	}
+    const CBlockIndex* pindex = chainActive[nHeight];
+    if (!pindex)
+        return false;
+    if ((block.IsNull() || block.GetHash() != pindex->GetBlockHash()) && !ReadBlockFromDisk(block, pindex, Params().GetConsensus()))
+        return false;
 
-	std::vector<uint256>::iterator it = vTx.begin();
-	for (; it != vTx.end(); it++)
-	{
-		std::map<uint256, CWalletTx>::iterator itTx;
+    BOOST_FOREACH(const CTransaction& tx, block.vtx)
+    {
+        if (tx.GetHash() == txId)
+        {
+            txOut = tx;
+            return true;
+        }
+    }
+    return false;
+}
 
-		{
-			LOCK(pwalletMain->cs_wallet);
-			itTx = pwalletMain->mapWallet.find(*it);
-			if (itTx == pwalletMain->mapWallet.end())
-			{
-				continue;
-			}
-		}
+bool UpgradeAssetSupplyIndex()
+{
+    bool fUpgraded = false;
+    if (pblocktree->ReadFlag("assetsupplyindex", fUpgraded) && fUpgraded)
+        return true;
 
+    LogPrintf("%s: building the asset supply index...\n", __func__);
 
-		BOOST_FOREACH(const CTxOut& txout, itTx->second.vout)
-		{
-			if (!txout.IsAsset())
-				continue;
+    std::set<uint8_t> setTxClass;
+    setTxClass.insert(ADD_ISSUE_TXOUT);
+    setTxClass.insert(DESTORY_TXOUT);
+    setTxClass.insert(PUT_CANDY_TXOUT);
 
-			CAppHeader header;
-			vector<unsigned char> vData;
-			if (ParseReserve(txout.vReserve, header, vData))
-			{
-				if (header.nAppCmd == ADD_ASSET_CMD)
-				{
-					CCommonData commonData;
-					if (ParseCommonData(vData, commonData))
-					{
-						if (assetId == commonData.assetId)
-							value += commonData.nAmount;
-					}
-				}
-			}
-		}
-	}
+    std::vector<std::pair<CAssetTx_IndexKey, int> > vKey;
+    pblocktree->Read_AssetTx_Index(setTxClass, vKey);
+
+    // in height order, so that every block is read once without -txindex
+    std::vector<std::pair<int, size_t> > vOrder;
+    for (size_t i = 0; i < vKey.size(); i++)
+        vOrder.push_back(std::make_pair(vKey[i].second, i));
+    std::sort(vOrder.begin(), vOrder.end());
+
+    LOCK(cs_main);
+    CBlock block;
+    std::map<uint256, CAssetSupply_IndexValue> mapSupply;
+    for (size_t i = 0; i < vOrder.size(); i++)
+    {
+        boost::this_thread::interruption_point();
+
+        // the rows of the spent inputs carry no amount
+        const CAssetTx_IndexKey& key = vKey[vOrder[i].second].first;
+        if (key.out.n == (uint32_t)-1)
+            continue;
+
+        CTransaction tx;
+        if (!ReadIndexedAssetTransaction(key.out.hash, vOrder[i].first, tx, block) || key.out.n >= tx.vout.size())
+            return error("%s: read asset transaction %s at height %d failed", __func__, key.out.ToString(), vOrder[i].first);
+
+        CAppHeader header;
+        vector<unsigned char> vData;
+        if (!ParseReserve(tx.vout[key.out.n].vReserve, header, vData))
+            return error("%s: parse asset transaction %s failed", __func__, key.out.ToString());
+
+        if (header.nAppCmd == ADD_ASSET_CMD || header.nAppCmd == DESTORY_ASSET_CMD)
+        {
+            CCommonData commonData;
+            if (!ParseCommonData(vData, commonData))
+                return error("%s: parse asset data %s failed", __func__, key.out.ToString());
+            if (header.nAppCmd == ADD_ASSET_CMD)
+                mapSupply[commonData.assetId].nAddAmount += commonData.nAmount;
+            else
+                mapSupply[commonData.assetId].nDestoryAmount += commonData.nAmount;
+        }
+        else if (header.nAppCmd == PUT_CANDY_CMD)
+        {
+            CPutCandyData candyData;
+            if (!ParsePutCandyData(vData, candyData))
+                return error("%s: parse candy data %s failed", __func__, key.out.ToString());
+            mapSupply[candyData.assetId].nPutCandyAmount += candyData.nAmount;
+        }
+    }
+
+    if (mapSupply.size() && !pblocktree->Update_AssetSupply_Index(mapSupply, true))
+        return error("%s: write asset supply index failed", __func__);
 
-	return value;
+    LogPrintf("%s: indexed the supply of %u assets\n", __func__, mapSupply.size());
+    return pblocktree->WriteFlag("assetsupplyindex", true);
 }
 
-bool GetRangeChangeHeight(const int nCandyHeight, vector<int>& vChangeHeight)
+void AddAssetBalanceDelta(const CTransaction& tx, const CCoinsViewCache& view, std::map<CAssetBalance_IndexKey, CAssetBalance_IndexValue>& mapBalance)
 {
-    vChangeHeight.clear();
+    for (unsigned int i = 0; i < tx.vout.size(); i++)
+    {
+        const CTxOut& txout = tx.vout[i];
+        const CAppPayload* pPayload = GetAppPayload(tx, i);
+        uint256 assetId;
+        if (!pPayload || !GetPayloadAssetId(*pPayload, assetId))
+            continue;
 
-    vector<int> vHeight;
-    if(pblocktree->Read_CandyHeight_Index(vHeight))
-        sort(vHeight.begin(), vHeight.end());
+        std::string strAddress = "";
+        if (!GetTxOutAddress(txout, &strAddress))
+            continue;
 
-    if(vHeight.empty() || find(vHeight.begin(), vHeight.end(), nCandyHeight) == vHeight.end())
-        return false;
+        CAssetBalance_IndexValue& balance = mapBalance[CAssetBalance_IndexKey(strAddress, assetId)];
+        balance.nReceived.Add(CAssetAmount(txout.nValue));
+        if (txout.nUnlockedHeight > 0)
+            balance.mapLocked[txout.nUnlockedHeight].Add(CAssetAmount(txout.nValue));
+    }
+
+    if (tx.IsCoinBase())
+        return;
 
-    for(unsigned int i = 0; i < vHeight.size(); i++)
+    for (unsigned int i = 0; i < tx.vin.size(); i++)
     {
-        if(vHeight[i] < nCandyHeight)
+        const CTxIn& txin = tx.vin[i];
+        const CCoins* coins = view.AccessCoins(txin.prevout.hash);
+        if (!coins || !coins->IsAvailable(txin.prevout.n))
+            continue;
+
+        // a get candy tx refers to the put candy output without spending it
+        const CTxOut& prevout = coins->vout[txin.prevout.n];
+        uint32_t nAppCmd = 0;
+        if (!prevout.IsAsset(&nAppCmd) || (nAppCmd == PUT_CANDY_CMD && txin.scriptSig.empty()))
             continue;
-        vChangeHeight.push_back(vHeight[i]);
+
+        CAppPayload payload;
+        uint256 assetId;
+        if (!ParseAppPayload(prevout, payload) || !GetPayloadAssetId(payload, assetId))
+            continue;
+
+        std::string strAddress = "";
+        if (!GetTxOutAddress(prevout, &strAddress))
+            continue;
+
+        mapBalance[CAssetBalance_IndexKey(strAddress, assetId)].nSent.Add(CAssetAmount(prevout.nValue));
     }
+}
 
-    return true;
+bool GetAssetBalance(const std::string& strAddress, const uint256& assetId, CAssetBalance_IndexValue& balance, const bool fWithMempool)
+{
+    balance = CAssetBalance_IndexValue();
+    if (assetId.IsNull())
+        return false;
+
+    CAssetBalance_IndexKey key(strAddress, assetId);
+    bool fRet = pblocktree->Read_AssetBalance_Index(key, balance);
+    if (fWithMempool)
+    {
+        CAssetBalance_IndexValue poolBalance;
+        if (mempool.get_AssetBalance_Index(key, poolBalance))
+        {
+            if (!balance.Add(poolBalance))
+                return error("%s: asset %s balance of %s out of range", __func__, assetId.ToString(), strAddress);
+            fRet = true;
+        }
+    }
+
+    return fRet;
 }
 
-static int BinarySearchFromFile(const string& strFile, const string& strAddress, CAmount& nAmount, long* pPos = NULL);
-bool GetAddressAmountByHeight(const int& nHeight, const std::string& strAddress, CAmount& nAmount)
+bool UpgradeAssetBalanceIndex()
 {
-    std::lock_guard<std::mutex> lock(g_mutexChangeFile);
+    bool fUpgraded = false;
+    if (pblocktree->ReadFlag("assetbalanceindex", fUpgraded) && fUpgraded)
+        return true;
+
+    LogPrintf("%s: building the asset balance index...\n", __func__);
+
+    // every class but ALL_TXOUT and UNLOCKED_TXOUT, which are only used for lookups
+    std::set<uint8_t> setTxClass;
+    for (uint8_t nTxClass = LOCKED_TXOUT; nTxClass <= CHANGE_ASSET_TXOUT; nTxClass++)
+        setTxClass.insert(nTxClass);
+
+    std::vector<std::pair<CAssetTx_IndexKey, int> > vKey;
+    pblocktree->Read_AssetTx_Index(setTxClass, vKey);
+
+    std::set<uint256> setTxId;
+    for (size_t i = 0; i < vKey.size(); i++)
+        setTxId.insert(vKey[i].first.out.hash);
+
+    std::map<CAssetBalance_IndexKey, CAssetBalance_IndexValue> mapBalance;
+    BOOST_FOREACH(const uint256& txId, setTxId)
+    {
+        boost::this_thread::interruption_point();
+
+        CTransaction tx;
+        uint256 hashBlock;
+        if (!GetTransaction(txId, tx, Params().GetConsensus(), hashBlock, true))
+            return error("%s: read asset transaction %s failed", __func__, txId.ToString());
+
+        CCoinsView viewDummy;
+        CCoinsViewCache view(&viewDummy);
+        if (!tx.IsCoinBase())
+        {
+            BOOST_FOREACH(const CTxIn& txin, tx.vin)
+            {
+                if (view.HaveCoinsInCache(txin.prevout.hash))
+                    continue;
+
+                CTransaction txPrev;
+                if (!GetTransaction(txin.prevout.hash, txPrev, Params().GetConsensus(), hashBlock, true))
+                    return error("%s: read transaction %s spent by %s failed", __func__, txin.prevout.hash.ToString(), txId.ToString());
+                *view.ModifyCoins(txin.prevout.hash) = CCoins(txPrev, 0);
+            }
+        }
+
+        AddAssetBalanceDelta(tx, view, mapBalance);
+    }
 
-    uint64_t nDetailFileSize = boost::filesystem::file_size(GetDataDir() / "height/detail.dat");
+    if (mapBalance.size() && !pblocktree->Update_AssetBalance_Index(mapBalance, true))
+        return error("%s: write asset balance index failed", __func__);
+
+    LogPrintf("%s: indexed %u address balances of %u asset transactions\n", __func__, mapBalance.size(), setTxId.size());
+    return pblocktree->WriteFlag("assetbalanceindex", true);
+}
+
+static bool CheckAddressAmountHeight(const int& nHeight)
+{
+    int nDetailHeight = candybalancedb.GetDetailHeight();
+    if(nHeight > nDetailHeight)
+        return error("%s: address amount at %d is not written yet", __func__, nHeight);
 
     if (nHeight >= g_nStartSPOSHeight)
     {
-        if(nDetailFileSize / sizeof(CBlockDetail) + g_nCriticalHeight - 1 - nHeight > 3 * SPOS_BLOCKS_PER_MONTH)
+        if(nDetailHeight - nHeight > 3 * SPOS_BLOCKS_PER_MONTH)
             return error("%s: cannot get address amount out of 3 months", __func__);
     }
     else
@@ -7783,34 +8054,30 @@ bool GetAddressAmountByHeight(const int& nHeight, const std::string& strAddress,
         {
             int nSPOSLaveHeight = (nHeight + 3 * BLOCKS_PER_MONTH - g_nStartSPOSHeight) * ConvertBlockHeight(Params().GetConsensus());
             int nTrueThreeMonthBlockHeight = g_nStartSPOSHeight + nSPOSLaveHeight;
-            if (nDetailFileSize / sizeof(CBlockDetail) + g_nCriticalHeight - 1 - nHeight > nTrueThreeMonthBlockHeight)
+            if (nDetailHeight - nHeight > nTrueThreeMonthBlockHeight)
                 return error("%s: cannot get address amount out of 3 months", __func__);
         }
         else
         {
-            if(nDetailFileSize / sizeof(CBlockDetail) + g_nCriticalHeight - 1 - nHeight > 3 * BLOCKS_PER_MONTH)
+            if(nDetailHeight - nHeight > 3 * BLOCKS_PER_MONTH)
                 return error("%s: cannot get address amount out of 3 months", __func__);
         }
     }
 
-    vector<int> vChangeHeight;
-    if(!GetRangeChangeHeight(nHeight, vChangeHeight))
-        return error("%s: get change files failed at %d", __func__, nHeight);
+    return true;
+}
+
+bool GetAddressAmountByHeight(const int& nHeight, const std::string& strAddress, CAmount& nAmount)
+{
+    if(!CheckAddressAmountHeight(nHeight))
+        return false;
 
-    // 1. search address from all.dat
-    if(BinarySearchFromFile("all.dat", strAddress, nAmount) < 0)
-        return error("%s: search %s from all.dat failed at %d", __func__, strAddress, nHeight);
+    CCandyAddressKey key;
+    if(!key.SetString(strAddress))
+        return error("%s: invalid address %s", __func__, strAddress);
 
-    // 2. search address from change file
-    string strFile = "";
-    BOOST_FOREACH(const int& nChangeHeight, vChangeHeight)
-    {
-        strFile = itostr(nChangeHeight) + ".change";
-        CAmount nChangeAmount = 0;
-        if(BinarySearchFromFile(strFile, strAddress, nChangeAmount) < 0)
-            return error("%s: search %s from %s failed at %d", __func__, strAddress, strFile, nHeight);
-        nAmount -= nChangeAmount;
-    }
+    if(!candybalancedb.GetAmountByHeight(nHeight, key, nAmount))
+        return error("%s: search %s failed at %d", __func__, strAddress, nHeight);
 
     if(nAmount < 0)
         return false;
@@ -7818,11 +8085,43 @@ bool GetAddressAmountByHeight(const int& nHeight, const std::string& strAddress,
     return true;
 }
 
+bool GetAddressAmountsByHeight(const int& nHeight, const std::vector<CCandyAddressKey>& vKey, std::vector<CAmount>& vAmount)
+{
+    if(!CheckAddressAmountHeight(nHeight))
+        return false;
+
+    if(!candybalancedb.GetAmountsByHeight(nHeight, vKey, vAmount))
+        return error("%s: search %u addresses failed at %d", __func__, vKey.size(), nHeight);
+
+    return true;
+}
+
 bool GetTotalAmountByHeight(const int& nHeight, CAmount& nTotalAmount)
 {
     return pblocktree->Read_CandyHeight_TotalAmount_Index(nHeight, nTotalAmount);
 }
 
+bool IsCandyExpired(const int nCandyHeight, const int nExpired, const int nCurrentHeight)
+{
+    if (nCandyHeight >= g_nStartSPOSHeight)
+        return nExpired * SPOS_BLOCKS_PER_MONTH + nCandyHeight - 3 * SPOS_BLOCKS_PER_DAY < nCurrentHeight;
+
+    if (nExpired * BLOCKS_PER_MONTH + nCandyHeight >= g_nStartSPOSHeight)
+    {
+        int nSPOSLaveHeight = (nExpired * BLOCKS_PER_MONTH + nCandyHeight - g_nStartSPOSHeight) * (Params().GetConsensus().nPowTargetSpacing / Params().GetConsensus().nSPOSTargetSpacing);
+        int nTrueBlockHeight = g_nStartSPOSHeight + nSPOSLaveHeight;
+        return nTrueBlockHeight < nCurrentHeight;
+    }
+
+    return nExpired * BLOCKS_PER_MONTH + nCandyHeight < nCurrentHeight;
+}
+
+bool IsCandyAmountInRange(const CAmount nCandyAmount, const CAmount nTotalAmount)
+{
+    // only the integer parts of 0.001 * total and 0.1 * total are compared
+    return nCandyAmount >= nTotalAmount / 1000 && nCandyAmount <= nTotalAmount / 10;
+}
+
 bool GetCOutPointAddress(const uint256& assetId, std::map<COutPoint, std::vector<std::string>> &moutpointaddress)
 {
     if (assetId.IsNull())
@@ -7862,16 +8161,17 @@ bool GetIssueAssetInfo(std::map<uint256, CAssetData>& mapissueassetinfo)
             if (!pcoin->vout[i].IsAsset())
                 continue;
 
-            CAppHeader header;
-            std::vector<unsigned char> vData;
-            if(!ParseReserve(pcoin->vout[i].vReserve, header, vData))
+            const CAppPayload* pPayload = GetAppPayload(*pcoin, i);
+            if(!pPayload)
                 continue;
 
+            const CAppHeader& header = pPayload->header;
+
             if(header.nAppCmd == ISSUE_ASSET_CMD)
             {
-                CAssetData assetData;
-                if(!ParseIssueData(vData, assetData))
+                if(!pPayload->fDataValid)
                     continue;
+                const CAssetData& assetData = pPayload->assetData;
 
                 uint256 assetid = assetData.GetHash();
                 if (assetid.IsNull())
@@ -7889,290 +8189,64 @@ bool GetIssueAssetInfo(std::map<uint256, CAssetData>& mapissueassetinfo)
     return true;
 }
 
-static bool GetAllCandyInfo()
+bool LoadCandyHeightToList()
 {
-    unsigned int icounter = 0;
-
-    bool fRet = false;
-    std::map<CPutCandy_IndexKey, CPutCandy_IndexValue> mapCandy;
-    if (!GetAssetIdCandyInfoList(mapCandy))
-        return fRet;
-
-    if (mapCandy.empty())
-        return fRet;
-
-    vector<pair<CPutCandy_IndexKey, CPutCandy_IndexValue>> vallassetidcandyinfolist(mapCandy.begin(), mapCandy.end());
-    sort(vallassetidcandyinfolist.begin(), vallassetidcandyinfolist.end(), CompareCandyInfo());
+    listCandyHeight.clear();
 
-    map<CKeyID, int64_t> mapKeyBirth;
-    {
-        LOCK(pwalletMain->cs_wallet);
-        pwalletMain->GetKeyBirthTimes(mapKeyBirth);
-    }
+    std::vector<int> vHeight;
+    if(pblocktree->Read_CandyHeight_TotalAmount_Index(vHeight))
+        std::sort(vHeight.begin(), vHeight.end());
 
-    int keyBirthCount = 0;
-    std::vector<std::string> vaddress;
-    for (map<CKeyID, int64_t>::const_iterator tempit = mapKeyBirth.begin(); tempit != mapKeyBirth.end(); tempit++)
+    std::vector<int> vCandyHeight;
+    if (pblocktree->Read_CandyHeight_Index(vCandyHeight))
     {
-        boost::this_thread::interruption_point();
-        if(++keyBirthCount==1000)
+        std::sort(vCandyHeight.begin(), vCandyHeight.end());
+        for (std::vector<int>::iterator it = vCandyHeight.begin(); it != vCandyHeight.end(); it++)
         {
-            keyBirthCount = 0;
-            MilliSleep(10);
+            boost::this_thread::interruption_point();
+            if (vHeight.size() != 0 && *it <= vHeight.back())
+                continue;
+            listCandyHeight.push_back(*it);
         }
-        std::string saddress = CBitcoinAddress(tempit->first).ToString();
-        vaddress.push_back(saddress);
     }
 
-    int nCurrentHeight = g_nChainHeight;
-
-    int candyListSize = vallassetidcandyinfolist.size();
-    for (int candyCount = 0; candyCount<candyListSize;candyCount++)
-    {
-        boost::this_thread::interruption_point();
-        if(candyCount%500==0&&candyCount!=0)
-            MilliSleep(10);
-        const CPutCandy_IndexKey& candyInfoIndex = vallassetidcandyinfolist[candyCount].first;
-        CPutCandy_IndexValue& candyInfoValue = vallassetidcandyinfolist[candyCount].second;
-        CAssetId_AssetInfo_IndexValue assetInfo;
-        const uint256& assetId = candyInfoIndex.assetId;
-        if (assetId.IsNull() || !GetAssetInfoByAssetId(assetId, assetInfo, false))
-            continue;
-
-        const COutPoint& out = candyInfoIndex.out;
-        const CCandyInfo& candyInfo = candyInfoIndex.candyInfo;
+    return true;
+}
 
-        CAmount dbamount = 0;
-        CAmount memamount = 0;
-        if (!GetGetCandyTotalAmount(assetId, out, dbamount, memamount))
-            continue;
+static bool PutCandyHeightToList(const int& nCandyHeight)
+{
+    std::lock_guard<std::mutex> lock(g_mutexCandyHeight);
 
-        CAmount nGetCandyAmount =  dbamount + memamount;
-        CAmount nNowGetCandyTotalAmount = 0;
+    list<int>::iterator it = find(listCandyHeight.begin(), listCandyHeight.end(), nCandyHeight);
+    if(it != listCandyHeight.end())
+        return true;
 
-        if (candyInfo.nAmount <= 0)
-            continue;
+    listCandyHeight.push_back(nCandyHeight);
+    listCandyHeight.sort();
+    if(!pblocktree->Write_CandyHeight_Index(nCandyHeight))
+        return false;
 
-        int nTxHeight = candyInfoValue.nHeight;
-        if (nTxHeight > g_nChainHeight)
-            continue;
+    candybalancedb.AddChangeHeight(nCandyHeight);
+    return true;
+}
 
-        BlockMap::iterator mi = mapBlockIndex.find(candyInfoValue.blockHash);
-        if (mi == mapBlockIndex.end())
-            continue;
+static bool GetCandyHeightFromList(int& nCandyHeight)
+{
+    std::lock_guard<std::mutex> lock(g_mutexCandyHeight);
 
-        int64_t nTimeBegin = mapBlockIndex[candyInfoValue.blockHash]->GetBlockTime();
+    if (listCandyHeight.empty())
+        return false;
 
-        if (nTxHeight >= g_nStartSPOSHeight)
-        {
-            if (candyInfo.nExpired * SPOS_BLOCKS_PER_MONTH + nTxHeight - 3 * SPOS_BLOCKS_PER_DAY < nCurrentHeight)
-                continue;
-        }
-        else
+    std::vector<int> vHeight;
+    if(pblocktree->Read_CandyHeight_TotalAmount_Index(vHeight))
+    {
+        std::sort(vHeight.begin(), vHeight.end());
+        for(list<int>::iterator it = listCandyHeight.begin(); it != listCandyHeight.end();)
         {
-            if (candyInfo.nExpired * BLOCKS_PER_MONTH + nTxHeight >= g_nStartSPOSHeight)
-            {
-                int nSPOSLaveHeight = (candyInfo.nExpired * BLOCKS_PER_MONTH + nTxHeight - g_nStartSPOSHeight) * (Params().GetConsensus().nPowTargetSpacing / Params().GetConsensus().nSPOSTargetSpacing);
-                int nTrueBlockHeight = g_nStartSPOSHeight + nSPOSLaveHeight;
-                if (nTrueBlockHeight < nCurrentHeight)
-                    continue;
-            }
+            if (find(vHeight.begin(), vHeight.end(), nCandyHeight) != vHeight.end())
+                it = listCandyHeight.erase(it);
             else
-            {
-                if (candyInfo.nExpired * BLOCKS_PER_MONTH + nTxHeight < nCurrentHeight)
-                    continue;
-            }
-        }
-
-        CAmount nTotalSafe = 0;
-        if(!GetTotalAmountByHeight(nTxHeight, nTotalSafe))
-            continue;
-
-        if (nTotalSafe <= 0)
-            continue;
-
-        bool relust = false;
-        int addressSize = vaddress.size();
-        for (int addrCount = 0; addrCount<addressSize;addrCount++)
-        {
-            boost::this_thread::interruption_point();
-            if(addrCount%50==0&&addrCount!=0)
-                MilliSleep(10);
-            CAmount nSafe = 0;
-            if(!GetAddressAmountByHeight(nTxHeight, vaddress[addrCount], nSafe))
-                continue;
-            if (nSafe < 1 * COIN || nSafe > nTotalSafe)
-                continue;
-
-            CAmount nTempAmount = 0;
-            CAmount nCandyAmount = (CAmount)(1.0 * nSafe / nTotalSafe * candyInfo.nAmount);
-            //add all nCandyAmount to judge whether more than candyInfo.nAmount
-            if (nCandyAmount >= AmountFromValue("0.0001", assetInfo.assetData.nDecimals, true) && !GetGetCandyAmount(assetId, out, vaddress[addrCount], nTempAmount))
-            {
-                relust = true;
-                nNowGetCandyTotalAmount += nCandyAmount;
-            }
-        }
-
-        if (nNowGetCandyTotalAmount + nGetCandyAmount > candyInfo.nAmount)
-            continue;
-
-        if (relust)
-        {
-            fRet = true;
-            CCandy_BlockTime_Info tempcandybolcktimeinfo(assetId,assetInfo.assetData,candyInfo,out,nTimeBegin,nTxHeight);
-
-            icounter++;
-            if (icounter <= nCandyPageCount && fHaveGUI)
-				uiInterface.CandyVecPut();
-
-            {
-                std::lock_guard<std::mutex> lock(g_mutexAllCandyInfo);
-                gAllCandyInfoVec.push_back(tempcandybolcktimeinfo);
-            }
-            if(icounter%100==0)
-                MilliSleep(10);
-        }
-    }
-
-    {
-        std::lock_guard<std::mutex> lock(g_mutexTmpAllCandyInfo);
-        bool sendToFirstPage = false;
-        unsigned int vecSize = gAllCandyInfoVec.size();
-        if(vecSize>0&&vecSize<nCandyPageCount)
-            sendToFirstPage = true;
-        int64_t lastBlockTime = 0;
-        int lastBlockIndex = 0;
-        if(vecSize>0)
-        {
-            lastBlockTime = gAllCandyInfoVec[0].blocktime;
-            bool foundIndex = false;
-            for(unsigned int i = lastBlockIndex;i<vecSize;i++)
-            {
-                if(lastBlockTime!=gAllCandyInfoVec[i].blocktime)
-                {
-                    foundIndex = true;
-                    lastBlockIndex = i;
-                    break;
-                }
-            }
-        }
-        if(gTmpAllCandyInfoVec.size()>0 && fRet)
-        {
-            for(unsigned int i=0;i<gTmpAllCandyInfoVec.size();i++)
-            {
-                CCandy_BlockTime_Info& tmpInfo = gTmpAllCandyInfoVec[i];
-                if(tmpInfo.blocktime<lastBlockTime)
-                    continue;
-                bool exist = false;
-                if(tmpInfo.blocktime==lastBlockTime)
-                {
-                    //compare exists
-                    for(unsigned int i=0;i<=lastBlockIndex;i++)
-                    {
-                        CCandy_BlockTime_Info& info = gAllCandyInfoVec[i];
-                        if(info.assetId==tmpInfo.assetId&&info.outpoint==tmpInfo.outpoint&&info.candyinfo==tmpInfo.candyinfo
-                                &&info.assetData.strAssetName==tmpInfo.assetData.strAssetName)
-                        {
-                            exist = true;
-                            break;
-                        }
-                    }
-                }
-                if(!exist)
-                    gAllCandyInfoVec.insert(gAllCandyInfoVec.begin(),gTmpAllCandyInfoVec[i]);
-            }
-        }
-
-        if(sendToFirstPage && fHaveGUI)
-			uiInterface.CandyVecPut();
-    }
-
-    return fRet;
-}
-
-void ThreadGetAllCandyInfo()
-{
-	SetThreadPriority(THREAD_PRIORITY_BELOW_NORMAL);
-	RenameThread("safe-get-allcandy");
-
-	static bool fOneThread;
-	if (fOneThread)
-		return;
-	fOneThread = true;
-
-	while (true)
-	{
-		boost::this_thread::interruption_point();
-		if (!fGetCandyInfoStart)
-		{
-			MilliSleep(100);
-			continue;
-		}
-		if (GetAllCandyInfo())
-		{
-			fUpdateAllCandyInfoFinished = true;
-			LogPrintf("Message:GetAllCandyInfo finished\n");
-			break;
-		}
-		MilliSleep(1000);
-	}
-}
-
-bool LoadCandyHeightToList()
-{
-    listCandyHeight.clear();
-
-    std::vector<int> vHeight;
-    if(pblocktree->Read_CandyHeight_TotalAmount_Index(vHeight))
-        std::sort(vHeight.begin(), vHeight.end());
-
-    std::vector<int> vCandyHeight;
-    if (pblocktree->Read_CandyHeight_Index(vCandyHeight))
-    {
-        std::sort(vCandyHeight.begin(), vCandyHeight.end());
-        for (std::vector<int>::iterator it = vCandyHeight.begin(); it != vCandyHeight.end(); it++)
-        {
-            boost::this_thread::interruption_point();
-            if (vHeight.size() != 0 && *it <= vHeight.back())
-                continue;
-            listCandyHeight.push_back(*it);
-        }
-    }
-
-    return true;
-}
-
-static bool PutCandyHeightToList(const int& nCandyHeight)
-{
-    std::lock_guard<std::mutex> lock(g_mutexCandyHeight);
-
-    list<int>::iterator it = find(listCandyHeight.begin(), listCandyHeight.end(), nCandyHeight);
-    if(it != listCandyHeight.end())
-        return true;
-
-    listCandyHeight.push_back(nCandyHeight);
-    listCandyHeight.sort();
-    return pblocktree->Write_CandyHeight_Index(nCandyHeight);
-}
-
-static bool GetCandyHeightFromList(int& nCandyHeight)
-{
-    std::lock_guard<std::mutex> lock(g_mutexCandyHeight);
-
-    if (listCandyHeight.empty())
-        return false;
-
-    std::vector<int> vHeight;
-    if(pblocktree->Read_CandyHeight_TotalAmount_Index(vHeight))
-    {
-        std::sort(vHeight.begin(), vHeight.end());
-        for(list<int>::iterator it = listCandyHeight.begin(); it != listCandyHeight.end();)
-        {
-            if (find(vHeight.begin(), vHeight.end(), nCandyHeight) != vHeight.end())
-                it = listCandyHeight.erase(it);
-            else
-                it++;
+                it++;
         }
     }
 
@@ -8184,237 +8258,6 @@ static bool GetCandyHeightFromList(int& nCandyHeight)
     return true;
 }
 
-
-static void CloseFiles(vector<FILE**> vFiles)
-{
-    for(vector<FILE**>::iterator it = vFiles.begin(); it != vFiles.end(); it++)
-    {
-        if(**it)
-        {
-            fclose(**it);
-            **it = NULL;
-        }
-    }
-}
-
-static int BinarySearchFromFile(FILE* pFile, const string& strAddress, CAmount& nAmount, long* pPos = NULL);
-static bool MergeFileAndMap(const string& strSrcFile, const map<string, CAmount>& mapAddressAmount, const string& strDestFile)
-{
-    FILE *pSrcFile, *pDestFile;
-    pSrcFile = pDestFile = NULL;
-    vector<FILE**> vFiles;
-    vFiles.push_back(&pSrcFile);
-    vFiles.push_back(&pDestFile);
-
-    if(!(pSrcFile = fopen(strSrcFile.data(), "rb")))
-        return error("%s: open %s failed", __func__, strSrcFile);
-
-    if(!(pDestFile = fopen(strDestFile.data(), "wb")))
-    {
-        CloseFiles(vFiles);
-        return error("%s: open %s failed", __func__, strDestFile);
-    }
-
-    CAmount nAmount = 0;
-    long nPos = 0;
-    long nNextPos = 0;
-    int nRet = 0;
-    CAddressAmount arr[BATCH_COUNT];
-    map<string, CAmount>::const_iterator it = mapAddressAmount.begin();
-    for(; it != mapAddressAmount.end(); it++)
-    {
-        nRet = BinarySearchFromFile(pSrcFile, it->first, nAmount, &nPos);
-        if(nRet == -1)
-        {
-            CloseFiles(vFiles);
-            return error("%s: search %s from %s failed", __func__, it->first, strSrcFile);
-        }
-
-        if(fseek(pSrcFile, nNextPos * sizeof(CAddressAmount), SEEK_SET))
-        {
-            CloseFiles(vFiles);
-            return error("%s: fseek %s failed", __func__, strSrcFile);
-        }
-
-        long nCount = nPos - nNextPos;
-        if(nCount < 0)
-        {
-            CloseFiles(vFiles);
-            return error("%s: unorder data from %s and map", __func__, strSrcFile);
-        }
-
-        for(long i = 0; i < nCount / BATCH_COUNT; i++)
-        {
-            if(fread(arr, sizeof(CAddressAmount), BATCH_COUNT, pSrcFile) != BATCH_COUNT)
-            {
-                CloseFiles(vFiles);
-                return error("%s: 1-read %s failed", __func__, strSrcFile);
-            }
-            if(fwrite(arr, sizeof(CAddressAmount), BATCH_COUNT, pDestFile) != BATCH_COUNT)
-            {
-                CloseFiles(vFiles);
-                return error("%s: 1-write %s failed", __func__, strDestFile);
-            }
-        }
-        size_t nSize = nCount % BATCH_COUNT;
-        if(nSize)
-        {
-            if(fread(arr, sizeof(CAddressAmount), nSize, pSrcFile) != nSize)
-            {
-                CloseFiles(vFiles);
-                return error("%s: 2-read %s failed", __func__, strSrcFile);
-            }
-            if(fwrite(arr, sizeof(CAddressAmount), nSize, pDestFile) != nSize)
-            {
-                CloseFiles(vFiles);
-                return error("%s: 2-write %s failed", __func__, strDestFile);
-            }
-        }
-
-        CAddressAmount temp;
-        if(nRet == 0)
-        {
-            nNextPos = nPos + 1;
-            if(fread(&temp, sizeof(CAddressAmount), 1, pSrcFile) != 1)
-            {
-                CloseFiles(vFiles);
-                return error("%s: 3-read: %s failed", __func__, strSrcFile);
-            }
-            temp.nAmount += it->second;
-            if(temp.nAmount == 0)
-                continue;
-        }
-        else if(nRet == 1)
-        {
-            temp = CAddressAmount(it->first, it->second);
-            nNextPos = nPos;
-        }
-        else
-            break;
-
-        if(fwrite(&temp, sizeof(CAddressAmount), 1, pDestFile) != 1)
-        {
-            CloseFiles(vFiles);
-            return error("%s: 3-write %s failed", __func__, strDestFile);
-        }
-    }
-
-    if(nRet == 2)
-    {
-        for(; it != mapAddressAmount.end(); it++)
-        {
-            CAddressAmount temp(it->first, it->second);
-            if(fwrite(&temp, sizeof(CAddressAmount), 1, pDestFile) != 1)
-            {
-                CloseFiles(vFiles);
-                return error("%s: 5-write %s failed", __func__, strDestFile);
-            }
-        }
-    }
-    else
-    {
-        size_t nSize = 0;
-        while(!feof(pSrcFile))
-        {
-            if((nSize = fread(arr, sizeof(CAddressAmount), BATCH_COUNT, pSrcFile)) == 0)
-            {
-                if(feof(pSrcFile))
-                    break;
-                CloseFiles(vFiles);
-                return error("%s: 6-read from %s failed", __func__, strSrcFile);
-            }
-            if(nSize != fwrite(arr, sizeof(CAddressAmount), nSize, pDestFile))
-            {
-                CloseFiles(vFiles);
-                return error("%s: 6-write to %s failed", __func__, strDestFile);
-            }
-        }
-    }
-
-    CloseFiles(vFiles);
-    return true;
-}
-
-/*
- * error: < 0
- * found: = 0
- * none: > 0 (2: strAdress is more than all of file, 1: strAddress is a median)
- */
-static int BinarySearchFromFile(const string& strFile, const string& strAddress, CAmount& nAmount, long* pPos)
-{
-    const string strFullName = GetDataDir().string() + "/height/" + strFile;
-    FILE* pFile = fopen(strFullName.data(), "rb");
-    if(!pFile)
-        return false;
-
-    int nRet = BinarySearchFromFile(pFile, strAddress, nAmount, pPos);
-    fclose(pFile);
-    return nRet;
-}
-
-static int BinarySearchFromFile(FILE* pFile, const string& strAddress, CAmount& nAmount, long* pPos)
-{
-    if(!pFile) // error
-        return -1;
-
-    if(fseek(pFile, 0L, SEEK_END))
-    {
-        LogPrintf("%s: fseek failed\n", __func__);
-        return -1;
-    }
-
-    long nFileLen = ftell(pFile);
-    if(nFileLen < 0) // error
-    {
-        LogPrintf("%s: ftell failed\n", __func__);
-        return -1;
-    }
-
-    CAddressAmount data;
-
-    long high = nFileLen / sizeof(CAddressAmount);
-    long low = 0;
-    long mid = 0;
-    int nCmp = 0;
-    while(low <= high)
-    {
-        mid = (low + high) / 2;
-
-        if(fseek(pFile, mid * sizeof(CAddressAmount), SEEK_SET))
-        {
-            LogPrintf("%s: fseek failed\n", __func__);
-            return -1;
-        }
-
-        if(1 != fread(&data, sizeof(CAddressAmount), 1, pFile))
-        {
-            if(feof(pFile))
-            {
-                if(pPos) *pPos = high;
-                return 2;
-            }
-
-            LogPrintf("%s: fread failed\n", __func__);
-            return -1;
-        }
-
-        nCmp = strcmp(data.szAddress, strAddress.data());
-        if(nCmp < 0)
-            low = mid + 1;
-        else if(nCmp > 0)
-            high = mid - 1;
-        else // found
-        {
-            nAmount = data.nAmount;
-            if(pPos) *pPos = mid;
-            return 0;
-        }
-    }
-
-    if(pPos) *pPos = low;
-    return 1;
-}
-
 static bool GetChangeFilterAmount(const int& nStartHeight, const int& nEndHeight, CAmount& nChangeAmount, CAmount& nFilterAmount)
 {
     string strDetailFile = GetDataDir().string() + "/height/detail.dat";
@@ -8499,132 +8342,7 @@ static bool GetHeightAddressAmount(const int& nCandyHeight)
     if (!pblocktree->Write_CandyHeight_TotalAmount_Index(nCandyHeight, nTotalAmount))
         return error("%s: write finnal candy height index failed at %d", __func__, nCandyHeight);
 
-    CBlock candyBlock;
-    while(true)
-    {
-        boost::this_thread::interruption_point();
-
-        if(nCandyHeight > chainActive.Height())
-        {
-            MilliSleep(1000);
-            continue;
-        }
-
-        CBlockIndex* pindex = chainActive[nCandyHeight];
-        if (ReadBlockFromDisk(candyBlock, pindex, Params().GetConsensus()))
-            break;
-        MilliSleep(1000);
-    }
-
-    bool fUpdateUI = false;
-
-    map<CKeyID, int64_t> mapKeyBirth;
-    {
-        LOCK(pwalletMain->cs_wallet);
-        pwalletMain->GetKeyBirthTimes(mapKeyBirth);
-    }
-
-    std::vector<std::string> vaddress;
-    for (map<CKeyID, int64_t>::const_iterator tempit = mapKeyBirth.begin(); tempit != mapKeyBirth.end(); tempit++)
-    {
-        boost::this_thread::interruption_point();
-        std::string saddress = CBitcoinAddress(tempit->first).ToString();
-        vaddress.push_back(saddress);
-    }
-
-    int nCurrentHeight = g_nChainHeight;
-    BOOST_FOREACH(const CTransaction& tx, candyBlock.vtx)
-    {
-        for(unsigned int i = 0; i < tx.vout.size(); i++)
-        {
-            boost::this_thread::interruption_point();
-
-            const CTxOut& txout = tx.vout[i];
-
-            CAppHeader header;
-            std::vector<unsigned char> vData;
-            if(!ParseReserve(txout.vReserve, header, vData) || header.nAppCmd != PUT_CANDY_CMD)
-                continue;
-
-            CPutCandyData candyData;
-            if(!ParsePutCandyData(vData, candyData))
-                continue;
-
-            const uint256& assetId = candyData.assetId;
-            if(assetId.IsNull())
-                continue;
-
-            CAssetId_AssetInfo_IndexValue assetInfo;
-            if(!GetAssetInfoByAssetId(assetId, assetInfo, false))
-                continue;
-
-            COutPoint out(tx.GetHash(), i);
-            CCandy_BlockTime_Info candyblocktimeinfo(assetId, assetInfo.assetData, CCandyInfo(candyData.nAmount, candyData.nExpired),out , candyBlock.nTime, nCandyHeight);
-
-            if (nCandyHeight >= g_nStartSPOSHeight)
-            {
-                if (candyData.nExpired * SPOS_BLOCKS_PER_MONTH + nCandyHeight - 3 * SPOS_BLOCKS_PER_DAY< nCurrentHeight)
-                    continue;
-            }
-            else
-            {
-                if (candyData.nExpired * BLOCKS_PER_MONTH + nCandyHeight >= g_nStartSPOSHeight)
-                {
-                    int nSPOSLaveHeight = (candyData.nExpired * BLOCKS_PER_MONTH + nCandyHeight - g_nStartSPOSHeight) * (Params().GetConsensus().nPowTargetSpacing / Params().GetConsensus().nSPOSTargetSpacing);
-                    int nTrueBlockHeight = g_nStartSPOSHeight + nSPOSLaveHeight;
-                    if (nTrueBlockHeight < nCurrentHeight)
-                        continue;
-                }
-                else
-                {
-                    if (candyData.nExpired * BLOCKS_PER_MONTH + nCandyHeight < nCurrentHeight)
-                        continue;
-                }
-            }
-
-            if(nCandyHeight > nCurrentHeight)
-                continue;
-
-            bool result = false;
-            for (std::vector<std::string>::iterator addit = vaddress.begin(); addit != vaddress.end(); addit++)
-            {
-                boost::this_thread::interruption_point();
-
-                CAmount nSafe = 0;
-                if(!GetAddressAmountByHeight(nCandyHeight, *addit, nSafe))
-                    continue;
-                if (nSafe < 1 * COIN || nSafe > nTotalAmount)
-                    continue;
-
-                CAmount nTempAmount = 0;
-                CAmount nCandyAmount = (CAmount)(1.0 * nSafe / nTotalAmount * candyData.nAmount);
-                if (nCandyAmount >= AmountFromValue("0.0001", assetInfo.assetData.nDecimals, true) && !GetGetCandyAmount(assetId, out, *addit, nTempAmount,false))
-                {
-                    result = true;
-                    break;
-                }
-            }
-
-            if(!result)
-                continue;
-
-            if(fUpdateAllCandyInfoFinished)
-            {
-                if(gAllCandyInfoVec.size()<nCandyPageCount)
-                    fUpdateUI = true;
-                std::lock_guard<std::mutex> lock(g_mutexAllCandyInfo);
-                gAllCandyInfoVec.insert(gAllCandyInfoVec.begin(),candyblocktimeinfo);
-            }
-            else
-            {
-                std::lock_guard<std::mutex> lock(g_mutexTmpAllCandyInfo);
-                gTmpAllCandyInfoVec.push_back(candyblocktimeinfo);
-            }
-        }
-    }
-    if(fUpdateUI && fHaveGUI)
-		uiInterface.CandyVecPut();
-
+    candyengine.NotifyCandyHeight(nCandyHeight);
     return true;
 }
 
@@ -8669,10 +8387,10 @@ static bool CheckDetailFile(FILE* pFile, const int& nHeight, int& nLastCandyHeig
 
     int nLastHeight = nFileLen / sizeof(CBlockDetail) + g_nCriticalHeight - 1;
 
-    if(nLastHeight < nHeight - 1 - g_nListChangeInfoLimited)
+    if(nLastHeight < nHeight - 1 - CHANGE_INFO_QUEUE_CAPACITY)
     {
         fValid = false;
-        return error("%s: missing %d in detail.dat at least", __func__, nHeight - 1 - g_nListChangeInfoLimited);
+        return error("%s: missing %d in detail.dat at least", __func__, nHeight - 1 - CHANGE_INFO_QUEUE_CAPACITY);
     }
 
     if(nLastHeight >= nHeight)
@@ -8726,175 +8444,221 @@ static bool WriteDetailFile(const string& strFile, const CBlockDetail& detail)
     return bRet;
 }
 
-static bool WriteChangeFile(const string& strFile, const map<string, CAmount>& mapAddressAmount)
+static int g_nLastCandyHeight = 0;
+//! last height in detail.dat, set by VerifyDetailFile()
+static int g_nDetailFileHeight = 0;
+
+/** Drop the records of detail.dat above nHeight */
+static bool TruncateDetailFile(int nHeight)
 {
-    string strTempFile = strFile + ".temp";
-    boost::filesystem::remove(strTempFile);
-    if(!MergeFileAndMap(strFile, mapAddressAmount, strTempFile))
-    {
-        boost::filesystem::remove(strTempFile);
-        return error("%s: merge address information to %s failed", __func__, strFile);
-    }
+    string strFile = GetDataDir().string() + "/height/detail.dat";
+    FILE* pFile = fopen(strFile.data(), "rb+");
+    if(!pFile)
+        return error("%s: open detail.dat failed", __func__);
 
-    string strBakFile = strFile + ".bak";
-    boost::filesystem::remove(strBakFile);
-    if(!RenameOver(strFile, strBakFile))
-    {
-        boost::filesystem::remove(strTempFile);
-        return error("%s: backup %s to %s failed", __func__, strFile, strBakFile);
-    }
+    bool fRet = TruncateFile(pFile, std::max(0, nHeight + 1 - g_nCriticalHeight) * sizeof(CBlockDetail));
+    if(fRet)
+        FileCommit(pFile);
+    fclose(pFile);
+    return fRet;
+}
+
+bool OpenCandyBalanceDB()
+{
+    g_queueChangeInfo.Clear();
+
+    if(!candybalancedb.Open(GetDataDir() / "height", g_nDetailFileHeight))
+        return error("%s: open candy balance db failed", __func__);
 
-    if(!RenameOver(strTempFile, strFile))
+    // detail.dat reached the disk ahead of delta.log, replay the blocks in between again
+    const int nLogHeight = candybalancedb.GetLogHeight();
+    if(nLogHeight < g_nDetailFileHeight)
     {
-        boost::filesystem::remove(strTempFile);
-        if(!RenameOver(strBakFile, strFile))
-            throw std::runtime_error(strprintf("%s: Restore %s to %s faield, missing address information", __func__, strBakFile, strFile));
-        boost::filesystem::remove(strBakFile);
-        return error("%s: rename %s to %s failed", __func__, strTempFile, strFile);
+        LogPrintf("%s: delta log at %d is behind detail.dat at %d\n", __func__, nLogHeight, g_nDetailFileHeight);
+        g_nLastCandyHeight = 0;
+        if(!TruncateDetailFile(nLogHeight) || !VerifyDetailFile())
+            return error("%s: truncate detail.dat to %d failed", __func__, nLogHeight);
+        candybalancedb.SetDetailHeight(g_nDetailFileHeight);
     }
 
-    boost::filesystem::remove(strBakFile);
+    vector<int> vCandyHeight;
+    pblocktree->Read_CandyHeight_Index(vCandyHeight);
+    candybalancedb.SetChangeHeights(vCandyHeight);
     return true;
 }
 
-static int g_nLastCandyHeight = 0;
-bool LoadChangeInfoToList()
+/** GetTransaction() without cs_main when the tx index is on, so the replay threads don't queue on it */
+static bool GetIndexedTransaction(const uint256& hash, CTransaction& txOut, uint256& hashBlock)
 {
-    boost::filesystem::path heightDir = GetDataDir() / "height";
+    if(!fTxIndex)
+        return GetTransaction(hash, txOut, Params().GetConsensus(), hashBlock, true);
 
-    string strAllFile = heightDir.string() + "/all.dat";
-    if(!boost::filesystem::exists(strAllFile))
-    {
-        FILE* pAllFile = fopen(strAllFile.data(), "ab+");
-        if(!pAllFile)
-            return error("%s: create empty all file failed", __func__);
-        fclose(pAllFile);
-    }
+    CDiskTxPos postx;
+    return pblocktree->ReadTxIndex(hash, postx) && ReadTransactionAt(postx, hash, txOut, hashBlock);
+}
 
-    g_listChangeInfo.clear();
+/** What a block on disk changes, without the reward and candy height that depend on the blocks before it */
+struct CBlockChange
+{
+    CBlockHeader header;
+    bool fCandy;
+    std::vector<CAddressAmount> vAddressAmount;
 
-    string strFile = heightDir.string() + "/detail.dat";
-    FILE* pFile = fopen(strFile.data(), "ab+");
-    if(!pFile)
-        return error("%s: open detail.dat failed", __func__);
-    if(fseek(pFile, 0L, SEEK_END))
-    {
-        fclose(pFile);
-        return error("%s: fseek detail.dat failed", __func__);
-    }
-    long nLen = ftell(pFile);
-    if(nLen < 0)
-    {
-        fclose(pFile);
-        return error("%s: ftell detail.dat failed", __func__);
-    }
+    CBlockChange() : fCandy(false) {}
+};
+
+static bool ReadBlockChange(const CBlockIndex* pindex, CBlockChange& change)
+{
+    CBlock block;
+    if(!ReadBlockFromDisk(block, pindex, Params().GetConsensus()))
+        return error("%s: read block from disk failed at %d, hash=%s", __func__, pindex->nHeight, pindex->GetBlockHash().ToString());
+    change.header = block.GetBlockHeader();
 
-    int nLastHeight = nLen / sizeof(CBlockDetail) + g_nCriticalHeight - 1;
-    if(nLastHeight != g_nCriticalHeight - 1)
+    CCandyAddressKey addressKey;
+    for(size_t i = 0; i < block.vtx.size(); i++)
     {
-        if(fseek(pFile, -1 * sizeof(CBlockDetail), SEEK_END))
+        const CTransaction& tx = block.vtx[i];
+
+        // vin
+        if(!tx.IsCoinBase())
         {
-            fclose(pFile);
-            return error("%s: fseek detail.dat failed at %d", __func__, nLastHeight);
+            for(size_t j = 0; j < tx.vin.size(); j++)
+            {
+                const CTxIn& txin = tx.vin[j];
+
+                CTransaction in_tx;
+                uint256 in_blockHash;
+                if(!GetIndexedTransaction(txin.prevout.hash, in_tx, in_blockHash) || in_blockHash.IsNull())
+                    return error("%s: read txin transaction failed, hash=%s", __func__, txin.prevout.hash.ToString());
+
+                const CTxOut& in_txout = in_tx.vout[txin.prevout.n];
+                if(in_txout.IsAsset() || !GetTxOutAddressKey(in_txout, addressKey))
+                    continue;
+
+                BlockMap::const_iterator mi = mapBlockIndex.find(in_blockHash);
+                if(mi == mapBlockIndex.end() || mi->second->nHeight < g_nCriticalHeight)
+                    continue;
+
+                change.vAddressAmount.push_back(CAddressAmount(addressKey, -in_txout.nValue));
+            }
         }
 
-        CBlockDetail detail;
-        if(fread(&detail, sizeof(CBlockDetail), 1, pFile) != 1)
+        for(size_t j = 0; j < tx.vout.size(); j++)
         {
-            fclose(pFile);
-            return error("%s: read detail.dat failed at %d", __func__, nLastHeight);
+            const CTxOut& txout = tx.vout[j];
+            if(txout.IsAsset() || !GetTxOutAddressKey(txout, addressKey))
+                continue;
+
+            change.vAddressAmount.push_back(CAddressAmount(addressKey, txout.nValue));
         }
 
-        if(detail.fCandy)
-            g_nLastCandyHeight = detail.nHeight;
-        else
-            g_nLastCandyHeight = detail.nLastCandyHeight;
+        for(size_t j = 0; j < tx.vout.size() && !change.fCandy; j++)
+        {
+            uint32_t nAppCmd = 0;
+            if(tx.vout[j].IsAsset(&nAppCmd) && nAppCmd == PUT_CANDY_CMD)
+                change.fCandy = true;
+        }
     }
 
-    for(int nHeight = nLastHeight + 1; nHeight <= chainActive.Height(); nHeight++)
-    {
-        CBlockIndex* pindex = chainActive[nHeight];
+    MergeAddressAmounts(change.vAddressAmount);
+    return true;
+}
 
-        CBlock block;
-        if(!ReadBlockFromDisk(block, pindex, Params().GetConsensus()))
-        {
-            fclose(pFile);
-            return error("%s: read block from disk failed at %d, hash=%s", __func__, pindex->nHeight, pindex->GetBlockHash().ToString());
-        }
+/**
+ * Block changes for LoadChangeInfoToList(). Worker threads read the blocks and their spent
+ * outputs in any order, at most CHANGE_INFO_REPLAY_AHEAD blocks ahead of Take(), which hands
+ * them out in height order.
+ */
+class CBlockChangeReplay
+{
+private:
+    boost::mutex mutex;
+    boost::condition_variable condRead;
+    boost::condition_variable condSpace;
+    //! next height for a worker
+    int nReadHeight;
+    int nEndHeight;
+    //! next height for Take()
+    int nTakeHeight;
+    std::map<int, CBlockChange> mapChange;
+    bool fStopped;
 
-        map<string, CAmount> mapAddressAmount;
-        string strAddress = "";
-        bool bExistCandy = false;
+public:
+    CBlockChangeReplay(const int nStartHeight, const int nEndHeightIn)
+        : nReadHeight(nStartHeight), nEndHeight(nEndHeightIn), nTakeHeight(nStartHeight), fStopped(false) {}
 
-        for(size_t i = 0; i < block.vtx.size(); i++)
+    void Work()
+    {
+        while(true)
         {
-            const CTransaction& tx = block.vtx[i];
-
-            // vin
-            if(!tx.IsCoinBase())
+            int nHeight = 0;
             {
-                for(size_t j = 0; j < tx.vin.size(); j++)
-                {
-                    const CTxIn& txin = tx.vin[j];
-
-                    CTransaction in_tx;
-                    uint256 in_blockHash;
-                    if(!GetTransaction(txin.prevout.hash, in_tx, Params().GetConsensus(), in_blockHash, true) || in_blockHash.IsNull())
-                    {
-                        fclose(pFile);
-                        return error("%s: read txin transaction failed, hash=%s", __func__, txin.prevout.hash.ToString());
-                    }
-
-                    const CTxOut& in_txout = in_tx.vout[txin.prevout.n];
-                    if(in_txout.IsAsset() || !GetTxOutAddress(in_txout, &strAddress))
-                        continue;
+                boost::unique_lock<boost::mutex> lock(mutex);
+                while(!fStopped && nReadHeight <= nEndHeight && nReadHeight >= nTakeHeight + CHANGE_INFO_REPLAY_AHEAD)
+                    condSpace.wait(lock);
+                if(fStopped || nReadHeight > nEndHeight)
+                    return;
+                nHeight = nReadHeight++;
+            }
 
-                    if(mapBlockIndex.count(in_blockHash) == 0 || mapBlockIndex[in_blockHash]->nHeight < g_nCriticalHeight)
-                        continue;
+            CBlockChange change;
+            bool fRead = ReadBlockChange(chainActive[nHeight], change);
 
-                    if(mapAddressAmount.count(strAddress))
-                    {
-                        mapAddressAmount[strAddress] += -in_txout.nValue;
-                        if(mapAddressAmount[strAddress] == 0)
-                            mapAddressAmount.erase(strAddress);
-                    }
-                    else
-                        mapAddressAmount[strAddress] = -in_txout.nValue;
-                }
-            }
+            boost::unique_lock<boost::mutex> lock(mutex);
+            if(fRead)
+                mapChange[nHeight] = std::move(change);
+            else
+                fStopped = true;
+            condRead.notify_all();
+        }
+    }
 
-            for(size_t j = 0; j < tx.vout.size(); j++)
-            {
-                const CTxOut& txout = tx.vout[j];
-                if(txout.IsAsset() || !GetTxOutAddress(txout, &strAddress))
-                    continue;
+    //! The change of the next height, false once a worker failed
+    bool Take(CBlockChange& change)
+    {
+        boost::unique_lock<boost::mutex> lock(mutex);
+        std::map<int, CBlockChange>::iterator it;
+        while(!fStopped && (it = mapChange.find(nTakeHeight)) == mapChange.end())
+            condRead.wait(lock);
+        if(fStopped)
+            return false;
 
-                if(mapAddressAmount.count(strAddress))
-                {
-                    mapAddressAmount[strAddress] += txout.nValue;
-                    if(mapAddressAmount[strAddress] == 0)
-                        mapAddressAmount.erase(strAddress);
-                }
-                else
-                    mapAddressAmount[strAddress] = txout.nValue;
-            }
+        change = std::move(it->second);
+        mapChange.erase(it);
+        nTakeHeight++;
+        condSpace.notify_all();
+        return true;
+    }
 
-            for(size_t j = 0; j < tx.vout.size(); j++)
-            {
-                const CTxOut& txout = tx.vout[j];
-                uint32_t nAppCmd = 0;
-                if(!txout.IsAsset(&nAppCmd))
-                    continue;
-                if(nAppCmd == PUT_CANDY_CMD)
-                {
-                    bExistCandy = true;
-                    break;
-                }
-            }
+    void Stop()
+    {
+        boost::unique_lock<boost::mutex> lock(mutex);
+        fStopped = true;
+        condSpace.notify_all();
+        condRead.notify_all();
+    }
+};
+
+bool ReplayChangeInfo(const int nStartHeight, const int nEndHeight, const int nThreads, int nLastCandyHeight, const boost::function<bool (CChangeInfo&)>& fnChangeInfo)
+{
+    CBlockChangeReplay replay(nStartHeight, nEndHeight);
+    boost::thread_group threadGroup;
+    for(int i = 0; i < nThreads; i++)
+        threadGroup.create_thread(boost::bind(&CBlockChangeReplay::Work, &replay));
+
+    bool fRet = true;
+    for(int nHeight = nStartHeight; nHeight <= nEndHeight && !ShutdownRequested(); nHeight++)
+    {
+        CBlockChange change;
+        if(!replay.Take(change))
+        {
+            fRet = error("%s: replay block %d failed", __func__, nHeight);
+            break;
         }
 
+        CBlockIndex* pindex = chainActive[nHeight];
         CAmount blockReward = 0;
-        if(CheckCriticalBlock(block))
+        if(CheckCriticalBlock(change.header))
             blockReward = g_nCriticalReward;
         else
         {
@@ -8904,42 +8668,72 @@ bool LoadChangeInfoToList()
                 blockReward = GetBlockSubsidy(pindex->pprev->nBits, pindex->pprev->nHeight, Params().GetConsensus());
         }
 
-        g_listChangeInfo.push_back(CChangeInfo(pindex->nHeight, g_nLastCandyHeight, blockReward, bExistCandy, mapAddressAmount));
+        CChangeInfo changeInfo(nHeight, nLastCandyHeight, blockReward, change.fCandy, std::move(change.vAddressAmount));
+        if(!fnChangeInfo(changeInfo))
+        {
+            fRet = false;
+            break;
+        }
 
-        if(bExistCandy)
-            g_nLastCandyHeight = pindex->nHeight;
+        if(change.fCandy)
+            nLastCandyHeight = nHeight;
     }
 
-    fclose(pFile);
+    replay.Stop();
+    threadGroup.join_all();
+    return fRet;
+}
+
+/** Hand a replayed block to ThreadWriteChangeInfo(), which already runs and drains the queue */
+static bool QueueReplayedChangeInfo(CChangeInfo& changeInfo, const int nStartHeight, const int nEndHeight, int& nReportDone)
+{
+    const int nHeight = changeInfo.nHeight;
+    g_queueChangeInfo.WaitForSpace(1);
+    if(changeInfo.fCandy)
+        g_nLastCandyHeight = nHeight;
+    g_queueChangeInfo.Push(std::move(changeInfo));
+
+    int nDone = (int)((nHeight - nStartHeight + 1) * 100LL / (nEndHeight - nStartHeight + 1));
+    if(nDone != nReportDone)
+    {
+        uiInterface.ShowProgress(_("Loading candy change info..."), nDone);
+        nReportDone = nDone;
+    }
     return true;
 }
 
-static bool PutChangeInfoToList(const int& nHeight, const CAmount& nReward, const bool fCandy, const map<string, CAmount>& mapAddressAmount)
+bool LoadChangeInfoToList()
 {
-    if (nHeight < g_nCriticalHeight)
+    const int nStartHeight = g_nDetailFileHeight + 1;
+    const int nEndHeight = chainActive.Height();
+    if(nStartHeight > nEndHeight)
         return true;
 
-    std::lock_guard<std::mutex> lock(g_mutexChangeInfo);
+    const int nThreads = std::max(1, nScriptCheckThreads);
+    LogPrintf("%s: replaying blocks %d to %d with %d threads...\n", __func__, nStartHeight, nEndHeight, nThreads);
+    uiInterface.InitMessage(_("Loading candy change info..."));
+    int64_t nStart = GetTimeMillis();
+
+    int nReportDone = -1;
+    bool fRet = ReplayChangeInfo(nStartHeight, nEndHeight, nThreads, g_nLastCandyHeight,
+                                 boost::bind(&QueueReplayedChangeInfo, _1, nStartHeight, nEndHeight, boost::ref(nReportDone)));
+    uiInterface.ShowProgress("", 100);
+
+    LogPrintf("%s: replayed %d blocks in %dms\n", __func__, nEndHeight - nStartHeight + 1, GetTimeMillis() - nStart);
+    return fRet;
+}
 
-    if(!g_listChangeInfo.empty() && (nHeight < g_listChangeInfo.front().nHeight))
+static bool PutChangeInfoToList(const int& nHeight, const CAmount& nReward, const bool fCandy, std::vector<CAddressAmount>&& vAddressAmount)
+{
+    if (nHeight < g_nCriticalHeight)
         return true;
 
-    bool fExist = false;
-    list<CChangeInfo>::iterator it = g_listChangeInfo.begin();
-    for(; it != g_listChangeInfo.end(); it++)
-    {
-        if(it->nHeight == nHeight)
-        {
-            fExist = true;
-            break;
-        }
-    }
+    // ActivateBestChain() makes room before taking cs_main, this only waits if blocks are connected another way
+    g_queueChangeInfo.WaitForSpace(1);
 
-    if(fExist)
-    {
-        while(it != g_listChangeInfo.end())
-            it = g_listChangeInfo.erase(it);
-    }
+    // a reorg replaces the queued blocks from nHeight on
+    if(!g_queueChangeInfo.Truncate(nHeight))
+        return true;
 
     string strFile = GetDataDir().string() + "/height/detail.dat";
     FILE* pFile = fopen(strFile.data(), "ab+");
@@ -9010,7 +8804,7 @@ static bool PutChangeInfoToList(const int& nHeight, const CAmount& nReward, cons
         return true;
     }
 
-    g_listChangeInfo.push_back(CChangeInfo(nHeight, g_nLastCandyHeight, nReward, fCandy, mapAddressAmount));
+    g_queueChangeInfo.Push(CChangeInfo(nHeight, g_nLastCandyHeight, nReward, fCandy, std::move(vAddressAmount)));
 
     if(fCandy)
         g_nLastCandyHeight = nHeight;
@@ -9018,48 +8812,16 @@ static bool PutChangeInfoToList(const int& nHeight, const CAmount& nReward, cons
     return true;
 }
 
-static bool GetChangeInfoFromList(CChangeInfo& changeInfo)
+/** Flush the delta log and detail.dat to disk */
+static bool SyncChangeInfo()
 {
-    if(GetChangeInfoListSize() < g_nListChangeInfoLimited)
-        return false;
+    std::lock_guard<std::mutex> lock(g_mutexChangeFile);
 
-    std::lock_guard<std::mutex> lock(g_mutexChangeInfo);
-    changeInfo = g_listChangeInfo.front();
-    g_listChangeInfo.pop_front();
+    if(!candybalancedb.Sync())
+        return error("%s: sync delta log and detail.dat failed", __func__);
     return true;
 }
 
-static void DeleteFilesToHeight(const int& nHeight)
-{
-    if(nHeight < 0)
-        return;
-
-    boost::filesystem::path heightDir = GetDataDir() / "height";
-    if(!boost::filesystem::exists(heightDir) || !boost::filesystem::is_directory(heightDir))
-        return;
-
-    string strFileName = "";
-    boost::filesystem::directory_iterator end_iter;
-    for(boost::filesystem::directory_iterator iter(heightDir); iter != end_iter; ++iter)
-    {
-        boost::this_thread::interruption_point();
-
-        if(!boost::filesystem::is_regular_file(iter->status()))
-            continue;
-
-        strFileName = iter->path().filename().string();
-
-        int nTempHeight = atoi(strFileName);
-        if(nTempHeight == 0 && (strFileName[0] > '9' || strFileName[0] < '0'))
-            continue;
-
-        if(nTempHeight >= nHeight)
-            continue;
-
-        boost::filesystem::remove(iter->path());
-    }
-}
-
 static bool WriteChangeInfo(const CChangeInfo& changeInfo)
 {
     if(changeInfo.nHeight <= 0 || changeInfo.nReward <= 0)
@@ -9071,77 +8833,56 @@ static bool WriteChangeInfo(const CChangeInfo& changeInfo)
 
     static int nStep = 0;
 
-    // 1. write all.dat
+    // 1. append address amount to delta log, all.dat and change file are compacted from it
     if(nStep == 0)
     {
-        string strAllFile = heightDir.string() + "/all.dat";
-        try {
-            if(!WriteChangeFile(strAllFile, changeInfo.mapAddressAmount))
-                return error("%s: write all.dat at %d failed", __func__, changeInfo.nHeight);
-        } catch (const boost::filesystem::filesystem_error& e) {
-            return error("%s: write all.dat at %d throw exception", __func__, changeInfo.nHeight);
-        }
+        if(!candybalancedb.AppendBlock(changeInfo))
+            return error("%s: append address amount at %d failed", __func__, changeInfo.nHeight);
         nStep = 1;
     }
 
-    // 2. write change file
+    // 2. write detail.dat
     if(nStep == 1)
     {
-        if(changeInfo.nLastCandyHeight > 0)
+        string strDetailFile = heightDir.string() + "/detail.dat";
+
+        static std::vector<CCandyAddressKey> vFilterKey;
+        if(vFilterKey.empty())
         {
-            string strChangeFile = heightDir.string() + "/" + itostr(changeInfo.nLastCandyHeight) + ".change";
-            if(changeInfo.nHeight == changeInfo.nLastCandyHeight + 1)
+            const std::string vFilterAddress[] = {g_strCancelledMoneroCandyAddress, g_strCancelledSafeAddress, g_strCancelledAssetAddress, g_strPutCandyAddress};
+            for(const std::string& strFilterAddress : vFilterAddress)
             {
-                FILE* pChangeFile = fopen(strChangeFile.data(), "ab+");
-                if(!pChangeFile)
-                    return error("%s: create empty change file %s at %d failed", strChangeFile, changeInfo.nHeight);
-                fclose(pChangeFile);
-            }
-            try {
-                if(!WriteChangeFile(strChangeFile, changeInfo.mapAddressAmount))
-                    return error("%s: write changed address amount in block %d to %s failed", __func__, changeInfo.nHeight, strChangeFile);
-            } catch (const boost::filesystem::filesystem_error& e) {
-                return error("%s: write changed address amount in block %d to %s throw exception", __func__, changeInfo.nHeight, strChangeFile);
+                CCandyAddressKey key;
+                if(key.SetString(strFilterAddress))
+                    vFilterKey.push_back(key);
             }
         }
-        nStep = 2;
-    }
-
-    // 3. write detail.dat
-    if(nStep == 2)
-    {
-        string strDetailFile = heightDir.string() + "/detail.dat";
 
         CAmount nFilterAmount = 0;
-        map<string, CAmount>::const_iterator it1 = changeInfo.mapAddressAmount.find(g_strCancelledMoneroCandyAddress);
-        if(it1 != changeInfo.mapAddressAmount.end())
-            nFilterAmount += it1->second;
-        map<string, CAmount>::const_iterator it2 = changeInfo.mapAddressAmount.find(g_strCancelledSafeAddress);
-        if(it2 != changeInfo.mapAddressAmount.end())
-            nFilterAmount += it2->second;
-        map<string, CAmount>::const_iterator it3 = changeInfo.mapAddressAmount.find(g_strCancelledAssetAddress);
-        if(it3 != changeInfo.mapAddressAmount.end())
-            nFilterAmount += it3->second;
-        map<string, CAmount>::const_iterator it4 = changeInfo.mapAddressAmount.find(g_strPutCandyAddress);
-        if(it4 != changeInfo.mapAddressAmount.end())
-            nFilterAmount += it4->second;
+        for(const CCandyAddressKey& key : vFilterKey)
+        {
+            std::vector<CAddressAmount>::const_iterator it = std::lower_bound(changeInfo.vAddressAmount.begin(), changeInfo.vAddressAmount.end(), CAddressAmount(key, 0));
+            if(it != changeInfo.vAddressAmount.end() && it->key == key)
+                nFilterAmount += it->nAmount;
+        }
 
         CBlockDetail detail(changeInfo.nHeight, changeInfo.nLastCandyHeight, changeInfo.nReward, nFilterAmount, changeInfo.fCandy);
         if(!WriteDetailFile(strDetailFile, detail))
             return error("%s: write %d to detail.dat failed", __func__, changeInfo.nHeight);
-        nStep = 3;
+        candybalancedb.SetDetailHeight(changeInfo.nHeight);
+        nStep = 2;
     }
 
-    // 4. write candy information
-    if(nStep == 3)
+    // 3. write candy information
+    if(nStep == 2)
     {
         if(changeInfo.fCandy && !PutCandyHeightToList(changeInfo.nHeight))
             return error("%s: put candy height %d to list failed", __func__, changeInfo.nHeight);
-        nStep = 4;
+        nStep = 3;
     }
 
-    // 5. remove change file before 3 month
-    if(nStep == 4)
+    // 4. remove change file before 3 month
+    if(nStep == 3)
     {
         int nEndHeight = 0;
         if (changeInfo.nHeight >= g_nStartSPOSHeight)
@@ -9159,7 +8900,7 @@ static bool WriteChangeInfo(const CChangeInfo& changeInfo)
         }
         if(nEndHeight >= changeInfo.nLastCandyHeight)
             nEndHeight = changeInfo.nLastCandyHeight;
-        DeleteFilesToHeight(nEndHeight);
+        candybalancedb.RemoveChangeBefore(nEndHeight);
     }
 
     nStep = 0;
@@ -9171,239 +8912,50 @@ void ThreadWriteChangeInfo()
 	SetThreadPriority(THREAD_PRIORITY_NORMAL);
 	RenameThread("safe-change");
 
+	// with -changesyncblocks every batch of blocks is flushed to disk with one fsync
+	const int nSyncBlocks = std::max(0, (int)GetArg("-changesyncblocks", DEFAULT_CHANGE_SYNC_BLOCKS));
+
+	std::vector<CChangeInfo> vChangeInfo;
 	while (true)
 	{
-		boost::this_thread::interruption_point();
-		CChangeInfo changeInfo;
-		if (GetChangeInfoFromList(changeInfo))
+		vChangeInfo.clear();
+		g_queueChangeInfo.PopForWriting(vChangeInfo, nSyncBlocks);
+
+		for (const CChangeInfo& changeInfo : vChangeInfo)
 		{
 			while (true)
 			{
 				boost::this_thread::interruption_point();
-				if (WriteChangeInfo(changeInfo))
-					break;
+				try {
+					if (WriteChangeInfo(changeInfo))
+						break;
+				} catch (const std::runtime_error& e) {
+					AbortNode(std::string("System error while writing change info: ") + e.what());
+					return;
+				}
+				// a retry cannot repair the delta log, it is recovered on the next start
+				if (candybalancedb.IsFailed())
+				{
+					AbortNode("Failed to write the candy balance delta log");
+					return;
+				}
 				MilliSleep(100);
 			}
 		}
-		else
-			MilliSleep(10);
-	}
-}
-
-void resetNumA(std::string numAStr)
-{
-    memset(numA, 0, M * sizeof(int));
-
-    for (uint32_t i = 0; i < numAStr.length(); i++)
-        numA[i] = numAStr[numAStr.length() - i - 1] - '0';
-}
-
-void resetNumB(std::string numBStr)
-{
-    memset(numB, 0, M * sizeof(int));
-
-    for (uint32_t i = 0; i < numBStr.length(); i++)
-        numB[i] = numBStr[numBStr.length()-i-1] - '0';
-}
-
-std::string getNumString(int* num)
-{
-    std::string numString = "";
-    bool isBegin = false;
-    for (int i = M - 1; i >= 0 ; i--)
-    {
-        if(num[i] != 0)
-            isBegin = true;
-
-        if (isBegin)
-            numString += num[i] + '0';
-    }
-    return numString;
-}
-
-int comparestring(std::string numAStr, std::string numBStr)
-{
-    if (numAStr.length() > numBStr.length())
-        return 1;
-    else if (numAStr.length() < numBStr.length())
-        return -1;
-    else
-    {
-        for (uint32_t i = 0; i < numAStr.length(); i++)
-        {
-            if (numAStr[i]>numBStr[i])
-                return 1;
-
-            if (numAStr[i]<numBStr[i])
-                return -1;
-        }
-
-        return 0;
-    }
-}
-
-int compareFloatString(const std::string& numAStr,const std::string& numBStr,bool fOnlyCompareInt)
-{
-    int posA = numAStr.find('.');
-    int posB = numBStr.find('.');
-
-    string posAIntStr = numAStr;
-    if(posA>0)
-        posAIntStr = numAStr.substr(0,posA);
-
-    string posBIntStr = numBStr;
-    if(posB>0)
-        posBIntStr = numBStr.substr(0,posB);
-
-    if(fOnlyCompareInt)
-        return comparestring(posAIntStr,posBIntStr);
-
-    string posAFloatStr = "0",posBFloatStr="0";
-    if(posA>0)
-    {
-        bool skipFirstZero = true;
-        for(unsigned int i=posA+1;i<numAStr.size();i++)
-        {
-            if(skipFirstZero&&numAStr[i]=='0')
-                continue;
-            if(skipFirstZero)
-            {
-                skipFirstZero = false;
-                posAFloatStr.clear();
-            }
-            posAFloatStr.push_back(numAStr[i]);
-        }
-    }
-    if(posB>0)
-    {
-        bool skipFirstZero = true;
-        for(unsigned int i=posB+1;i<numBStr.size();i++)
-        {
-            if(skipFirstZero&&numBStr[i]=='0')
-                continue;
-            if(skipFirstZero)
-            {
-                skipFirstZero = false;
-                posBFloatStr.clear();
-            }
-            posBFloatStr.push_back(numBStr[i]);
-        }
-    }
-    int aFloatSize = numAStr.size()-posA-1;
-    int bFloatSize = numBStr.size()-posB-1;
-    int size = std::abs(aFloatSize-bFloatSize);
-    for(int i=0;i<size;i++)
-    {
-        if(aFloatSize<bFloatSize)
-            posAFloatStr.push_back('0');
-        else
-            posBFloatStr.push_back('0');
-    }
-    return comparestring(posAFloatStr,posBFloatStr);
-}
-
-std::string plusstring(std::string numAStr, std::string numBStr)
-{
-    resetNumA(numAStr);
-    resetNumB(numBStr);
-
-    for (int i = 0; i < M; i++)
-    {
-        numA[i] += numB[i];
-
-        if(numA[i] > 9)
-        {
-            numA[i] -= 10;
-            numA[i+1]++;
-        }
-    }
-
-    return getNumString(numA);
-}
-
-std::string minusstring(std::string numAStr, std::string numBStr)
-{
-    bool isNegative = false;
-
-    if (comparestring(numAStr,numBStr)==-1)
-    {
-        isNegative = true;
-        string temp = numAStr;
-        numAStr = numBStr;
-        numBStr = temp;
-    }
-    else if (comparestring(numAStr,numBStr)==0)
-        return "0";
-
-    resetNumA(numAStr);
-    resetNumB(numBStr);
-
-    for (int i = 0; i < M; i++)
-    {
-        if (numA[i]<numB[i])
-        {
-            numA[i] = numA[i]+10-numB[i];
-            numA[i+1]--;
-        }
-        else
-            numA[i] -= numB[i];
-    }
-
-    if (isNegative)
-        return "-"+  getNumString(numA);
-    else
-        return getNumString(numA);
-}
-
-std::string mulstring(std::string numAStr, std::string numBStr)
-{
-    resetNumA(numAStr);
-    resetNumB(numBStr);
-
-    vector<string> vnums;
-    for (uint32_t i = 0; i < numBStr.length(); i++)
-    {
-        int tempnum[M];
-        memset(tempnum, 0, M * sizeof(int));
-
-        for (uint32_t j = i; j < numAStr.length() + i; j++)
-        {
-            tempnum[j] += numA[j - i] * numB[i] % 10;
-            tempnum[j + 1] = numA[j - i] * numB[i] /10;
-            if (tempnum[j] > 9)
-            {
-                tempnum[j] -= 10;
-                tempnum[j + 1]++;
-            }
-        }
-
-        vnums.push_back(getNumString(tempnum));
-    }
-
-    string strresult = vnums[0];
-    for (uint32_t i = 1; i < vnums.size(); i++)
-        strresult = plusstring(strresult, vnums[i]);
-
-    return strresult;
-}
-
-std::string numtofloatstring(std::string numstr, int32_t Decimals)
-{
-    if (numstr.empty())
-        return "";
 
-    int32_t istrlength = numstr.length();
-    if (istrlength <= Decimals)
-    {
-        return "";
-    }
-
-    std::string strlastfloat = "";
-    std::string strnumber = numstr.substr(0, numstr.length() - Decimals);
-    std::string strfloat = numstr.substr(numstr.length() - Decimals);
-    strlastfloat = strnumber + "." + strfloat;
+		if (nSyncBlocks > 0)
+		{
+			while (true)
+			{
+				boost::this_thread::interruption_point();
+				if (SyncChangeInfo())
+					break;
+				MilliSleep(100);
+			}
+		}
 
-    return strlastfloat;
+		g_queueChangeInfo.FinishWriting(vChangeInfo.size(), nSyncBlocks > 0);
+	}
 }
 
 bool VerifyDetailFile()
@@ -9421,31 +8973,34 @@ bool VerifyDetailFile()
     }
 
     string strFile = heightDir.string() + "/detail.dat";
-    FILE* pFile = fopen(strFile.data(), "ab+");
+    FILE* pFile = fopen(strFile.data(), "ab");
     if(!pFile)
         return error("%s: open detail.dat failed", __func__);
+    fclose(pFile);
 
-    if(fseek(pFile, 0L, SEEK_SET))
-    {
-        fclose(pFile);
-        return error("%s: fseek detail.dat failed", __func__);
+    // a single pass over a read-only mapping, detail.dat has a record for every block since g_nCriticalHeight
+    boost::interprocess::file_mapping mapping;
+    boost::interprocess::mapped_region region;
+    size_t nCount = 0;
+    try {
+        nCount = boost::filesystem::file_size(strFile) / sizeof(CBlockDetail);
+        if(nCount > 0)
+        {
+            boost::interprocess::file_mapping(strFile.c_str(), boost::interprocess::read_only).swap(mapping);
+            boost::interprocess::mapped_region(mapping, boost::interprocess::read_only, 0, nCount * sizeof(CBlockDetail)).swap(region);
+        }
+    } catch (const boost::interprocess::interprocess_exception& e) {
+        return error("%s: map detail.dat failed: %s", __func__, e.what());
+    } catch (const boost::filesystem::filesystem_error& e) {
+        return error("%s: %s", __func__, e.what());
     }
 
-    CBlockDetail detail;
+    const CBlockDetail* pDetail = static_cast<const CBlockDetail*>(region.get_address());
     int nHeight = g_nCriticalHeight;
-    while(true)
+    for(size_t i = 0; i < nCount; i++, nHeight++)
     {
-        if(fread(&detail, sizeof(CBlockDetail), 1, pFile) != 1)
-        {
-            if(feof(pFile))
-                break;
-            fclose(pFile);
-            return error("%s: read detail.dat failed", __func__);
-        }
-
-        if(detail.nHeight != nHeight)
+        if(pDetail[i].nHeight != nHeight)
         {
-            fclose(pFile);
             uiInterface.ThreadSafeQuestion(
                 _("detail.dat is corrupted, please restart with -reindex=1 or set reindex=1 in safe.conf if you want to repaire it."),
                 "detail.dat is corrupted, please restart with -reindex=1 or set reindex=1 in safe.conf if you want to repaire it.",
@@ -9453,11 +9008,15 @@ bool VerifyDetailFile()
                 CClientUIInterface::MSG_ERROR);
             return false;
         }
-
-        nHeight++;
     }
 
-    fclose(pFile);
+    CBlockDetail lastDetail;
+    if(nCount > 0)
+        lastDetail = pDetail[nCount - 1];
+
+    g_nDetailFileHeight = nHeight - 1;
+    if(g_nDetailFileHeight >= g_nCriticalHeight)
+        g_nLastCandyHeight = lastDetail.fCandy ? lastDetail.nHeight : lastDetail.nLastCandyHeight;
     return true;
 }
 
@@ -9515,14 +9074,10 @@ bool CompareDBGetCandyPutCandyTotal(std::map<CPutCandy_IndexKey, CAmount> &mapAs
 }
 
 
-void GetAllPayeeInfoMap(std::map<std::string,CMasternodePayee_IndexValue>& mapAllPayeeInfo)
+const std::map<std::string,CMasternodePayee_IndexValue>& GetAllPayeeInfoMap()
 {
-    std::lock_guard<std::mutex> lock(g_mutexAllPayeeInfo);
-
-    for (auto& Payeepair : gAllPayeeInfoMap)
-    {
-        mapAllPayeeInfo[Payeepair.first] = Payeepair.second;
-    }
+    AssertLockHeld(cs_main);
+    return gAllPayeeInfoMap;
 }
 
 void CalculateIncreaseMasternode(int& nRemainNum,int& nIncrease,unsigned int vecSize,unsigned int nPercentCnt)
@@ -9538,29 +9093,45 @@ void CalculateIncreaseMasternode(int& nRemainNum,int& nIncrease,unsigned int vec
     }
 }
 
-void SortMasternodeByScore(std::map<COutPoint, CMasternode> &mapMasternodes, std::vector<CMasternode>& vecResultMasternodes,uint32_t nScoreTime,
-                           std::string strArrName,std::map<std::string,CMasternodePayee_IndexValue>& mapAllPayeeInfo)
+// Compact record the selection sorts and shuffles instead of whole masternodes
+struct CMasternodeScore
+{
+    uint256 score;
+    COutPoint outpoint;
+    CKeyID keyIDCollateral;
+    const CMasternode* pmn;
+
+    CMasternodeScore(const COutPoint& outpointIn, const CMasternode& mn)
+        : outpoint(outpointIn), keyIDCollateral(mn.pubKeyCollateralAddress.GetID()), pmn(&mn) {}
+
+    bool operator<(const CMasternodeScore& other) const { return score < other.score; }
+    bool operator==(const CMasternodeScore& other) const { return score == other.score; }
+};
+
+// vecScores comes in collateral outpoint order and goes out shuffled, one record per score
+static void SortMasternodeByScore(std::vector<CMasternodeScore>& vecScores,uint32_t nScoreTime,
+                           std::string strArrName,const std::map<std::string,CMasternodePayee_IndexValue>& mapAllPayeeInfo)
 {
     //sort by score
-    std::map<uint256, CMasternode> scoreMasternodes;
-    for (std::map<COutPoint, CMasternode>::const_reverse_iterator mnpair = mapMasternodes.rbegin(); mnpair != mapMasternodes.rend(); ++mnpair)
+    for (CMasternodeScore& mnscore : vecScores)
     {
-        const CMasternode& mn = (*mnpair).second;
-
-        uint256 hash = mn.pubKeyCollateralAddress.GetHash();
+        uint256 hash = mnscore.pmn->pubKeyCollateralAddress.GetHash();
         CHashWriter ss(SER_GETHASH, PROTOCOL_VERSION);
         ss << hash;
         ss << nScoreTime;
-        uint256 score = ss.GetHash();
-        scoreMasternodes[score] = mn;
+        mnscore.score = ss.GetHash();
     }
+    // the first outpoint of a score wins, as it did with the score map
+    std::stable_sort(vecScores.begin(), vecScores.end());
+    vecScores.erase(std::unique(vecScores.begin(), vecScores.end()), vecScores.end());
 
     int logErrorCnt = 0, logNormalCnt = 0;
-    LogPrintf("SPOS_Message:%s(size:%d) after sort:\n",strArrName,scoreMasternodes.size());
-    for (auto& mnpair : scoreMasternodes)
+    LogPrintf("SPOS_Message:%s(size:%d) after sort:\n",strArrName,vecScores.size());
+    for (const CMasternodeScore& mnscore : vecScores)
     {
-        std::string strPubKeyCollateralAddress = mnpair.second.pubKeyCollateralAddress.GetID().ToString();
-        std::map<std::string,CMasternodePayee_IndexValue>::iterator tempit = mapAllPayeeInfo.find(strPubKeyCollateralAddress);
+        const CMasternode& mn = *mnscore.pmn;
+        std::string strPubKeyCollateralAddress = mnscore.keyIDCollateral.ToString();
+        std::map<std::string,CMasternodePayee_IndexValue>::const_iterator tempit = mapAllPayeeInfo.find(strPubKeyCollateralAddress);
         logErrorCnt++;
         logNormalCnt++;
         if (tempit == mapAllPayeeInfo.end())
@@ -9568,39 +9139,33 @@ void SortMasternodeByScore(std::map<COutPoint, CMasternode> &mapMasternodes, std
             if(logErrorCnt<=g_nLogMaxCnt)
             {
                 LogPrintf("SPOS_Error:SortMasternodeByScore,payee not found,ip:%s,strPubKeyCollateralAddress:%s\n",
-                      mnpair.second.addr.ToStringIP(),strPubKeyCollateralAddress);
+                      mn.addr.ToStringIP(),strPubKeyCollateralAddress);
             }else
             {
                 LogPrint("sposinfo","SPOS_Error:extra SortMasternodeByScore,payee not found,ip:%s,strPubKeyCollateralAddress:%s\n",
-                      mnpair.second.addr.ToStringIP(),strPubKeyCollateralAddress);
+                      mn.addr.ToStringIP(),strPubKeyCollateralAddress);
             }
         }else
         {
             if(logNormalCnt<=g_nLogMaxCnt)
             {
                 LogPrintf("SPOS_Info:%s[%d]:ip:%s,collateralAddress:%s,nScoreTime:%d,nPayeeBlockTime:%d,nPayeeTimes:%d,"
-                          "lastHeight:%d,nState:%d\n",strArrName,logErrorCnt-1,mnpair.second.addr.ToStringIP(),strPubKeyCollateralAddress,
+                          "lastHeight:%d,nState:%d\n",strArrName,logErrorCnt-1,mn.addr.ToStringIP(),strPubKeyCollateralAddress,
                           nScoreTime,tempit->second.blockTime,tempit->second.nPayeeTimes,tempit->second.nHeight,
-                          mnpair.second.nActiveState);
+                          mn.nActiveState);
             }else
             {
                 LogPrint("sposinfo","SPOS_Info:extra %s[%d]:ip:%s,collateralAddress:%s,nScoreTime:%d,nPayeeBlockTime:%d,nPayeeTimes:%d,"
-                                    "lastHeight:%d,nState:%d\n",strArrName,logErrorCnt-1,mnpair.second.addr.ToStringIP(),strPubKeyCollateralAddress,
+                                    "lastHeight:%d,nState:%d\n",strArrName,logErrorCnt-1,mn.addr.ToStringIP(),strPubKeyCollateralAddress,
                                     nScoreTime,tempit->second.blockTime,tempit->second.nPayeeTimes,tempit->second.nHeight,
-                                    mnpair.second.nActiveState);
+                                    mn.nActiveState);
             }
         }
     }
 
-    for (auto& mnpair : scoreMasternodes)
-    {
-        CMasternode& mn = mnpair.second;
-        vecResultMasternodes.push_back(mn);
-    }
-
     //random the master node
     uint64_t now_hi = uint64_t(nScoreTime) << 32;
-    for( uint32_t i = 0; i < vecResultMasternodes.size(); ++i )
+    for( uint32_t i = 0; i < vecScores.size(); ++i )
     {
         /// High performance random generator
         /// http://xorshift.di.unimi.it/
@@ -9610,23 +9175,29 @@ void SortMasternodeByScore(std::map<COutPoint, CMasternode> &mapMasternodes, std
         k ^= (k >> 27);
         k *= 2685821657736338717ULL;
 
-        uint32_t jmax = vecResultMasternodes.size() - i;
+        uint32_t jmax = vecScores.size() - i;
         uint32_t j = i + k%jmax;
-        std::swap(vecResultMasternodes[i], vecResultMasternodes[j]);
+        std::swap(vecScores[i], vecScores[j]);
     }
 }
 
+std::shared_ptr<const std::vector<CMasternode> > GetResultMasternodes()
+{
+    LOCK(cs_spos);
+    return g_pResultMasternodes;
+}
+
 void UpdateMasternodeGlobalData(const std::vector<CMasternode>& tmpVecMasternodes,bool bClearVec,int selectMasterNodeRet,int nSposGeneratedIndex
                           ,int64_t nStartNewLoopTime)
 {
-    LOCK(cs_spos);
+    // readers keep the snapshot they took, so build the new one outside the lock
+    std::shared_ptr<const std::vector<CMasternode> > pResultMasternodes;
     if(bClearVec||!tmpVecMasternodes.empty())
-    {
-        g_vecResultMasternodes.clear();
-        std::vector<CMasternode>().swap(g_vecResultMasternodes);
-        for(auto& mn:tmpVecMasternodes)
-            g_vecResultMasternodes.push_back(mn);
-    }
+        pResultMasternodes = std::make_shared<const std::vector<CMasternode> >(tmpVecMasternodes);
+
+    LOCK(cs_spos);
+    if(pResultMasternodes)
+        g_pResultMasternodes.swap(pResultMasternodes);
     if(selectMasterNodeRet!=g_nSelectGlobalDefaultValue)
         g_nSelectMasterNodeRet = selectMasterNodeRet;
     if(nSposGeneratedIndex!=g_nSelectGlobalDefaultValue)
@@ -9659,7 +9230,7 @@ void SelectMasterNodeByPayee(int nCurrBlockHeight, uint32_t nTime,uint32_t nScor
                                    ,bool& bClearVec,int& nSelectMasterNodeRet,int& nSposGeneratedIndex,int64_t& nStartNewLoopTime,bool fTimeoutReselect,const unsigned int& nMasternodeSPosCount, 
                                    SPORK_SELECT_LOOP nSporkSelectLoop, bool fRemoveOfficialMasternode)
 {
-    if(!masternodeSync.IsSynced()&&g_vecResultMasternodes.empty())
+    if(!masternodeSync.IsSynced()&&GetResultMasternodes()->empty())
         return;
 
     if (!bProcessSpork)
@@ -9704,11 +9275,12 @@ void SelectMasterNodeByPayee(int nCurrBlockHeight, uint32_t nTime,uint32_t nScor
     LogPrintf("SPOS_Info:--------------------------------------------------------\n");
     LogPrintf("SPOS_Message:start select masternode,nCurrHeight:%d,fTimeoutReselect:%s,g_nTimeoutCount:%d.\n",nCurrBlockHeight,
               fTimeoutReselect?"true":"false",g_nTimeoutCount);
+    // the payee table only changes with the chain, so read it in place under cs_main
+    LOCK(cs_main);
     std::map<COutPoint, CMasternode> mapMeetedMasternodes;
     bool fFilterSpent = true;
-    std::map<std::string,CMasternodePayee_IndexValue> mapAllPayeeInfo;
+    const std::map<std::string,CMasternodePayee_IndexValue>& mapAllPayeeInfo = GetAllPayeeInfoMap();
     int nFullMasternodeSize = mnodeman.size();
-    GetAllPayeeInfoMap(mapAllPayeeInfo);
     if (bSpork)
     {
         LogPrintf("SPOS_Message:Spork message select official master node\n");
@@ -9748,7 +9320,7 @@ void SelectMasterNodeByPayee(int nCurrBlockHeight, uint32_t nTime,uint32_t nScor
         }
     }
 
-    if(!g_vecResultMasternodes.empty()){
+    if(!GetResultMasternodes()->empty()){
         bClearVec = true;
     }
 
@@ -9769,8 +9341,11 @@ void SelectMasterNodeByPayee(int nCurrBlockHeight, uint32_t nTime,uint32_t nScor
 
     if (nSporkSelectLoop==SPORK_SELECT_LOOP_1||nSporkSelectLoop==SPORK_SELECT_LOOP_OVER_TIMEOUT_LIMIT)
     {
-        std::vector<CMasternode> vecResultAllOfficialMasternodes;
-        SortMasternodeByScore(mapMeetedMasternodes, vecResultAllOfficialMasternodes, nScoreTime, "Official", mapAllPayeeInfo);
+        std::vector<CMasternodeScore> vecResultAllOfficialMasternodes;
+        vecResultAllOfficialMasternodes.reserve(mapMeetedMasternodes.size());
+        for (const auto& mnpair : mapMeetedMasternodes)
+            vecResultAllOfficialMasternodes.push_back(CMasternodeScore(mnpair.first, mnpair.second));
+        SortMasternodeByScore(vecResultAllOfficialMasternodes, nScoreTime, "Official", mapAllPayeeInfo);
         
         uint32_t nAllOfficialMasternodecount = vecResultAllOfficialMasternodes.size();
         for (uint32_t i = 0; i < nAllOfficialMasternodecount; ++i)
@@ -9778,10 +9353,10 @@ void SelectMasterNodeByPayee(int nCurrBlockHeight, uint32_t nTime,uint32_t nScor
             if (i == nMasternodeSPosCount)
                 break;
 
-            tmpVecResultMasternodes.push_back(vecResultAllOfficialMasternodes[i]);
-            const CMasternode& mn = vecResultAllOfficialMasternodes[i];
+            tmpVecResultMasternodes.push_back(*vecResultAllOfficialMasternodes[i].pmn);
+            const CMasternode& mn = tmpVecResultMasternodes.back();
 
-            std::map<std::string,CMasternodePayee_IndexValue>::iterator tempit = mapAllPayeeInfo.find(mn.pubKeyCollateralAddress.GetID().ToString());
+            std::map<std::string,CMasternodePayee_IndexValue>::const_iterator tempit = mapAllPayeeInfo.find(vecResultAllOfficialMasternodes[i].keyIDCollateral.ToString());
             if (tempit == mapAllPayeeInfo.end())
             {
                 LogPrintf("SPOS_Error:Official masterNodeIP[%d] not fount payeeinfo:%s(spos_select),keyid:%s,pingTime:%lld,sigTime:%lld,currHeight:%d\n",
@@ -9815,34 +9390,37 @@ void SelectMasterNodeByPayee(int nCurrBlockHeight, uint32_t nTime,uint32_t nScor
     unsigned int nMeetedMasternodeSize = mapMeetedMasternodes.size();
     unsigned int intervalHeight = nMeetedMasternodeSize / 2;
 
-    std::map<COutPoint, CMasternode> mapMasternodesL1,mapMasternodesL2,mapMasternodesL3;
+    // the levels point into mapMeetedMasternodes, only the selected masternodes get copied
+    std::vector<CMasternodeScore> vecResultMasternodesL1,vecResultMasternodesL2,vecResultMasternodesL3;
 
     std::map<COutPoint, CMasternode>::iterator it = mapMeetedMasternodes.begin();
     for (; it != mapMeetedMasternodes.end(); it++)
     {
-        const CMasternode& mn = it->second;
-        std::string strPubKeyCollateralAddress = mn.pubKeyCollateralAddress.GetID().ToString();
-        std::map<std::string,CMasternodePayee_IndexValue>::iterator tempit = mapAllPayeeInfo.find(strPubKeyCollateralAddress);
+        CMasternodeScore mnscore(it->first, it->second);
+        std::string strPubKeyCollateralAddress = mnscore.keyIDCollateral.ToString();
+        std::map<std::string,CMasternodePayee_IndexValue>::const_iterator tempit = mapAllPayeeInfo.find(strPubKeyCollateralAddress);
         if (tempit == mapAllPayeeInfo.end())
         {
             LogPrintf("SPOS_Error:payee not found,GetFullMasternodeData have already checked the payee,ip:%s,strPubKeyCollateralAddress:%s\n",
-                      mn.addr.ToStringIP(),strPubKeyCollateralAddress);
+                      it->second.addr.ToStringIP(),strPubKeyCollateralAddress);
         }else
         {
             uint32_t nIntervalHeight = nCurrBlockHeight - tempit->second.nHeight;
             if (nIntervalHeight <= intervalHeight)
-                mapMasternodesL1[it->first] = it->second;
+                vecResultMasternodesL1.push_back(mnscore);
             else if (nIntervalHeight > intervalHeight && nIntervalHeight <=  2 *intervalHeight)
-                mapMasternodesL2[it->first] = it->second;
+                vecResultMasternodesL2.push_back(mnscore);
             else
-                mapMasternodesL3[it->first] = it->second;
+                vecResultMasternodesL3.push_back(mnscore);
         }
     }
 
-    std::vector<CMasternode> vecResultMasternodesL1,vecResultMasternodesL2,vecResultMasternodesL3;
-    SortMasternodeByScore(mapMasternodesL1, vecResultMasternodesL1, nScoreTime, "L1", mapAllPayeeInfo);
-    SortMasternodeByScore(mapMasternodesL2, vecResultMasternodesL2, nScoreTime, "L2", mapAllPayeeInfo);
-    SortMasternodeByScore(mapMasternodesL3, vecResultMasternodesL3, nScoreTime, "L3", mapAllPayeeInfo);
+    unsigned int nMasternodesL1 = vecResultMasternodesL1.size();
+    unsigned int nMasternodesL2 = vecResultMasternodesL2.size();
+    unsigned int nMasternodesL3 = vecResultMasternodesL3.size();
+    SortMasternodeByScore(vecResultMasternodesL1, nScoreTime, "L1", mapAllPayeeInfo);
+    SortMasternodeByScore(vecResultMasternodesL2, nScoreTime, "L2", mapAllPayeeInfo);
+    SortMasternodeByScore(vecResultMasternodesL3, nScoreTime, "L3", mapAllPayeeInfo);
 
     //5
     unsigned int vec1Size = vecResultMasternodesL1.size();
@@ -9862,7 +9440,7 @@ void SelectMasterNodeByPayee(int nCurrBlockHeight, uint32_t nTime,uint32_t nScor
         LogPrintf("SPOS_Error:mnSize less than masternode min count,mnSize:%d,nSporkLoop1Size:%d,g_nMasternodeMinCount:%d,nFullMasternode:%d,nMeetedMasternode:%d,"
                   "payeeInfoCount:%d,nP1:%d,nP2:%d,nP3:%d,mapMasternodesL1:%d,mapMasternodesL2:%d,mapMasternodesL3:%d\n",
                   nMnSize,nSporkLoop1Size,g_nMasternodeMinCount,nFullMasternodeSize,nMeetedMasternodeSize,mapAllPayeeInfo.size(),nP1,nP2,nP3,
-                  mapMasternodesL1.size(),mapMasternodesL2.size(),mapMasternodesL3.size());
+                  nMasternodesL1,nMasternodesL2,nMasternodesL3);
         nSelectMasterNodeRet = g_nSelectMasterNodeFail;
         return;
     }
@@ -9883,19 +9461,19 @@ void SelectMasterNodeByPayee(int nCurrBlockHeight, uint32_t nTime,uint32_t nScor
     if(nP1Total>vec1Size)
         LogPrintf("SPOS_Error:nP1:%d,nP1Increase:%d,vec1Size:%d\n",nP1,nP1Increase,nP1Total);
     for (unsigned int i = 0; i < nP1Total && i < vec1Size; i++)
-        tmpVecResultMasternodes.push_back(vecResultMasternodesL1[i]);
+        tmpVecResultMasternodes.push_back(*vecResultMasternodesL1[i].pmn);
 
     unsigned int nP2Total = nP2+nP2Increase;
     if(nP2Total>vec2Size)
         LogPrintf("SPOS_Error:nP2:%d,nP2Increase:%d,vec2Size:%d\n",nP2,nP2Increase,nP2Total);
     for (unsigned int j = 0; j < nP2Total && j < vec2Size; j++)
-        tmpVecResultMasternodes.push_back(vecResultMasternodesL2[j]);
+        tmpVecResultMasternodes.push_back(*vecResultMasternodesL2[j].pmn);
 
     unsigned int nP3Total = nP3 + nP3Increase;
     if(nP3Total>vec3Size)
         LogPrintf("SPOS_Error:nP2:%d,nP2Increase:%d,vec2Size:%d\n",nP3,nP3Increase,nP3Total);
     for (unsigned int k = 0; k < nP3Total && k < vec3Size; k++)
-        tmpVecResultMasternodes.push_back(vecResultMasternodesL3[k]);
+        tmpVecResultMasternodes.push_back(*vecResultMasternodesL3[k].pmn);
 
     if (!bProcessSpork)
         g_nLastSelectMasterNodeHeight = nCurrBlockHeight;
@@ -9914,8 +9492,8 @@ void SelectMasterNodeByPayee(int nCurrBlockHeight, uint32_t nTime,uint32_t nScor
 
     LogPrintf("mnSize:%d,g_nMasternodeMinCount:%d,nFullMasternode:%d,nMeetedMasternode:%d,payeeInfoCount:%d,mapMasternodesL1:%d,mapMasternodesL2:%d,"
               "mapMasternodesL3:%d,nP1:%d(nP1Increase:%d),nP2:%d(nP2Increase:%d),nP3:%d(nP3Increase:%d),g_nTimeoutCount:%d,g_nPushForwardTime:%d\n"
-              ,nMnSize,g_nMasternodeMinCount,nFullMasternodeSize,nMeetedMasternodeSize,mapAllPayeeInfo.size(),mapMasternodesL1.size()
-              ,mapMasternodesL2.size(),mapMasternodesL3.size(),nP1,nP1Increase,nP2,nP2Increase,nP3,nP3Increase,g_nTimeoutCount,g_nPushForwardTime);
+              ,nMnSize,g_nMasternodeMinCount,nFullMasternodeSize,nMeetedMasternodeSize,mapAllPayeeInfo.size(),nMasternodesL1
+              ,nMasternodesL2,nMasternodesL3,nP1,nP1Increase,nP2,nP2Increase,nP3,nP3Increase,g_nTimeoutCount,g_nPushForwardTime);
     for( uint32_t i = 0; i < size; ++i )
     {
         string nPStr = "P3";
@@ -9926,7 +9504,7 @@ void SelectMasterNodeByPayee(int nCurrBlockHeight, uint32_t nTime,uint32_t nScor
         const CMasternode& mn = tmpVecResultMasternodes[i];
         if(i>=nSporkLoop1Size)
         {
-            std::map<std::string,CMasternodePayee_IndexValue>::iterator tempit = mapAllPayeeInfo.find(mn.pubKeyCollateralAddress.GetID().ToString());
+            std::map<std::string,CMasternodePayee_IndexValue>::const_iterator tempit = mapAllPayeeInfo.find(mn.pubKeyCollateralAddress.GetID().ToString());
             if (tempit == mapAllPayeeInfo.end())
             {
                 LogPrintf("SPOS_Error:General masterNodeIP[%d] not fount payeeinfo:%s(spos_select),keyid:%s,pingTime:%lld,sigTime:%lld,location:%s,currHeight:%d\n",
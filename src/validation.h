@@ -13,13 +13,17 @@
 #endif
 
 #include "amount.h"
+#include "assetamount.h"
+#include "candyaddress.h"
 #include "chain.h"
+#include "changequeue.h"
 #include "coins.h"
 #include "protocol.h" // For CMessageHeader::MessageStartChars
 #include "script/script_error.h"
 #include "sync.h"
 #include "versionbits.h"
 #include "spentindex.h"
+#include "appindex.h"
 #include "app/app.h"
 #include "masternode.h"
 
@@ -27,6 +31,7 @@
 #include <algorithm>
 #include <exception>
 #include <map>
+#include <memory>
 #include <set>
 #include <stdint.h>
 #include <string>
@@ -35,6 +40,7 @@
 
 #include <atomic>
 
+#include <boost/function.hpp>
 #include <boost/unordered_map.hpp>
 #include <boost/filesystem/path.hpp>
 
@@ -88,6 +94,8 @@ static const unsigned int UNDOFILE_CHUNK_SIZE = 0x100000; // 1 MiB
 static const int MAX_SCRIPTCHECK_THREADS = 16;
 /** -par default (number of script-checking threads, 0 = auto) */
 static const int DEFAULT_SCRIPTCHECK_THREADS = 0;
+/** -changesyncblocks default (blocks written to the change files per fsync, 0 = never fsync) */
+static const int DEFAULT_CHANGE_SYNC_BLOCKS = 0;
 /** Number of blocks that can be requested at any given time from a single peer. */
 static const int MAX_BLOCKS_IN_TRANSIT_PER_PEER = 16;
 /** Timeout in seconds during which a peer must stall block download progress before being disconnected. */
@@ -255,6 +263,8 @@ bool LoadBlockIndex();
 void UnloadBlockIndex();
 /** Run an instance of the script checking thread */
 void ThreadScriptCheck();
+/** Run an instance of the app and asset rules checking thread */
+void ThreadAppCheck();
 /** Check whether we are doing an initial block download (synchronizing from disk or network) */
 bool IsInitialBlockDownload();
 /** Format a string that describes several potential problems detected by the core.
@@ -408,15 +418,11 @@ struct CAuth_IndexKey
     }
 };
 
-struct CAppTx_IndexKey
+struct CIterator_IdKey
 {
-    uint256 appId;
-    std::string strAddress;
-    uint8_t nTxClass;
-    COutPoint out;
+    uint256 id;
 
-    CAppTx_IndexKey(const uint256& appId = uint256(), const std::string& strAddress = "", const uint8_t& nTxClass = 0, const COutPoint& out = COutPoint())
-        : appId(appId), strAddress(strAddress), nTxClass(nTxClass), out(out) {
+    CIterator_IdKey(const uint256& id = uint256())      : id(id) {
     }
 
     ADD_SERIALIZE_METHODS;
@@ -424,23 +430,16 @@ struct CAppTx_IndexKey
     template <typename Stream, typename Operation>
     inline void SerializationOp(Stream& s, Operation ser_action, int nType, int nVersion)
     {
-        READWRITE(appId);
-        READWRITE(LIMITED_STRING(strAddress, MAX_ADDRESS_SIZE));
-        READWRITE(nTxClass);
-        READWRITE(out);
-    }
-
-    friend bool operator==(const CAppTx_IndexKey& a, const CAppTx_IndexKey& b)
-    {
-        return (a.appId == b.appId && a.strAddress == b.strAddress && a.nTxClass == b.nTxClass && a.out == b.out);
+        READWRITE(id);
     }
 };
 
-struct CIterator_IdKey
+struct CIterator_IdAddressKey
 {
     uint256 id;
+    std::string strAddress;
 
-    CIterator_IdKey(const uint256& id = uint256())      : id(id) {
+    CIterator_IdAddressKey(const uint256& id = uint256(), const std::string& strAddress = "") : id(id), strAddress(strAddress) {
     }
 
     ADD_SERIALIZE_METHODS;
@@ -449,15 +448,18 @@ struct CIterator_IdKey
     inline void SerializationOp(Stream& s, Operation ser_action, int nType, int nVersion)
     {
         READWRITE(id);
+        READWRITE(LIMITED_STRING(strAddress, MAX_ADDRESS_SIZE));
     }
 };
 
-struct CIterator_IdAddressKey
+struct CAddressTx_IndexKey
 {
-    uint256 id;
     std::string strAddress;
+    uint256 id;
+    COutPoint out;
 
-    CIterator_IdAddressKey(const uint256& id = uint256(), const std::string& strAddress = "") : id(id), strAddress(strAddress) {
+    CAddressTx_IndexKey(const std::string& strAddress = "", const uint256& id = uint256(), const COutPoint& out = COutPoint())
+        : strAddress(strAddress), id(id), out(out) {
     }
 
     ADD_SERIALIZE_METHODS;
@@ -465,19 +467,17 @@ struct CIterator_IdAddressKey
     template <typename Stream, typename Operation>
     inline void SerializationOp(Stream& s, Operation ser_action, int nType, int nVersion)
     {
-        READWRITE(id);
         READWRITE(LIMITED_STRING(strAddress, MAX_ADDRESS_SIZE));
+        READWRITE(id);
+        READWRITE(out);
     }
 };
 
-struct CAssetId_AssetInfo_IndexValue
+struct CIterator_AddressKey
 {
-    std::string strAdminAddress;
-    CAssetData assetData;
-    int nHeight;
+    std::string strAddress;
 
-    CAssetId_AssetInfo_IndexValue(const std::string& strAdminAddress = "", const CAssetData& assetData = CAssetData(), const int& nHeight = 0)
-        : strAdminAddress(strAdminAddress), assetData(assetData), nHeight(nHeight) {
+    CIterator_AddressKey(const std::string& strAddress = "") : strAddress(strAddress) {
     }
 
     ADD_SERIALIZE_METHODS;
@@ -485,21 +485,18 @@ struct CAssetId_AssetInfo_IndexValue
     template <typename Stream, typename Operation>
     inline void SerializationOp(Stream& s, Operation ser_action, int nType, int nVersion)
     {
-        READWRITE(LIMITED_STRING(strAdminAddress, MAX_ADDRESS_SIZE));
-        READWRITE(assetData);
-        READWRITE(nHeight);
+        READWRITE(LIMITED_STRING(strAddress, MAX_ADDRESS_SIZE));
     }
 };
 
-struct CAssetTx_IndexKey
+struct CAssetId_AssetInfo_IndexValue
 {
-    uint256 assetId;
-    std::string strAddress;
-    uint8_t nTxClass;
-    COutPoint out;
+    std::string strAdminAddress;
+    CAssetData assetData;
+    int nHeight;
 
-    CAssetTx_IndexKey(const uint256& assetId = uint256(), const std::string& strAddress = "", const uint8_t& nTxClass = 0, const COutPoint& out = COutPoint())
-        : assetId(assetId), strAddress(strAddress), nTxClass(nTxClass), out(out) {
+    CAssetId_AssetInfo_IndexValue(const std::string& strAdminAddress = "", const CAssetData& assetData = CAssetData(), const int& nHeight = 0)
+        : strAdminAddress(strAdminAddress), assetData(assetData), nHeight(nHeight) {
     }
 
     ADD_SERIALIZE_METHODS;
@@ -507,15 +504,9 @@ struct CAssetTx_IndexKey
     template <typename Stream, typename Operation>
     inline void SerializationOp(Stream& s, Operation ser_action, int nType, int nVersion)
     {
-        READWRITE(assetId);
-        READWRITE(LIMITED_STRING(strAddress, MAX_ADDRESS_SIZE));
-        READWRITE(nTxClass);
-        READWRITE(out);
-    }
-
-    friend bool operator==(const CAssetTx_IndexKey& a, const CAssetTx_IndexKey& b)
-    {
-        return (a.assetId == b.assetId && a.strAddress == b.strAddress && a.nTxClass == b.nTxClass && a.out == b.out);
+        READWRITE(LIMITED_STRING(strAdminAddress, MAX_ADDRESS_SIZE));
+        READWRITE(assetData);
+        READWRITE(nHeight);
     }
 };
 
@@ -686,6 +677,149 @@ struct CGetCandyCount_IndexValue
     }
 };
 
+struct CAssetSupply_IndexValue
+{
+    CAmount nAddAmount;
+    CAmount nDestoryAmount;
+    CAmount nPutCandyAmount;
+
+    CAssetSupply_IndexValue(const CAmount& nAddAmount = 0, const CAmount& nDestoryAmount = 0, const CAmount& nPutCandyAmount = 0)
+        : nAddAmount(nAddAmount), nDestoryAmount(nDestoryAmount), nPutCandyAmount(nPutCandyAmount) {
+    }
+
+    ADD_SERIALIZE_METHODS;
+
+    template <typename Stream, typename Operation>
+    inline void SerializationOp(Stream& s, Operation ser_action, int nType, int nVersion)
+    {
+        READWRITE(nAddAmount);
+        READWRITE(nDestoryAmount);
+        READWRITE(nPutCandyAmount);
+    }
+
+    bool IsNull() const
+    {
+        return nAddAmount == 0 && nDestoryAmount == 0 && nPutCandyAmount == 0;
+    }
+
+    CAssetSupply_IndexValue& operator+=(const CAssetSupply_IndexValue& data)
+    {
+        nAddAmount += data.nAddAmount;
+        nDestoryAmount += data.nDestoryAmount;
+        nPutCandyAmount += data.nPutCandyAmount;
+        return *this;
+    }
+
+    CAssetSupply_IndexValue& operator-=(const CAssetSupply_IndexValue& data)
+    {
+        nAddAmount -= data.nAddAmount;
+        nDestoryAmount -= data.nDestoryAmount;
+        nPutCandyAmount -= data.nPutCandyAmount;
+        return *this;
+    }
+};
+
+struct CAssetBalance_IndexKey
+{
+    std::string strAddress;
+    uint256 assetId;
+
+    CAssetBalance_IndexKey(const std::string& strAddress = "", const uint256& assetId = uint256())
+        : strAddress(strAddress), assetId(assetId) {
+    }
+
+    ADD_SERIALIZE_METHODS;
+
+    template <typename Stream, typename Operation>
+    inline void SerializationOp(Stream& s, Operation ser_action, int nType, int nVersion)
+    {
+        READWRITE(strAddress);
+        READWRITE(assetId);
+    }
+
+    friend bool operator<(const CAssetBalance_IndexKey& a, const CAssetBalance_IndexKey& b)
+    {
+        if(a.strAddress == b.strAddress)
+            return a.assetId < b.assetId;
+        return a.strAddress < b.strAddress;
+    }
+};
+
+/**
+ * Asset amounts an address has received and sent over the whole chain. The sums
+ * are kept on 128 bits, adding 64 bit amounts to them can't overflow.
+ */
+struct CAssetBalance_IndexValue
+{
+    CAssetAmount nReceived;
+    CAssetAmount nSent;
+    //! received amounts of the locked outputs by nUnlockedHeight
+    std::map<int64_t, CAssetAmount> mapLocked;
+
+    ADD_SERIALIZE_METHODS;
+
+    template <typename Stream, typename Operation>
+    inline void SerializationOp(Stream& s, Operation ser_action, int nType, int nVersion)
+    {
+        READWRITE(nReceived);
+        READWRITE(nSent);
+        READWRITE(mapLocked);
+    }
+
+    bool IsNull() const
+    {
+        return nReceived.IsZero() && nSent.IsZero() && mapLocked.empty();
+    }
+
+    /** Amount of the received outputs still locked at nHeight */
+    CAssetAmount GetLockedAmount(const int nHeight) const
+    {
+        CAssetAmount nLocked;
+        for(std::map<int64_t, CAssetAmount>::const_iterator it = mapLocked.upper_bound(nHeight); it != mapLocked.end(); it++)
+            nLocked.Add(it->second);
+        return nLocked;
+    }
+
+    /**
+     * Add or subtract the amounts of data. False if a sum overflows or a
+     * subtraction goes below zero, the value is then left unchanged.
+     */
+    bool Add(const CAssetBalance_IndexValue& data)
+    {
+        CAssetBalance_IndexValue sum = *this;
+        if(!sum.nReceived.Add(data.nReceived) || !sum.nSent.Add(data.nSent))
+            return false;
+        for(std::map<int64_t, CAssetAmount>::const_iterator it = data.mapLocked.begin(); it != data.mapLocked.end(); it++)
+        {
+            if(it->second.IsZero())
+                continue;
+            if(!sum.mapLocked[it->first].Add(it->second))
+                return false;
+        }
+        std::swap(*this, sum);
+        return true;
+    }
+
+    bool Sub(const CAssetBalance_IndexValue& data)
+    {
+        CAssetBalance_IndexValue diff = *this;
+        if(!diff.nReceived.Sub(data.nReceived) || diff.nReceived.IsNegative() || !diff.nSent.Sub(data.nSent) || diff.nSent.IsNegative())
+            return false;
+        for(std::map<int64_t, CAssetAmount>::const_iterator it = data.mapLocked.begin(); it != data.mapLocked.end(); it++)
+        {
+            if(it->second.IsZero())
+                continue;
+            std::map<int64_t, CAssetAmount>::iterator lockedit = diff.mapLocked.find(it->first);
+            if(lockedit == diff.mapLocked.end() || !lockedit->second.Sub(it->second) || lockedit->second.IsNegative())
+                return false;
+            if(lockedit->second.IsZero())
+                diff.mapLocked.erase(lockedit);
+        }
+        std::swap(*this, diff);
+        return true;
+    }
+};
+
 struct CGetCandy_IndexKey
 {
     uint256 assetId;
@@ -833,25 +967,18 @@ struct CChangeInfo
     int nLastCandyHeight;
     CAmount nReward;
     bool fCandy;
-    std::map<std::string, CAmount> mapAddressAmount;
+    //! balance changes of the block, one per address sorted by key (see MergeAddressAmounts())
+    std::vector<CAddressAmount> vAddressAmount;
 
-    CChangeInfo(const int& nHeight = 0, const int& nLastCandyHeight = 0, const CAmount& nReward = 0, const bool fCandy = false, const std::map<std::string, CAmount>& mapAddressAmount = (std::map<std::string, CAmount>()))
-        : nHeight(nHeight), nLastCandyHeight(nLastCandyHeight), nReward(nReward), fCandy(fCandy), mapAddressAmount(mapAddressAmount) {
+    CChangeInfo(const int& nHeight = 0, const int& nLastCandyHeight = 0, const CAmount& nReward = 0, const bool fCandy = false, std::vector<CAddressAmount> vAddressAmount = (std::vector<CAddressAmount>()))
+        : nHeight(nHeight), nLastCandyHeight(nLastCandyHeight), nReward(nReward), fCandy(fCandy), vAddressAmount(std::move(vAddressAmount)) {
     }
 
-    CChangeInfo& operator=(const CChangeInfo& data)
-    {
-        if(this == &data)
-            return *this;
-
-        nHeight = data.nHeight;
-        nLastCandyHeight = data.nLastCandyHeight;
-        nReward = data.nReward;
-        fCandy = data.fCandy;
-        mapAddressAmount = data.mapAddressAmount;
-
-        return *this;
-    }
+    // the address amounts of a block can be large, it is only ever moved from ConnectBlock() to the change writer
+    CChangeInfo(CChangeInfo&&) = default;
+    CChangeInfo& operator=(CChangeInfo&&) = default;
+    CChangeInfo(const CChangeInfo&) = delete;
+    CChangeInfo& operator=(const CChangeInfo&) = delete;
 
     friend bool operator==(const CChangeInfo& a, const CChangeInfo& b)
     {
@@ -897,59 +1024,6 @@ struct CBlockDetail
     }
 };
 
-struct CAddressAmount
-{
-    char szAddress[36];
-    CAmount nAmount;
-
-    CAddressAmount()
-    {
-        memset(szAddress, 0x00, sizeof(szAddress));
-        nAmount = 0;
-    }
-
-    CAddressAmount(const char* szAddressIn, const CAmount& nAmountIn)
-    {
-        memset(szAddress, 0x00, sizeof(szAddress));
-        strncpy(szAddress, szAddressIn, sizeof(szAddress) - 1);
-        nAmount = nAmountIn;
-    }
-
-    CAddressAmount(const std::string& strAddressIn, const CAmount& nAmountIn)
-    {
-        memset(szAddress, 0x00, sizeof(szAddress));
-        strncpy(szAddress, strAddressIn.data(), sizeof(szAddress) - 1);
-        nAmount = nAmountIn;
-    }
-
-    CAddressAmount& operator=(const CAddressAmount& data)
-    {
-        if(this == &data)
-            return *this;
-
-        memset(szAddress, 0x00, sizeof(szAddress));
-        strncpy(szAddress, data.szAddress, sizeof(szAddress) - 1);
-        nAmount = data.nAmount;
-
-        return *this;
-    }
-
-    friend bool operator>(const CAddressAmount& a, const CAddressAmount& b)
-    {
-        return strcmp(a.szAddress, b.szAddress) > 0;
-    }
-
-    friend bool operator<(const CAddressAmount& a, const CAddressAmount& b)
-    {
-        return strcmp(a.szAddress, b.szAddress) < 0;
-    }
-
-    friend bool operator==(const CAddressAmount& a, const CAddressAmount& b)
-    {
-        return strcmp(a.szAddress, b.szAddress) == 0;
-    }
-};
-
 ////////////////////////////////////////////////////////////////////////////////////////
 struct CTimestampIndexIteratorKey {
     unsigned int timestamp;
@@ -1297,6 +1371,9 @@ bool CheckUnlockedHeight(const int32_t& nTxVersion, const int64_t& nOffset);
 /** Context-independent validity checks */
 bool CheckTransaction(const CTransaction& tx, CValidationState& state, const enum CTxSrcType& nType, const int& nHeight = -1);
 
+/** App and asset rules, mapAssetGetCandy sums the candy got by the transactions checked together with this one */
+bool CheckAppTransaction(const CTransaction& tx, CValidationState &state, const CCoinsViewCache& view, std::map<CPutCandy_IndexKey, CAmount>& mapAssetGetCandy, const bool &fWithMempool);
+
 /**
  * Check if transaction is final and can be included in a block with the
  * specified height and time. Consensus critical.
@@ -1412,7 +1489,11 @@ bool TestBlockValidity(CValidationState& state, const CChainParams& chainparams,
 
 /**Get a map of the amount corresponding to the address according to the height*/
 bool GetAddressAmountByHeight(const int& nHeight, const std::string& strAddress, CAmount& nAmount);
+/**Batched GetAddressAmountByHeight, vKey must be sorted and vAmount[i] belongs to vKey[i]*/
+bool GetAddressAmountsByHeight(const int& nHeight, const std::vector<CCandyAddressKey>& vKey, std::vector<CAmount>& vAmount);
 bool GetTotalAmountByHeight(const int& nHeight, CAmount& nTotalAmount);
+/** Whether a candy put at nCandyHeight can no longer be gotten at nCurrentHeight */
+bool IsCandyExpired(const int nCandyHeight, const int nExpired, const int nCurrentHeight);
 
 class CBlockFileInfo
 {
@@ -1540,6 +1621,12 @@ bool GetAssetIdByShortName(const std::string& strShortName, uint256& assetId, co
 bool GetAssetIdByAssetName(const std::string& strAssetName, uint256& assetId, const bool fWithMempool = true);
 bool GetTxInfoByAssetIdTxClass(const uint256& assetId, const uint8_t& nTxClass, std::vector<COutPoint>& vOut, const bool fWithMempool = true);
 bool GetTxInfoByAssetIdAddressTxClass(const uint256& assetId, const std::string& strAddress, const uint8_t& nTxClass, std::vector<COutPoint>& vOut, const bool fWithMempool = true);
+/**
+ * Call fn for the transactions of an asset, or of an asset and address if strAddress isn't empty, after cursor
+ * in height order, the mempool ones last. Stops at the first transaction fn returns false for and returns true,
+ * cursor is then where the listing continues. Returns false when there are no more transactions.
+ */
+bool ForEachAssetTx(const uint256& assetId, const std::string& strAddress, const uint8_t& nTxClass, CAssetTxCursor& cursor, const boost::function<bool(const uint256&)>& fn, const bool fWithMempool = true);
 bool GetAssetIdByAddress(const std::string & strAddress, std::vector<uint256> &assetIdlist, const bool fWithMempool = true);
 bool GetAssetIdCandyInfo(const uint256& assetId, std::map<COutPoint, CCandyInfo>& mapCandyInfo);
 bool GetAssetIdCandyInfo(const uint256& assetId, const COutPoint& out, CCandyInfo& candyInfo);
@@ -1548,11 +1635,27 @@ bool GetGetCandyTotalAmount(const uint256& assetId, const COutPoint& out, CAmoun
 bool GetAssetListInfo(std::vector<uint256> &vAssetId, const bool fWithMempool = true);
 bool GetIssueAssetInfo(std::map<uint256, CAssetData> &mapissueassetinfo);
 CAmount GetAddedAmountByAssetId(const uint256& assetId, const bool fWithMempool = true);
-
-void ThreadGetAllCandyInfo();
+bool GetAssetSupplyByAssetId(const uint256& assetId, CAssetSupply_IndexValue& supply, const bool fWithMempool = true);
+bool UpgradeAssetSupplyIndex();
+/** Add what the asset outputs of tx pay to and its asset inputs take from every address, the spent outputs are read from view */
+void AddAssetBalanceDelta(const CTransaction& tx, const CCoinsViewCache& view, std::map<CAssetBalance_IndexKey, CAssetBalance_IndexValue>& mapBalance);
+bool GetAssetBalance(const std::string& strAddress, const uint256& assetId, CAssetBalance_IndexValue& balance, const bool fWithMempool = true);
+bool UpgradeAssetBalanceIndex();
+
+CChangeInfoQueueStats GetChangeInfoQueueStats();
+/** Block until the change info queue has room for nBlocks more blocks, must not be called with cs_main held */
+void WaitForChangeInfoQueue(const int nBlocks);
 void ThreadWriteChangeInfo();
 void ThreadCalculateAddressAmount();
 bool VerifyDetailFile();
+/** Open the candy balance db at the last height of detail.dat, call after VerifyDetailFile() */
+bool OpenCandyBalanceDB();
+/**
+ * Read the change info of the active chain blocks nStartHeight to nEndHeight on nThreads threads
+ * and hand it to fnChangeInfo in height order, nLastCandyHeight is the candy height below nStartHeight
+ */
+bool ReplayChangeInfo(const int nStartHeight, const int nEndHeight, const int nThreads, int nLastCandyHeight, const boost::function<bool (CChangeInfo&)>& fnChangeInfo);
+/** Queue the change info of the blocks above detail.dat, ThreadWriteChangeInfo() must already run */
 bool LoadChangeInfoToList();
 bool LoadCandyHeightToList();
 
@@ -1561,21 +1664,16 @@ bool GetCOutPointList(const uint256& assetId, const std::string& strAddress, std
 
 bool GetAssetIdCandyInfoList(std::map<CPutCandy_IndexKey, CPutCandy_IndexValue>& mapCandy);
 
-std::string getNumString(int* num);
-void resetNumA(std::string numAStr);
-void resetNumB(std::string numBStr);
-int compareFloatString(const std::string& numAStr,const std::string& numBStr,bool fOnlyCompareInt=true);
-int comparestring(std::string numAStr,std::string numBStr);
-std::string plusstring(std::string numAStr, std::string numBStr);
-std::string minusstring(std::string numAStr, std::string numBStr);
-std::string mulstring(std::string numAStr, std::string numBStr);
-std::string numtofloatstring(std::string numstr, int32_t Decimals);
+/** Candy amount must be between 0.001 * total and 0.1 * total of the asset */
+bool IsCandyAmountInRange(const CAmount nCandyAmount, const CAmount nTotalAmount);
 
 bool ExistForbidTxin(const int nHeight, const std::vector<int>& prevheights);
 
 bool CompareGetCandyPutCandyTotal(std::map<CPutCandy_IndexKey, CAmount> &mapAssetGetCandy, const CPutCandy_IndexKey &key, const CAmount &ngetcandytotalamount, const CAmount &nputcandytotalamount, const CAmount &nCandyAmount, CAmount &nmapgetcandyamount);
 bool CompareDBGetCandyPutCandyTotal(std::map<CPutCandy_IndexKey, CAmount> &mapAssetGetCandy, const CPutCandy_IndexKey &key, const CAmount &ndbgetcandytotalamount, const CAmount &nputcandytotalamount, const CAmount &nCandyAmount, CAmount &nmapgetcandyamount);
 
+/** The masternodes selected for the current SPOS loop; the snapshot stays valid after the next selection replaces it */
+std::shared_ptr<const std::vector<CMasternode> > GetResultMasternodes();
 void UpdateMasternodeGlobalData(const std::vector<CMasternode>& tmpVecMasternodes,bool bClearVec,int selectMasterNodeRet,int nSposGeneratedIndex
                                 ,int64_t nStartNewLoopTime);
 void UpdateGlobalTimeoutCount(int nTimeoutCount);
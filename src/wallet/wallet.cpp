@@ -1311,40 +1311,41 @@ CAmount CWallet::GetDebit(const CTxIn &txin, const isminefilter& filter, const b
 
                 if(fAsset)
                 {
-                    CAppHeader header;
-                    std::vector<unsigned char> vData;
-                    if(!ParseReserve(txout.vReserve, header, vData))
+                    const CAppPayload* pPayload = GetAppPayload(prev, txin.prevout.n);
+                    if(!pPayload)
                         return 0;
 
+                    const CAppHeader& header = pPayload->header;
+
                     if(header.nAppCmd == ISSUE_ASSET_CMD)
                     {
-                        CAssetData assetData;
-                        if(!ParseIssueData(vData, assetData))
+                        if(!pPayload->fDataValid)
                             return 0;
+                        const CAssetData& assetData = pPayload->assetData;
                         if(assetData.GetHash() != *pAssetId)
                             return 0;
                     }
                     else if(header.nAppCmd == ADD_ASSET_CMD || header.nAppCmd == TRANSFER_ASSET_CMD || header.nAppCmd == DESTORY_ASSET_CMD || header.nAppCmd == CHANGE_ASSET_CMD)
                     {
-                        CCommonData commonData;
-                        if(!ParseCommonData(vData, commonData))
+                        if(!pPayload->fDataValid)
                             return 0;
+                        const CCommonData& commonData = pPayload->commonData;
                         if(commonData.assetId != *pAssetId)
                             return 0;
                     }
                     else if(header.nAppCmd == PUT_CANDY_CMD)
                     {
-                        CPutCandyData candyData;
-                        if(!ParsePutCandyData(vData, candyData))
+                        if(!pPayload->fDataValid)
                             return 0;
+                        const CPutCandyData& candyData = pPayload->putCandyData;
                         if(candyData.assetId != *pAssetId)
                             return 0;
                     }
                     else if(header.nAppCmd == GET_CANDY_CMD)
                     {
-                        CGetCandyData candyData;
-                        if(!ParseGetCandyData(vData, candyData))
+                        if(!pPayload->fDataValid)
                             return 0;
+                        const CGetCandyData& candyData = pPayload->getCandyData;
                         if(candyData.assetId != *pAssetId)
                             return 0;
                     }
@@ -1671,8 +1672,9 @@ CAmount CWallet::GetCredit(const CTransaction& tx, const isminefilter& filter, c
     if(fAsset && pAssetId == NULL)
         return 0;
 
-    BOOST_FOREACH(const CTxOut& txout, tx.vout)
+    for(unsigned int i = 0; i < tx.vout.size(); i++)
     {
+        const CTxOut& txout = tx.vout[i];
         boost::this_thread::interruption_point();
         if(pAddress && pAddress->IsValid())
         {
@@ -1688,40 +1690,41 @@ CAmount CWallet::GetCredit(const CTransaction& tx, const isminefilter& filter, c
 
         if(fAsset)
         {
-            CAppHeader header;
-            std::vector<unsigned char> vData;
-            if(!ParseReserve(txout.vReserve, header, vData))
+            const CAppPayload* pPayload = GetAppPayload(tx, i);
+            if(!pPayload)
                 continue;
 
+            const CAppHeader& header = pPayload->header;
+
             if(header.nAppCmd == ISSUE_ASSET_CMD)
             {
-                CAssetData assetData;
-                if(!ParseIssueData(vData, assetData))
+                if(!pPayload->fDataValid)
                     continue;
+                const CAssetData& assetData = pPayload->assetData;
                 if(assetData.GetHash() != *pAssetId)
                     continue;
             }
             else if(header.nAppCmd == ADD_ASSET_CMD || header.nAppCmd == TRANSFER_ASSET_CMD || header.nAppCmd == DESTORY_ASSET_CMD || header.nAppCmd == CHANGE_ASSET_CMD)
             {
-                CCommonData commonData;
-                if(!ParseCommonData(vData, commonData))
+                if(!pPayload->fDataValid)
                     continue;
+                const CCommonData& commonData = pPayload->commonData;
                 if(commonData.assetId != *pAssetId)
                     continue;
             }
             else if(header.nAppCmd == PUT_CANDY_CMD)
             {
-                CPutCandyData candyData;
-                if(!ParsePutCandyData(vData, candyData))
+                if(!pPayload->fDataValid)
                     continue;
+                const CPutCandyData& candyData = pPayload->putCandyData;
                 if(candyData.assetId != *pAssetId)
                     continue;
             }
             else if(header.nAppCmd == GET_CANDY_CMD)
             {
-                CGetCandyData candyData;
-                if(!ParseGetCandyData(vData, candyData))
+                if(!pPayload->fDataValid)
                     continue;
+                const CGetCandyData& candyData = pPayload->getCandyData;
                 if(candyData.assetId != *pAssetId)
                     continue;
             }
@@ -2159,17 +2162,18 @@ CAmount CWalletTx::GetLockedCredit(const bool fAsset, const uint256* pAssetId, c
 
         if(fAsset)
         {
-            CAppHeader header;
-            std::vector<unsigned char> vData;
-            if(!ParseReserve(txout.vReserve, header, vData))
+            const CAppPayload* pPayload = GetAppPayload(*this, i);
+            if(!pPayload)
                 continue;
 
+            const CAppHeader& header = pPayload->header;
+
             if(header.nAppCmd != TRANSFER_ASSET_CMD)
                 continue;
 
-            CCommonData transferData;
-            if(!ParseCommonData(vData, transferData))
+            if(!pPayload->fDataValid)
                 continue;
+            const CCommonData& transferData = pPayload->commonData;
             if(transferData.assetId != *pAssetId)
                 continue;
         }
@@ -2258,40 +2262,41 @@ CAmount CWalletTx::GetAvailableCredit(const bool fAsset, const uint256* pAssetId
 
         if(fAsset)
         {
-            CAppHeader header;
-            std::vector<unsigned char> vData;
-            if(!ParseReserve(txout.vReserve, header, vData))
+            const CAppPayload* pPayload = GetAppPayload(*this, i);
+            if(!pPayload)
                 continue;
 
+            const CAppHeader& header = pPayload->header;
+
             if(header.nAppCmd == ISSUE_ASSET_CMD)
             {
-                CAssetData assetData;
-                if(!ParseIssueData(vData, assetData))
+                if(!pPayload->fDataValid)
                     continue;
+                const CAssetData& assetData = pPayload->assetData;
                 if(assetData.GetHash() != *pAssetId)
                     continue;
             }
             else if(header.nAppCmd == ADD_ASSET_CMD || header.nAppCmd == TRANSFER_ASSET_CMD || header.nAppCmd == DESTORY_ASSET_CMD || header.nAppCmd == CHANGE_ASSET_CMD)
             {
-                CCommonData commonData;
-                if(!ParseCommonData(vData, commonData))
+                if(!pPayload->fDataValid)
                     continue;
+                const CCommonData& commonData = pPayload->commonData;
                 if(commonData.assetId != *pAssetId)
                     continue;
             }
             else if(header.nAppCmd == PUT_CANDY_CMD)
             {
-                CPutCandyData candyData;
-                if(!ParsePutCandyData(vData, candyData))
+                if(!pPayload->fDataValid)
                     continue;
+                const CPutCandyData& candyData = pPayload->putCandyData;
                 if(candyData.assetId != *pAssetId)
                     continue;
             }
             else if(header.nAppCmd == GET_CANDY_CMD)
             {
-                CGetCandyData candyData;
-                if(!ParseGetCandyData(vData, candyData))
+                if(!pPayload->fDataValid)
                     continue;
+                const CGetCandyData& candyData = pPayload->getCandyData;
                 if(candyData.assetId != *pAssetId)
                     continue;
             }
@@ -2364,17 +2369,18 @@ CAmount CWalletTx::GetLockedWatchOnlyCredit(const bool fAsset, const uint256* pA
 
         if(fAsset)
         {
-            CAppHeader header;
-            std::vector<unsigned char> vData;
-            if(!ParseReserve(txout.vReserve, header, vData))
+            const CAppPayload* pPayload = GetAppPayload(*this, i);
+            if(!pPayload)
                 continue;
 
+            const CAppHeader& header = pPayload->header;
+
             if(header.nAppCmd != TRANSFER_ASSET_CMD)
                 continue;
 
-            CCommonData transferData;
-            if(!ParseCommonData(vData, transferData))
+            if(!pPayload->fDataValid)
                 continue;
+            const CCommonData& transferData = pPayload->commonData;
             if(transferData.assetId != *pAssetId)
                 continue;
         }
@@ -2463,40 +2469,41 @@ CAmount CWalletTx::GetAvailableWatchOnlyCredit(const bool fAsset, const uint256*
 
         if(fAsset)
         {
-            CAppHeader header;
-            std::vector<unsigned char> vData;
-            if(!ParseReserve(txout.vReserve, header, vData))
+            const CAppPayload* pPayload = GetAppPayload(*this, i);
+            if(!pPayload)
                 continue;
 
+            const CAppHeader& header = pPayload->header;
+
             if(header.nAppCmd == ISSUE_ASSET_CMD)
             {
-                CAssetData assetData;
-                if(!ParseIssueData(vData, assetData))
+                if(!pPayload->fDataValid)
                     continue;
+                const CAssetData& assetData = pPayload->assetData;
                 if(assetData.GetHash() != *pAssetId)
                     continue;
             }
             else if(header.nAppCmd == ADD_ASSET_CMD || header.nAppCmd == TRANSFER_ASSET_CMD || header.nAppCmd == DESTORY_ASSET_CMD || header.nAppCmd == CHANGE_ASSET_CMD)
             {
-                CCommonData commonData;
-                if(!ParseCommonData(vData, commonData))
+                if(!pPayload->fDataValid)
                     continue;
+                const CCommonData& commonData = pPayload->commonData;
                 if(commonData.assetId != *pAssetId)
                     continue;
             }
             else if(header.nAppCmd == PUT_CANDY_CMD)
             {
-                CPutCandyData candyData;
-                if(!ParsePutCandyData(vData, candyData))
+                if(!pPayload->fDataValid)
                     continue;
+                const CPutCandyData& candyData = pPayload->putCandyData;
                 if(candyData.assetId != *pAssetId)
                     continue;
             }
             else if(header.nAppCmd == GET_CANDY_CMD)
             {
-                CGetCandyData candyData;
-                if(!ParseGetCandyData(vData, candyData))
+                if(!pPayload->fDataValid)
                     continue;
+                const CGetCandyData& candyData = pPayload->getCandyData;
                 if(candyData.assetId != *pAssetId)
                     continue;
             }
@@ -3328,11 +3335,12 @@ void CWallet::AvailableCoins(vector<COutput>& vCoins, bool fOnlyConfirmed, const
 
                 if(fAsset)
                 {
-                    CAppHeader header;
-                    std::vector<unsigned char> vData;
-                    if(!ParseReserve(pcoin->vout[i].vReserve, header, vData))
+                    const CAppPayload* pPayload = GetAppPayload(*pcoin, i);
+                    if(!pPayload)
                         continue;
 
+                    const CAppHeader& header = pPayload->header;
+
                     if(header.nAppCmd == ISSUE_ASSET_CMD || header.nAppCmd == ADD_ASSET_CMD || header.nAppCmd == GET_CANDY_CMD)
                     {
                         if(nDepth <= 0)
@@ -3341,35 +3349,35 @@ void CWallet::AvailableCoins(vector<COutput>& vCoins, bool fOnlyConfirmed, const
 
                     if(header.nAppCmd == ISSUE_ASSET_CMD)
                     {
-                        CAssetData assetData;
-                        if(!ParseIssueData(vData, assetData))
+                        if(!pPayload->fDataValid)
                             continue;
+                        const CAssetData& assetData = pPayload->assetData;
                         if(assetData.GetHash() != *pAssetId)
                             continue;
                     }
                     else if(header.nAppCmd == ADD_ASSET_CMD || header.nAppCmd == TRANSFER_ASSET_CMD || header.nAppCmd == CHANGE_ASSET_CMD)
                     {
-                        CCommonData commonData;
-                        if(!ParseCommonData(vData, commonData))
+                        if(!pPayload->fDataValid)
                             continue;
+                        const CCommonData& commonData = pPayload->commonData;
                         if(commonData.assetId != *pAssetId)
                             continue;
                     }
                     else if(header.nAppCmd == GET_CANDY_CMD)
                     {
-                        CGetCandyData candyData;
-                        if(!ParseGetCandyData(vData, candyData))
+                        if(!pPayload->fDataValid)
                             continue;
+                        const CGetCandyData& candyData = pPayload->getCandyData;
                         if(candyData.assetId != *pAssetId)
                             continue;
                     }
                 }
                 else
                 {
-                    CAppHeader header;
-                    std::vector<unsigned char> vData;
-                    if(ParseReserve(pcoin->vout[i].vReserve, header, vData))
+                    const CAppPayload* pPayload = GetAppPayload(*pcoin, i);
+                    if(pPayload)
                     {
+                        const CAppHeader& header = pPayload->header;
                         if(header.nAppCmd == REGISTER_APP_CMD || header.nAppCmd == ADD_AUTH_CMD || header.nAppCmd == DELETE_AUTH_CMD || header.nAppCmd == CREATE_EXTEND_TX_CMD)
                         {
                             if(nDepth <= 0)